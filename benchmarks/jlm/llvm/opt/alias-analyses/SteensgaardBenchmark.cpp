@@ -0,0 +1,137 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+
+#include <jlm/llvm/ir/operators.hpp>
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/llvm/opt/alias-analyses/PointsToGraph.hpp>
+#include <jlm/llvm/opt/alias-analyses/Steensgaard.hpp>
+#include <jlm/rvsdg/bitstring/constant.hpp>
+#include <jlm/util/Statistics.hpp>
+#include <jlm/util/time.hpp>
+
+#include <cassert>
+#include <iostream>
+#include <random>
+
+/**
+ * Benchmarks Steensgaard on a generated pointer-heavy RVSDG, whose analysis time is dominated by
+ * the unification of locations.
+ */
+
+/**
+ * Creates a function with \p numAllocas allocas of pointer type, followed by \p numStores random
+ * stores of alloca addresses into allocas and as many loads from random allocas, whose results
+ * are stored again. The allocas are partitioned into groups of \p groupSize, and all operands of
+ * a load and its store are taken from the same group. This keeps the points-to sets small, such
+ * that the points-to graph construction does not dominate the analysis time. All memory
+ * operations are sequentialized through a single memory state.
+ *
+ * @return The module, the alloca nodes, and the (address, stored value) pairs of all stores.
+ */
+static std::tuple<
+    std::unique_ptr<jlm::llvm::RvsdgModule>,
+    std::vector<const jlm::rvsdg::node *>,
+    std::vector<std::pair<size_t, size_t>>>
+CreatePointerHeavyModule(size_t numAllocas, size_t numStores, size_t groupSize)
+{
+  using namespace jlm::llvm;
+
+  auto pointerType = PointerType::Create();
+  auto functionType =
+      FunctionType::Create({ MemoryStateType::Create() }, { MemoryStateType::Create() });
+
+  auto module = RvsdgModule::Create(jlm::util::filepath(""), "", "");
+  auto & graph = module->Rvsdg();
+  graph.node_normal_form(typeid(jlm::rvsdg::operation))->set_mutable(false);
+
+  auto lambda = lambda::node::create(graph.root(), functionType, "f", linkage::external_linkage);
+  auto size = jlm::rvsdg::create_bitconstant(lambda->subregion(), 32, 1);
+
+  std::vector<const jlm::rvsdg::node *> allocaNodes;
+  std::vector<jlm::rvsdg::output *> addresses;
+  std::vector<jlm::rvsdg::output *> memoryStates({ lambda->fctargument(0) });
+  for (size_t n = 0; n < numAllocas; n++)
+  {
+    auto outputs = alloca_op::create(pointerType, size, 8);
+    allocaNodes.push_back(jlm::rvsdg::output::GetNode(*outputs[0]));
+    addresses.push_back(outputs[0]);
+    memoryStates.push_back(outputs[1]);
+  }
+  auto memoryState = MemoryStateMergeOperation::Create(memoryStates);
+
+  std::mt19937 random(0);
+  auto randomAlloca = [&](size_t group)
+  {
+    return group * groupSize + random() % groupSize;
+  };
+
+  std::vector<std::pair<size_t, size_t>> stores;
+  for (size_t n = 0; n < numStores; n++)
+  {
+    auto group = random() % (numAllocas / groupSize);
+    auto address = randomAlloca(group);
+    auto value = randomAlloca(group);
+    memoryState = StoreNonVolatileNode::Create(
+        addresses[address],
+        addresses[value],
+        { memoryState },
+        8)[0];
+    stores.emplace_back(address, value);
+
+    auto loadAddress = addresses[randomAlloca(group)];
+    auto loadOutputs = LoadNonVolatileNode::Create(loadAddress, { memoryState }, pointerType, 8);
+    memoryState = StoreNonVolatileNode::Create(
+        addresses[randomAlloca(group)],
+        loadOutputs[0],
+        { loadOutputs[1] },
+        8)[0];
+  }
+
+  lambda->finalize({ memoryState });
+  GraphExport::Create(*lambda->output(), "f");
+
+  return { std::move(module), std::move(allocaNodes), std::move(stores) };
+}
+
+static int
+SteensgaardBenchmark()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  const size_t numAllocas = 20000;
+  const size_t numStores = 20000;
+  auto [module, allocaNodes, stores] = CreatePointerHeavyModule(numAllocas, numStores, 10);
+
+  // Act
+  aa::Steensgaard steensgaard;
+  jlm::util::StatisticsCollector statisticsCollector;
+
+  jlm::util::timer timer;
+  timer.start();
+  auto pointsToGraph = steensgaard.Analyze(*module, statisticsCollector);
+  timer.stop();
+
+  std::cout << "Steensgaard: " << numAllocas << " allocas, " << 3 * numStores
+            << " memory operations, " << static_cast<double>(timer.ns()) / 1000000 << " ms"
+            << std::endl;
+
+  // Assert
+  assert(pointsToGraph->NumAllocaNodes() == numAllocas);
+  for (auto [address, value] : stores)
+  {
+    auto & addressNode = pointsToGraph->GetAllocaNode(*allocaNodes[address]);
+    auto & valueNode = pointsToGraph->GetAllocaNode(*allocaNodes[value]);
+    assert(addressNode.HasTarget(valueNode));
+  }
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "benchmarks/jlm/llvm/opt/alias-analyses/SteensgaardBenchmark",
+    SteensgaardBenchmark)
@@ -0,0 +1,182 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include <TestRvsdgs.hpp>
+
+#include <test-registry.hpp>
+
+#include <jlm/llvm/opt/alias-analyses/PointerObjectSet.hpp>
+#include <jlm/util/time.hpp>
+#include <jlm/util/Worklist.hpp>
+
+#include <cassert>
+#include <iostream>
+#include <random>
+
+/**
+ * Benchmarks the worklists used by the Andersen worklist solver, both in isolation and as part of
+ * solving a generated constraint graph with every worklist policy.
+ */
+
+/**
+ * Work items of enumeration type are not integral, and therefore use the generic worklist
+ * implementations based on hashing. This makes it possible to compare them to the dense ones.
+ */
+enum class GenericPointerObjectIndex : jlm::llvm::aa::PointerObjectIndex
+{
+};
+
+/**
+ * Pushes and pops \p numItems work items in a pattern resembling the worklist solver, where most
+ * pushes target items that are already on the worklist.
+ * @return the time spent per push and pop, in nanoseconds
+ */
+template<typename Worklist, typename T>
+static double
+BenchmarkPushPop(size_t numItems)
+{
+  std::mt19937 random(0);
+  Worklist worklist;
+  jlm::util::timer timer;
+  size_t numOperations = 0;
+
+  timer.start();
+  for (size_t n = 0; n < numItems; n++)
+    worklist.PushWorkItem(static_cast<T>(n));
+
+  size_t checksum = 0;
+  while (worklist.HasMoreWorkItems())
+  {
+    checksum += static_cast<size_t>(worklist.PopWorkItem());
+    numOperations++;
+
+    // Every popped work item pushes a few successors, until the budget is exhausted
+    if (numOperations < 4 * numItems)
+    {
+      for (size_t n = 0; n < 3; n++)
+      {
+        worklist.PushWorkItem(static_cast<T>(random() % numItems));
+        numOperations++;
+      }
+    }
+  }
+  timer.stop();
+
+  assert(checksum > 0);
+  return static_cast<double>(timer.ns()) / numOperations;
+}
+
+template<template<typename> class WorklistTemplate>
+static void
+ComparePushPop(const char * name)
+{
+  using namespace jlm::llvm::aa;
+  const size_t numItems = 100000;
+
+  auto dense = BenchmarkPushPop<WorklistTemplate<PointerObjectIndex>, PointerObjectIndex>(numItems);
+  auto generic = BenchmarkPushPop<
+      WorklistTemplate<GenericPointerObjectIndex>,
+      GenericPointerObjectIndex>(numItems);
+
+  std::cout << name << ": dense " << dense << " ns/operation, generic " << generic
+            << " ns/operation" << std::endl;
+}
+
+static int
+WorklistPushPopBenchmark()
+{
+  ComparePushPop<jlm::util::LifoWorklist>("LifoWorklist");
+  ComparePushPop<jlm::util::FifoWorklist>("FifoWorklist");
+  ComparePushPop<jlm::util::LrfWorklist>("LrfWorklist");
+  ComparePushPop<jlm::util::TwoPhaseLrfWorklist>("TwoPhaseLrfWorklist");
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "benchmarks/jlm/llvm/opt/alias-analyses/WorklistSolverBenchmark-PushPop",
+    WorklistPushPopBenchmark)
+
+static int
+WorklistSolverBenchmark()
+{
+  using namespace jlm::llvm::aa;
+  using Policy = PointerObjectConstraintSet::WorklistSolverPolicy;
+
+  // Arrange
+  const size_t numMemoryObjects = 50;
+  const size_t numRegisters = 4000;
+
+  jlm::tests::NAllocaNodesTest rvsdg(numMemoryObjects);
+  rvsdg.InitializeTest();
+
+  PointerObjectSet set;
+  PointerObjectConstraintSet constraints(set);
+
+  std::vector<PointerObjectIndex> memoryObjects;
+  for (size_t n = 0; n < numMemoryObjects; n++)
+    memoryObjects.push_back(set.CreateAllocaMemoryObject(rvsdg.GetAllocaNode(n), true));
+
+  std::vector<PointerObjectIndex> registers;
+  for (size_t n = 0; n < numRegisters; n++)
+    registers.push_back(set.CreateDummyRegisterPointerObject());
+
+  // Create a random constraint graph with long chains of superset constraints, as well as loads
+  // and stores, such that work items are pushed many times before the solution converges
+  std::mt19937 random(0);
+  auto randomRegister = [&]()
+  {
+    return registers[random() % numRegisters];
+  };
+  for (size_t n = 0; n < numRegisters; n++)
+  {
+    if (n % 50 == 0)
+    {
+      auto memoryObject = memoryObjects[random() % numMemoryObjects];
+      constraints.AddPointerPointeeConstraint(registers[n], memoryObject);
+    }
+    if (n > 0)
+      constraints.AddConstraint(SupersetConstraint(registers[n], registers[n - 1]));
+
+    constraints.AddConstraint(SupersetConstraint(randomRegister(), registers[n]));
+    if (n % 10 == 0)
+      constraints.AddConstraint(StoreConstraint(randomRegister(), randomRegister()));
+    if (n % 10 == 5)
+      constraints.AddConstraint(LoadConstraint(randomRegister(), randomRegister()));
+  }
+
+  // Act & Assert
+  std::unique_ptr<PointerObjectSet> referenceSolution;
+  for (auto policy : { Policy::LeastRecentlyFired,
+                       Policy::TwoPhaseLeastRecentlyFired,
+                       Policy::TopologicalSort,
+                       Policy::FirstInFirstOut,
+                       Policy::LastInFirstOut })
+  {
+    auto [setClone, constraintsClone] = constraints.Clone();
+
+    jlm::util::timer timer;
+    timer.start();
+    auto statistics =
+        constraintsClone->SolveUsingWorklist(policy, false, false, false, false, false);
+    timer.stop();
+
+    auto numWorkItems = std::max<size_t>(statistics.NumWorkItemsPopped, 1);
+    std::cout << PointerObjectConstraintSet::WorklistSolverPolicyToString(policy) << ": "
+              << statistics.NumWorkItemsPopped << " work items popped, "
+              << static_cast<double>(timer.ns()) / numWorkItems << " ns/work item" << std::endl;
+
+    if (referenceSolution)
+      assert(setClone->HasIdenticalSolAs(*referenceSolution));
+    else
+      referenceSolution = std::move(setClone);
+  }
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "benchmarks/jlm/llvm/opt/alias-analyses/WorklistSolverBenchmark-Solver",
+    WorklistSolverBenchmark)
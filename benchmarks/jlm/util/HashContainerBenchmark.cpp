@@ -0,0 +1,198 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+
+#include <jlm/util/BijectiveMap.hpp>
+#include <jlm/util/HashSet.hpp>
+#include <jlm/util/time.hpp>
+
+#include <cassert>
+#include <iostream>
+#include <random>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * Benchmarks the insert, lookup, and iteration throughput of util::HashSet and util::BijectiveMap
+ * against their node-based standard library counterparts. The checksums are printed alongside the
+ * timings, such that the measured loops are not optimized away in release builds.
+ */
+
+static const size_t NumItems = 200000;
+
+/**
+ * Creates pointer-like keys, which is the most common kind of item in our containers.
+ */
+static std::vector<uintptr_t>
+CreateKeys()
+{
+  std::mt19937_64 random(0);
+  std::vector<uintptr_t> keys;
+  for (size_t n = 0; n < NumItems; n++)
+    keys.push_back((random() & ~uintptr_t(0xF)) | 0x8);
+
+  return keys;
+}
+
+static void
+PrintResult(const char * container, const char * operation, const jlm::util::timer & timer)
+{
+  std::cout << container << " " << operation << ": "
+            << static_cast<double>(timer.ns()) / NumItems << " ns/item" << std::endl;
+}
+
+static void
+PrintChecksum(const char * container, size_t checksum)
+{
+  std::cout << container << " checksum: " << checksum << std::endl;
+}
+
+template<typename T>
+static size_t
+BenchmarkSet(const char * name, const std::vector<uintptr_t> & keys)
+{
+  T set;
+  jlm::util::timer insertTimer, lookupTimer, iterateTimer;
+
+  insertTimer.start();
+  for (auto key : keys)
+  {
+    if constexpr (std::is_same_v<T, jlm::util::HashSet<uintptr_t>>)
+      set.Insert(key);
+    else
+      set.insert(key);
+  }
+  insertTimer.stop();
+
+  size_t numFound = 0;
+  lookupTimer.start();
+  for (auto key : keys)
+  {
+    if constexpr (std::is_same_v<T, jlm::util::HashSet<uintptr_t>>)
+      numFound += set.Contains(key) + set.Contains(key + 1);
+    else
+      numFound += set.count(key) + set.count(key + 1);
+  }
+  lookupTimer.stop();
+
+  uintptr_t sum = 0;
+  iterateTimer.start();
+  if constexpr (std::is_same_v<T, jlm::util::HashSet<uintptr_t>>)
+  {
+    for (auto item : set.Items())
+      sum += item;
+  }
+  else
+  {
+    for (auto item : set)
+      sum += item;
+  }
+  iterateTimer.stop();
+
+  PrintResult(name, "insert", insertTimer);
+  PrintResult(name, "lookup", lookupTimer);
+  PrintResult(name, "iterate", iterateTimer);
+  PrintChecksum(name, numFound + sum);
+
+  uintptr_t expectedSum = 0;
+  for (auto key : keys)
+    expectedSum += key;
+  assert(sum == expectedSum);
+
+  return numFound;
+}
+
+static int
+HashSetBenchmark()
+{
+  auto keys = CreateKeys();
+
+  auto numFound = BenchmarkSet<jlm::util::HashSet<uintptr_t>>("HashSet", keys);
+  auto numFoundStd = BenchmarkSet<std::unordered_set<uintptr_t>>("std::unordered_set", keys);
+
+  assert(numFound == NumItems);
+  assert(numFoundStd == NumItems);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("benchmarks/jlm/util/HashContainerBenchmark-HashSet", HashSetBenchmark)
+
+static int
+BijectiveMapBenchmark()
+{
+  auto keys = CreateKeys();
+
+  {
+    jlm::util::BijectiveMap<uintptr_t, size_t> map;
+    jlm::util::timer insertTimer, lookupTimer, iterateTimer;
+
+    insertTimer.start();
+    for (size_t n = 0; n < keys.size(); n++)
+      map.Insert(keys[n], n);
+    insertTimer.stop();
+
+    size_t sum = 0;
+    lookupTimer.start();
+    for (size_t n = 0; n < keys.size(); n++)
+      sum += map.LookupKey(keys[n]) + (map.LookupValue(n) == keys[n]);
+    lookupTimer.stop();
+
+    size_t iteratedSum = 0;
+    iterateTimer.start();
+    for (auto & [key, value] : map)
+      iteratedSum += value;
+    iterateTimer.stop();
+
+    PrintResult("BijectiveMap", "insert", insertTimer);
+    PrintResult("BijectiveMap", "lookup", lookupTimer);
+    PrintResult("BijectiveMap", "iterate", iterateTimer);
+    PrintChecksum("BijectiveMap", sum + iteratedSum);
+
+    assert(map.Size() == NumItems);
+    assert(sum == iteratedSum + NumItems);
+  }
+
+  {
+    std::unordered_map<uintptr_t, size_t> forwardMap;
+    std::unordered_map<size_t, uintptr_t> reverseMap;
+    jlm::util::timer insertTimer, lookupTimer, iterateTimer;
+
+    insertTimer.start();
+    for (size_t n = 0; n < keys.size(); n++)
+    {
+      forwardMap.emplace(keys[n], n);
+      reverseMap.emplace(n, keys[n]);
+    }
+    insertTimer.stop();
+
+    size_t sum = 0;
+    lookupTimer.start();
+    for (size_t n = 0; n < keys.size(); n++)
+      sum += forwardMap.at(keys[n]) + (reverseMap.at(n) == keys[n]);
+    lookupTimer.stop();
+
+    size_t iteratedSum = 0;
+    iterateTimer.start();
+    for (auto & [key, value] : forwardMap)
+      iteratedSum += value;
+    iterateTimer.stop();
+
+    PrintResult("std::unordered_map pair", "insert", insertTimer);
+    PrintResult("std::unordered_map pair", "lookup", lookupTimer);
+    PrintResult("std::unordered_map pair", "iterate", iterateTimer);
+    PrintChecksum("std::unordered_map pair", sum + iteratedSum);
+
+    assert(sum == iteratedSum + NumItems);
+  }
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "benchmarks/jlm/util/HashContainerBenchmark-BijectiveMap",
+    BijectiveMapBenchmark)
@@ -5,6 +5,7 @@
  */
 
 #include <jlm/hls/backend/rhls2firrtl/RhlsToFirrtlConverter.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/PerformanceCounters.hpp>
 #include <jlm/llvm/ir/operators/MemoryStateOperations.hpp>
 #include <jlm/util/strfmt.hpp>
 
@@ -1761,6 +1762,78 @@ RhlsToFirrtlConverter::MlirGenPrint(const jlm::rvsdg::simple_node * node)
   return module;
 }
 
+circt::firrtl::FModuleOp
+RhlsToFirrtlConverter::MlirGenPerformanceCounter(const jlm::rvsdg::simple_node * node)
+{
+  auto op = util::AssertedCast<const perf_counter_op>(&node->operation());
+
+  // Create the module and its input/output ports. The counter value is exposed on an additional
+  // port without handshaking.
+  ::llvm::SmallVector<circt::firrtl::PortInfo> ports;
+  AddClockPort(&ports);
+  AddResetPort(&ports);
+  AddBundlePort(
+      &ports,
+      circt::firrtl::Direction::In,
+      "i0",
+      GetFirrtlType(&node->input(0)->type()));
+  AddBundlePort(
+      &ports,
+      circt::firrtl::Direction::Out,
+      "o0",
+      GetFirrtlType(&node->output(0)->type()));
+  struct circt::firrtl::PortInfo countPort = {
+    Builder_->getStringAttr("count"), GetIntType(64), circt::firrtl::Direction::Out, {},
+    Builder_->getUnknownLoc(),
+  };
+  ports.push_back(countPort);
+  auto module = Builder_->create<circt::firrtl::FModuleOp>(
+      Builder_->getUnknownLoc(),
+      Builder_->getStringAttr(GetModuleName(node)),
+      circt::firrtl::ConventionAttr::get(
+          Builder_->getContext(),
+          circt::firrtl::Convention::Internal),
+      ports);
+  auto body = module.getBodyBlock();
+
+  auto clock = GetClockSignal(module);
+  auto reset = GetResetSignal(module);
+
+  // Input signals
+  auto inBundle = GetInPort(module, 0);
+  auto inReady = GetSubfield(body, inBundle, "ready");
+  auto inValid = GetSubfield(body, inBundle, "valid");
+  // Output signals
+  auto outBundle = GetOutPort(module, 0);
+  Connect(body, outBundle, inBundle);
+
+  auto countReg = Builder_->create<circt::firrtl::RegResetOp>(
+      Builder_->getUnknownLoc(),
+      GetIntType(64),
+      clock,
+      reset,
+      GetConstant(body, 64, 0),
+      Builder_->getStringAttr("count_reg"));
+  body->push_back(countReg);
+  Connect(body, GetPort(module, "count"), countReg.getResult());
+
+  mlir::Value event;
+  if (op->kind() == perf_counter_op::counter_kind::iterations)
+  {
+    event = AddAndOp(body, inReady, inValid);
+  }
+  else
+  {
+    event = AddAndOp(body, inValid, AddNotOp(body, inReady));
+  }
+  auto increment =
+      AddBitsOp(body, AddAddOp(body, countReg.getResult(), GetConstant(body, 64, 1)), 63, 0);
+  auto eventBody = AddWhenOp(body, event, false).getThenBodyBuilder().getBlock();
+  Connect(eventBody, countReg.getResult(), increment);
+
+  return module;
+}
+
 circt::firrtl::FModuleOp
 RhlsToFirrtlConverter::MlirGenPredicationBuffer(const jlm::rvsdg::simple_node * node)
 {
@@ -2444,6 +2517,10 @@ RhlsToFirrtlConverter::MlirGen(const jlm::rvsdg::simple_node * node)
   {
     return MlirGenPrint(node);
   }
+  else if (dynamic_cast<const hls::perf_counter_op *>(&(node->operation())))
+  {
+    return MlirGenPerformanceCounter(node);
+  }
   else if (dynamic_cast<const hls::addr_queue_op *>(&(node->operation())))
   {
     return MlirGenAddrQueue(node);
@@ -2555,6 +2632,19 @@ RhlsToFirrtlConverter::MlirGen(rvsdg::Region * subRegion, mlir::Block * circuitB
         get_port_name(subRegion->result(i)),
         GetFirrtlType(&subRegion->result(i)->type()));
   }
+  // Performance counter ports
+  for (auto counter : GetPerformanceCounters(*subRegion))
+  {
+    auto op = util::AssertedCast<const perf_counter_op>(&counter->operation());
+    struct circt::firrtl::PortInfo port = {
+      Builder_->getStringAttr("perf_" + std::to_string(op->id())),
+      GetIntType(64),
+      circt::firrtl::Direction::Out,
+      {},
+      Builder_->getUnknownLoc(),
+    };
+    ports.push_back(port);
+  }
 
   // Create a name for the module
   auto moduleName = Builder_->getStringAttr("subregion_mod");
@@ -2732,6 +2822,16 @@ RhlsToFirrtlConverter::MlirGen(rvsdg::Region * subRegion, mlir::Block * circuitB
     Connect(body, sinkPort, sourcePort);
   }
 
+  // Connect the performance counters, which may be nested in loops
+  for (auto & instance : instances)
+  {
+    if (auto op = dynamic_cast<const perf_counter_op *>(&instance.first->operation()))
+    {
+      auto sinkPort = GetPort(module, "perf_" + std::to_string(op->id()));
+      Connect(body, sinkPort, GetInstancePort(instance.second, "count"));
+    }
+  }
+
   return module;
 }
 
@@ -2917,6 +3017,21 @@ RhlsToFirrtlConverter::MlirGen(const llvm::lambda::node * lambdaNode)
     ports.push_back(memBundle);
   }
 
+  // Performance counter ports
+  auto counters = GetPerformanceCounters(*subRegion);
+  for (auto counter : counters)
+  {
+    auto op = util::AssertedCast<const perf_counter_op>(&counter->operation());
+    struct circt::firrtl::PortInfo port = {
+      Builder_->getStringAttr("perf_" + std::to_string(op->id())),
+      GetIntType(64),
+      circt::firrtl::Direction::Out,
+      {},
+      Builder_->getUnknownLoc(),
+    };
+    ports.push_back(port);
+  }
+
   // Now when we have all the port information we can create the module
   // The same name is used for the circuit and main module
   auto module = Builder_->create<circt::firrtl::FModuleOp>(
@@ -2942,6 +3057,13 @@ RhlsToFirrtlConverter::MlirGen(const llvm::lambda::node * lambdaNode)
   // Connect the Reset
   auto reset = GetResetSignal(module);
   Connect(body, GetInstancePort(instance, "reset"), reset);
+  // Connect the performance counters
+  for (auto counter : counters)
+  {
+    auto op = util::AssertedCast<const perf_counter_op>(&counter->operation());
+    auto portName = "perf_" + std::to_string(op->id());
+    Connect(body, GetPort(module, portName), GetInstancePort(instance, portName));
+  }
 
   //
   // Add registers to the module
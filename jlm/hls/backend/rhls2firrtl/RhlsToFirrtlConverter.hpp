@@ -150,6 +150,8 @@ private:
   circt::firrtl::FModuleOp
   MlirGenPrint(const jlm::rvsdg::simple_node * node);
   circt::firrtl::FModuleOp
+  MlirGenPerformanceCounter(const jlm::rvsdg::simple_node * node);
+  circt::firrtl::FModuleOp
   MlirGenAddrQueue(const jlm::rvsdg::simple_node * node);
   circt::firrtl::FModuleOp
   MlirGenPredicationBuffer(const jlm::rvsdg::simple_node * node);
@@ -4,6 +4,7 @@
  */
 
 #include <jlm/hls/backend/rhls2firrtl/verilator-harness-hls.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/PerformanceCounters.hpp>
 #include <jlm/llvm/ir/operators/delta.hpp>
 
 namespace jlm::hls
@@ -33,7 +34,9 @@ VerilatorHarnessHLS::get_text(llvm::RvsdgModule & rm)
          "#include <unistd.h>\n"
          "#include <sstream>\n"
          "#include <iomanip>\n"
-         "#include <queue>\n"
+         "#include <algorithm>\n"
+         "#include <deque>\n"
+         "#include <vector>\n"
          "#ifdef FST\n"
          "#include \"verilated_fst_c.h\"\n"
          "#else\n"
@@ -119,6 +122,11 @@ VerilatorHarnessHLS::get_text(llvm::RvsdgModule & rm)
          "void term(int signum) {\n"
          "    terminate = true;\n"
          "}\n"
+         "\n";
+  get_memory_model(cpp);
+  cpp << "mem_port_model mem_port["
+      << mem_resps.size()
+      << "];\n"
          "\n"
          "void verilator_finish() {\n"
          "    // Final model cleanup\n"
@@ -127,6 +135,10 @@ VerilatorHarnessHLS::get_text(llvm::RvsdgModule & rm)
          "#endif\n"
          "    top->final();\n"
          "\n"
+         "    for (size_t i = 0; i < sizeof(mem_port) / sizeof(mem_port[0]); i++) {\n"
+         "        mem_port[i].print_statistics(i, main_time);\n"
+         "    }\n"
+         "\n"
          "    //  Coverage analysis (since test passed)\n"
          "#if VM_COVERAGE\n"
          "    Verilated::mkdir(\"logs\");\n"
@@ -140,27 +152,6 @@ VerilatorHarnessHLS::get_text(llvm::RvsdgModule & rm)
          //		"    top = NULL;\n"
          "}\n"
          "\n"
-         "typedef struct mem_resp_struct {\n"
-         "    bool valid = false;\n"
-         "    uint64_t data = 0xDEADBEEF;\n"
-         "    uint8_t id = 0;\n"
-         "} mem_resp_struct;\n"
-         "\n"
-         "std::queue<mem_resp_struct>* mem_resp["
-      << mem_resps.size()
-      << "];\n"
-         "const uint64_t mem_latency["
-      << mem_resps.size() << "] = {";
-  for (size_t i = 0; i < mem_resps.size(); ++i)
-  {
-    if (i != 0)
-    {
-      cpp << ", ";
-    }
-    cpp << "10";
-  }
-  cpp << "};\n";
-  cpp << "\n"
          "void verilator_init(int argc, char **argv) {\n"
          "    // set up signaling so we can kill the program and still get waveforms\n"
          "    struct sigaction action;\n"
@@ -168,22 +159,8 @@ VerilatorHarnessHLS::get_text(llvm::RvsdgModule & rm)
          "    action.sa_handler = term;\n"
          "    sigaction(SIGTERM, &action, NULL);\n"
          "    sigaction(SIGKILL, &action, NULL);\n"
-         "    sigaction(SIGINT, &action, NULL);\n";
-
-  for (size_t i = 0; i < mem_resps.size(); ++i)
-  {
-    cpp << "    mem_resp[" << i << "] = new std::queue<mem_resp_struct>();\n";
-  }
-  for (size_t i = 0; i < mem_resps.size(); ++i)
-  {
-    cpp << "    for (size_t i = 0; i < mem_latency[" << i
-        << "]; ++i) {\n"
-           "       mem_resp["
-        << i
-        << "]->emplace();\n"
-           "    }\n";
-  }
-  cpp << "\n"
+         "    sigaction(SIGINT, &action, NULL);\n"
+         "\n"
          "	atexit(verilator_finish);\n"
          "\n"
          "    // Set debug level, 0 is off, 9 is highest presently used\n"
@@ -253,16 +230,16 @@ VerilatorHarnessHLS::get_text(llvm::RvsdgModule & rm)
          "void finish_clock_cycle() {\n";
   for (size_t i = 0; i < mem_reqs.size(); ++i)
   {
-    cpp << "    top->mem_" << i << "_res_data_data = mem_resp[" << i
-        << "]->front().data;\n"
+    cpp << "    top->mem_" << i << "_res_data_data = mem_port[" << i
+        << "].response().data;\n"
            "    top->mem_"
-        << i << "_res_data_id = mem_resp[" << i
-        << "]->front().id;\n"
+        << i << "_res_data_id = mem_port[" << i
+        << "].response().id;\n"
            "    top->mem_"
-        << i << "_res_valid = mem_resp[" << i
-        << "]->front().valid;\n"
+        << i << "_res_valid = mem_port[" << i
+        << "].response_valid(main_time);\n"
            "    top->mem_"
-        << i << "_req_ready = true;\n";
+        << i << "_req_ready = mem_port[" << i << "].can_accept();\n";
   }
   cpp << "    top->eval();\n"
          "    // dump before trying to access memory\n"
@@ -276,15 +253,9 @@ VerilatorHarnessHLS::get_text(llvm::RvsdgModule & rm)
   {
     cpp << "    if (top->mem_" << i << "_res_valid && top->mem_" << i
         << "_res_ready) {\n"
-           "        mem_resp["
-        << i
-        << "]->pop();\n"
-           "    } else if (!mem_resp["
-        << i
-        << "]->front().valid){\n"
-           "        mem_resp["
+           "        mem_port["
         << i
-        << "]->pop();\n"
+        << "].pop_response(main_time);\n"
            "    }\n";
   }
   for (size_t i = 0; i < mem_reqs.size(); ++i)
@@ -294,14 +265,8 @@ VerilatorHarnessHLS::get_text(llvm::RvsdgModule & rm)
            "    if (!top->reset && top->mem_"
         << i << "_req_valid && top->mem_" << i
         << "_req_ready) {\n"
-           "        mem_resp["
+           "        uint8_t id = top->mem_"
         << i
-        << "]->emplace();\n"
-           "        mem_resp["
-        << i
-        << "]->back().valid = true;\n"
-           "        mem_resp["
-        << i << "]->back().id = top->mem_" << i
         << "_req_data_id;\n"
            "        void *addr = (void *) top->mem_"
         << i
@@ -309,7 +274,8 @@ VerilatorHarnessHLS::get_text(llvm::RvsdgModule & rm)
            "        uint64_t size = top->mem_"
         << i
         << "_req_data_size;\n"
-           "        uint64_t data;\n";
+           "        uint64_t data;\n"
+           "        std::vector<uint64_t> beats;\n";
     auto req_bt = dynamic_cast<const bundletype *>(&mem_reqs[i]->type());
     auto has_write = req_bt->get_element_type("write") != nullptr;
     if (has_write)
@@ -341,9 +307,7 @@ VerilatorHarnessHLS::get_text(llvm::RvsdgModule & rm)
              "                default:\n"
              "                    assert(false);\n"
              "            }\n"
-             "            mem_resp["
-          << i
-          << "]->back().data = 0xFFFFFFFF;\n"
+             "            beats.push_back(0xFFFFFFFF);\n"
              "        } else {\n";
     }
     else
@@ -371,17 +335,12 @@ VerilatorHarnessHLS::get_text(llvm::RvsdgModule & rm)
            "                default:\n"
            "                    assert(false);\n"
            "            }\n"
-           "            mem_resp["
-        << i
-        << "]->back().data = data;\n"
+           "            beats.push_back(data);\n"
            "            access_mem_load({addr, data, size, mem_access_ctr++});\n"
            "        }\n"
-           "    } else if (mem_resp["
-        << i << "]->size()<mem_latency[" << i
-        << "]){\n"
-           "        mem_resp["
+           "        mem_port["
         << i
-        << "]->emplace();\n"
+        << "].accept(main_time, addr, uint64_t(1) << size, id, beats);\n"
            "    }\n";
   }
   cpp << "    assert(!Verilated::gotFinish());\n"
@@ -544,8 +503,25 @@ VerilatorHarnessHLS::get_text(llvm::RvsdgModule & rm)
          "    for (auto &pair: load_map) {\n"
          "        assert(pair.second.empty());\n"
          "    }\n"
-         "    std::cout << \"finished - took \" << (main_time - start) << \"cycles\\n\";\n"
-         "\n"
+         "    std::cout << \"finished - took \" << (main_time - start) << \"cycles\\n\";\n";
+  auto counters = GetPerformanceCounters(*ln->subregion());
+  if (!counters.empty())
+  {
+    // The counters are only cleared by a reset, i.e., they accumulate over all invocations
+    cpp << "    std::cout << \"performance counters:\\n\";\n"
+           "    std::cout << std::left << std::setw(6) << \"id\" << std::setw(12) << \"kind\"\n"
+           "              << std::setw(24) << \"channel\" << \"count\\n\";\n";
+    for (auto counter : counters)
+    {
+      auto op = util::AssertedCast<const perf_counter_op>(&counter->operation());
+      auto kind = op->kind() == perf_counter_op::counter_kind::iterations ? "iterations" : "stalls";
+      cpp << "    std::cout << std::left << std::setw(6) << " << op->id() << " << std::setw(12) << \""
+          << kind << "\"\n"
+          << "              << std::setw(24) << \"" << op->name() << "\" << top->perf_" << op->id()
+          << " << \"\\n\";\n";
+    }
+  }
+  cpp << "\n"
          "    // empty loads and stores\n"
          "    ref_loads.erase(ref_loads.begin(), ref_loads.end());\n"
          "    ref_stores.erase(ref_stores.begin(), ref_stores.end());\n"
@@ -706,6 +682,166 @@ VerilatorHarnessHLS::get_function_header(
          ")";
 }
 
+void
+VerilatorHarnessHLS::get_memory_model(std::ostringstream & cpp)
+{
+  size_t model = 0;
+  switch (MemoryModel_.Kind)
+  {
+  case MemoryModelConfiguration::Model::FixedLatency:
+    model = 0;
+    break;
+  case MemoryModelConfiguration::Model::Bandwidth:
+    model = 1;
+    break;
+  case MemoryModelConfiguration::Model::Dram:
+    model = 2;
+    break;
+  }
+
+  auto define = [&](const std::string & name, size_t value)
+  {
+    cpp << "#ifndef " << name << "\n#define " << name << " " << value << "\n#endif\n";
+  };
+  cpp << "#define MEM_MODEL_FIXED 0\n"
+         "#define MEM_MODEL_BANDWIDTH 1\n"
+         "#define MEM_MODEL_DRAM 2\n";
+  define("MEM_MODEL", model);
+  define("MEM_LATENCY", MemoryModel_.Latency);
+  define("MEM_BYTES_PER_CYCLE", MemoryModel_.BytesPerCycle);
+  define("MEM_MAX_OUTSTANDING", MemoryModel_.MaxOutstanding);
+  define("MEM_BANKS", MemoryModel_.NumBanks);
+  define("MEM_ROW_SIZE", MemoryModel_.RowSize);
+  define("MEM_ROW_MISS_PENALTY", MemoryModel_.RowMissPenalty);
+  cpp << "\n"
+         "typedef struct mem_resp_struct {\n"
+         "    bool valid = false;\n"
+         "    uint64_t data = 0xDEADBEEF;\n"
+         "    uint8_t id = 0;\n"
+         "    // cycle from which on the response is presented to the circuit\n"
+         "    uint64_t available = 0;\n"
+         "    // cycle in which the request was accepted\n"
+         "    uint64_t issued = 0;\n"
+         "    bool first = false;\n"
+         "    bool last = false;\n"
+         "} mem_resp_struct;\n"
+         "\n"
+         "// Timing model of a single memory port, which returns the responses in order\n"
+         "class mem_port_model {\n"
+         "public:\n"
+         "    mem_port_model() {\n"
+         "        for (size_t n = 0; n < MEM_BANKS; n++) {\n"
+         "            open_row[n] = UINT64_MAX;\n"
+         "            bank_ready[n] = 0;\n"
+         "        }\n"
+         "    }\n"
+         "\n"
+         "    bool can_accept() const {\n"
+         "#if MEM_MODEL == MEM_MODEL_FIXED\n"
+         "        return true;\n"
+         "#else\n"
+         "        return outstanding < MEM_MAX_OUTSTANDING;\n"
+         "#endif\n"
+         "    }\n"
+         "\n"
+         "    bool response_valid(uint64_t now) const {\n"
+         "        return !responses.empty() && responses.front().available <= now;\n"
+         "    }\n"
+         "\n"
+         "    const mem_resp_struct &response() const {\n"
+         "        static const mem_resp_struct none;\n"
+         "        return responses.empty() ? none : responses.front();\n"
+         "    }\n"
+         "\n"
+         "    void pop_response(uint64_t now) {\n"
+         "        auto &resp = responses.front();\n"
+         "        if (resp.first) {\n"
+         "            total_latency += now - resp.issued;\n"
+         "        }\n"
+         "        if (resp.last) {\n"
+         "            outstanding--;\n"
+         "        }\n"
+         "        responses.pop_front();\n"
+         "    }\n"
+         "\n"
+         "    void accept(uint64_t now, void *addr, uint64_t bytes, uint8_t id,\n"
+         "                const std::vector<uint64_t> &beats) {\n"
+         "        uint64_t available = schedule(now, (uint64_t) addr, bytes);\n"
+         "        // at most one beat is returned per cycle\n"
+         "        if (!responses.empty()) {\n"
+         "            available = std::max(available, responses.back().available + 1);\n"
+         "        }\n"
+         "        for (size_t n = 0; n < beats.size(); n++) {\n"
+         "            mem_resp_struct resp;\n"
+         "            resp.valid = true;\n"
+         "            resp.data = beats[n];\n"
+         "            resp.id = id;\n"
+         "            resp.available = available + n;\n"
+         "            resp.issued = now;\n"
+         "            resp.first = n == 0;\n"
+         "            resp.last = n == beats.size() - 1;\n"
+         "            responses.push_back(resp);\n"
+         "        }\n"
+         "        outstanding++;\n"
+         "        requests++;\n"
+         "        transferred += bytes;\n"
+         "    }\n"
+         "\n"
+         "    void print_statistics(size_t port, uint64_t cycles) const {\n"
+         "        std::cout << \"mem_\" << port << \": \" << requests << \" requests, \"\n"
+         "                  << transferred << \" bytes, \" << std::fixed << std::setprecision(2)\n"
+         "                  << (cycles ? (double) transferred / cycles : 0.0)\n"
+         "                  << \" bytes/cycle, \"\n"
+         "                  << (requests ? (double) total_latency / requests : 0.0)\n"
+         "                  << \" cycles average latency\";\n"
+         "#if MEM_MODEL == MEM_MODEL_DRAM\n"
+         "        std::cout << \", \" << row_hits << \" row hits\";\n"
+         "#endif\n"
+         "        std::cout << std::defaultfloat << \"\\n\";\n"
+         "    }\n"
+         "\n"
+         "private:\n"
+         "    // returns the cycle from which on the first beat of the response is available\n"
+         "    uint64_t schedule(uint64_t now, uint64_t addr, uint64_t bytes) {\n"
+         "#if MEM_MODEL == MEM_MODEL_FIXED\n"
+         "        return now + MEM_LATENCY;\n"
+         "#else\n"
+         "        uint64_t accessed = now + MEM_LATENCY;\n"
+         "#if MEM_MODEL == MEM_MODEL_DRAM\n"
+         "        uint64_t row = addr / MEM_ROW_SIZE;\n"
+         "        uint64_t bank = row % MEM_BANKS;\n"
+         "        // accesses to an open row are pipelined, opening a row blocks the bank\n"
+         "        uint64_t start = std::max(now, bank_ready[bank]);\n"
+         "        if (open_row[bank] == row) {\n"
+         "            row_hits++;\n"
+         "        } else {\n"
+         "            start += MEM_ROW_MISS_PENALTY;\n"
+         "            open_row[bank] = row;\n"
+         "        }\n"
+         "        bank_ready[bank] = start + 1;\n"
+         "        accessed = start + MEM_LATENCY;\n"
+         "#endif\n"
+         "        // the data bus of the port is shared by all requests\n"
+         "        uint64_t transfer = std::max(accessed, bus_free);\n"
+         "        bus_free = transfer + (bytes + MEM_BYTES_PER_CYCLE - 1) / MEM_BYTES_PER_CYCLE;\n"
+         "        return transfer;\n"
+         "#endif\n"
+         "    }\n"
+         "\n"
+         "    std::deque<mem_resp_struct> responses;\n"
+         "    uint64_t outstanding = 0;\n"
+         "    uint64_t bus_free = 0;\n"
+         "    uint64_t open_row[MEM_BANKS];\n"
+         "    uint64_t bank_ready[MEM_BANKS];\n"
+         "\n"
+         "    uint64_t requests = 0;\n"
+         "    uint64_t transferred = 0;\n"
+         "    uint64_t total_latency = 0;\n"
+         "    uint64_t row_hits = 0;\n"
+         "};\n"
+         "\n";
+}
+
 std::string
 VerilatorHarnessHLS::convert_to_c_type(const jlm::rvsdg::Type * type)
 {
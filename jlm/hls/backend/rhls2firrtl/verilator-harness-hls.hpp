@@ -12,6 +12,50 @@
 namespace jlm::hls
 {
 
+/**
+ * Timing model of the memory ports in the generated Verilator harness. Every port is modeled
+ * individually and returns its responses in order. The parameters are emitted as macros, such
+ * that they can also be overridden when compiling the harness.
+ */
+struct MemoryModelConfiguration
+{
+  enum class Model
+  {
+    /**
+     * Every request is answered after Latency cycles. A request is accepted in every cycle.
+     */
+    FixedLatency,
+
+    /**
+     * A request occupies the data bus of the port for its size divided by BytesPerCycle cycles,
+     * and is answered Latency cycles after its transfer. At most MaxOutstanding requests are in
+     * flight.
+     */
+    Bandwidth,
+
+    /**
+     * Extends the bandwidth model by NumBanks banks with a row buffer of RowSize bytes each. A
+     * request to a row that is not open in its bank additionally pays RowMissPenalty cycles, and a
+     * bank serves one request at a time.
+     */
+    Dram
+  };
+
+  Model Kind = Model::FixedLatency;
+
+  size_t Latency = 10;
+
+  size_t BytesPerCycle = 8;
+
+  size_t MaxOutstanding = 8;
+
+  size_t NumBanks = 8;
+
+  size_t RowSize = 2048;
+
+  size_t RowMissPenalty = 20;
+};
+
 class VerilatorHarnessHLS : public BaseHLS
 {
   std::string
@@ -29,13 +73,24 @@ public:
    *
    * /param verilogFile The filename to the Verilog file that is to be used together with the
    * generated harness as input to Verilator.
+   * /param memoryModel The timing model of the memory ports.
    */
-  explicit VerilatorHarnessHLS(util::filepath verilogFile)
-      : VerilogFile_(std::move(verilogFile))
+  explicit VerilatorHarnessHLS(
+      util::filepath verilogFile,
+      MemoryModelConfiguration memoryModel = MemoryModelConfiguration())
+      : VerilogFile_(std::move(verilogFile)),
+        MemoryModel_(std::move(memoryModel))
   {}
 
 private:
   const util::filepath VerilogFile_;
+  const MemoryModelConfiguration MemoryModel_;
+
+  /**
+   * Emits the memory model macros and the timing model of a single memory port.
+   */
+  void
+  get_memory_model(std::ostringstream & cpp);
 
   /**
    * \return The Verilog filename that is to be used together with the generated harness as input to
@@ -0,0 +1,316 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/hls/backend/rvsdg2rhls/LoopInitiationInterval.hpp>
+#include <jlm/llvm/ir/operators/lambda.hpp>
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace jlm::hls
+{
+
+size_t
+LatencyModel::GetOutputLatency(const rvsdg::output & output)
+{
+  auto node = rvsdg::TryGetOwnerNode<rvsdg::node>(output);
+  if (node == nullptr)
+  {
+    return 0;
+  }
+
+  if (auto structuralNode = dynamic_cast<const rvsdg::StructuralNode *>(node))
+  {
+    return GetNodeDepth(*structuralNode);
+  }
+
+  if (rvsdg::is<load_op>(node))
+  {
+    // data, states..., memory request
+    if (output.index() == 0)
+      return MemoryLatency_;
+    return output.index() == node->noutputs() - 1 ? 0 : 1;
+  }
+  if (rvsdg::is<decoupled_load_op>(node) || rvsdg::is<burst_load_op>(node))
+  {
+    // data, memory request
+    return output.index() == 0 ? MemoryLatency_ : 0;
+  }
+  if (rvsdg::is<store_op>(node))
+  {
+    // states..., memory request address, memory request data
+    return output.index() < node->noutputs() - 2 ? 1 : 0;
+  }
+  if (auto buffer = dynamic_cast<const buffer_op *>(&node->operation()))
+  {
+    return buffer->pass_through ? 0 : 1;
+  }
+
+  return 0;
+}
+
+size_t
+LatencyModel::GetNodeDepth(const rvsdg::StructuralNode & node)
+{
+  auto it = NodeDepths_.find(&node);
+  if (it != NodeDepths_.end())
+  {
+    return it->second;
+  }
+
+  size_t depth = 0;
+  for (size_t n = 0; n < node.nsubregions(); n++)
+  {
+    depth = std::max(depth, GetRegionDepth(*node.subregion(n)));
+  }
+  NodeDepths_[&node] = depth;
+  return depth;
+}
+
+/**
+ * \return The nodes of \p region in topological order.
+ */
+static std::vector<const rvsdg::node *>
+GetTopologicalOrder(const rvsdg::Region & region)
+{
+  std::vector<const rvsdg::node *> nodes;
+  for (auto & node : region.Nodes())
+  {
+    nodes.push_back(&node);
+  }
+  std::stable_sort(
+      nodes.begin(),
+      nodes.end(),
+      [](const rvsdg::node * a, const rvsdg::node * b)
+      {
+        return a->depth() < b->depth();
+      });
+  return nodes;
+}
+
+size_t
+LatencyModel::GetRegionDepth(const rvsdg::Region & region)
+{
+  std::unordered_map<const rvsdg::output *, size_t> arrival;
+  for (auto node : GetTopologicalOrder(region))
+  {
+    size_t start = 0;
+    for (size_t i = 0; i < node->ninputs(); i++)
+    {
+      auto it = arrival.find(node->input(i)->origin());
+      if (it != arrival.end())
+      {
+        start = std::max(start, it->second);
+      }
+    }
+    for (size_t i = 0; i < node->noutputs(); i++)
+    {
+      arrival[node->output(i)] = start + GetOutputLatency(*node->output(i));
+    }
+  }
+
+  size_t depth = 0;
+  for (size_t i = 0; i < region.nresults(); i++)
+  {
+    auto it = arrival.find(region.result(i)->origin());
+    if (it != arrival.end())
+    {
+      depth = std::max(depth, it->second);
+    }
+  }
+  return depth;
+}
+
+/**
+ * Computes the longest path from the back-edge argument of \p result to \p result.
+ *
+ * @param nodes The nodes of the loop subregion in topological order.
+ * @param result The back-edge result closing the recurrence.
+ * @param latencyModel The model providing the latencies of the outputs in the loop.
+ * @param path The outputs along the longest path, starting at the back-edge argument.
+ *
+ * \return The length of the recurrence in cycles, or zero if \p result does not depend on its
+ * back-edge argument.
+ */
+static size_t
+ComputeRecurrence(
+    const std::vector<const rvsdg::node *> & nodes,
+    const backedge_result & result,
+    LatencyModel & latencyModel,
+    std::vector<const rvsdg::output *> & path)
+{
+  std::unordered_map<const rvsdg::output *, size_t> distance;
+  std::unordered_map<const rvsdg::output *, const rvsdg::output *> predecessor;
+  distance[result.argument()] = 0;
+  for (auto node : nodes)
+  {
+    const rvsdg::output * origin = nullptr;
+    size_t start = 0;
+    for (size_t i = 0; i < node->ninputs(); i++)
+    {
+      auto it = distance.find(node->input(i)->origin());
+      if (it != distance.end() && (origin == nullptr || it->second > start))
+      {
+        origin = it->first;
+        start = it->second;
+      }
+    }
+    if (origin == nullptr)
+    {
+      continue;
+    }
+    for (size_t i = 0; i < node->noutputs(); i++)
+    {
+      distance[node->output(i)] = start + latencyModel.GetOutputLatency(*node->output(i));
+      predecessor[node->output(i)] = origin;
+    }
+  }
+
+  auto it = distance.find(result.origin());
+  if (it == distance.end())
+  {
+    return 0;
+  }
+
+  path.clear();
+  for (const rvsdg::output * output = result.origin(); output != nullptr;)
+  {
+    path.push_back(output);
+    auto pit = predecessor.find(output);
+    output = pit == predecessor.end() ? nullptr : pit->second;
+  }
+  std::reverse(path.begin(), path.end());
+
+  // the value is registered in the back-edge, such that the next iteration starts at the earliest
+  // one cycle later
+  return std::max<size_t>(it->second, 1);
+}
+
+LoopInitiationInterval
+LoopInitiationInterval::Compute(const loop_node & loop, size_t memoryLatency)
+{
+  LatencyModel latencyModel(memoryLatency);
+  return Compute(loop, latencyModel);
+}
+
+LoopInitiationInterval
+LoopInitiationInterval::Compute(const loop_node & loop, LatencyModel & latencyModel)
+{
+  auto memoryLatency = latencyModel.GetMemoryLatency();
+  auto & subregion = *loop.subregion();
+  auto nodes = GetTopologicalOrder(subregion);
+
+  size_t ii = 1;
+  std::vector<const rvsdg::output *> criticalPath;
+  for (size_t i = 0; i < subregion.nresults(); i++)
+  {
+    auto result = dynamic_cast<const backedge_result *>(subregion.result(i));
+    if (result == nullptr)
+    {
+      continue;
+    }
+
+    std::vector<const rvsdg::output *> path;
+    auto length = ComputeRecurrence(nodes, *result, latencyModel, path);
+    if (length > ii || criticalPath.empty())
+    {
+      ii = std::max(ii, length);
+      criticalPath = std::move(path);
+    }
+  }
+
+  // A load waits for the response to its request before it issues the next request
+  for (auto node : nodes)
+  {
+    if (rvsdg::is<load_op>(node) && memoryLatency + 1 > ii)
+    {
+      ii = memoryLatency + 1;
+      criticalPath = { node->output(0) };
+    }
+  }
+
+  return LoopInitiationInterval(loop, ii, std::move(criticalPath));
+}
+
+static std::string
+GetFunctionName(const rvsdg::Region & region)
+{
+  for (auto node = region.node(); node != nullptr; node = node->region()->node())
+  {
+    if (auto lambda = dynamic_cast<const llvm::lambda::node *>(node))
+    {
+      return lambda->name();
+    }
+  }
+  return "";
+}
+
+static std::string
+GetOutputName(const rvsdg::output & output)
+{
+  if (dynamic_cast<const backedge_argument *>(&output))
+  {
+    return "BACKEDGE";
+  }
+  if (auto node = rvsdg::TryGetOwnerNode<rvsdg::node>(output))
+  {
+    return node->operation().debug_string();
+  }
+  return "ARG";
+}
+
+std::string
+LoopInitiationInterval::ToString() const
+{
+  std::string str = "loop in " + GetFunctionName(*Loop_->region()) + ": II "
+                  + std::to_string(II_) + ", critical recurrence:";
+  for (size_t n = 0; n < CriticalPath_.size(); n++)
+  {
+    str += (n == 0 ? " " : " -> ") + GetOutputName(*CriticalPath_[n]);
+  }
+  return str;
+}
+
+static void
+ComputeLoopInitiationIntervals(
+    const rvsdg::Region & region,
+    LatencyModel & latencyModel,
+    std::vector<LoopInitiationInterval> & loops)
+{
+  for (auto node : GetTopologicalOrder(region))
+  {
+    auto structuralNode = dynamic_cast<const rvsdg::StructuralNode *>(node);
+    if (structuralNode == nullptr)
+    {
+      continue;
+    }
+
+    if (auto loop = dynamic_cast<const loop_node *>(node))
+    {
+      loops.push_back(LoopInitiationInterval::Compute(*loop, latencyModel));
+    }
+    for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+    {
+      ComputeLoopInitiationIntervals(*structuralNode->subregion(n), latencyModel, loops);
+    }
+  }
+}
+
+std::vector<LoopInitiationInterval>
+ComputeLoopInitiationIntervals(const rvsdg::Region & region, size_t memoryLatency)
+{
+  LatencyModel latencyModel(memoryLatency);
+  std::vector<LoopInitiationInterval> loops;
+  ComputeLoopInitiationIntervals(region, latencyModel, loops);
+  return loops;
+}
+
+std::vector<LoopInitiationInterval>
+ComputeLoopInitiationIntervals(const llvm::RvsdgModule & rvsdgModule, size_t memoryLatency)
+{
+  return ComputeLoopInitiationIntervals(*rvsdgModule.Rvsdg().root(), memoryLatency);
+}
+
+}
@@ -0,0 +1,158 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_HLS_BACKEND_RVSDG2RHLS_LOOPINITIATIONINTERVAL_HPP
+#define JLM_HLS_BACKEND_RVSDG2RHLS_LOOPINITIATIONINTERVAL_HPP
+
+#include <jlm/hls/ir/hls.hpp>
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace jlm::hls
+{
+
+/**
+ * Latency model of the RHLS circuit. Registered outputs, such as the outputs of non-pass-through
+ * buffers and the state outputs of loads and stores, take one cycle. Load data takes the assumed
+ * memory latency. Structural outputs take the depth of the subregions of their node.
+ *
+ * The depth of every structural node is computed once and cached, such that the cost of a query
+ * is linear in the size of the nested regions. The model must therefore not be used across
+ * changes to the subregions of the nodes it has seen.
+ */
+class LatencyModel final
+{
+public:
+  /**
+   * @param memoryLatency The assumed latency in cycles of memory responses.
+   */
+  explicit LatencyModel(size_t memoryLatency)
+      : MemoryLatency_(memoryLatency)
+  {}
+
+  [[nodiscard]] size_t
+  GetMemoryLatency() const noexcept
+  {
+    return MemoryLatency_;
+  }
+
+  /**
+   * Computes the number of cycles between all inputs of the producer of \p output being available
+   * and \p output being available.
+   *
+   * @param output The output for which the latency is computed.
+   *
+   * \return The latency of \p output in cycles.
+   */
+  size_t
+  GetOutputLatency(const rvsdg::output & output);
+
+  /**
+   * Computes the length in cycles of the longest path from the arguments to the results of
+   * \p region. For the subregion of a loop_node, this is the latency of a single iteration.
+   */
+  size_t
+  GetRegionDepth(const rvsdg::Region & region);
+
+private:
+  size_t
+  GetNodeDepth(const rvsdg::StructuralNode & node);
+
+  size_t MemoryLatency_;
+  std::unordered_map<const rvsdg::StructuralNode *, size_t> NodeDepths_;
+};
+
+/**
+ * The minimum initiation interval (II) of a loop_node, i.e., the minimum number of cycles
+ * between the start of two consecutive iterations, as constrained by its recurrences.
+ *
+ * Every loop-carried dependence of a loop_node passes through a back-edge: loop variables and
+ * memory states through the back-edges created by loop_node::add_loopvar(), and the predicate
+ * through the back-edge feeding the predicate_buffer_op, which in turn drives all
+ * loop_constant_buffer_ops of the loop. The II is the length of the longest path from a back-edge
+ * argument to its back-edge result. Loads that are not decoupled only permit a single
+ * outstanding request, and constrain the II to the memory round trip.
+ */
+class LoopInitiationInterval final
+{
+public:
+  LoopInitiationInterval(
+      const loop_node & loop,
+      size_t ii,
+      std::vector<const rvsdg::output *> criticalPath)
+      : Loop_(&loop),
+        II_(ii),
+        CriticalPath_(std::move(criticalPath))
+  {}
+
+  [[nodiscard]] const loop_node &
+  GetLoop() const noexcept
+  {
+    return *Loop_;
+  }
+
+  [[nodiscard]] size_t
+  GetII() const noexcept
+  {
+    return II_;
+  }
+
+  /**
+   * \return The outputs along the recurrence that constrains the II. For a back-edge, the path
+   * starts at the back-edge argument and ends at the origin of the back-edge result. For a load,
+   * the path consists of the data output of the load.
+   */
+  [[nodiscard]] const std::vector<const rvsdg::output *> &
+  GetCriticalPath() const noexcept
+  {
+    return CriticalPath_;
+  }
+
+  /**
+   * \return A single line with the function of the loop, its II, and the critical recurrence.
+   */
+  [[nodiscard]] std::string
+  ToString() const;
+
+  /**
+   * Computes the recurrence-constrained minimum II of \p loop.
+   *
+   * @param loop The loop for which the II is computed.
+   * @param memoryLatency The assumed latency in cycles of memory responses.
+   */
+  static LoopInitiationInterval
+  Compute(const loop_node & loop, size_t memoryLatency);
+
+  /**
+   * Computes the recurrence-constrained minimum II of \p loop.
+   *
+   * @param loop The loop for which the II is computed.
+   * @param latencyModel The model providing the latencies of the outputs in the loop.
+   */
+  static LoopInitiationInterval
+  Compute(const loop_node & loop, LatencyModel & latencyModel);
+
+private:
+  const loop_node * Loop_;
+  size_t II_;
+  std::vector<const rvsdg::output *> CriticalPath_;
+};
+
+/**
+ * Computes the II of every loop_node in \p region and its subregions, with outer loops preceding
+ * the loops nested in them.
+ */
+std::vector<LoopInitiationInterval>
+ComputeLoopInitiationIntervals(const rvsdg::Region & region, size_t memoryLatency);
+
+std::vector<LoopInitiationInterval>
+ComputeLoopInitiationIntervals(const llvm::RvsdgModule & rvsdgModule, size_t memoryLatency);
+
+}
+
+#endif // JLM_HLS_BACKEND_RVSDG2RHLS_LOOPINITIATIONINTERVAL_HPP
@@ -0,0 +1,164 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/hls/backend/rvsdg2rhls/LoopUnrolling.hpp>
+#include <jlm/llvm/ir/operators/call.hpp>
+#include <jlm/llvm/ir/operators/Load.hpp>
+#include <jlm/llvm/ir/operators/Store.hpp>
+#include <jlm/llvm/opt/unroll.hpp>
+#include <jlm/rvsdg/theta.hpp>
+
+#include <algorithm>
+#include <unordered_set>
+
+namespace jlm::hls
+{
+
+/**
+ * \return The number of loads, stores, and calls in \p region and its subregions, i.e., the
+ * number of memory request channels a single copy of \p region occupies.
+ */
+static size_t
+CountMemoryOperations(const rvsdg::Region & region)
+{
+  size_t numOperations = 0;
+  for (auto & node : region.Nodes())
+  {
+    if (auto structuralNode = dynamic_cast<const rvsdg::StructuralNode *>(&node))
+    {
+      for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+        numOperations += CountMemoryOperations(*structuralNode->subregion(n));
+    }
+    else if (
+        rvsdg::is<llvm::LoadOperation>(&node) || rvsdg::is<llvm::StoreOperation>(&node)
+        || rvsdg::is<llvm::CallOperation>(&node))
+    {
+      numOperations++;
+    }
+  }
+
+  return numOperations;
+}
+
+static bool
+ContainsTheta(const rvsdg::Region & region)
+{
+  for (auto & node : region.Nodes())
+  {
+    if (auto structuralNode = dynamic_cast<const rvsdg::StructuralNode *>(&node))
+    {
+      if (dynamic_cast<const rvsdg::ThetaNode *>(structuralNode))
+        return true;
+
+      for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+      {
+        if (ContainsTheta(*structuralNode->subregion(n)))
+          return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+static void
+CollectInnermostThetas(rvsdg::Region & region, std::vector<rvsdg::ThetaNode *> & thetas)
+{
+  for (auto & node : region.Nodes())
+  {
+    auto structuralNode = dynamic_cast<rvsdg::StructuralNode *>(&node);
+    if (!structuralNode)
+      continue;
+
+    auto theta = dynamic_cast<rvsdg::ThetaNode *>(structuralNode);
+    if (theta && !ContainsTheta(*theta->subregion()))
+    {
+      thetas.push_back(theta);
+      continue;
+    }
+
+    for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+      CollectInnermostThetas(*structuralNode->subregion(n), thetas);
+  }
+}
+
+/**
+ * \return The number of copies of the loop body that llvm::unroll() creates when unrolling a loop
+ * with \p tripCount iterations by \p factor, including the copy for the remaining iterations.
+ */
+static size_t
+CountBodyCopies(const rvsdg::bitvalue_repr * tripCount, size_t factor)
+{
+  // The trip count is unknown at compile time, and the remaining iterations are executed by a
+  // copy of the original loop
+  if (!tripCount)
+    return factor + 1;
+
+  // The loop is completely unrolled
+  auto numIterations = tripCount->to_uint();
+  if (numIterations <= factor)
+    return numIterations;
+
+  return factor + (numIterations % factor != 0 ? 1 : 0);
+}
+
+size_t
+ComputeUnrollFactor(const rvsdg::ThetaNode & theta, const UnrollConfiguration & configuration)
+{
+  if (configuration.MaxFactor < 2 || ContainsTheta(*theta.subregion()))
+    return 1;
+
+  auto inductionVariable = llvm::InductionVariable::Create(theta);
+  if (!inductionVariable)
+    return 1;
+
+  auto tripCount = inductionVariable->GetTripCount();
+  auto numMemoryOperations = CountMemoryOperations(*theta.subregion());
+  auto estimate = EstimateResources(*theta.subregion(), configuration.CostTable);
+  for (auto factor = configuration.MaxFactor; factor >= 2; factor--)
+  {
+    auto numCopies = CountBodyCopies(tripCount.get(), factor);
+    if (numCopies * numMemoryOperations <= configuration.NumMemoryPorts
+        && numCopies * estimate.Area <= configuration.AreaBudget)
+      return factor;
+  }
+
+  return 1;
+}
+
+size_t
+UnrollLoops(llvm::RvsdgModule & rvsdgModule, const UnrollConfiguration & configuration)
+{
+  std::vector<rvsdg::ThetaNode *> thetas;
+  CollectInnermostThetas(*rvsdgModule.Rvsdg().root(), thetas);
+
+  // llvm::unroll() leaves the normal form mutable, which changes the behavior of later passes
+  auto nf = rvsdgModule.Rvsdg().node_normal_form(typeid(rvsdg::operation));
+  auto isMutable = nf->get_mutable();
+
+  size_t numUnrolled = 0;
+  std::unordered_set<rvsdg::Region *> unrolledRegions;
+  for (auto theta : thetas)
+  {
+    auto factor = ComputeUnrollFactor(*theta, configuration);
+    if (factor < 2)
+      continue;
+
+    unrolledRegions.insert(theta->region());
+    llvm::unroll(theta, factor);
+    numUnrolled++;
+  }
+
+  // Only the last copy of the body computes the loop predicate. The predicates of all other copies
+  // are dead.
+  for (auto region : unrolledRegions)
+    region->prune(true);
+
+  nf->set_mutable(isMutable);
+
+  return numUnrolled;
+}
+
+}
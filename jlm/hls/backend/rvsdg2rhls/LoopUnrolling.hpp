@@ -0,0 +1,70 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_HLS_BACKEND_RVSDG2RHLS_LOOPUNROLLING_HPP
+#define JLM_HLS_BACKEND_RVSDG2RHLS_LOOPUNROLLING_HPP
+
+#include <jlm/hls/opt/ResourceSharing.hpp>
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+
+namespace jlm::rvsdg
+{
+class ThetaNode;
+}
+
+namespace jlm::hls
+{
+
+/**
+ * Configuration of the spatial unrolling of loops.
+ */
+struct UnrollConfiguration
+{
+  /**
+   * Largest number of copies of a loop body. A value of one disables unrolling.
+   */
+  size_t MaxFactor = 4;
+
+  /**
+   * Number of memory ports available to a single loop. Every load and store of every copy of the
+   * loop body occupies one port.
+   */
+  size_t NumMemoryPorts = 4;
+
+  /**
+   * Area in units of the cost table that the expensive operators of all copies of a loop body may
+   * occupy.
+   */
+  size_t AreaBudget = 1600;
+
+  OperatorCostTable CostTable = OperatorCostTable::CreateDefault();
+};
+
+/**
+ * Computes the largest unroll factor for which all copies of the body of \p theta fit into the
+ * memory ports and the area budget of \p configuration. The copy that llvm::unroll() emits for the
+ * remaining iterations counts against both budgets. The theta node is not modified.
+ *
+ * \return The unroll factor, or one if \p theta should not be unrolled. Only innermost loops with
+ * an induction variable recognized by llvm::InductionVariable are unrolled.
+ */
+size_t
+ComputeUnrollFactor(const rvsdg::ThetaNode & theta, const UnrollConfiguration & configuration);
+
+/**
+ * Replicates the bodies of innermost theta nodes by the factor computed with
+ * ComputeUnrollFactor(), such that the independent parts of consecutive iterations are executed
+ * by parallel hardware once the loop is converted to a loop_node. The loads of every copy are
+ * later on separated by mem_queue, and MemoryConverter distributes the loads of read-only pointer
+ * arguments over NumMemoryPorts ports. Must be applied before ConvertThetaNodes.
+ *
+ * \return The number of unrolled loops.
+ */
+size_t
+UnrollLoops(llvm::RvsdgModule & rvsdgModule, const UnrollConfiguration & configuration);
+
+}
+
+#endif // JLM_HLS_BACKEND_RVSDG2RHLS_LOOPUNROLLING_HPP
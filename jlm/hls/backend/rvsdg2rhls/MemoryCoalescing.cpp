@@ -0,0 +1,370 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/hls/backend/rvsdg2rhls/mem-conv.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/MemoryCoalescing.hpp>
+#include <jlm/hls/ir/hls.hpp>
+#include <jlm/llvm/ir/operators/GetElementPtr.hpp>
+#include <jlm/llvm/ir/operators/operators.hpp>
+#include <jlm/llvm/ir/operators/sext.hpp>
+#include <jlm/rvsdg/bitstring.hpp>
+
+#include <unordered_map>
+
+namespace jlm::hls
+{
+
+/**
+ * \return The value a loop variable takes in the next iteration, or nullptr if \p mux is not the
+ * mux of a loop variable.
+ */
+static const rvsdg::output *
+GetNextValue(const rvsdg::node & mux)
+{
+  auto op = dynamic_cast<const mux_op *>(&mux.operation());
+  if (!op || !op->loop || mux.ninputs() != 3)
+    return nullptr;
+
+  auto backedge = dynamic_cast<backedge_argument *>(mux.input(2)->origin());
+  if (!backedge)
+    return nullptr;
+
+  auto origin = backedge->result()->origin();
+  auto node = rvsdg::TryGetOwnerNode<rvsdg::node>(*origin);
+  while (node && rvsdg::is<buffer_op>(node))
+  {
+    origin = node->input(0)->origin();
+    node = rvsdg::TryGetOwnerNode<rvsdg::node>(*origin);
+  }
+
+  // the back-edge is fed by the branch that steers the next value into the next iteration
+  auto branch = node ? dynamic_cast<const branch_op *>(&node->operation()) : nullptr;
+  if (!branch || !branch->loop)
+    return nullptr;
+
+  return node->input(1)->origin();
+}
+
+static bool
+IsLoopInvariant(const rvsdg::output & output, size_t depth = 0)
+{
+  if (depth > 16)
+    return false;
+
+  if (dynamic_cast<const EntryArgument *>(&output))
+    return true;
+
+  auto node = rvsdg::TryGetOwnerNode<rvsdg::simple_node>(output);
+  if (!node)
+    return false;
+
+  if (rvsdg::is<loop_constant_buffer_op>(node))
+    return true;
+  if (rvsdg::is<mux_op>(node))
+    return GetNextValue(*node) == &output;
+  if (rvsdg::is<branch_op>(node) || rvsdg::is<buffer_op>(node) || rvsdg::is<load_op>(node)
+      || rvsdg::is<decoupled_load_op>(node) || rvsdg::is<burst_load_op>(node))
+    return false;
+
+  for (size_t n = 0; n < node->ninputs(); n++)
+  {
+    if (!IsLoopInvariant(*node->input(n)->origin(), depth + 1))
+      return false;
+  }
+
+  return true;
+}
+
+/**
+ * \return True if \p output is a loop variable that is incremented by one in every iteration.
+ */
+static bool
+IsUnitStrideInduction(const rvsdg::output & output)
+{
+  auto mux = rvsdg::TryGetOwnerNode<rvsdg::simple_node>(output);
+  if (!mux)
+    return false;
+
+  auto next = GetNextValue(*mux);
+  auto add = next ? rvsdg::TryGetOwnerNode<rvsdg::simple_node>(*next) : nullptr;
+  if (!add || !rvsdg::is<rvsdg::bitadd_op>(add))
+    return false;
+
+  for (size_t n = 0; n < 2; n++)
+  {
+    auto constant = rvsdg::TryGetOwnerNode<rvsdg::simple_node>(*add->input(1 - n)->origin());
+    auto op = constant ? dynamic_cast<const rvsdg::bitconstant_op *>(&constant->operation())
+                       : nullptr;
+    if (add->input(n)->origin() == &output && op && op->value().to_int() == 1)
+      return true;
+  }
+
+  return false;
+}
+
+bool
+IsUnitStrideAddress(const rvsdg::output & address, size_t elementBytes)
+{
+  // state gates only order the address with memory states
+  auto origin = &address;
+  auto gep = rvsdg::TryGetOwnerNode<rvsdg::simple_node>(*origin);
+  while (gep && rvsdg::is<state_gate_op>(gep) && origin->index() == 0)
+  {
+    origin = gep->input(0)->origin();
+    gep = rvsdg::TryGetOwnerNode<rvsdg::simple_node>(*origin);
+  }
+
+  auto op = gep ? dynamic_cast<const llvm::GetElementPtrOperation *>(&gep->operation()) : nullptr;
+  if (!op || gep->ninputs() < 2 || !IsLoopInvariant(*gep->input(0)->origin()))
+    return false;
+
+  // all but the last offset must be invariant, and the last one must select the elements
+  const rvsdg::Type * type = &op->GetPointeeType();
+  for (size_t n = 1; n < gep->ninputs() - 1; n++)
+  {
+    auto arrayType = dynamic_cast<const llvm::arraytype *>(type);
+    if (!arrayType || !IsLoopInvariant(*gep->input(n)->origin()))
+      return false;
+    type = &arrayType->element_type();
+  }
+
+  auto elementType = dynamic_cast<const rvsdg::bittype *>(type);
+  if (!elementType || elementType->nbits() != elementBytes * 8)
+    return false;
+
+  auto offset = gep->input(gep->ninputs() - 1)->origin();
+  auto node = rvsdg::TryGetOwnerNode<rvsdg::simple_node>(*offset);
+  if (node && (rvsdg::is<llvm::sext_op>(node) || rvsdg::is<llvm::zext_op>(node)))
+    offset = node->input(0)->origin();
+
+  return IsUnitStrideInduction(*offset);
+}
+
+/**
+ * \return The response output of the mem_resp_op that feeds \p load, or nullptr if it can not be
+ * traced.
+ */
+static rvsdg::output *
+TraceResponse(const rvsdg::node & load)
+{
+  auto origin = load.input(1)->origin();
+  while (auto argument = dynamic_cast<EntryArgument *>(origin))
+  {
+    if (argument->nusers() != 1)
+      return nullptr;
+    origin = argument->input()->origin();
+  }
+
+  auto node = rvsdg::TryGetOwnerNode<rvsdg::simple_node>(*origin);
+  return node && rvsdg::is<mem_resp_op>(node) ? origin : nullptr;
+}
+
+/**
+ * \return The input of the mem_req_op that receives the requests of \p load, or nullptr if it can
+ * not be traced.
+ */
+static rvsdg::input *
+TraceRequest(const rvsdg::node & load)
+{
+  auto output = load.output(1);
+  while (output->nusers() == 1)
+  {
+    auto user = *output->begin();
+    if (auto result = dynamic_cast<ExitResult *>(user))
+    {
+      output = result->output();
+      continue;
+    }
+
+    auto node = rvsdg::input::GetNode(*user);
+    return node && rvsdg::is<mem_req_op>(node) ? user : nullptr;
+  }
+
+  return nullptr;
+}
+
+/**
+ * Removes the entry arguments and loop inputs that routed a response to a removed load.
+ */
+static void
+RemoveDeadRoute(rvsdg::output & origin)
+{
+  auto argument = dynamic_cast<EntryArgument *>(&origin);
+  while (argument && argument->nusers() == 0)
+  {
+    auto input = argument->input();
+    auto loop = util::AssertedCast<loop_node>(input->node());
+    auto next = input->origin();
+    loop->subregion()->RemoveArgument(argument->index());
+    loop->RemoveInput(input->index());
+    argument = dynamic_cast<EntryArgument *>(next);
+  }
+}
+
+struct CoalescedLoad
+{
+  rvsdg::simple_node * Load;
+  size_t Port;
+};
+
+static void
+GatherDecoupledLoads(rvsdg::Region & region, std::vector<rvsdg::simple_node *> & loads)
+{
+  for (auto & node : region.Nodes())
+  {
+    if (auto structuralNode = dynamic_cast<rvsdg::StructuralNode *>(&node))
+    {
+      for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+      {
+        GatherDecoupledLoads(*structuralNode->subregion(n), loads);
+      }
+    }
+    else if (rvsdg::is<decoupled_load_op>(&node) && dynamic_cast<loop_node *>(region.node()))
+    {
+      loads.push_back(util::AssertedCast<rvsdg::simple_node>(&node));
+    }
+  }
+}
+
+static void
+CoalesceLoads(
+    rvsdg::simple_node & response,
+    rvsdg::simple_node & request,
+    const std::vector<CoalescedLoad> & loads,
+    const BurstConfiguration & configuration)
+{
+  auto requestOperation = util::AssertedCast<const mem_req_op>(&request.operation());
+  std::vector<std::shared_ptr<const rvsdg::ValueType>> responseTypes;
+  for (size_t n = 0; n < response.noutputs(); n++)
+  {
+    responseTypes.push_back(
+        std::dynamic_pointer_cast<const rvsdg::ValueType>(response.output(n)->Type()));
+  }
+  std::vector<std::shared_ptr<const rvsdg::ValueType>> loadTypes;
+  for (auto & type : *requestOperation->GetLoadTypes())
+  {
+    loadTypes.push_back(std::dynamic_pointer_cast<const rvsdg::ValueType>(type));
+  }
+  std::vector<std::shared_ptr<const rvsdg::ValueType>> storeTypes;
+  for (auto & type : *requestOperation->GetStoreTypes())
+  {
+    storeTypes.push_back(std::dynamic_pointer_cast<const rvsdg::ValueType>(type));
+  }
+
+  for (auto & load : loads)
+  {
+    auto loadedType = std::dynamic_pointer_cast<const rvsdg::bittype>(
+        util::AssertedCast<const decoupled_load_op>(&load.Load->operation())->GetLoadedType());
+    burst_load_op op(loadedType, configuration.BurstLength, configuration.Depth);
+    responseTypes[load.Port] = burst_load_op::GetBeatType(*loadedType, configuration.BurstLength);
+    loadTypes[load.Port] = op.GetLineType();
+  }
+
+  auto newResponse = rvsdg::simple_node::create(
+      response.region(),
+      mem_resp_op(responseTypes),
+      { response.input(0)->origin() });
+  auto responses = rvsdg::outputs(newResponse);
+  for (size_t n = 0; n < response.noutputs(); n++)
+  {
+    if (*response.output(n)->Type() == *responses[n]->Type())
+      response.output(n)->divert_users(responses[n]);
+  }
+
+  std::vector<rvsdg::output *> operands;
+  for (size_t n = 0; n < request.ninputs(); n++)
+  {
+    operands.push_back(request.input(n)->origin());
+  }
+  auto newRequest =
+      rvsdg::simple_node::create(request.region(), mem_req_op(loadTypes, storeTypes), operands);
+  for (size_t n = 0; n < request.noutputs(); n++)
+  {
+    request.output(n)->divert_users(newRequest->output(n));
+  }
+  remove(&request);
+
+  for (auto & load : loads)
+  {
+    auto loadNode = load.Load;
+    auto loadedType = std::dynamic_pointer_cast<const rvsdg::bittype>(
+        util::AssertedCast<const decoupled_load_op>(&loadNode->operation())->GetLoadedType());
+    // the old route carries the element type, so a new one is created for the beats
+    auto oldRoute = loadNode->input(1)->origin();
+    auto routed = route_response(loadNode->region(), responses[load.Port]);
+    // the loop predicate tells the load when the loop is entered again
+    auto loop = util::AssertedCast<loop_node>(loadNode->region()->node());
+    auto outputs = burst_load_op::create(
+        *loadNode->input(0)->origin(),
+        *routed,
+        *loop->predicate_buffer(),
+        loadedType,
+        configuration.BurstLength,
+        configuration.Depth);
+    loadNode->output(0)->divert_users(outputs[0]);
+    loadNode->output(1)->divert_users(outputs[1]);
+    remove(loadNode);
+    RemoveDeadRoute(*oldRoute);
+  }
+
+  remove(&response);
+}
+
+size_t
+CoalesceDecoupledLoads(llvm::RvsdgModule & rvsdgModule, const BurstConfiguration & configuration)
+{
+  if (configuration.BurstLength <= 1)
+    return 0;
+  if ((configuration.BurstLength & (configuration.BurstLength - 1)) != 0)
+    throw util::error("The burst length must be a power of two.");
+  if (configuration.Depth < 2)
+    throw util::error("The burst depth must be at least two.");
+
+  std::vector<rvsdg::simple_node *> decoupledLoads;
+  GatherDecoupledLoads(*rvsdgModule.Rvsdg().root(), decoupledLoads);
+
+  std::vector<rvsdg::simple_node *> responses;
+  std::unordered_map<rvsdg::simple_node *, rvsdg::simple_node *> requests;
+  std::unordered_map<rvsdg::simple_node *, std::vector<CoalescedLoad>> loads;
+  for (auto load : decoupledLoads)
+  {
+    auto op = util::AssertedCast<const decoupled_load_op>(&load->operation());
+    auto loadedType = dynamic_cast<const rvsdg::bittype *>(op->GetLoadedType().get());
+    if (!loadedType || loadedType->nbits() % 8 != 0 || loadedType->nbits() > 64
+        || loadedType->nbits() / 8 * configuration.BurstLength > configuration.MaxLineBytes)
+      continue;
+
+    if (!IsUnitStrideAddress(*load->input(0)->origin(), loadedType->nbits() / 8))
+      continue;
+
+    auto response = TraceResponse(*load);
+    auto request = TraceRequest(*load);
+    if (!response || !request || response->index() != request->index())
+      continue;
+
+    auto responseNode = rvsdg::TryGetOwnerNode<rvsdg::simple_node>(*response);
+    auto requestNode = rvsdg::input::GetNode(*request);
+    // a store to the port could modify a line after it was fetched
+    auto requestOperation = util::AssertedCast<const mem_req_op>(&requestNode->operation());
+    if (!requestOperation->GetStoreTypes()->empty())
+      continue;
+
+    if (loads.find(responseNode) == loads.end())
+      responses.push_back(responseNode);
+    requests[responseNode] = util::AssertedCast<rvsdg::simple_node>(requestNode);
+    loads[responseNode].push_back({ load, response->index() });
+  }
+
+  size_t numCoalesced = 0;
+  for (auto response : responses)
+  {
+    CoalesceLoads(*response, *requests[response], loads[response], configuration);
+    numCoalesced += loads[response].size();
+  }
+
+  return numCoalesced;
+}
+
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_HLS_BACKEND_RVSDG2RHLS_MEMORYCOALESCING_HPP
+#define JLM_HLS_BACKEND_RVSDG2RHLS_MEMORYCOALESCING_HPP
+
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+
+namespace jlm::hls
+{
+
+/**
+ * Configuration of the coalescing of decoupled loads into burst requests.
+ */
+struct BurstConfiguration
+{
+  /**
+   * Number of elements fetched by a single burst request. Must be a power of two. A value of one
+   * disables coalescing.
+   */
+  size_t BurstLength = 4;
+
+  /**
+   * Maximum size of a line in bytes. Loads whose line would exceed it are not coalesced.
+   */
+  size_t MaxLineBytes = 64;
+
+  /**
+   * Number of lines that can be in flight or buffered per load, including the line that is
+   * currently consumed. Must be at least two.
+   */
+  size_t Depth = 4;
+};
+
+/**
+ * \return True if \p address advances by exactly one element of \p elementBytes bytes in every
+ * iteration of the loop_node it is computed in.
+ */
+bool
+IsUnitStrideAddress(const rvsdg::output & address, size_t elementBytes);
+
+/**
+ * Replaces decoupled loads with unit-stride addresses inside loop_nodes by burst_load_ops. Loads
+ * of ports that are also stored to are not coalesced, as a store could modify a buffered line. The
+ * memory response and request nodes of the affected ports are recreated with the beat and line
+ * types of the bursts. Must be applied after MemoryConverter.
+ *
+ * burst_load_ops are only supported by the RhlsSimulator. RhlsToFirrtlConverter does not lower
+ * them yet.
+ *
+ * \return The number of coalesced loads.
+ */
+size_t
+CoalesceDecoupledLoads(llvm::RvsdgModule & rvsdgModule, const BurstConfiguration & configuration);
+
+}
+
+#endif // JLM_HLS_BACKEND_RVSDG2RHLS_MEMORYCOALESCING_HPP
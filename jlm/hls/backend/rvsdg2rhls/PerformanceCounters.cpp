@@ -0,0 +1,148 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/hls/backend/rvsdg2rhls/PerformanceCounters.hpp>
+#include <jlm/hls/ir/hls.hpp>
+#include <jlm/llvm/ir/operators/lambda.hpp>
+
+#include <algorithm>
+
+namespace jlm::hls
+{
+
+static void
+CollectLoops(rvsdg::Region & region, std::vector<loop_node *> & loops)
+{
+  for (auto & node : region.Nodes())
+  {
+    if (auto loop = dynamic_cast<loop_node *>(&node))
+      loops.push_back(loop);
+
+    if (auto structuralNode = dynamic_cast<rvsdg::StructuralNode *>(&node))
+    {
+      for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+        CollectLoops(*structuralNode->subregion(n), loops);
+    }
+  }
+}
+
+static void
+InsertCounter(
+    rvsdg::input & input,
+    perf_counter_op::counter_kind kind,
+    size_t & id,
+    const std::string & name)
+{
+  auto counter = perf_counter_op::create(*input.origin(), kind, id++, name)[0];
+  input.divert_to(counter);
+}
+
+size_t
+AddPerformanceCounters(
+    llvm::RvsdgModule & rvsdgModule,
+    const PerformanceCounterConfiguration & configuration)
+{
+  auto & rootRegion = *rvsdgModule.Rvsdg().root();
+  size_t id = 0;
+
+  std::vector<loop_node *> loops;
+  CollectLoops(rootRegion, loops);
+  for (size_t n = 0; n < loops.size(); n++)
+  {
+    auto loop = loops[n];
+    auto loopName = "loop" + std::to_string(n);
+    if (configuration.IterationCounters)
+    {
+      // The predicate carries exactly one token per iteration
+      InsertCounter(*loop->predicate(), perf_counter_op::counter_kind::iterations, id, loopName);
+    }
+
+    if (configuration.LoopStallCounters)
+    {
+      for (size_t i = 0; i < loop->ninputs(); i++)
+      {
+        InsertCounter(
+            *loop->input(i),
+            perf_counter_op::counter_kind::stalls,
+            id,
+            loopName + ".i" + std::to_string(i));
+      }
+    }
+  }
+
+  if (!configuration.MemoryStallCounters)
+    return id;
+
+  for (auto & node : rootRegion.Nodes())
+  {
+    auto lambda = dynamic_cast<llvm::lambda::node *>(&node);
+    if (!lambda)
+      continue;
+
+    // The ports are numbered in the order of the bundle results, see BaseHLS::get_mem_reqs()
+    size_t port = 0;
+    for (size_t r = 0; r < lambda->subregion()->nresults(); r++)
+    {
+      auto result = lambda->subregion()->result(r);
+      if (!dynamic_cast<const bundletype *>(&result->type()))
+        continue;
+
+      auto requestNode = rvsdg::output::GetNode(*result->origin());
+      if (requestNode && rvsdg::is<mem_req_op>(requestNode))
+      {
+        for (size_t i = 0; i < requestNode->ninputs(); i++)
+        {
+          InsertCounter(
+              *requestNode->input(i),
+              perf_counter_op::counter_kind::stalls,
+              id,
+              "mem_" + std::to_string(port) + ".req" + std::to_string(i));
+        }
+      }
+      port++;
+    }
+  }
+
+  return id;
+}
+
+static void
+CollectPerformanceCounters(
+    const rvsdg::Region & region,
+    std::vector<const rvsdg::simple_node *> & counters)
+{
+  for (auto & node : region.Nodes())
+  {
+    if (auto structuralNode = dynamic_cast<const rvsdg::StructuralNode *>(&node))
+    {
+      for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+        CollectPerformanceCounters(*structuralNode->subregion(n), counters);
+    }
+    else if (rvsdg::is<perf_counter_op>(&node))
+    {
+      counters.push_back(util::AssertedCast<const rvsdg::simple_node>(&node));
+    }
+  }
+}
+
+std::vector<const rvsdg::simple_node *>
+GetPerformanceCounters(const rvsdg::Region & region)
+{
+  std::vector<const rvsdg::simple_node *> counters;
+  CollectPerformanceCounters(region, counters);
+  std::sort(
+      counters.begin(),
+      counters.end(),
+      [](const rvsdg::simple_node * a, const rvsdg::simple_node * b)
+      {
+        auto & aOperation = *util::AssertedCast<const perf_counter_op>(&a->operation());
+        auto & bOperation = *util::AssertedCast<const perf_counter_op>(&b->operation());
+        return aOperation.id() < bOperation.id();
+      });
+
+  return counters;
+}
+
+}
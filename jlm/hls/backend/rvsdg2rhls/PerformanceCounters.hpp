@@ -0,0 +1,63 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_HLS_BACKEND_RVSDG2RHLS_PERFORMANCECOUNTERS_HPP
+#define JLM_HLS_BACKEND_RVSDG2RHLS_PERFORMANCECOUNTERS_HPP
+
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+
+namespace jlm::rvsdg
+{
+class simple_node;
+}
+
+namespace jlm::hls
+{
+
+/**
+ * Selects the channels that are instrumented by AddPerformanceCounters().
+ */
+struct PerformanceCounterConfiguration
+{
+  /**
+   * Count the iterations of every loop_node on its predicate.
+   */
+  bool IterationCounters = true;
+
+  /**
+   * Count the stall cycles of the inputs of every loop_node, i.e., the cycles in which a new
+   * invocation of a loop waits for the previous one to finish.
+   */
+  bool LoopStallCounters = true;
+
+  /**
+   * Count the stall cycles of every request channel of the memory ports, i.e., the cycles in which
+   * a load or store waits for the memory.
+   */
+  bool MemoryStallCounters = true;
+};
+
+/**
+ * Inserts perf_counter_op nodes into the channels selected by \p configuration. The counters are
+ * numbered consecutively and lowered by RhlsToFirrtlConverter to output ports perf_<id> of the
+ * circuit, which are dumped by the Verilator harness at the end of a run. Must be applied after
+ * add_buffers, as the counters do not buffer tokens.
+ *
+ * \return The number of inserted counters.
+ */
+size_t
+AddPerformanceCounters(
+    llvm::RvsdgModule & rvsdgModule,
+    const PerformanceCounterConfiguration & configuration);
+
+/**
+ * \return The perf_counter_op nodes in \p region and its subregions ordered by their id.
+ */
+std::vector<const rvsdg::simple_node *>
+GetPerformanceCounters(const rvsdg::Region & region);
+
+}
+
+#endif // JLM_HLS_BACKEND_RVSDG2RHLS_PERFORMANCECOUNTERS_HPP
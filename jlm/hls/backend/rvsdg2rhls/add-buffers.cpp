@@ -4,94 +4,252 @@
  */
 
 #include <jlm/hls/backend/rvsdg2rhls/add-buffers.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/LoopInitiationInterval.hpp>
 #include <jlm/hls/backend/rvsdg2rhls/rvsdg2rhls.hpp>
 #include <jlm/hls/ir/hls.hpp>
 #include <jlm/rvsdg/traverser.hpp>
 
+#include <algorithm>
+#include <unordered_map>
+
 namespace jlm::hls
 {
 
-void
-add_buffers(rvsdg::Region * region, bool pass_through)
+/**
+ * Latency, depth, and achievable initiation interval of a region.
+ */
+struct RegionTiming
+{
+  std::unordered_map<const rvsdg::output *, size_t> Arrival;
+  std::unordered_map<const rvsdg::node *, size_t> RequiredStart;
+  size_t Depth = 0;
+  size_t II = 1;
+};
+
+static bool
+IsLoad(const rvsdg::node & node)
+{
+  return rvsdg::is<load_op>(&node) || rvsdg::is<decoupled_load_op>(&node)
+      || rvsdg::is<burst_load_op>(&node);
+}
+
+static size_t
+ArrivalTime(const RegionTiming & timing, const rvsdg::output * output)
+{
+  auto it = timing.Arrival.find(output);
+  return it == timing.Arrival.end() ? 0 : it->second;
+}
+
+static size_t
+RequiredTime(const RegionTiming & timing, const rvsdg::input * input)
+{
+  if (auto ni = dynamic_cast<const rvsdg::node_input *>(input))
+  {
+    auto it = timing.RequiredStart.find(ni->node());
+    if (it != timing.RequiredStart.end())
+    {
+      return it->second;
+    }
+  }
+  return timing.Depth;
+}
+
+/**
+ * Computes the number of slots that a buffer on \p output requires to sustain the initiation
+ * interval of the region, i.e., the number of tokens that are in flight while the reconvergent
+ * paths starting at \p output catch up.
+ */
+static size_t
+RequiredCapacity(
+    const RegionTiming & timing,
+    const rvsdg::output * output,
+    const BufferSizingConfiguration & configuration)
 {
+  size_t slack = 0;
+  auto arrival = ArrivalTime(timing, output);
+  for (auto user : *output)
+  {
+    auto required = RequiredTime(timing, user);
+    if (required > arrival)
+    {
+      slack = std::max(slack, required - arrival);
+    }
+  }
+  auto capacity = (slack + timing.II - 1) / timing.II;
+  return std::clamp<size_t>(capacity, 1, configuration.MaxCapacity);
+}
+
+static void
+PlaceBuffer(
+    rvsdg::output * out,
+    size_t capacity,
+    bool pass_through,
+    BufferSizingReport & report)
+{
+  JLM_ASSERT(out->nusers() == 1);
+  if (auto ni = dynamic_cast<jlm::rvsdg::node_input *>(*out->begin()))
+  {
+    auto buf = dynamic_cast<const hls::buffer_op *>(&ni->node()->operation());
+    if (buf && (buf->pass_through || !pass_through))
+    {
+      if (buf->capacity >= capacity)
+      {
+        return;
+      }
+      // grow buffers inserted by earlier passes, e.g., after decoupled loads
+      auto new_out = buffer_op::create(*out, capacity, buf->pass_through)[0];
+      ni->node()->output(0)->divert_users(new_out);
+      remove(ni->node());
+      report.NumBuffers++;
+      report.TotalSlots += capacity;
+      return;
+    }
+  }
+  std::vector<jlm::rvsdg::input *> old_users(out->begin(), out->end());
+  auto new_out = buffer_op::create(*out, capacity, pass_through)[0];
+  for (auto user : old_users)
+  {
+    user->divert_to(new_out);
+  }
+  report.NumBuffers++;
+  report.TotalSlots += capacity;
+}
+
+static void
+size_buffers(
+    rvsdg::Region * region,
+    bool pass_through,
+    const BufferSizingConfiguration & configuration,
+    BufferSizingReport & report)
+{
+  RegionTiming timing;
+  timing.II = std::max<size_t>(configuration.TargetII, 1);
+
+  // the II of a loop is bounded by its recurrences
+  if (auto loop = dynamic_cast<const loop_node *>(region->node()))
+  {
+    auto loopII = LoopInitiationInterval::Compute(*loop, configuration.MemoryLatency);
+    timing.II = std::max(timing.II, loopII.GetII());
+  }
+
+  // Structural nodes are only queried after their subregions are sized, such that the cached
+  // depths include the inserted buffers
+  LatencyModel latencyModel(configuration.MemoryLatency);
+
+  // ASAP schedule of the region. Subregions are sized first, such that the latency of structural
+  // nodes reflects the buffers inserted in them.
+  std::vector<rvsdg::node *> nodes;
+  std::vector<rvsdg::node *> candidates;
   for (auto & node : jlm::rvsdg::topdown_traverser(region))
   {
     if (auto structnode = dynamic_cast<rvsdg::StructuralNode *>(node))
     {
       for (size_t n = 0; n < structnode->nsubregions(); n++)
       {
-        add_buffers(structnode->subregion(n), pass_through);
+        size_buffers(structnode->subregion(n), pass_through, configuration, report);
       }
     }
-    else if (dynamic_cast<jlm::rvsdg::simple_node *>(node))
+    else if (IsLoad(*node) || rvsdg::is<fork_op>(node) || rvsdg::is<state_gate_op>(node))
+    {
+      candidates.push_back(node);
+    }
+
+    size_t start = 0;
+    for (size_t i = 0; i < node->ninputs(); i++)
+    {
+      start = std::max(start, ArrivalTime(timing, node->input(i)->origin()));
+    }
+    for (size_t i = 0; i < node->noutputs(); i++)
+    {
+      auto output = node->output(i);
+      timing.Arrival[output] = start + latencyModel.GetOutputLatency(*output);
+    }
+    nodes.push_back(node);
+  }
+
+  for (size_t i = 0; i < region->nresults(); i++)
+  {
+    auto origin = region->result(i)->origin();
+    timing.Depth = std::max(timing.Depth, ArrivalTime(timing, origin));
+  }
+
+  // ALAP schedule of the region
+  for (auto it = nodes.rbegin(); it != nodes.rend(); it++)
+  {
+    auto node = *it;
+    auto requiredStart = timing.Depth;
+    for (size_t i = 0; i < node->noutputs(); i++)
     {
-      if (jlm::rvsdg::is<hls::load_op>(node) || jlm::rvsdg::is<hls::decoupled_load_op>(node))
+      auto output = node->output(i);
+      auto latency = latencyModel.GetOutputLatency(*output);
+      for (auto user : *output)
       {
-        auto out = node->output(0);
-        JLM_ASSERT(out->nusers() == 1);
-        if (auto ni = dynamic_cast<jlm::rvsdg::node_input *>(*out->begin()))
-        {
-          auto buf = dynamic_cast<const hls::buffer_op *>(&ni->node()->operation());
-          if (buf && (buf->pass_through || !pass_through))
-          {
-            continue;
-          }
-        }
-        std::vector<jlm::rvsdg::input *> old_users(out->begin(), out->end());
-        jlm::rvsdg::output * new_out;
-        if (pass_through)
-        {
-          new_out = buffer_op::create(*out, 20, true)[0];
-        }
-        else
-        {
-          new_out = buffer_op::create(*out, 1, false)[0];
-        }
-        for (auto user : old_users)
-        {
-          user->divert_to(new_out);
-        }
+        auto required = RequiredTime(timing, user);
+        requiredStart = std::min(requiredStart, required > latency ? required - latency : 0);
       }
-      if (jlm::rvsdg::is<hls::fork_op>(node) || jlm::rvsdg::is<hls::state_gate_op>(node))
+    }
+    timing.RequiredStart[node] = requiredStart;
+  }
+
+  for (auto node : candidates)
+  {
+    if (IsLoad(*node))
+    {
+      auto out = node->output(0);
+      auto capacity = RequiredCapacity(timing, out, configuration);
+      if (rvsdg::is<decoupled_load_op>(node))
+      {
+        // the buffer has to absorb the responses of all requests in flight
+        auto inFlight = (configuration.MemoryLatency + timing.II - 1) / timing.II + 1;
+        capacity = std::min(std::max(capacity, inFlight), configuration.MaxCapacity);
+      }
+      PlaceBuffer(out, capacity, pass_through, report);
+    }
+    else
+    {
+      for (size_t i = 0; i < node->noutputs(); ++i)
       {
-        for (size_t i = 0; i < node->noutputs(); ++i)
-        {
-          auto out = node->output(i);
-          JLM_ASSERT(out->nusers() == 1);
-          if (auto ni = dynamic_cast<jlm::rvsdg::node_input *>(*out->begin()))
-          {
-            auto buf = dynamic_cast<const hls::buffer_op *>(&ni->node()->operation());
-            if (buf && (buf->pass_through || !pass_through))
-            {
-              continue;
-            }
-          }
-          std::vector<jlm::rvsdg::input *> old_users(out->begin(), out->end());
-          jlm::rvsdg::output * new_out;
-          if (pass_through)
-          {
-            new_out = buffer_op::create(*out, 10, true)[0];
-          }
-          else
-          {
-            new_out = buffer_op::create(*out, 1, false)[0];
-          }
-          for (auto user : old_users)
-          {
-            user->divert_to(new_out);
-          }
-        }
+        auto out = node->output(i);
+        PlaceBuffer(out, RequiredCapacity(timing, out, configuration), pass_through, report);
       }
     }
   }
+
+  report.EstimatedII = std::max(report.EstimatedII, timing.II);
+}
+
+BufferSizingReport
+add_buffers(
+    rvsdg::Region * region,
+    bool pass_through,
+    const BufferSizingConfiguration & configuration)
+{
+  BufferSizingReport report;
+  size_buffers(region, pass_through, configuration, report);
+  return report;
 }
 
 void
-add_buffers(llvm::RvsdgModule & rm, bool pass_through)
+add_buffers(rvsdg::Region * region, bool pass_through)
+{
+  add_buffers(region, pass_through, BufferSizingConfiguration());
+}
+
+BufferSizingReport
+add_buffers(
+    llvm::RvsdgModule & rm,
+    bool pass_through,
+    const BufferSizingConfiguration & configuration)
 {
   auto & graph = rm.Rvsdg();
   auto root = graph.root();
-  add_buffers(root, pass_through);
+  return add_buffers(root, pass_through, configuration);
+}
+
+void
+add_buffers(llvm::RvsdgModule & rm, bool pass_through)
+{
+  add_buffers(rm, pass_through, BufferSizingConfiguration());
 }
 
 }
@@ -12,9 +12,76 @@
 namespace jlm::hls
 {
 
+/**
+ * Parameters used by add_buffers() to size the inserted buffers.
+ */
+struct BufferSizingConfiguration
+{
+  /**
+   * Initiation interval the buffers are sized for. Regions whose recurrences or memory accesses
+   * do not permit this interval are sized for the interval they can achieve.
+   */
+  size_t TargetII = 1;
+
+  /**
+   * Assumed latency in cycles of memory responses. Mirrors the default of the Verilator harness.
+   */
+  size_t MemoryLatency = 10;
+
+  /**
+   * Upper bound for the capacity of a single buffer.
+   */
+  size_t MaxCapacity = 32;
+};
+
+/**
+ * Summary of the buffers placed by add_buffers().
+ */
+struct BufferSizingReport
+{
+  /**
+   * Number of buffers that were inserted or resized.
+   */
+  size_t NumBuffers = 0;
+
+  /**
+   * Sum of the capacities of all buffers that were inserted or resized.
+   */
+  size_t TotalSlots = 0;
+
+  /**
+   * Largest initiation interval estimated for any region.
+   */
+  size_t EstimatedII = 1;
+};
+
+/**
+ * Inserts buffers after forks, state gates, and loads. The capacity of every buffer is derived
+ * from the latency imbalance of the reconvergent paths starting at the buffered output, the
+ * recurrence length of the surrounding loop, and the assumed memory latency, such that the
+ * region can sustain the targeted initiation interval with as few buffer slots as possible.
+ *
+ * @param region The region in which buffers are inserted.
+ * @param pass_through Determines whether the inserted buffers are pass-through buffers.
+ * @param configuration The parameters used for sizing the buffers.
+ *
+ * \return A summary of the inserted buffers.
+ */
+BufferSizingReport
+add_buffers(
+    rvsdg::Region * region,
+    bool pass_through,
+    const BufferSizingConfiguration & configuration);
+
 void
 add_buffers(rvsdg::Region * region, bool pass_through);
 
+BufferSizingReport
+add_buffers(
+    llvm::RvsdgModule & rm,
+    bool pass_through,
+    const BufferSizingConfiguration & configuration);
+
 void
 add_buffers(llvm::RvsdgModule & rm, bool pass_through);
 
@@ -13,10 +13,14 @@
 #include <jlm/llvm/ir/operators/MemoryStateOperations.hpp>
 #include <jlm/llvm/ir/operators/operators.hpp>
 #include <jlm/llvm/ir/operators/Store.hpp>
+#include <jlm/rvsdg/bitstring/arithmetic.hpp>
 #include <jlm/rvsdg/bitstring/constant.hpp>
+#include <jlm/rvsdg/control.hpp>
 #include <jlm/rvsdg/substitution.hpp>
 #include <jlm/rvsdg/traverser.hpp>
 
+#include <optional>
+
 namespace jlm::hls
 {
 
@@ -115,8 +119,270 @@ gep_to_index(jlm::rvsdg::output * o)
   return no->node()->input(2)->origin();
 }
 
+static std::optional<uint64_t>
+GetConstantValue(const jlm::rvsdg::output * output)
+{
+  auto node = jlm::rvsdg::output::GetNode(*output);
+  if (node == nullptr)
+  {
+    return std::nullopt;
+  }
+  if (auto constant = dynamic_cast<const jlm::rvsdg::bitconstant_op *>(&node->operation()))
+  {
+    return constant->value().to_uint();
+  }
+  return std::nullopt;
+}
+
+/**
+ * \return True if \p output is provably a multiple of \p factor.
+ */
+static bool
+IsMultipleOf(const jlm::rvsdg::output * output, size_t factor)
+{
+  if (auto value = GetConstantValue(output))
+  {
+    return *value % factor == 0;
+  }
+
+  auto node = jlm::rvsdg::output::GetNode(*output);
+  if (node == nullptr)
+  {
+    return false;
+  }
+  if (jlm::rvsdg::is<jlm::rvsdg::bitmul_op>(node))
+  {
+    return IsMultipleOf(node->input(0)->origin(), factor)
+        || IsMultipleOf(node->input(1)->origin(), factor);
+  }
+  if (jlm::rvsdg::is<jlm::rvsdg::bitadd_op>(node))
+  {
+    return IsMultipleOf(node->input(0)->origin(), factor)
+        && IsMultipleOf(node->input(1)->origin(), factor);
+  }
+  if (jlm::rvsdg::is<jlm::rvsdg::bitshl_op>(node))
+  {
+    auto shift = GetConstantValue(node->input(1)->origin());
+    if (shift && *shift < 64 && (uint64_t(1) << *shift) % factor == 0)
+    {
+      return true;
+    }
+    return IsMultipleOf(node->input(0)->origin(), factor);
+  }
+  return false;
+}
+
+/**
+ * Determines the bank accessed by \p index if it is the same for all values of \p index.
+ *
+ * \return The bank, or std::nullopt if the access requires a crossbar.
+ */
+static std::optional<size_t>
+GetStaticBank(
+    const jlm::rvsdg::output * index,
+    LocalMemoryPartitioning::Scheme scheme,
+    size_t factor,
+    size_t bankSize)
+{
+  if (auto value = GetConstantValue(index))
+  {
+    return scheme == LocalMemoryPartitioning::Scheme::Cyclic ? *value % factor : *value / bankSize;
+  }
+  if (scheme != LocalMemoryPartitioning::Scheme::Cyclic)
+  {
+    return std::nullopt;
+  }
+
+  // i * factor + c
+  if (IsMultipleOf(index, factor))
+  {
+    return 0;
+  }
+  auto node = jlm::rvsdg::output::GetNode(*index);
+  if (node && jlm::rvsdg::is<jlm::rvsdg::bitadd_op>(node))
+  {
+    for (size_t n = 0; n < 2; n++)
+    {
+      auto offset = GetConstantValue(node->input(n)->origin());
+      if (offset && IsMultipleOf(node->input(1 - n)->origin(), factor))
+      {
+        return *offset % factor;
+      }
+    }
+  }
+  return std::nullopt;
+}
+
+static bool
+IsPowerOfTwo(size_t value)
+{
+  return value != 0 && (value & (value - 1)) == 0;
+}
+
+static size_t
+Log2(size_t value)
+{
+  size_t log = 0;
+  while (value >>= 1)
+  {
+    log++;
+  }
+  return log;
+}
+
+/**
+ * Creates index / divisor, or index % divisor if \p remainder is true.
+ */
+static jlm::rvsdg::output *
+CreateDivision(jlm::rvsdg::output & index, size_t divisor, bool remainder)
+{
+  auto region = index.region();
+  auto nbits = jlm::util::AssertedCast<const jlm::rvsdg::bittype>(&index.type())->nbits();
+  if (auto value = GetConstantValue(&index))
+  {
+    return jlm::rvsdg::create_bitconstant(
+        region,
+        nbits,
+        remainder ? *value % divisor : *value / divisor);
+  }
+
+  if (IsPowerOfTwo(divisor))
+  {
+    if (remainder)
+    {
+      auto mask = jlm::rvsdg::create_bitconstant(region, nbits, divisor - 1);
+      return jlm::rvsdg::simple_node::create_normalized(
+          region,
+          jlm::rvsdg::bitand_op(nbits),
+          { &index, mask })[0];
+    }
+    auto shift = jlm::rvsdg::create_bitconstant(region, nbits, Log2(divisor));
+    return jlm::rvsdg::simple_node::create_normalized(
+        region,
+        jlm::rvsdg::bitshr_op(nbits),
+        { &index, shift })[0];
+  }
+
+  auto constant = jlm::rvsdg::create_bitconstant(region, nbits, divisor);
+  if (remainder)
+  {
+    return jlm::rvsdg::simple_node::create_normalized(
+        region,
+        jlm::rvsdg::bitumod_op(nbits),
+        { &index, constant })[0];
+  }
+  return jlm::rvsdg::simple_node::create_normalized(
+      region,
+      jlm::rvsdg::bitudiv_op(nbits),
+      { &index, constant })[0];
+}
+
+/**
+ * Creates the index within the bank of element \p index.
+ */
+static jlm::rvsdg::output *
+CreateBankOffset(
+    jlm::rvsdg::output & index,
+    LocalMemoryPartitioning::Scheme scheme,
+    size_t factor,
+    size_t bankSize)
+{
+  if (scheme == LocalMemoryPartitioning::Scheme::Cyclic)
+  {
+    return CreateDivision(index, factor, false);
+  }
+  return CreateDivision(index, bankSize, true);
+}
+
+/**
+ * Creates a predicate selecting the bank of element \p index.
+ */
+static jlm::rvsdg::output *
+CreateBankSelect(
+    jlm::rvsdg::output & index,
+    LocalMemoryPartitioning::Scheme scheme,
+    size_t factor,
+    size_t bankSize)
+{
+  auto bank = scheme == LocalMemoryPartitioning::Scheme::Cyclic
+                ? CreateDivision(index, factor, true)
+                : CreateDivision(index, bankSize, false);
+  auto nbits = jlm::util::AssertedCast<const jlm::rvsdg::bittype>(&index.type())->nbits();
+  std::unordered_map<uint64_t, uint64_t> mapping;
+  for (size_t n = 0; n < factor - 1; n++)
+  {
+    mapping[n] = n;
+  }
+  return jlm::rvsdg::match(nbits, mapping, factor - 1, factor, bank);
+}
+
+/**
+ * Resolves Scheme::Automatic and invalid factors of \p partitioning for an array with
+ * \p nelements elements that is accessed with \p indices.
+ */
+static LocalMemoryPartitioning
+ResolvePartitioning(
+    const LocalMemoryPartitioning & partitioning,
+    size_t nelements,
+    const std::vector<jlm::rvsdg::output *> & indices)
+{
+  using Scheme = LocalMemoryPartitioning::Scheme;
+
+  LocalMemoryPartitioning resolved;
+  if (partitioning.PartitionScheme != Scheme::Automatic)
+  {
+    resolved = partitioning;
+    resolved.Factor = std::min(partitioning.Factor, nelements);
+    if (resolved.PartitionScheme == Scheme::None || resolved.Factor <= 1)
+    {
+      resolved.PartitionScheme = Scheme::None;
+      resolved.Factor = 1;
+    }
+    return resolved;
+  }
+
+  size_t bestNumBanks = 1;
+  for (auto scheme : { Scheme::Cyclic, Scheme::Block })
+  {
+    for (size_t factor = 2; factor <= std::min(partitioning.MaxFactor, nelements); factor *= 2)
+    {
+      auto bankSize = (nelements + factor - 1) / factor;
+      std::unordered_set<size_t> banks;
+      bool isStatic = true;
+      for (auto index : indices)
+      {
+        auto bank = GetStaticBank(index, scheme, factor, bankSize);
+        if (!bank)
+        {
+          isStatic = false;
+          break;
+        }
+        banks.insert(*bank);
+      }
+      if (isStatic && banks.size() > bestNumBanks)
+      {
+        bestNumBanks = banks.size();
+        resolved.PartitionScheme = scheme;
+        resolved.Factor = factor;
+      }
+    }
+  }
+  return resolved;
+}
+
+/**
+ * The memory, response, and request operands of a single bank of a partitioned array.
+ */
+struct MemoryBank
+{
+  std::vector<jlm::rvsdg::output *> mem_outs;
+  std::vector<jlm::rvsdg::output *> resp_outs;
+  std::vector<jlm::rvsdg::output *> load_addrs;
+  std::vector<jlm::rvsdg::output *> store_operands;
+};
+
 void
-alloca_conv(rvsdg::Region * region)
+alloca_conv(rvsdg::Region * region, const LocalMemoryPartitioning & partitioning)
 {
   for (auto & node : jlm::rvsdg::topdown_traverser(region))
   {
@@ -124,7 +390,7 @@ alloca_conv(rvsdg::Region * region)
     {
       for (size_t n = 0; n < structnode->nsubregions(); n++)
       {
-        alloca_conv(structnode->subregion(n));
+        alloca_conv(structnode->subregion(n), partitioning);
       }
     }
     else if (auto po = dynamic_cast<const jlm::llvm::alloca_op *>(&(node->operation())))
@@ -142,18 +408,72 @@ alloca_conv(rvsdg::Region * region)
       JLM_ASSERT(at);
       // detect loads and stores attached to alloca
       TraceAllocaUses ta(node->output(0));
+      // determine the banks of the array
+      std::vector<jlm::rvsdg::output *> indices;
+      for (auto l : ta.load_nodes)
+      {
+        indices.push_back(gep_to_index(l->input(0)->origin()));
+      }
+      for (auto s : ta.store_nodes)
+      {
+        indices.push_back(gep_to_index(s->input(0)->origin()));
+      }
+      auto resolved = ResolvePartitioning(partitioning, at->nelements(), indices);
+      auto scheme = resolved.PartitionScheme;
+      auto factor = resolved.Factor;
+      auto bankSize = (at->nelements() + factor - 1) / factor;
+      std::vector<std::optional<size_t>> accessBanks;
+      for (auto index : indices)
+      {
+        accessBanks.push_back(factor == 1 ? 0 : GetStaticBank(index, scheme, factor, bankSize));
+      }
       // create memory + response
-      auto mem_outs = local_mem_op::create(at, node->region());
-      auto resp_outs = local_mem_resp_op::create(*mem_outs[0], ta.load_nodes.size());
+      std::vector<MemoryBank> banks(factor);
+      for (size_t b = 0; b < factor; b++)
+      {
+        size_t loads = 0;
+        for (size_t n = 0; n < ta.load_nodes.size(); n++)
+        {
+          if (!accessBanks[n] || *accessBanks[n] == b)
+          {
+            loads++;
+          }
+        }
+        auto bank_type = jlm::llvm::arraytype::Create(at->GetElementType(), bankSize);
+        banks[b].mem_outs = local_mem_op::create(bank_type, node->region());
+        banks[b].resp_outs = local_mem_resp_op::create(*banks[b].mem_outs[0], loads);
+      }
       std::cout << "alloca converted " << at->debug_string() << std::endl;
       // replace gep outputs (convert pointer to index calculation)
       // replace loads and stores
-      std::vector<jlm::rvsdg::output *> load_addrs;
-      for (auto l : ta.load_nodes)
+      for (size_t n = 0; n < ta.load_nodes.size(); n++)
       {
-        auto index = gep_to_index(l->input(0)->origin());
-        auto response = route_response(l->region(), resp_outs.front());
-        resp_outs.erase(resp_outs.begin());
+        auto l = ta.load_nodes[n];
+        auto index = indices[n];
+        jlm::rvsdg::output * select = nullptr;
+        jlm::rvsdg::output * response = nullptr;
+        if (factor > 1)
+        {
+          if (!accessBanks[n])
+          {
+            // crossbar: the response is selected by the bank of the index
+            select = CreateBankSelect(*index, scheme, factor, bankSize);
+            std::vector<jlm::rvsdg::output *> responses;
+            for (auto & bank : banks)
+            {
+              responses.push_back(route_response(l->region(), bank.resp_outs.front()));
+              bank.resp_outs.erase(bank.resp_outs.begin());
+            }
+            response = mux_op::create(*select, responses, false)[0];
+          }
+          index = CreateBankOffset(*index, scheme, factor, bankSize);
+        }
+        if (response == nullptr)
+        {
+          auto & bank = banks[*accessBanks[n]];
+          response = route_response(l->region(), bank.resp_outs.front());
+          bank.resp_outs.erase(bank.resp_outs.begin());
+        }
         std::vector<jlm::rvsdg::output *> states;
         for (size_t i = 1; i < l->ninputs(); ++i)
         {
@@ -166,13 +486,34 @@ alloca_conv(rvsdg::Region * region)
           l->output(i)->divert_users(nn->output(i));
         }
         remove(l);
-        auto addr = route_request(node->region(), load_outs.back());
-        load_addrs.push_back(addr);
+        if (select)
+        {
+          auto addrs = branch_op::create(*select, *load_outs.back());
+          for (size_t b = 0; b < factor; b++)
+          {
+            banks[b].load_addrs.push_back(route_request(node->region(), addrs[b]));
+          }
+        }
+        else
+        {
+          auto addr = route_request(node->region(), load_outs.back());
+          banks[*accessBanks[n]].load_addrs.push_back(addr);
+        }
       }
-      std::vector<jlm::rvsdg::output *> store_operands;
-      for (auto s : ta.store_nodes)
+      for (size_t n = 0; n < ta.store_nodes.size(); n++)
       {
-        auto index = gep_to_index(s->input(0)->origin());
+        auto s = ta.store_nodes[n];
+        auto index = indices[ta.load_nodes.size() + n];
+        auto storeBank = accessBanks[ta.load_nodes.size() + n];
+        jlm::rvsdg::output * select = nullptr;
+        if (factor > 1)
+        {
+          if (!storeBank)
+          {
+            select = CreateBankSelect(*index, scheme, factor, bankSize);
+          }
+          index = CreateBankOffset(*index, scheme, factor, bankSize);
+        }
         std::vector<jlm::rvsdg::output *> states;
         for (size_t i = 2; i < s->ninputs(); ++i)
         {
@@ -185,15 +526,33 @@ alloca_conv(rvsdg::Region * region)
           s->output(i)->divert_users(nn->output(i));
         }
         remove(s);
-        auto addr = route_request(node->region(), store_outs[store_outs.size() - 2]);
-        auto data = route_request(node->region(), store_outs.back());
-        store_operands.push_back(addr);
-        store_operands.push_back(data);
+        if (select)
+        {
+          // crossbar: address and data are steered to the bank of the index
+          auto addrs = branch_op::create(*select, *store_outs[store_outs.size() - 2]);
+          auto datas = branch_op::create(*select, *store_outs.back());
+          for (size_t b = 0; b < factor; b++)
+          {
+            banks[b].store_operands.push_back(route_request(node->region(), addrs[b]));
+            banks[b].store_operands.push_back(route_request(node->region(), datas[b]));
+          }
+        }
+        else
+        {
+          auto addr = route_request(node->region(), store_outs[store_outs.size() - 2]);
+          auto data = route_request(node->region(), store_outs.back());
+          banks[*storeBank].store_operands.push_back(addr);
+          banks[*storeBank].store_operands.push_back(data);
+        }
       }
       // TODO: ensure that loads/stores are either alloca or global, never both
       // TODO: ensure that loads/stores have same width and alignment and geps can be merged -
       // otherwise slice? create request
-      auto req_outs = local_mem_req_op::create(*mem_outs[1], load_addrs, store_operands);
+      for (auto & bank : banks)
+      {
+        JLM_ASSERT(bank.resp_outs.empty());
+        local_mem_req_op::create(*bank.mem_outs[1], bank.load_addrs, bank.store_operands);
+      }
 
       // remove alloca from memstate merge
       // TODO: handle general case of other nodes getting state edge without a merge
@@ -225,11 +584,23 @@ alloca_conv(rvsdg::Region * region)
 }
 
 void
-alloca_conv(jlm::llvm::RvsdgModule & rm)
+alloca_conv(rvsdg::Region * region)
+{
+  alloca_conv(region, LocalMemoryPartitioning());
+}
+
+void
+alloca_conv(jlm::llvm::RvsdgModule & rm, const LocalMemoryPartitioning & partitioning)
 {
   auto & graph = rm.Rvsdg();
   auto root = graph.root();
-  alloca_conv(root);
+  alloca_conv(root, partitioning);
+}
+
+void
+alloca_conv(jlm::llvm::RvsdgModule & rm)
+{
+  alloca_conv(rm, LocalMemoryPartitioning());
 }
 
 } // namespace jlm::hls
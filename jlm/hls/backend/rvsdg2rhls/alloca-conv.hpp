@@ -12,9 +12,63 @@
 namespace jlm::hls
 {
 
+/**
+ * Describes how the array of an alloca is split into several local_mem_op banks, each with its
+ * own request and response ports.
+ *
+ * Accesses whose bank can be determined statically from their GEP index are connected to their
+ * bank only. All other accesses are routed through a crossbar, i.e., a branch_op for the requests
+ * and a mux_op for the responses, selected by the bank of the index.
+ */
+struct LocalMemoryPartitioning
+{
+  enum class Scheme
+  {
+    /**
+     * The array is kept in a single local_mem_op.
+     */
+    None,
+
+    /**
+     * Element i is placed in bank i % Factor.
+     */
+    Cyclic,
+
+    /**
+     * Consecutive elements are placed in the same bank, i.e., element i is placed in bank
+     * i / ceil(N / Factor) for an array with N elements.
+     */
+    Block,
+
+    /**
+     * Selects the scheme and factor that distribute the accesses over the most banks without
+     * requiring a crossbar. Arrays for which no such partitioning exists are not partitioned.
+     */
+    Automatic
+  };
+
+  Scheme PartitionScheme = Scheme::None;
+
+  /**
+   * Number of banks for Scheme::Cyclic and Scheme::Block.
+   */
+  size_t Factor = 1;
+
+  /**
+   * Upper bound for the number of banks selected by Scheme::Automatic.
+   */
+  size_t MaxFactor = 8;
+};
+
+void
+alloca_conv(rvsdg::Region * region, const LocalMemoryPartitioning & partitioning);
+
 void
 alloca_conv(rvsdg::Region * region);
 
+void
+alloca_conv(llvm::RvsdgModule & rm, const LocalMemoryPartitioning & partitioning);
+
 void
 alloca_conv(llvm::RvsdgModule & rm);
 
@@ -18,6 +18,8 @@
 #include <jlm/rvsdg/traverser.hpp>
 #include <jlm/rvsdg/view.hpp>
 
+#include <algorithm>
+
 jlm::rvsdg::output *
 jlm::hls::route_response(rvsdg::Region * target, jlm::rvsdg::output * response)
 {
@@ -552,8 +554,44 @@ jlm::hls::TracePointerArguments(
   }
 }
 
+/**
+ * Distributes the loads of ports without stores and decoupled loads round-robin over up to
+ * \p numReadPorts ports. Loads that do not share a store cannot conflict, so their requests do not
+ * need to be ordered by a single port.
+ */
+static void
+ReplicateReadOnlyPorts(jlm::hls::port_load_store_decouple & portNodes, size_t numReadPorts)
+{
+  jlm::hls::port_load_store_decouple replicatedPorts;
+  for (auto & portNode : portNodes)
+  {
+    auto & loadNodes = std::get<0>(portNode);
+    auto numPorts = std::min(numReadPorts, loadNodes.size());
+    if (numPorts < 2 || !std::get<1>(portNode).empty() || !std::get<2>(portNode).empty())
+    {
+      replicatedPorts.push_back(portNode);
+      continue;
+    }
+
+    auto firstPort = replicatedPorts.size();
+    replicatedPorts.resize(firstPort + numPorts);
+    for (size_t n = 0; n < loadNodes.size(); n++)
+    {
+      std::get<0>(replicatedPorts[firstPort + n % numPorts]).push_back(loadNodes[n]);
+    }
+  }
+
+  portNodes = std::move(replicatedPorts);
+}
+
 void
 jlm::hls::MemoryConverter(jlm::llvm::RvsdgModule & rm)
+{
+  MemoryConverter(rm, 1);
+}
+
+void
+jlm::hls::MemoryConverter(jlm::llvm::RvsdgModule & rm, size_t numReadPorts)
 {
   //
   // Replacing memory nodes with nodes that have explicit memory ports requires arguments and
@@ -589,6 +627,7 @@ jlm::hls::MemoryConverter(jlm::llvm::RvsdgModule & rm)
   //
   port_load_store_decouple portNodes;
   TracePointerArguments(lambda, portNodes);
+  ReplicateReadOnlyPorts(portNodes, numReadPorts);
 
   auto responseTypePtr = get_mem_res_type(jlm::rvsdg::bittype::Create(64));
   auto requestTypePtr = get_mem_req_type(jlm::rvsdg::bittype::Create(64), false);
@@ -30,6 +30,19 @@ TracePointerArguments(const llvm::lambda::node * lambda, port_load_store_decoupl
 void
 MemoryConverter(llvm::RvsdgModule & rm);
 
+/**
+ * Replaces the loads and stores of the lambda with nodes that are connected to explicit memory
+ * request and response ports. Every pointer argument receives its own port. The loads of pointer
+ * arguments that are never stored to are distributed over up to \p numReadPorts ports, such that
+ * independent loads, e.g., of the copies of an unrolled loop body, issue their requests in
+ * parallel.
+ *
+ * @param rm The module with the lambda to be converted
+ * @param numReadPorts The maximum number of ports of a read-only pointer argument
+ */
+void
+MemoryConverter(llvm::RvsdgModule & rm, size_t numReadPorts);
+
 /**
  * @param lambda The lambda node for wich the load and store operations are to be connected to
  * response (argument) ports
@@ -14,9 +14,11 @@
 #include <jlm/hls/backend/rvsdg2rhls/distribute-constants.hpp>
 #include <jlm/hls/backend/rvsdg2rhls/GammaConversion.hpp>
 #include <jlm/hls/backend/rvsdg2rhls/instrument-ref.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/LoopUnrolling.hpp>
 #include <jlm/hls/backend/rvsdg2rhls/mem-conv.hpp>
 #include <jlm/hls/backend/rvsdg2rhls/mem-queue.hpp>
 #include <jlm/hls/backend/rvsdg2rhls/mem-sep.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/MemoryCoalescing.hpp>
 #include <jlm/hls/backend/rvsdg2rhls/memstate-conv.hpp>
 #include <jlm/hls/backend/rvsdg2rhls/merge-gamma.hpp>
 #include <jlm/hls/backend/rvsdg2rhls/remove-redundant-buf.hpp>
@@ -24,7 +26,9 @@
 #include <jlm/hls/backend/rvsdg2rhls/rhls-dne.hpp>
 #include <jlm/hls/backend/rvsdg2rhls/rvsdg2rhls.hpp>
 #include <jlm/hls/backend/rvsdg2rhls/ThetaConversion.hpp>
+#include <jlm/hls/opt/BitwidthMinimization.hpp>
 #include <jlm/hls/opt/cne.hpp>
+#include <jlm/hls/opt/ResourceSharing.hpp>
 #include <jlm/hls/util/view.hpp>
 #include <jlm/llvm/backend/jlm2llvm/jlm2llvm.hpp>
 #include <jlm/llvm/backend/rvsdg2jlm/rvsdg2jlm.hpp>
@@ -410,34 +414,70 @@ rvsdg2ref(llvm::RvsdgModule & rhls, std::string path)
 
 void
 rvsdg2rhls(llvm::RvsdgModule & rhls)
+{
+  util::StatisticsCollector statisticsCollector;
+  rvsdg2rhls(rhls, statisticsCollector);
+}
+
+void
+rvsdg2rhls(llvm::RvsdgModule & rhls, util::StatisticsCollector & statisticsCollector)
+{
+  rvsdg2rhls(rhls, statisticsCollector, RhlsConfiguration());
+}
+
+BufferSizingReport
+rvsdg2rhls(
+    llvm::RvsdgModule & rhls,
+    util::StatisticsCollector & statisticsCollector,
+    const RhlsConfiguration & configuration)
 {
   pre_opt(rhls);
   merge_gamma(rhls);
-  util::StatisticsCollector statisticsCollector;
   llvm::DeadNodeElimination llvmDne;
   llvmDne.run(rhls, statisticsCollector);
+  UnrollConfiguration unrollConfiguration;
+  unrollConfiguration.MaxFactor = configuration.MaxUnrollFactor;
+  UnrollLoops(rhls, unrollConfiguration);
 
   mem_sep_argument(rhls);
   remove_unused_state(rhls);
   // main conversion steps
   distribute_constants(rhls);
+  if (configuration.MinimizeBitwidths)
+  {
+    hls::BitwidthMinimization bitwidthMinimization;
+    bitwidthMinimization.run(rhls, statisticsCollector);
+  }
   ConvertGammaNodes(rhls);
   ConvertThetaNodes(rhls);
   hls::cne hlsCne;
   hlsCne.run(rhls, statisticsCollector);
   // rhls optimization
   dne(rhls);
-  alloca_conv(rhls);
+  if (configuration.ShareResources)
+  {
+    hls::ResourceSharing resourceSharing;
+    resourceSharing.run(rhls, statisticsCollector);
+  }
+  LocalMemoryPartitioning partitioning;
+  if (configuration.PartitionLocalMemories)
+    partitioning.PartitionScheme = LocalMemoryPartitioning::Scheme::Automatic;
+  alloca_conv(rhls, partitioning);
   mem_queue(rhls);
-  MemoryConverter(rhls);
+  // Additional read ports only pay off for the copies of unrolled loop bodies
+  MemoryConverter(rhls, configuration.MaxUnrollFactor > 1 ? unrollConfiguration.NumMemoryPorts : 1);
+  if (configuration.CoalesceLoads)
+    CoalesceDecoupledLoads(rhls, BurstConfiguration());
   memstate_conv(rhls);
   remove_redundant_buf(rhls);
   // enforce 1:1 input output relationship
   add_sinks(rhls);
   add_forks(rhls);
-  add_buffers(rhls, true);
+  auto bufferSizingReport = add_buffers(rhls, true, configuration.BufferSizing);
   // ensure that all rhls rules are met
   check_rhls(rhls);
+
+  return bufferSizingReport;
 }
 
 void
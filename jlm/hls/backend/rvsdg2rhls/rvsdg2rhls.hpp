@@ -6,10 +6,12 @@
 #ifndef JLM_HLS_BACKEND_RVSDG2RHLS_RVSDG2RHLS_HPP
 #define JLM_HLS_BACKEND_RVSDG2RHLS_RVSDG2RHLS_HPP
 
+#include <jlm/hls/backend/rvsdg2rhls/add-buffers.hpp>
 #include <jlm/llvm/ir/operators/operators.hpp>
 #include <jlm/llvm/ir/RvsdgModule.hpp>
 #include <jlm/rvsdg/bitstring/constant.hpp>
 #include <jlm/rvsdg/node.hpp>
+#include <jlm/util/Statistics.hpp>
 
 namespace jlm::hls
 {
@@ -22,9 +24,67 @@ is_constant(const jlm::rvsdg::node * node)
       || jlm::rvsdg::is<jlm::rvsdg::ctlconstant_op>(node);
 }
 
+/**
+ * Selects the optional transformations of the conversion to RHLS.
+ */
+struct RhlsConfiguration
+{
+  /**
+   * Coalesce unit-stride loads inside loops into burst requests, see CoalesceDecoupledLoads. The
+   * resulting circuit can only be simulated with the RhlsSimulator, as RhlsToFirrtlConverter does
+   * not support burst loads.
+   */
+  bool CoalesceLoads = false;
+
+  /**
+   * Narrow the datapaths to the ranges of their values, see BitwidthMinimization.
+   */
+  bool MinimizeBitwidths = false;
+
+  /**
+   * Share expensive operators across exclusive branches, see ResourceSharing.
+   */
+  bool ShareResources = false;
+
+  /**
+   * Partition local memories into banks with LocalMemoryPartitioning::Scheme::Automatic, see
+   * alloca_conv.
+   */
+  bool PartitionLocalMemories = false;
+
+  /**
+   * Largest factor by which innermost loops are unrolled, see UnrollLoops. A value of one disables
+   * unrolling.
+   */
+  size_t MaxUnrollFactor = 1;
+
+  /**
+   * Parameters for sizing the buffers inserted into the circuit, see add_buffers.
+   */
+  BufferSizingConfiguration BufferSizing;
+};
+
 void
 rvsdg2rhls(llvm::RvsdgModule & rm);
 
+void
+rvsdg2rhls(llvm::RvsdgModule & rm, util::StatisticsCollector & statisticsCollector);
+
+/**
+ * Converts the RVSDG of \p rm to RHLS.
+ *
+ * @param rm The module to be converted.
+ * @param statisticsCollector The collector for the statistics of the applied transformations.
+ * @param configuration The optional transformations and their parameters.
+ *
+ * \return A summary of the buffers inserted into the circuit.
+ */
+BufferSizingReport
+rvsdg2rhls(
+    llvm::RvsdgModule & rm,
+    util::StatisticsCollector & statisticsCollector,
+    const RhlsConfiguration & configuration);
+
 void
 rvsdg2ref(llvm::RvsdgModule & rm, std::string path);
 
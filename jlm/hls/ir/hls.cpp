@@ -203,7 +203,7 @@ get_mem_req_type(std::shared_ptr<const rvsdg::ValueType> elementType, bool write
     elements.emplace_back("data", std::move(elementType));
     elements.emplace_back("write", jlm::rvsdg::bittype::Create(1));
   }
-  return std::make_shared<bundletype>(std::move(elements));
+  return rvsdg::InternType(std::make_shared<const bundletype>(std::move(elements)));
 }
 
 std::shared_ptr<const bundletype>
@@ -212,6 +212,6 @@ get_mem_res_type(std::shared_ptr<const jlm::rvsdg::ValueType> dataType)
   std::vector<std::pair<std::string, std::shared_ptr<const jlm::rvsdg::Type>>> elements;
   elements.emplace_back("data", std::move(dataType));
   elements.emplace_back("id", jlm::rvsdg::bittype::Create(8));
-  return std::make_shared<bundletype>(std::move(elements));
+  return rvsdg::InternType(std::make_shared<const bundletype>(std::move(elements)));
 }
 }
@@ -14,6 +14,7 @@
 #include <jlm/rvsdg/substitution.hpp>
 #include <jlm/util/common.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
@@ -584,6 +585,94 @@ public:
   }
 };
 
+/**
+ * Pass-through node that counts the handshakes of the channel it is inserted into. The count is
+ * exposed as an additional output port of the generated circuit.
+ */
+class perf_counter_op final : public jlm::rvsdg::simple_op
+{
+public:
+  enum class counter_kind
+  {
+    /**
+     * Counts the tokens transferred over the channel.
+     */
+    iterations,
+
+    /**
+     * Counts the cycles in which a token is offered, but not accepted.
+     */
+    stalls
+  };
+
+  ~perf_counter_op() noexcept override = default;
+
+  perf_counter_op(
+      const std::shared_ptr<const jlm::rvsdg::Type> & type,
+      counter_kind kind,
+      size_t id,
+      std::string name)
+      : jlm::rvsdg::simple_op({ type }, { type }),
+        Kind_(kind),
+        Id_(id),
+        Name_(std::move(name))
+  {}
+
+  bool
+  operator==(const jlm::rvsdg::operation &) const noexcept override
+  {
+    return false; // counters are intentionally distinct
+  }
+
+  std::string
+  debug_string() const override
+  {
+    return util::strfmt("HLS_PERF_", Kind_ == counter_kind::iterations ? "ITER_" : "STALL_", Id_);
+  }
+
+  std::unique_ptr<jlm::rvsdg::operation>
+  copy() const override
+  {
+    return std::unique_ptr<jlm::rvsdg::operation>(new perf_counter_op(*this));
+  }
+
+  [[nodiscard]] counter_kind
+  kind() const noexcept
+  {
+    return Kind_;
+  }
+
+  /**
+   * \return The number of the counter, which determines the name of its output port.
+   */
+  [[nodiscard]] size_t
+  id() const noexcept
+  {
+    return Id_;
+  }
+
+  /**
+   * \return A description of the counted channel for reports.
+   */
+  [[nodiscard]] const std::string &
+  name() const noexcept
+  {
+    return Name_;
+  }
+
+  static std::vector<jlm::rvsdg::output *>
+  create(jlm::rvsdg::output & value, counter_kind kind, size_t id, std::string name)
+  {
+    perf_counter_op op(value.Type(), kind, id, std::move(name));
+    return jlm::rvsdg::simple_node::create_normalized(value.region(), op, { &value });
+  }
+
+private:
+  counter_kind Kind_;
+  size_t Id_;
+  std::string Name_;
+};
+
 class loop_op final : public jlm::rvsdg::structural_op
 {
 public:
@@ -980,7 +1069,8 @@ public:
     // TODO:
     auto ot = dynamic_cast<const addr_queue_op *>(&other);
     // check predicate and value
-    return ot && *ot->argument(1) == *argument(1) && ot->narguments() == narguments();
+    return ot && *ot->argument(1) == *argument(1) && ot->narguments() == narguments()
+        && ot->combinatorial == combinatorial && ot->capacity == capacity;
   }
 
   static std::vector<std::shared_ptr<const jlm::rvsdg::Type>>
@@ -1047,7 +1137,8 @@ public:
   {
     auto ot = dynamic_cast<const state_gate_op *>(&other);
     // check predicate and value
-    return ot && *ot->argument(1) == *argument(1) && ot->narguments() == narguments();
+    return ot && ot->narguments() == narguments()
+        && (narguments() < 2 || *ot->argument(1) == *argument(1));
   }
 
   static std::vector<std::shared_ptr<const jlm::rvsdg::Type>>
@@ -1154,6 +1245,125 @@ public:
   }
 };
 
+/**
+ * Decoupled load that coalesces consecutive accesses to the same memory line.
+ *
+ * Every address selects an element of the aligned line of burstLength elements it falls into. A
+ * burst request for the whole line is only issued if the address leaves the line of the previous
+ * address, or if it is the first address after the loop was entered. The latter is signalled by
+ * the loop predicate that accompanies every address, and ensures that no line fetched in a
+ * previous execution of the loop is reused. The line is returned in 64 bit beats, which are
+ * collected in an unpacking buffer of up to depth lines, from which the elements are served in the
+ * order of their addresses.
+ *
+ * Inputs: address, memory data, loop predicate. Outputs: data, memory request.
+ */
+class burst_load_op final : public jlm::rvsdg::simple_op
+{
+public:
+  ~burst_load_op() noexcept override = default;
+
+  burst_load_op(
+      const std::shared_ptr<const rvsdg::bittype> & loadedType,
+      size_t burstLength,
+      size_t depth)
+      : simple_op(
+          { llvm::PointerType::Create(),
+            GetBeatType(*loadedType, burstLength),
+            rvsdg::ControlType::Create(2) },
+          { loadedType, llvm::PointerType::Create() }),
+        BurstLength_(burstLength),
+        Depth_(depth)
+  {
+    JLM_ASSERT(burstLength > 1 && (burstLength & (burstLength - 1)) == 0);
+    // the line that is currently consumed occupies one entry
+    JLM_ASSERT(depth > 1);
+  }
+
+  bool
+  operator==(const jlm::rvsdg::operation & other) const noexcept override
+  {
+    auto ot = dynamic_cast<const burst_load_op *>(&other);
+    return ot && *ot->result(0) == *result(0) && ot->BurstLength_ == BurstLength_
+        && ot->Depth_ == Depth_;
+  }
+
+  std::string
+  debug_string() const override
+  {
+    return "HLS_BURST_LOAD_" + std::to_string(BurstLength_) + "_" + result(0)->debug_string();
+  }
+
+  std::unique_ptr<jlm::rvsdg::operation>
+  copy() const override
+  {
+    return std::unique_ptr<jlm::rvsdg::operation>(new burst_load_op(*this));
+  }
+
+  static std::vector<jlm::rvsdg::output *>
+  create(
+      jlm::rvsdg::output & addr,
+      jlm::rvsdg::output & response,
+      jlm::rvsdg::output & predicate,
+      const std::shared_ptr<const rvsdg::bittype> & loadedType,
+      size_t burstLength,
+      size_t depth)
+  {
+    burst_load_op op(loadedType, burstLength, depth);
+    return jlm::rvsdg::simple_node::create_normalized(
+        addr.region(),
+        op,
+        { &addr, &response, &predicate });
+  }
+
+  /**
+   * \return The type of the beats in which a line of \p burstLength elements of \p loadedType
+   * is returned by the memory.
+   */
+  static std::shared_ptr<const rvsdg::bittype>
+  GetBeatType(const rvsdg::bittype & loadedType, size_t burstLength)
+  {
+    return rvsdg::bittype::Create(std::min<size_t>(loadedType.nbits() * burstLength, 64));
+  }
+
+  [[nodiscard]] std::shared_ptr<const rvsdg::bittype>
+  GetLoadedType() const noexcept
+  {
+    return std::dynamic_pointer_cast<const rvsdg::bittype>(result(0));
+  }
+
+  /**
+   * \return The type of a whole line, which determines the size of the burst requests.
+   */
+  [[nodiscard]] std::shared_ptr<const rvsdg::bittype>
+  GetLineType() const
+  {
+    return rvsdg::bittype::Create(GetLoadedType()->nbits() * BurstLength_);
+  }
+
+  [[nodiscard]] size_t
+  GetNumBeats() const noexcept
+  {
+    return (GetLoadedType()->nbits() * BurstLength_ + 63) / 64;
+  }
+
+  [[nodiscard]] size_t
+  GetBurstLength() const noexcept
+  {
+    return BurstLength_;
+  }
+
+  [[nodiscard]] size_t
+  GetDepth() const noexcept
+  {
+    return Depth_;
+  }
+
+private:
+  size_t BurstLength_;
+  size_t Depth_;
+};
+
 class mem_resp_op final : public jlm::rvsdg::simple_op
 {
 public:
@@ -1170,7 +1380,7 @@ public:
     // TODO:
     auto ot = dynamic_cast<const mem_resp_op *>(&other);
     // check predicate and value
-    return ot && *ot->argument(1) == *argument(1) && ot->narguments() == narguments();
+    return ot && *ot->argument(0) == *argument(0) && ot->nresults() == nresults();
   }
 
   static std::vector<std::shared_ptr<const jlm::rvsdg::Type>>
@@ -1256,8 +1466,9 @@ public:
     auto ot = dynamic_cast<const mem_req_op *>(&other);
     // check predicate and value
     return ot && ot->narguments() == narguments()
-        && (ot->narguments() == 0 || (*ot->argument(1) == *argument(1)))
-        && ot->narguments() == narguments();
+        && (ot->narguments() < 2 || (*ot->argument(1) == *argument(1)))
+        && HaveEqualTypes(ot->LoadTypes_, LoadTypes_)
+        && HaveEqualTypes(ot->StoreTypes_, StoreTypes_);
   }
 
   static std::vector<std::shared_ptr<const jlm::rvsdg::Type>>
@@ -1353,6 +1564,23 @@ public:
   }
 
 private:
+  static bool
+  HaveEqualTypes(
+      const std::vector<std::shared_ptr<const rvsdg::Type>> & types1,
+      const std::vector<std::shared_ptr<const rvsdg::Type>> & types2) noexcept
+  {
+    if (types1.size() != types2.size())
+      return false;
+
+    for (size_t n = 0; n < types1.size(); n++)
+    {
+      if (*types1[n] != *types2[n])
+        return false;
+    }
+
+    return true;
+  }
+
   std::vector<std::shared_ptr<const rvsdg::Type>> LoadTypes_;
   std::vector<std::shared_ptr<const rvsdg::Type>> StoreTypes_;
 };
@@ -1500,7 +1728,7 @@ public:
     // TODO:
     auto ot = dynamic_cast<const local_mem_resp_op *>(&other);
     // check predicate and value
-    return ot && *ot->argument(1) == *argument(1) && ot->narguments() == narguments();
+    return ot && *ot->argument(0) == *argument(0) && ot->nresults() == nresults();
   }
 
   static std::vector<std::shared_ptr<const jlm::rvsdg::Type>>
@@ -1707,7 +1935,7 @@ public:
     auto ot = dynamic_cast<const local_mem_req_op *>(&other);
     // check predicate and value
     return ot && ot->narguments() == narguments()
-        && (ot->narguments() == 0 || (*ot->argument(1) == *argument(1)))
+        && (ot->narguments() < 2 || (*ot->argument(1) == *argument(1)))
         && ot->narguments() == narguments();
   }
 
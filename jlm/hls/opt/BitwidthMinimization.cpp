@@ -0,0 +1,882 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/hls/opt/BitwidthMinimization.hpp>
+#include <jlm/llvm/ir/operators/lambda.hpp>
+#include <jlm/llvm/ir/operators/operators.hpp>
+#include <jlm/llvm/ir/operators/sext.hpp>
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/rvsdg/bitstring/arithmetic.hpp>
+#include <jlm/rvsdg/bitstring/comparison.hpp>
+#include <jlm/rvsdg/bitstring/constant.hpp>
+#include <jlm/rvsdg/control.hpp>
+#include <jlm/rvsdg/gamma.hpp>
+#include <jlm/rvsdg/theta.hpp>
+#include <jlm/rvsdg/traverser.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <unordered_set>
+
+namespace jlm::hls
+{
+
+class BitwidthMinimization::Statistics final : public util::Statistics
+{
+public:
+  ~Statistics() override = default;
+
+  explicit Statistics(const util::filepath & sourceFile)
+      : util::Statistics(Statistics::Id::BitwidthMinimization, sourceFile)
+  {}
+
+  void
+  Start() noexcept
+  {
+    AddTimer(Label::Timer).start();
+  }
+
+  void
+  Stop(size_t numNarrowedOperations, size_t numNarrowedLoopVariables, size_t bitsSaved) noexcept
+  {
+    GetTimer(Label::Timer).stop();
+    AddMeasurement("#NarrowedOperations", numNarrowedOperations);
+    AddMeasurement("#NarrowedLoopVariables", numNarrowedLoopVariables);
+    AddMeasurement("#BitsSaved", bitsSaved);
+  }
+
+  static std::unique_ptr<Statistics>
+  Create(const util::filepath & sourceFile)
+  {
+    return std::make_unique<Statistics>(sourceFile);
+  }
+};
+
+/**
+ * \return The number of bits of \p output if it is a bit string with at most 64 bits, otherwise 0.
+ */
+static size_t
+GetNumBits(const rvsdg::output & output)
+{
+  auto bitType = dynamic_cast<const rvsdg::bittype *>(&output.type());
+  if (bitType == nullptr || bitType->nbits() > 64)
+    return 0;
+
+  return bitType->nbits();
+}
+
+/**
+ * \return True if \p range is a single known value.
+ */
+static bool
+IsSingleton(const ValueRange & range)
+{
+  return range.Lower == range.Upper;
+}
+
+ValueRange
+ValueRangeAnalysis::GetRange(const rvsdg::output & output) const
+{
+  auto it = Ranges_.find(&output);
+  if (it != Ranges_.end())
+    return it->second;
+
+  auto nbits = GetNumBits(output);
+  if (nbits == 0)
+    return ValueRange::CreateUnknown();
+
+  return ValueRange::CreateFull(nbits);
+}
+
+static ValueRange
+ComputeBinaryRange(
+    const rvsdg::bitbinary_op & operation,
+    const ValueRange & a,
+    const ValueRange & b,
+    size_t nbits)
+{
+  auto maxValue = ValueRange::GetMaxValue(nbits);
+  auto full = ValueRange::CreateFull(nbits);
+
+  if (dynamic_cast<const rvsdg::bitadd_op *>(&operation))
+  {
+    uint64_t lower = 0, upper = 0;
+    if (__builtin_add_overflow(a.Upper, b.Upper, &upper) || upper > maxValue)
+      return full;
+    lower = a.Lower + b.Lower;
+    return { lower, upper };
+  }
+  else if (dynamic_cast<const rvsdg::bitsub_op *>(&operation))
+  {
+    if (a.Lower < b.Upper)
+      return full;
+    return { a.Lower - b.Upper, a.Upper - b.Lower };
+  }
+  else if (dynamic_cast<const rvsdg::bitmul_op *>(&operation))
+  {
+    uint64_t upper = 0;
+    if (__builtin_mul_overflow(a.Upper, b.Upper, &upper) || upper > maxValue)
+      return full;
+    return { a.Lower * b.Lower, upper };
+  }
+  else if (dynamic_cast<const rvsdg::bitand_op *>(&operation))
+  {
+    return { 0, std::min(a.Upper, b.Upper) };
+  }
+  else if (dynamic_cast<const rvsdg::bitor_op *>(&operation))
+  {
+    auto upper = ValueRange::GetMaxValue(std::max(a.GetRequiredBits(), b.GetRequiredBits()));
+    return { std::max(a.Lower, b.Lower), upper };
+  }
+  else if (dynamic_cast<const rvsdg::bitxor_op *>(&operation))
+  {
+    return { 0, ValueRange::GetMaxValue(std::max(a.GetRequiredBits(), b.GetRequiredBits())) };
+  }
+  else if (dynamic_cast<const rvsdg::bitshr_op *>(&operation))
+  {
+    if (IsSingleton(b) && b.Lower < nbits)
+      return { a.Lower >> b.Lower, a.Upper >> b.Lower };
+    return { 0, a.Upper };
+  }
+  else if (dynamic_cast<const rvsdg::bitshl_op *>(&operation))
+  {
+    if (IsSingleton(b) && b.Lower < nbits && a.Upper <= (maxValue >> b.Lower))
+      return { a.Lower << b.Lower, a.Upper << b.Lower };
+    return full;
+  }
+  else if (dynamic_cast<const rvsdg::bitudiv_op *>(&operation))
+  {
+    if (b.Lower == 0)
+      return { 0, a.Upper };
+    return { a.Lower / b.Upper, a.Upper / b.Lower };
+  }
+  else if (dynamic_cast<const rvsdg::bitumod_op *>(&operation))
+  {
+    return { 0, b.Upper == 0 ? a.Upper : std::min(a.Upper, b.Upper - 1) };
+  }
+
+  return full;
+}
+
+void
+ValueRangeAnalysis::AnalyzeSimpleNode(const rvsdg::simple_node & node)
+{
+  if (node.noutputs() != 1)
+    return;
+
+  auto & output = *node.output(0);
+  auto nbits = GetNumBits(output);
+  if (nbits == 0)
+    return;
+
+  auto & operation = node.operation();
+  if (auto constant = dynamic_cast<const rvsdg::bitconstant_op *>(&operation))
+  {
+    if (constant->value().is_known())
+    {
+      auto value = constant->value().to_uint();
+      SetRange(output, { value, value });
+    }
+  }
+  else if (auto binary = dynamic_cast<const rvsdg::bitbinary_op *>(&operation))
+  {
+    // Normalized associative operations might have more than two operands
+    auto range = GetRange(*node.input(0)->origin());
+    for (size_t n = 1; n < node.ninputs(); n++)
+    {
+      range = ComputeBinaryRange(*binary, range, GetRange(*node.input(n)->origin()), nbits);
+    }
+    SetRange(output, range);
+  }
+  else if (dynamic_cast<const llvm::zext_op *>(&operation))
+  {
+    if (GetNumBits(*node.input(0)->origin()) != 0)
+      SetRange(output, GetRange(*node.input(0)->origin()));
+  }
+  else if (dynamic_cast<const llvm::trunc_op *>(&operation))
+  {
+    if (GetNumBits(*node.input(0)->origin()) == 0)
+      return;
+
+    auto range = GetRange(*node.input(0)->origin());
+    if (range.Upper <= ValueRange::GetMaxValue(nbits))
+      SetRange(output, range);
+  }
+  else if (auto sext = dynamic_cast<const llvm::sext_op *>(&operation))
+  {
+    auto range = GetRange(*node.input(0)->origin());
+    if (sext->nsrcbits() > 1 && range.Upper <= ValueRange::GetMaxValue(sext->nsrcbits() - 1))
+      SetRange(output, range);
+  }
+}
+
+void
+ValueRangeAnalysis::AnalyzeGamma(rvsdg::GammaNode & gammaNode)
+{
+  for (size_t n = 0; n < gammaNode.nentryvars(); n++)
+  {
+    auto entryVar = gammaNode.entryvar(n);
+    auto range = GetRange(*entryVar->origin());
+    for (size_t r = 0; r < gammaNode.nsubregions(); r++)
+    {
+      SetRange(*entryVar->argument(r), range);
+    }
+  }
+
+  for (size_t r = 0; r < gammaNode.nsubregions(); r++)
+  {
+    Analyze(*gammaNode.subregion(r));
+  }
+
+  for (size_t n = 0; n < gammaNode.nexitvars(); n++)
+  {
+    auto exitVar = gammaNode.exitvar(n);
+    auto range = GetRange(*exitVar->result(0)->origin());
+    for (size_t r = 1; r < gammaNode.nsubregions(); r++)
+    {
+      range = range.Union(GetRange(*exitVar->result(r)->origin()));
+    }
+    SetRange(*exitVar, range);
+  }
+}
+
+/**
+ * Relation of a value to a constant.
+ */
+enum class Relation
+{
+  Less,
+  LessEqual,
+  Greater,
+  GreaterEqual,
+  Equal,
+  NotEqual
+};
+
+static Relation
+Negate(Relation relation)
+{
+  switch (relation)
+  {
+  case Relation::Less:
+    return Relation::GreaterEqual;
+  case Relation::LessEqual:
+    return Relation::Greater;
+  case Relation::Greater:
+    return Relation::LessEqual;
+  case Relation::GreaterEqual:
+    return Relation::Less;
+  case Relation::Equal:
+    return Relation::NotEqual;
+  case Relation::NotEqual:
+    return Relation::Equal;
+  }
+
+  JLM_UNREACHABLE("Unhandled relation.");
+}
+
+static Relation
+Swap(Relation relation)
+{
+  switch (relation)
+  {
+  case Relation::Less:
+    return Relation::Greater;
+  case Relation::LessEqual:
+    return Relation::GreaterEqual;
+  case Relation::Greater:
+    return Relation::Less;
+  case Relation::GreaterEqual:
+    return Relation::LessEqual;
+  default:
+    return relation;
+  }
+}
+
+/**
+ * \return The range of the values of \p range that satisfy \p relation with \p constant, or
+ * \p range itself if the result is not an interval or empty.
+ */
+static ValueRange
+Refine(const ValueRange & range, Relation relation, uint64_t constant)
+{
+  ValueRange refined = range;
+  switch (relation)
+  {
+  case Relation::Less:
+    if (constant == 0)
+      return range;
+    refined.Upper = std::min(range.Upper, constant - 1);
+    break;
+  case Relation::LessEqual:
+    refined.Upper = std::min(range.Upper, constant);
+    break;
+  case Relation::Greater:
+    if (constant == UINT64_MAX)
+      return range;
+    refined.Lower = std::max(range.Lower, constant + 1);
+    break;
+  case Relation::GreaterEqual:
+    refined.Lower = std::max(range.Lower, constant);
+    break;
+  case Relation::Equal:
+    refined = { constant, constant };
+    break;
+  case Relation::NotEqual:
+    if (range.Upper == constant && range.Lower < constant)
+      refined.Upper = constant - 1;
+    else if (range.Lower == constant && range.Upper > constant)
+      refined.Lower = constant + 1;
+    break;
+  }
+
+  if (refined.Lower > refined.Upper || refined.Lower < range.Lower || refined.Upper > range.Upper)
+    return range;
+
+  return refined;
+}
+
+/**
+ * Extracts the comparison of a value with a constant that decides whether \p thetaNode performs
+ * another iteration.
+ *
+ * @param thetaNode The theta node.
+ * @param analysis The analysis providing the ranges of the compared values.
+ * @param value Set to the compared value.
+ * @param relation Set to the relation the value satisfies with the constant if the loop
+ * continues.
+ * @param constant Set to the compared constant.
+ *
+ * \return True if the predicate of \p thetaNode is such a comparison, otherwise false.
+ */
+static bool
+GetLoopCondition(
+    const rvsdg::ThetaNode & thetaNode,
+    const ValueRangeAnalysis & analysis,
+    const rvsdg::output *& value,
+    Relation & relation,
+    uint64_t & constant)
+{
+  auto matchNode = rvsdg::output::GetNode(*thetaNode.predicate()->origin());
+  auto matchOperation =
+      matchNode ? dynamic_cast<const rvsdg::match_op *>(&matchNode->operation()) : nullptr;
+  if (matchOperation == nullptr || matchOperation->nalternatives() != 2)
+    return false;
+
+  auto continueIfTrue = matchOperation->alternative(1) == 1;
+  if (continueIfTrue == (matchOperation->alternative(0) == 1))
+    return false;
+
+  auto compareNode = rvsdg::output::GetNode(*matchNode->input(0)->origin());
+  if (compareNode == nullptr || compareNode->ninputs() != 2)
+    return false;
+
+  auto & operation = compareNode->operation();
+  auto lhs = compareNode->input(0)->origin();
+  auto rhs = compareNode->input(1)->origin();
+  auto nbits = GetNumBits(*lhs);
+  if (nbits == 0)
+    return false;
+
+  auto lhsRange = analysis.GetRange(*lhs);
+  auto rhsRange = analysis.GetRange(*rhs);
+  auto swapped = false;
+  if (IsSingleton(rhsRange))
+  {
+    value = lhs;
+    constant = rhsRange.Lower;
+  }
+  else if (IsSingleton(lhsRange))
+  {
+    value = rhs;
+    constant = lhsRange.Lower;
+    swapped = true;
+  }
+  else
+  {
+    return false;
+  }
+
+  // Signed comparisons coincide with unsigned ones if both values are non-negative
+  auto maxSigned = ValueRange::GetMaxValue(nbits - 1);
+  auto isNonNegative = analysis.GetRange(*value).Upper <= maxSigned && constant <= maxSigned;
+
+  if (dynamic_cast<const rvsdg::bitult_op *>(&operation))
+    relation = Relation::Less;
+  else if (dynamic_cast<const rvsdg::bitule_op *>(&operation))
+    relation = Relation::LessEqual;
+  else if (dynamic_cast<const rvsdg::bitugt_op *>(&operation))
+    relation = Relation::Greater;
+  else if (dynamic_cast<const rvsdg::bituge_op *>(&operation))
+    relation = Relation::GreaterEqual;
+  else if (dynamic_cast<const rvsdg::bitslt_op *>(&operation) && isNonNegative)
+    relation = Relation::Less;
+  else if (dynamic_cast<const rvsdg::bitsle_op *>(&operation) && isNonNegative)
+    relation = Relation::LessEqual;
+  else if (dynamic_cast<const rvsdg::bitsgt_op *>(&operation) && isNonNegative)
+    relation = Relation::Greater;
+  else if (dynamic_cast<const rvsdg::bitsge_op *>(&operation) && isNonNegative)
+    relation = Relation::GreaterEqual;
+  else if (dynamic_cast<const rvsdg::biteq_op *>(&operation))
+    relation = Relation::Equal;
+  else if (dynamic_cast<const rvsdg::bitne_op *>(&operation))
+    relation = Relation::NotEqual;
+  else
+    return false;
+
+  if (swapped)
+    relation = Swap(relation);
+  if (!continueIfTrue)
+    relation = Negate(relation);
+
+  return true;
+}
+
+/**
+ * \return The range of the values the result \p result of \p thetaNode carries to the next
+ * iteration.
+ */
+static ValueRange
+GetBackEdgeRange(
+    const rvsdg::ThetaNode & thetaNode,
+    const rvsdg::RegionResult & result,
+    const ValueRangeAnalysis & analysis)
+{
+  auto range = analysis.GetRange(*result.origin());
+
+  const rvsdg::output * value = nullptr;
+  Relation relation = Relation::Equal;
+  uint64_t constant = 0;
+  if (GetLoopCondition(thetaNode, analysis, value, relation, constant)
+      && value == result.origin())
+  {
+    return Refine(range, relation, constant);
+  }
+
+  return range;
+}
+
+/**
+ * Widens \p range to the smallest threshold that covers \p next.
+ */
+static ValueRange
+Widen(
+    const ValueRange & range,
+    const ValueRange & next,
+    const std::vector<uint64_t> & thresholds,
+    size_t nbits)
+{
+  auto widened = range;
+  if (next.Lower < range.Lower)
+    widened.Lower = 0;
+
+  if (next.Upper > range.Upper)
+  {
+    widened.Upper = ValueRange::GetMaxValue(nbits);
+    for (auto threshold : thresholds)
+    {
+      if (threshold >= next.Upper && threshold < widened.Upper)
+        widened.Upper = threshold;
+    }
+  }
+
+  return widened;
+}
+
+void
+ValueRangeAnalysis::AnalyzeTheta(rvsdg::ThetaNode & thetaNode)
+{
+  // The loop predicate can only be evaluated with ranges, so the thresholds are collected lazily
+  std::vector<uint64_t> thresholds;
+  auto collectThresholds = [&]()
+  {
+    const rvsdg::output * value = nullptr;
+    Relation relation = Relation::Equal;
+    uint64_t constant = 0;
+    if (GetLoopCondition(thetaNode, *this, value, relation, constant))
+    {
+      thresholds.push_back(constant);
+      if (constant > 0)
+        thresholds.push_back(constant - 1);
+      if (constant < UINT64_MAX)
+        thresholds.push_back(constant + 1);
+    }
+  };
+
+  std::vector<rvsdg::ThetaInput *> loopVars;
+  for (size_t n = 0; n < thetaNode.ninputs(); n++)
+  {
+    auto input = thetaNode.input(n);
+    if (GetNumBits(*input->argument()) != 0)
+    {
+      loopVars.push_back(input);
+      SetRange(*input->argument(), GetRange(*input->origin()));
+    }
+  }
+
+  // Ascending iterations with widening until a post-fixpoint is reached
+  while (true)
+  {
+    Analyze(*thetaNode.subregion());
+    collectThresholds();
+
+    auto changed = false;
+    for (auto input : loopVars)
+    {
+      auto & argument = *input->argument();
+      auto current = GetRange(argument);
+      auto next = current.Union(GetBackEdgeRange(thetaNode, *input->result(), *this));
+      if (next != current)
+      {
+        SetRange(argument, Widen(current, next, thresholds, GetNumBits(argument)));
+        changed = true;
+      }
+    }
+
+    if (!changed)
+      break;
+  }
+
+  // Descending iterations recover the precision lost by widening
+  for (size_t iteration = 0; iteration < 2; iteration++)
+  {
+    std::vector<ValueRange> ranges;
+    for (auto input : loopVars)
+    {
+      ranges.push_back(GetRange(*input->origin())
+                           .Union(GetBackEdgeRange(thetaNode, *input->result(), *this)));
+    }
+    for (size_t n = 0; n < loopVars.size(); n++)
+    {
+      SetRange(*loopVars[n]->argument(), ranges[n]);
+    }
+    Analyze(*thetaNode.subregion());
+  }
+
+  for (auto input : loopVars)
+  {
+    SetRange(*input->output(), GetRange(*input->result()->origin()));
+  }
+}
+
+void
+ValueRangeAnalysis::Analyze(rvsdg::Region & region)
+{
+  for (auto & node : rvsdg::topdown_traverser(&region))
+  {
+    if (auto simpleNode = dynamic_cast<const rvsdg::simple_node *>(node))
+    {
+      AnalyzeSimpleNode(*simpleNode);
+    }
+    else if (auto gammaNode = dynamic_cast<rvsdg::GammaNode *>(node))
+    {
+      AnalyzeGamma(*gammaNode);
+    }
+    else if (auto thetaNode = dynamic_cast<rvsdg::ThetaNode *>(node))
+    {
+      AnalyzeTheta(*thetaNode);
+    }
+  }
+}
+
+BitwidthMinimization::~BitwidthMinimization() = default;
+
+rvsdg::output *
+BitwidthMinimization::Extend(rvsdg::output & origin, size_t nbits)
+{
+  auto & extended = llvm::zext_op::Create(origin, rvsdg::bittype::Create(nbits));
+  Analysis_.SetRange(extended, Analysis_.GetRange(origin));
+  return &extended;
+}
+
+rvsdg::output *
+BitwidthMinimization::NarrowOperand(rvsdg::output & origin, size_t nbits)
+{
+  auto numOriginBits = GetNumBits(origin);
+  JLM_ASSERT(numOriginBits >= nbits);
+  if (numOriginBits == nbits)
+    return &origin;
+
+  // The low bits of the value suffice for operations whose result does not depend on the high
+  // bits of their operands, so the value itself might not fit
+  auto range = Analysis_.GetRange(origin);
+  auto maxValue = ValueRange::GetMaxValue(nbits);
+  auto narrowedRange = range.Upper <= maxValue ? range : ValueRange::CreateFull(nbits);
+
+  auto node = rvsdg::output::GetNode(origin);
+  if (auto zext = node ? dynamic_cast<const llvm::zext_op *>(&node->operation()) : nullptr)
+  {
+    auto & operand = *node->input(0)->origin();
+    if (zext->nsrcbits() == nbits)
+      return &operand;
+    if (zext->nsrcbits() < nbits)
+      return Extend(operand, nbits);
+  }
+
+  rvsdg::output * narrowed = nullptr;
+  if (node && dynamic_cast<const rvsdg::bitconstant_op *>(&node->operation())
+      && IsSingleton(range))
+  {
+    auto value = range.Lower & maxValue;
+    narrowed = rvsdg::create_bitconstant(origin.region(), nbits, value);
+    narrowedRange = { value, value };
+  }
+  else
+  {
+    narrowed = llvm::trunc_op::create(nbits, &origin);
+  }
+  Analysis_.SetRange(*narrowed, narrowedRange);
+
+  return narrowed;
+}
+
+/**
+ * \return True if the low bits of the result of \p operation only depend on the low bits of its
+ * operands.
+ */
+static bool
+IsTruncationInvariant(const rvsdg::operation & operation)
+{
+  return dynamic_cast<const rvsdg::bitadd_op *>(&operation)
+      || dynamic_cast<const rvsdg::bitsub_op *>(&operation)
+      || dynamic_cast<const rvsdg::bitmul_op *>(&operation)
+      || dynamic_cast<const rvsdg::bitand_op *>(&operation)
+      || dynamic_cast<const rvsdg::bitor_op *>(&operation)
+      || dynamic_cast<const rvsdg::bitxor_op *>(&operation);
+}
+
+static bool
+IsUnsignedNarrowable(const rvsdg::operation & operation)
+{
+  return dynamic_cast<const rvsdg::bitshr_op *>(&operation)
+      || dynamic_cast<const rvsdg::bitshl_op *>(&operation)
+      || dynamic_cast<const rvsdg::bitudiv_op *>(&operation)
+      || dynamic_cast<const rvsdg::bitumod_op *>(&operation)
+      || dynamic_cast<const rvsdg::biteq_op *>(&operation)
+      || dynamic_cast<const rvsdg::bitne_op *>(&operation)
+      || dynamic_cast<const rvsdg::bitult_op *>(&operation)
+      || dynamic_cast<const rvsdg::bitule_op *>(&operation)
+      || dynamic_cast<const rvsdg::bitugt_op *>(&operation)
+      || dynamic_cast<const rvsdg::bituge_op *>(&operation);
+}
+
+static bool
+IsSignedComparison(const rvsdg::operation & operation)
+{
+  return dynamic_cast<const rvsdg::bitslt_op *>(&operation)
+      || dynamic_cast<const rvsdg::bitsle_op *>(&operation)
+      || dynamic_cast<const rvsdg::bitsgt_op *>(&operation)
+      || dynamic_cast<const rvsdg::bitsge_op *>(&operation);
+}
+
+void
+BitwidthMinimization::NarrowSimpleNode(rvsdg::simple_node & node)
+{
+  auto & operation = node.operation();
+  if (node.ninputs() == 0 || node.noutputs() != 1)
+    return;
+
+  auto nbits = GetNumBits(*node.input(0)->origin());
+  if (nbits <= 1)
+    return;
+
+  size_t operandBits = 0;
+  auto maxSigned = ValueRange::GetMaxValue(nbits - 1);
+  auto isNonNegative = true;
+  for (size_t n = 0; n < node.ninputs(); n++)
+  {
+    auto range = Analysis_.GetRange(*node.input(n)->origin());
+    operandBits = std::max(operandBits, range.GetRequiredBits());
+    isNonNegative = isNonNegative && range.Upper <= maxSigned;
+  }
+
+  size_t narrowedBits = 0;
+  auto binary = dynamic_cast<const rvsdg::bitbinary_op *>(&operation);
+  auto compare = dynamic_cast<const rvsdg::bitcompare_op *>(&operation);
+  auto resultBits = Analysis_.GetRange(*node.output(0)).GetRequiredBits();
+  if (binary && IsTruncationInvariant(operation))
+  {
+    narrowedBits = resultBits;
+  }
+  else if (binary && IsUnsignedNarrowable(operation))
+  {
+    narrowedBits = std::max(resultBits, operandBits);
+    if (dynamic_cast<const rvsdg::bitshl_op *>(&operation)
+        && Analysis_.GetRange(*node.input(1)->origin()).Upper >= narrowedBits)
+    {
+      return;
+    }
+  }
+  else if (compare && IsUnsignedNarrowable(operation))
+  {
+    narrowedBits = operandBits;
+  }
+  else if (compare && IsSignedComparison(operation) && isNonNegative)
+  {
+    // Keep a zero sign bit
+    narrowedBits = operandBits + 1;
+  }
+  else
+  {
+    return;
+  }
+
+  if (narrowedBits >= nbits)
+    return;
+
+  std::vector<rvsdg::output *> operands;
+  for (size_t n = 0; n < node.ninputs(); n++)
+  {
+    operands.push_back(NarrowOperand(*node.input(n)->origin(), narrowedBits));
+  }
+
+  auto region = node.region();
+  auto & output = *node.output(0);
+  if (binary)
+  {
+    auto narrowedOperation = binary->create(narrowedBits);
+    auto narrowed = rvsdg::simple_node::create_normalized(region, *narrowedOperation, operands)[0];
+    Analysis_.SetRange(*narrowed, Analysis_.GetRange(output));
+    output.divert_users(Extend(*narrowed, nbits));
+  }
+  else
+  {
+    auto narrowedOperation = compare->create(narrowedBits);
+    auto narrowed = rvsdg::simple_node::create_normalized(region, *narrowedOperation, operands)[0];
+    Analysis_.SetRange(*narrowed, Analysis_.GetRange(output));
+    output.divert_users(narrowed);
+  }
+  remove(&node);
+
+  NumNarrowedOperations_++;
+  BitsSaved_ += nbits - narrowedBits;
+}
+
+void
+BitwidthMinimization::NarrowTheta(rvsdg::ThetaNode & thetaNode)
+{
+  struct NarrowedLoopVar
+  {
+    rvsdg::ThetaInput * Input;
+    rvsdg::ThetaOutput * Output;
+    size_t NumBits;
+  };
+
+  // Replace loop variables by narrowed ones before the subregion is narrowed, such that the
+  // narrowed operations in the subregion can use them directly
+  std::vector<NarrowedLoopVar> narrowedLoopVars;
+  auto numInputs = thetaNode.ninputs();
+  for (size_t n = 0; n < numInputs; n++)
+  {
+    auto input = thetaNode.input(n);
+    auto & argument = *input->argument();
+    auto nbits = GetNumBits(argument);
+    if (nbits <= 1)
+      continue;
+
+    auto narrowedBits = std::max(
+        Analysis_.GetRange(argument).GetRequiredBits(),
+        Analysis_.GetRange(*input->result()->origin()).GetRequiredBits());
+    if (narrowedBits >= nbits)
+      continue;
+
+    auto narrowedOutput =
+        thetaNode.add_loopvar(NarrowOperand(*input->origin(), narrowedBits));
+    auto & narrowedArgument = *narrowedOutput->argument();
+    Analysis_.SetRange(narrowedArgument, Analysis_.GetRange(argument));
+    argument.divert_users(Extend(narrowedArgument, nbits));
+
+    narrowedLoopVars.push_back({ input, narrowedOutput, narrowedBits });
+    NumNarrowedLoopVariables_++;
+    BitsSaved_ += nbits - narrowedBits;
+  }
+
+  NarrowRegion(*thetaNode.subregion());
+
+  std::unordered_set<const rvsdg::ThetaInput *> deadInputs;
+  std::unordered_set<const rvsdg::ThetaOutput *> deadOutputs;
+  for (auto & loopVar : narrowedLoopVars)
+  {
+    auto input = loopVar.Input;
+    auto & output = *input->output();
+    auto origin = input->result()->origin();
+    loopVar.Output->result()->divert_to(NarrowOperand(*origin, loopVar.NumBits));
+
+    Analysis_.SetRange(*loopVar.Output, Analysis_.GetRange(output));
+    output.divert_users(Extend(*loopVar.Output, GetNumBits(output)));
+
+    deadInputs.insert(input);
+    deadOutputs.insert(&output);
+  }
+
+  thetaNode.RemoveThetaOutputsWhere(
+      [&](const rvsdg::ThetaOutput & output)
+      {
+        return deadOutputs.find(&output) != deadOutputs.end();
+      });
+  thetaNode.RemoveThetaInputsWhere(
+      [&](const rvsdg::ThetaInput & input)
+      {
+        return deadInputs.find(&input) != deadInputs.end();
+      });
+}
+
+void
+BitwidthMinimization::NarrowRegion(rvsdg::Region & region)
+{
+  std::vector<rvsdg::node *> nodes;
+  for (auto & node : rvsdg::topdown_traverser(&region))
+  {
+    nodes.push_back(node);
+  }
+
+  for (auto node : nodes)
+  {
+    if (auto simpleNode = dynamic_cast<rvsdg::simple_node *>(node))
+    {
+      NarrowSimpleNode(*simpleNode);
+    }
+    else if (auto gammaNode = dynamic_cast<rvsdg::GammaNode *>(node))
+    {
+      for (size_t r = 0; r < gammaNode->nsubregions(); r++)
+      {
+        NarrowRegion(*gammaNode->subregion(r));
+      }
+    }
+    else if (auto thetaNode = dynamic_cast<rvsdg::ThetaNode *>(node))
+    {
+      NarrowTheta(*thetaNode);
+    }
+  }
+}
+
+void
+BitwidthMinimization::run(
+    llvm::RvsdgModule & module,
+    util::StatisticsCollector & statisticsCollector)
+{
+  auto statistics = Statistics::Create(module.SourceFileName());
+  statistics->Start();
+
+  Analysis_ = ValueRangeAnalysis();
+  NumNarrowedOperations_ = 0;
+  NumNarrowedLoopVariables_ = 0;
+  BitsSaved_ = 0;
+
+  auto & rootRegion = *module.Rvsdg().root();
+  for (auto & node : rootRegion.Nodes())
+  {
+    if (auto lambda = dynamic_cast<llvm::lambda::node *>(&node))
+    {
+      Analysis_.Analyze(*lambda->subregion());
+      NarrowRegion(*lambda->subregion());
+      lambda->subregion()->prune(true);
+    }
+  }
+
+  statistics->Stop(NumNarrowedOperations_, NumNarrowedLoopVariables_, BitsSaved_);
+  statisticsCollector.CollectDemandedStatistics(std::move(statistics));
+}
+
+}
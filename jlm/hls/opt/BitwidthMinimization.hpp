@@ -0,0 +1,217 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_HLS_OPT_BITWIDTHMINIMIZATION_HPP
+#define JLM_HLS_OPT_BITWIDTHMINIMIZATION_HPP
+
+#include <jlm/llvm/opt/optimization.hpp>
+#include <jlm/rvsdg/region.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <unordered_map>
+
+namespace jlm::rvsdg
+{
+class GammaNode;
+class simple_node;
+class ThetaNode;
+}
+
+namespace jlm::llvm
+{
+class RvsdgModule;
+}
+
+namespace jlm::hls
+{
+
+/**
+ * Unsigned interval [Lower, Upper] of the values an output of bit type can assume.
+ */
+struct ValueRange
+{
+  uint64_t Lower;
+  uint64_t Upper;
+
+  /**
+   * \return The range of all values of a bit string with \p nbits bits.
+   */
+  static ValueRange
+  CreateFull(size_t nbits) noexcept
+  {
+    return { 0, GetMaxValue(nbits) };
+  }
+
+  /**
+   * \return The range of a value that is not analyzed, such as a bit string with more than 64
+   * bits. The range does not exclude any value.
+   */
+  static ValueRange
+  CreateUnknown() noexcept
+  {
+    return { 0, UINT64_MAX };
+  }
+
+  /**
+   * \return The largest unsigned value of a bit string with \p nbits bits.
+   */
+  static uint64_t
+  GetMaxValue(size_t nbits) noexcept
+  {
+    return nbits >= 64 ? UINT64_MAX : (uint64_t(1) << nbits) - 1;
+  }
+
+  /**
+   * \return The number of bits required to represent every value of the range.
+   */
+  [[nodiscard]] size_t
+  GetRequiredBits() const noexcept
+  {
+    size_t nbits = 1;
+    while (nbits < 64 && (Upper >> nbits) != 0)
+      nbits++;
+
+    return nbits;
+  }
+
+  [[nodiscard]] ValueRange
+  Union(const ValueRange & other) const noexcept
+  {
+    return { std::min(Lower, other.Lower), std::max(Upper, other.Upper) };
+  }
+
+  bool
+  operator==(const ValueRange & other) const noexcept
+  {
+    return Lower == other.Lower && Upper == other.Upper;
+  }
+
+  bool
+  operator!=(const ValueRange & other) const noexcept
+  {
+    return !(*this == other);
+  }
+};
+
+/**
+ * \brief Value range analysis for bit strings
+ *
+ * Computes an unsigned interval for every output of bit type with at most 64 bits. Intervals are
+ * propagated through bit arithmetic, extensions, and truncations. Gamma exit variables receive
+ * the union of the intervals of all alternatives. Theta loop variables are solved with a
+ * fixpoint iteration that widens to the constants the loop predicate compares against, and the
+ * values carried over the back-edge are refined with the loop predicate.
+ */
+class ValueRangeAnalysis final
+{
+public:
+  /**
+   * Analyzes \p region and all its subregions. The arguments of \p region are assumed to take
+   * any value unless a range was set for them.
+   */
+  void
+  Analyze(rvsdg::Region & region);
+
+  /**
+   * \return The range of \p output, or the full range of its type if no range is known. Outputs
+   * that are not bit strings with at most 64 bits have an unknown range.
+   */
+  [[nodiscard]] ValueRange
+  GetRange(const rvsdg::output & output) const;
+
+  void
+  SetRange(const rvsdg::output & output, const ValueRange & range)
+  {
+    Ranges_[&output] = range;
+  }
+
+private:
+  void
+  AnalyzeSimpleNode(const rvsdg::simple_node & node);
+
+  void
+  AnalyzeGamma(rvsdg::GammaNode & gammaNode);
+
+  void
+  AnalyzeTheta(rvsdg::ThetaNode & thetaNode);
+
+  std::unordered_map<const rvsdg::output *, ValueRange> Ranges_;
+};
+
+/**
+ * \brief Bitwidth minimization for RHLS datapaths
+ *
+ * Narrows bit arithmetic, comparisons, and theta loop variables to the number of bits required
+ * by their value ranges. Narrowed operands are truncated and narrowed results are zero-extended
+ * to their original width, such that the users of a value remain unchanged. Chains of narrowed
+ * operations are connected directly without intermediate extensions. Buffers and forks that are
+ * added later on inherit the narrowed types of the values they carry.
+ *
+ * The pass expects gamma and theta nodes, i.e., it has to run before their conversion to RHLS.
+ */
+class BitwidthMinimization final : public llvm::optimization
+{
+public:
+  class Statistics;
+
+  ~BitwidthMinimization() override;
+
+  void
+  run(llvm::RvsdgModule & module, util::StatisticsCollector & statisticsCollector) override;
+
+  /**
+   * \return The number of operations narrowed by the last run.
+   */
+  [[nodiscard]] size_t
+  GetNumNarrowedOperations() const noexcept
+  {
+    return NumNarrowedOperations_;
+  }
+
+  /**
+   * \return The number of theta loop variables narrowed by the last run.
+   */
+  [[nodiscard]] size_t
+  GetNumNarrowedLoopVariables() const noexcept
+  {
+    return NumNarrowedLoopVariables_;
+  }
+
+  /**
+   * \return The total number of datapath bits saved by the last run, i.e., the sum of the
+   * removed bits over all narrowed operations and loop variables.
+   */
+  [[nodiscard]] size_t
+  GetBitsSaved() const noexcept
+  {
+    return BitsSaved_;
+  }
+
+private:
+  void
+  NarrowRegion(rvsdg::Region & region);
+
+  void
+  NarrowSimpleNode(rvsdg::simple_node & node);
+
+  void
+  NarrowTheta(rvsdg::ThetaNode & thetaNode);
+
+  rvsdg::output *
+  NarrowOperand(rvsdg::output & origin, size_t nbits);
+
+  rvsdg::output *
+  Extend(rvsdg::output & origin, size_t nbits);
+
+  ValueRangeAnalysis Analysis_;
+  size_t NumNarrowedOperations_ = 0;
+  size_t NumNarrowedLoopVariables_ = 0;
+  size_t BitsSaved_ = 0;
+};
+
+}
+
+#endif // JLM_HLS_OPT_BITWIDTHMINIMIZATION_HPP
@@ -0,0 +1,431 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/hls/ir/hls.hpp>
+#include <jlm/hls/opt/ResourceSharing.hpp>
+#include <jlm/llvm/ir/operators/operators.hpp>
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/rvsdg/bitstring/arithmetic.hpp>
+#include <jlm/rvsdg/control.hpp>
+#include <jlm/rvsdg/traverser.hpp>
+
+#include <algorithm>
+#include <unordered_set>
+
+namespace jlm::hls
+{
+
+OperatorCostTable
+OperatorCostTable::CreateDefault()
+{
+  OperatorCostTable table;
+  table.SetCost("mul", { 200, 3 });
+  table.SetCost("udiv", { 800, 32 });
+  table.SetCost("sdiv", { 800, 32 });
+  table.SetCost("umod", { 800, 32 });
+  table.SetCost("smod", { 800, 32 });
+  table.SetCost("fadd", { 400, 4 });
+  table.SetCost("fsub", { 400, 4 });
+  table.SetCost("fmul", { 300, 4 });
+  table.SetCost("fdiv", { 1200, 16 });
+  table.SetCost("fmod", { 1200, 16 });
+  return table;
+}
+
+const OperatorCost *
+OperatorCostTable::GetCost(const rvsdg::operation & operation) const
+{
+  auto it = Costs_.find(GetOperatorKind(operation));
+  return it == Costs_.end() ? nullptr : &it->second;
+}
+
+std::string
+OperatorCostTable::GetOperatorKind(const rvsdg::operation & operation)
+{
+  if (dynamic_cast<const rvsdg::bitmul_op *>(&operation))
+    return "mul";
+  if (dynamic_cast<const rvsdg::bitudiv_op *>(&operation))
+    return "udiv";
+  if (dynamic_cast<const rvsdg::bitsdiv_op *>(&operation))
+    return "sdiv";
+  if (dynamic_cast<const rvsdg::bitumod_op *>(&operation))
+    return "umod";
+  if (dynamic_cast<const rvsdg::bitsmod_op *>(&operation))
+    return "smod";
+
+  if (auto fpbin = dynamic_cast<const llvm::fpbin_op *>(&operation))
+  {
+    switch (fpbin->fpop())
+    {
+    case llvm::fpop::add:
+      return "fadd";
+    case llvm::fpop::sub:
+      return "fsub";
+    case llvm::fpop::mul:
+      return "fmul";
+    case llvm::fpop::div:
+      return "fdiv";
+    case llvm::fpop::mod:
+      return "fmod";
+    }
+  }
+
+  return "";
+}
+
+/**
+ * The condition under which an output produces a token. Outputs of a branch_op only produce a
+ * token if the predicate selects the respective alternative. Nodes that exclusively consume such
+ * outputs inherit the condition, while outputs without a known condition are unconditional.
+ */
+struct ExecutionContext
+{
+  enum class Kind
+  {
+    Neutral,
+    Conditional,
+    Unconditional
+  };
+
+  Kind ContextKind = Kind::Neutral;
+  const rvsdg::output * Predicate = nullptr;
+  size_t Alternative = 0;
+
+  bool
+  operator==(const ExecutionContext & other) const noexcept
+  {
+    return ContextKind == other.ContextKind && Predicate == other.Predicate
+        && Alternative == other.Alternative;
+  }
+
+  bool
+  operator!=(const ExecutionContext & other) const noexcept
+  {
+    return !(*this == other);
+  }
+
+  static ExecutionContext
+  Join(const ExecutionContext & a, const ExecutionContext & b)
+  {
+    if (a.ContextKind == Kind::Neutral)
+      return b;
+    if (b.ContextKind == Kind::Neutral || a == b)
+      return a;
+    return { Kind::Unconditional };
+  }
+};
+
+static ExecutionContext
+GetContext(
+    const std::unordered_map<const rvsdg::output *, ExecutionContext> & contexts,
+    const rvsdg::output * output)
+{
+  auto it = contexts.find(output);
+  // region arguments and outputs of structural nodes
+  return it == contexts.end() ? ExecutionContext{ ExecutionContext::Kind::Unconditional }
+                              : it->second;
+}
+
+static void
+ComputeContext(
+    const rvsdg::node & node,
+    std::unordered_map<const rvsdg::output *, ExecutionContext> & contexts)
+{
+  if (!dynamic_cast<const rvsdg::simple_node *>(&node))
+    return;
+
+  if (auto branch = dynamic_cast<const branch_op *>(&node.operation()))
+  {
+    for (size_t n = 0; n < node.noutputs(); n++)
+    {
+      contexts[node.output(n)] = branch->loop
+                                   ? ExecutionContext{ ExecutionContext::Kind::Unconditional }
+                                   : ExecutionContext{ ExecutionContext::Kind::Conditional,
+                                                       node.input(0)->origin(),
+                                                       n };
+    }
+    return;
+  }
+
+  ExecutionContext context;
+  if (rvsdg::is<mux_op>(&node))
+  {
+    // a mux produces a token for every predicate token
+    context = GetContext(contexts, node.input(0)->origin());
+  }
+  else
+  {
+    for (size_t n = 0; n < node.ninputs(); n++)
+    {
+      context = ExecutionContext::Join(context, GetContext(contexts, node.input(n)->origin()));
+    }
+  }
+
+  for (size_t n = 0; n < node.noutputs(); n++)
+  {
+    contexts[node.output(n)] = context;
+  }
+}
+
+/**
+ * \return True if there is a path from \p source to \p target.
+ */
+static bool
+Reaches(const rvsdg::node & source, const rvsdg::node & target)
+{
+  std::unordered_set<const rvsdg::node *> visited({ &source });
+  std::vector<const rvsdg::node *> stack({ &source });
+  while (!stack.empty())
+  {
+    auto node = stack.back();
+    stack.pop_back();
+    if (node == &target)
+      return true;
+
+    for (size_t o = 0; o < node->noutputs(); o++)
+    {
+      for (auto user : *node->output(o))
+      {
+        auto userNode = rvsdg::input::GetNode(*user);
+        if (userNode && visited.insert(userNode).second)
+        {
+          stack.push_back(userNode);
+        }
+      }
+    }
+  }
+
+  return false;
+}
+
+static bool
+HasPath(const std::vector<rvsdg::node *> & nodes)
+{
+  for (auto source : nodes)
+  {
+    for (auto target : nodes)
+    {
+      if (source != target && Reaches(*source, *target))
+        return true;
+    }
+  }
+
+  return false;
+}
+
+/**
+ * Replaces the mutually exclusive \p nodes by a single node whose operands are selected by
+ * \p predicate. The node of alternative n is expected at index n.
+ */
+static void
+ShareNodes(rvsdg::output & predicate, const std::vector<rvsdg::node *> & nodes)
+{
+  auto & region = *predicate.region();
+  auto & operation = *util::AssertedCast<const rvsdg::simple_op>(&nodes[0]->operation());
+
+  std::vector<rvsdg::output *> operands;
+  for (size_t i = 0; i < nodes[0]->ninputs(); i++)
+  {
+    std::vector<rvsdg::output *> alternatives;
+    for (auto node : nodes)
+    {
+      alternatives.push_back(node->input(i)->origin());
+    }
+    operands.push_back(mux_op::create(predicate, alternatives, false)[0]);
+  }
+
+  auto sharedNode = rvsdg::simple_node::create(&region, operation, operands);
+
+  for (size_t o = 0; o < sharedNode->noutputs(); o++)
+  {
+    auto branchResults = branch_op::create(predicate, *sharedNode->output(o));
+    for (size_t n = 0; n < nodes.size(); n++)
+    {
+      nodes[n]->output(o)->divert_users(branchResults[n]);
+    }
+  }
+
+  for (auto node : nodes)
+  {
+    remove(node);
+  }
+}
+
+ResourceSharing::~ResourceSharing() = default;
+
+ResourceSharing::ResourceSharing()
+    : ResourceSharing(OperatorCostTable::CreateDefault())
+{}
+
+ResourceSharing::ResourceSharing(OperatorCostTable costTable)
+    : CostTable_(std::move(costTable)),
+      NumSharedUnits_(0),
+      AreaSaved_(0)
+{}
+
+void
+ResourceSharing::ShareResources(rvsdg::Region & region)
+{
+  std::vector<rvsdg::node *> nodes;
+  for (auto node : rvsdg::topdown_traverser(&region))
+  {
+    nodes.push_back(node);
+  }
+
+  std::unordered_map<const rvsdg::output *, ExecutionContext> contexts;
+  // candidates per predicate and alternative in topological order
+  std::unordered_map<const rvsdg::output *, std::vector<std::vector<rvsdg::node *>>> candidates;
+  std::vector<const rvsdg::output *> predicates;
+  for (auto node : nodes)
+  {
+    if (auto structuralNode = dynamic_cast<rvsdg::StructuralNode *>(node))
+    {
+      for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+      {
+        ShareResources(*structuralNode->subregion(n));
+      }
+      continue;
+    }
+
+    ComputeContext(*node, contexts);
+    if (node->noutputs() == 0 || !CostTable_.GetCost(node->operation()))
+      continue;
+
+    auto & context = contexts[node->output(0)];
+    if (context.ContextKind != ExecutionContext::Kind::Conditional)
+      continue;
+
+    auto & perAlternative = candidates[context.Predicate];
+    if (perAlternative.empty())
+    {
+      auto & controlType =
+          *util::AssertedCast<const rvsdg::ControlType>(&context.Predicate->type());
+      perAlternative.resize(controlType.nalternatives());
+      predicates.push_back(context.Predicate);
+    }
+    perAlternative[context.Alternative].push_back(node);
+  }
+
+  for (auto predicate : predicates)
+  {
+    auto & perAlternative = candidates[predicate];
+    for (auto first : perAlternative[0])
+    {
+      auto cost = CostTable_.GetCost(first->operation());
+      auto numAlternatives = perAlternative.size();
+      auto steeringArea =
+          (first->ninputs() + first->noutputs()) * numAlternatives * CostTable_.SteeringArea;
+      auto areaSaved = (numAlternatives - 1) * cost->Area;
+      if (areaSaved <= steeringArea)
+        continue;
+
+      std::vector<rvsdg::node *> group({ first });
+      for (size_t n = 1; n < numAlternatives; n++)
+      {
+        auto & alternative = perAlternative[n];
+        auto it = std::find_if(
+            alternative.begin(),
+            alternative.end(),
+            [&](const rvsdg::node * node)
+            {
+              return node && node->operation() == first->operation();
+            });
+        if (it == alternative.end())
+          break;
+        group.push_back(*it);
+      }
+
+      if (group.size() != numAlternatives || HasPath(group))
+        continue;
+
+      for (size_t n = 1; n < numAlternatives; n++)
+      {
+        auto & alternative = perAlternative[n];
+        *std::find(alternative.begin(), alternative.end(), group[n]) = nullptr;
+      }
+
+      ShareNodes(*const_cast<rvsdg::output *>(predicate), group);
+      NumSharedUnits_++;
+      AreaSaved_ += areaSaved - steeringArea;
+    }
+  }
+}
+
+void
+ResourceSharing::run(llvm::RvsdgModule & module, util::StatisticsCollector &)
+{
+  NumSharedUnits_ = 0;
+  AreaSaved_ = 0;
+  ShareResources(*module.Rvsdg().root());
+}
+
+static size_t
+EstimateResources(
+    const rvsdg::Region & region,
+    const OperatorCostTable & costTable,
+    ResourceEstimate & estimate)
+{
+  std::vector<const rvsdg::node *> nodes;
+  for (auto & node : region.Nodes())
+  {
+    nodes.push_back(&node);
+  }
+  std::sort(
+      nodes.begin(),
+      nodes.end(),
+      [](const rvsdg::node * a, const rvsdg::node * b)
+      {
+        return a->depth() < b->depth();
+      });
+
+  size_t depth = 0;
+  std::unordered_map<const rvsdg::output *, size_t> arrival;
+  for (auto node : nodes)
+  {
+    size_t start = 0;
+    for (size_t i = 0; i < node->ninputs(); i++)
+    {
+      auto it = arrival.find(node->input(i)->origin());
+      if (it != arrival.end())
+      {
+        start = std::max(start, it->second);
+      }
+    }
+
+    size_t latency = 0;
+    if (auto structuralNode = dynamic_cast<const rvsdg::StructuralNode *>(node))
+    {
+      for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+      {
+        latency =
+            std::max(latency, EstimateResources(*structuralNode->subregion(n), costTable, estimate));
+      }
+    }
+    else if (auto cost = costTable.GetCost(node->operation()))
+    {
+      estimate.NumUnits++;
+      estimate.Area += cost->Area;
+      latency = cost->Latency;
+    }
+
+    for (size_t o = 0; o < node->noutputs(); o++)
+    {
+      arrival[node->output(o)] = start + latency;
+    }
+    depth = std::max(depth, start + latency);
+  }
+
+  return depth;
+}
+
+ResourceEstimate
+EstimateResources(const rvsdg::Region & region, const OperatorCostTable & costTable)
+{
+  ResourceEstimate estimate;
+  estimate.Latency = EstimateResources(region, costTable, estimate);
+  return estimate;
+}
+
+}
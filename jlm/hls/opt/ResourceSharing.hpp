@@ -0,0 +1,155 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_HLS_OPT_RESOURCESHARING_HPP
+#define JLM_HLS_OPT_RESOURCESHARING_HPP
+
+#include <jlm/llvm/opt/optimization.hpp>
+#include <jlm/rvsdg/operation.hpp>
+#include <jlm/rvsdg/region.hpp>
+
+#include <string>
+#include <unordered_map>
+
+namespace jlm::llvm
+{
+class RvsdgModule;
+}
+
+namespace jlm::hls
+{
+
+/**
+ * Estimated area and latency of a functional unit.
+ */
+struct OperatorCost
+{
+  /**
+   * Area in abstract units, roughly corresponding to lookup tables.
+   */
+  size_t Area;
+
+  /**
+   * Latency in cycles.
+   */
+  size_t Latency;
+};
+
+/**
+ * Maps operator kinds to the cost of their functional units. Only operators with an entry are
+ * considered expensive, i.e., they are shared by ResourceSharing and counted by
+ * EstimateResources().
+ */
+class OperatorCostTable final
+{
+public:
+  /**
+   * \return A table with entries for integer multiplication, division, and remainder, as well as
+   * floating point arithmetic.
+   */
+  static OperatorCostTable
+  CreateDefault();
+
+  void
+  SetCost(const std::string & kind, OperatorCost cost)
+  {
+    Costs_[kind] = cost;
+  }
+
+  /**
+   * \return The cost of \p operation, or nullptr if the table has no entry for its kind.
+   */
+  [[nodiscard]] const OperatorCost *
+  GetCost(const rvsdg::operation & operation) const;
+
+  /**
+   * \return The kind of \p operation, e.g., "mul", "udiv", or "fdiv", or an empty string for
+   * operations without a kind.
+   */
+  static std::string
+  GetOperatorKind(const rvsdg::operation & operation);
+
+  /**
+   * Area of a single mux_op or branch_op input that steers operands to or results from a shared
+   * unit.
+   */
+  size_t SteeringArea = 1;
+
+private:
+  std::unordered_map<std::string, OperatorCost> Costs_;
+};
+
+/**
+ * \brief Resource sharing across mutually exclusive gamma branches
+ *
+ * Gamma nodes that are converted without speculation steer their inputs through a branch_op, such
+ * that only the nodes of the selected alternative receive tokens. This pass binds expensive
+ * operators with identical operations from all alternatives of the same predicate to a single
+ * functional unit. The operands of the unit are selected by a mux_op and its results are steered
+ * back to the users by a branch_op, both driven by the predicate of the gamma.
+ */
+class ResourceSharing final : public llvm::optimization
+{
+public:
+  ~ResourceSharing() override;
+
+  ResourceSharing();
+
+  explicit ResourceSharing(OperatorCostTable costTable);
+
+  void
+  run(llvm::RvsdgModule & module, util::StatisticsCollector & statisticsCollector) override;
+
+  /**
+   * \return The number of shared units created by the last run.
+   */
+  [[nodiscard]] size_t
+  GetNumSharedUnits() const noexcept
+  {
+    return NumSharedUnits_;
+  }
+
+  /**
+   * \return The estimated area saved by the last run, including the steering overhead.
+   */
+  [[nodiscard]] size_t
+  GetAreaSaved() const noexcept
+  {
+    return AreaSaved_;
+  }
+
+private:
+  void
+  ShareResources(rvsdg::Region & region);
+
+  OperatorCostTable CostTable_;
+  size_t NumSharedUnits_;
+  size_t AreaSaved_;
+};
+
+/**
+ * Area and latency estimate of the expensive operators of a region.
+ */
+struct ResourceEstimate
+{
+  size_t NumUnits = 0;
+  size_t Area = 0;
+
+  /**
+   * The latency of the longest chain of expensive operators. Loops contribute the latency of a
+   * single iteration.
+   */
+  size_t Latency = 0;
+};
+
+/**
+ * Estimates the area and latency of the expensive operators in \p region and its subregions.
+ */
+ResourceEstimate
+EstimateResources(const rvsdg::Region & region, const OperatorCostTable & costTable);
+
+}
+
+#endif // JLM_HLS_OPT_RESOURCESHARING_HPP
@@ -0,0 +1,2282 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/hls/backend/rhls2firrtl/base-hls.hpp>
+#include <jlm/hls/ir/hls.hpp>
+#include <jlm/hls/util/RhlsSimulator.hpp>
+#include <jlm/llvm/ir/operators/GetElementPtr.hpp>
+#include <jlm/llvm/ir/operators/operators.hpp>
+#include <jlm/llvm/ir/operators/sext.hpp>
+#include <jlm/rvsdg/bitstring.hpp>
+#include <jlm/rvsdg/control.hpp>
+#include <jlm/rvsdg/traverser.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <sstream>
+
+namespace jlm::hls
+{
+
+/**
+ * The value carried by a channel. Plain values only use Data, while memory request and response
+ * bundles also use the remaining fields.
+ */
+struct SimulationToken
+{
+  uint64_t Data = 0;
+  uint64_t Address = 0;
+  uint64_t Size = 0;
+  uint64_t Id = 0;
+  bool Write = false;
+
+  bool
+  operator==(const SimulationToken & other) const noexcept
+  {
+    return Data == other.Data && Address == other.Address && Size == other.Size
+        && Id == other.Id && Write == other.Write;
+  }
+
+  bool
+  operator!=(const SimulationToken & other) const noexcept
+  {
+    return !(*this == other);
+  }
+};
+
+/**
+ * A channel connects the producer of a value with all its consumers. A channel with several
+ * consumers behaves like an eager fork, i.e., every consumer takes the token individually and
+ * the producer is released once all consumers took it.
+ */
+class SimulationChannel final
+{
+public:
+  explicit SimulationChannel(const rvsdg::output & origin)
+      : Origin_(&origin),
+        IsConstant_(false),
+        Valid_(false),
+        Modified_(false)
+  {}
+
+  [[nodiscard]] const rvsdg::output &
+  Origin() const noexcept
+  {
+    return *Origin_;
+  }
+
+  size_t
+  AddConsumer(const rvsdg::input & input)
+  {
+    Consumers_.push_back(&input);
+    Ready_.push_back(false);
+    Taken_.push_back(false);
+    Transfers_.push_back(0);
+    Stalls_.push_back(0);
+    Starves_.push_back(0);
+    return Consumers_.size() - 1;
+  }
+
+  [[nodiscard]] size_t
+  NumConsumers() const noexcept
+  {
+    return Consumers_.size();
+  }
+
+  [[nodiscard]] const rvsdg::input &
+  Consumer(size_t index) const noexcept
+  {
+    return *Consumers_[index];
+  }
+
+  void
+  SetIsConstant(bool isConstant) noexcept
+  {
+    IsConstant_ = isConstant;
+  }
+
+  [[nodiscard]] bool
+  IsConstant() const noexcept
+  {
+    return IsConstant_;
+  }
+
+  void
+  SetValid(bool valid, const SimulationToken & token)
+  {
+    if (valid != Valid_ || (valid && token != Token_))
+    {
+      Modified_ = true;
+    }
+    Valid_ = valid;
+    Token_ = valid ? token : SimulationToken();
+  }
+
+  void
+  SetReady(size_t consumer, bool ready)
+  {
+    if (Ready_[consumer] != ready)
+    {
+      Modified_ = true;
+    }
+    Ready_[consumer] = ready;
+  }
+
+  [[nodiscard]] bool
+  IsValid() const noexcept
+  {
+    return Valid_;
+  }
+
+  [[nodiscard]] bool
+  IsValid(size_t consumer) const noexcept
+  {
+    return Valid_ && !Taken_[consumer];
+  }
+
+  [[nodiscard]] const SimulationToken &
+  Token() const noexcept
+  {
+    return Token_;
+  }
+
+  [[nodiscard]] bool
+  IsReady(size_t consumer) const noexcept
+  {
+    return Ready_[consumer];
+  }
+
+  /**
+   * \return True if all consumers either took the token or are ready to take it.
+   */
+  [[nodiscard]] bool
+  IsReady() const noexcept
+  {
+    for (size_t n = 0; n < Consumers_.size(); n++)
+    {
+      if (!Taken_[n] && !Ready_[n])
+        return false;
+    }
+
+    return true;
+  }
+
+  [[nodiscard]] bool
+  Fires(size_t consumer) const noexcept
+  {
+    return IsValid(consumer) && Ready_[consumer];
+  }
+
+  [[nodiscard]] bool
+  Fires() const noexcept
+  {
+    return Valid_ && IsReady();
+  }
+
+  bool
+  ClearModified() noexcept
+  {
+    auto modified = Modified_;
+    Modified_ = false;
+    return modified;
+  }
+
+  void
+  ResetSignals()
+  {
+    Valid_ = false;
+    Token_ = SimulationToken();
+    std::fill(Ready_.begin(), Ready_.end(), false);
+    Modified_ = false;
+  }
+
+  void
+  ResetState()
+  {
+    ResetSignals();
+    std::fill(Taken_.begin(), Taken_.end(), false);
+    std::fill(Transfers_.begin(), Transfers_.end(), 0);
+    std::fill(Stalls_.begin(), Stalls_.end(), 0);
+    std::fill(Starves_.begin(), Starves_.end(), 0);
+  }
+
+  /**
+   * Updates the statistics and the taken flags of the consumers at the end of a cycle.
+   */
+  void
+  ClockEdge()
+  {
+    auto producerFires = Fires();
+    for (size_t n = 0; n < Consumers_.size(); n++)
+    {
+      if (Fires(n))
+        Transfers_[n]++;
+      else if (IsValid(n))
+        Stalls_[n]++;
+      else if (!Valid_ && Ready_[n])
+        Starves_[n]++;
+
+      Taken_[n] = producerFires ? false : (Taken_[n] || Fires(n));
+    }
+  }
+
+  [[nodiscard]] size_t
+  NumTransfers(size_t consumer) const noexcept
+  {
+    return Transfers_[consumer];
+  }
+
+  [[nodiscard]] size_t
+  NumStalls(size_t consumer) const noexcept
+  {
+    return Stalls_[consumer];
+  }
+
+  [[nodiscard]] size_t
+  NumStarves(size_t consumer) const noexcept
+  {
+    return Starves_[consumer];
+  }
+
+private:
+  const rvsdg::output * Origin_;
+  bool IsConstant_;
+
+  bool Valid_;
+  SimulationToken Token_;
+  bool Modified_;
+
+  std::vector<const rvsdg::input *> Consumers_;
+  std::vector<bool> Ready_;
+  std::vector<bool> Taken_;
+
+  std::vector<size_t> Transfers_;
+  std::vector<size_t> Stalls_;
+  std::vector<size_t> Starves_;
+};
+
+/**
+ * Base class of all simulated hardware units. A cycle is simulated in three steps:
+ *
+ * 1. ComputeOutputs() computes the valid and data signals of the outputs from the unit's state
+ * and the valid and data signals of the inputs.
+ * 2. ComputeReadies() computes the ready signals of the inputs from the unit's state and the
+ * valid and ready signals of its ports.
+ * 3. ClockEdge() updates the unit's state according to the handshakes of the cycle.
+ *
+ * The first two steps are repeated by the simulator until a fixed point is reached.
+ */
+class SimulationUnit
+{
+  struct InputPort
+  {
+    SimulationChannel * Channel;
+    size_t Consumer;
+  };
+
+public:
+  virtual ~SimulationUnit() noexcept = default;
+
+  virtual void
+  ResetState()
+  {}
+
+  virtual void
+  ComputeOutputs() = 0;
+
+  virtual void
+  ComputeReadies() = 0;
+
+  virtual void
+  ClockEdge()
+  {}
+
+  /**
+   * \return True if the unit has outstanding work that does not depend on any handshake.
+   */
+  [[nodiscard]] virtual bool
+  IsBusy() const noexcept
+  {
+    return false;
+  }
+
+  void
+  AddInput(SimulationChannel & channel, const rvsdg::input & input)
+  {
+    Inputs_.push_back({ &channel, channel.AddConsumer(input) });
+  }
+
+  void
+  AddOutput(SimulationChannel & channel)
+  {
+    Outputs_.push_back(&channel);
+  }
+
+  [[nodiscard]] size_t
+  NumInputs() const noexcept
+  {
+    return Inputs_.size();
+  }
+
+  [[nodiscard]] size_t
+  NumOutputs() const noexcept
+  {
+    return Outputs_.size();
+  }
+
+protected:
+  [[nodiscard]] bool
+  InValid(size_t n) const noexcept
+  {
+    return Inputs_[n].Channel->IsValid(Inputs_[n].Consumer);
+  }
+
+  [[nodiscard]] const SimulationToken &
+  InToken(size_t n) const noexcept
+  {
+    return Inputs_[n].Channel->Token();
+  }
+
+  [[nodiscard]] uint64_t
+  InData(size_t n) const noexcept
+  {
+    return InToken(n).Data;
+  }
+
+  void
+  SetInReady(size_t n, bool ready)
+  {
+    Inputs_[n].Channel->SetReady(Inputs_[n].Consumer, ready);
+  }
+
+  [[nodiscard]] bool
+  InFires(size_t n) const noexcept
+  {
+    return Inputs_[n].Channel->Fires(Inputs_[n].Consumer);
+  }
+
+  [[nodiscard]] bool
+  AllInputsValid() const noexcept
+  {
+    for (size_t n = 0; n < NumInputs(); n++)
+    {
+      if (!InValid(n))
+        return false;
+    }
+
+    return true;
+  }
+
+  void
+  SetOutValid(size_t n, bool valid, const SimulationToken & token = {})
+  {
+    Outputs_[n]->SetValid(valid, token);
+  }
+
+  void
+  SetOutValid(size_t n, bool valid, uint64_t data)
+  {
+    SimulationToken token;
+    token.Data = data;
+    SetOutValid(n, valid, token);
+  }
+
+  [[nodiscard]] bool
+  OutValid(size_t n) const noexcept
+  {
+    return Outputs_[n]->IsValid();
+  }
+
+  [[nodiscard]] bool
+  OutReady(size_t n) const noexcept
+  {
+    return Outputs_[n]->IsReady();
+  }
+
+  [[nodiscard]] bool
+  OutFires(size_t n) const noexcept
+  {
+    return Outputs_[n]->Fires();
+  }
+
+private:
+  std::vector<InputPort> Inputs_;
+  std::vector<SimulationChannel *> Outputs_;
+};
+
+namespace
+{
+
+uint64_t
+Mask(uint64_t value, const rvsdg::Type & type)
+{
+  if (auto bitType = dynamic_cast<const rvsdg::bittype *>(&type))
+  {
+    if (bitType->nbits() < 64)
+      return value & ((uint64_t(1) << bitType->nbits()) - 1);
+  }
+
+  return value;
+}
+
+uint64_t
+SignExtend(uint64_t value, size_t nbits)
+{
+  if (nbits >= 64)
+    return value;
+
+  auto signBit = uint64_t(1) << (nbits - 1);
+  value &= (uint64_t(1) << nbits) - 1;
+  return (value ^ signBit) - signBit;
+}
+
+size_t
+GetNumBits(const rvsdg::Type & type)
+{
+  return BaseHLS::JlmSize(&type);
+}
+
+/**
+ * \return The log2 of the number of bytes accessed for a value of type \p type, as encoded in the
+ * size field of a memory request.
+ */
+uint64_t
+GetRequestSize(const rvsdg::Type & type)
+{
+  auto numBytes = std::max<size_t>(GetNumBits(type) / 8, 1);
+  uint64_t size = 0;
+  while ((size_t(1) << (size + 1)) <= numBytes)
+    size++;
+
+  return size;
+}
+
+bool
+IsStateOnly(const rvsdg::simple_op & operation)
+{
+  for (size_t n = 0; n < operation.nresults(); n++)
+  {
+    if (!rvsdg::is<rvsdg::StateType>(operation.result(n)))
+      return false;
+  }
+
+  return true;
+}
+
+/**
+ * Computes the results of a combinational operation.
+ */
+std::vector<uint64_t>
+Evaluate(const rvsdg::simple_op & operation, const std::vector<uint64_t> & operands)
+{
+  if (auto op = dynamic_cast<const rvsdg::bitconstant_op *>(&operation))
+  {
+    return { op->value().to_uint() };
+  }
+  else if (auto op = dynamic_cast<const rvsdg::ctlconstant_op *>(&operation))
+  {
+    return { op->value().alternative() };
+  }
+  else if (auto op = dynamic_cast<const rvsdg::bitbinary_op *>(&operation))
+  {
+    auto nbits = op->type().nbits();
+    rvsdg::bitvalue_repr op1(nbits, static_cast<int64_t>(Mask(operands[0], *op->argument(0))));
+    rvsdg::bitvalue_repr op2(nbits, static_cast<int64_t>(Mask(operands[1], *op->argument(1))));
+    return { Mask(op->reduce_constants(op1, op2).to_uint(), *op->result(0)) };
+  }
+  else if (auto op = dynamic_cast<const rvsdg::bitcompare_op *>(&operation))
+  {
+    auto nbits = op->type().nbits();
+    rvsdg::bitvalue_repr op1(nbits, static_cast<int64_t>(Mask(operands[0], *op->argument(0))));
+    rvsdg::bitvalue_repr op2(nbits, static_cast<int64_t>(Mask(operands[1], *op->argument(1))));
+    return { op->reduce_constants(op1, op2) == rvsdg::compare_result::static_true ? 1u : 0u };
+  }
+  else if (auto op = dynamic_cast<const rvsdg::bitunary_op *>(&operation))
+  {
+    auto nbits = op->type().nbits();
+    rvsdg::bitvalue_repr op1(nbits, static_cast<int64_t>(Mask(operands[0], *op->argument(0))));
+    return { Mask(op->reduce_constant(op1).to_uint(), *op->result(0)) };
+  }
+  else if (auto op = dynamic_cast<const rvsdg::match_op *>(&operation))
+  {
+    return { op->alternative(Mask(operands[0], *op->argument(0))) };
+  }
+  else if (auto op = dynamic_cast<const llvm::zext_op *>(&operation))
+  {
+    return { Mask(operands[0], *op->argument(0)) };
+  }
+  else if (auto op = dynamic_cast<const llvm::sext_op *>(&operation))
+  {
+    return { Mask(SignExtend(operands[0], op->nsrcbits()), *op->result(0)) };
+  }
+  else if (auto op = dynamic_cast<const llvm::trunc_op *>(&operation))
+  {
+    return { Mask(operands[0], *op->result(0)) };
+  }
+  else if (
+      dynamic_cast<const llvm::bitcast_op *>(&operation)
+      || dynamic_cast<const llvm::bits2ptr_op *>(&operation)
+      || dynamic_cast<const llvm::ptr2bits_op *>(&operation))
+  {
+    return { Mask(operands[0], *operation.result(0)) };
+  }
+  else if (auto op = dynamic_cast<const llvm::GetElementPtrOperation *>(&operation))
+  {
+    auto address = operands[0];
+    const rvsdg::Type * pointeeType = &op->GetPointeeType();
+    for (size_t n = 1; n < operands.size(); n++)
+    {
+      if (pointeeType == nullptr)
+        throw util::error("Unsupported GEP in RHLS simulation.");
+
+      auto numBytes = GetNumBits(*pointeeType) / 8;
+      if (dynamic_cast<const rvsdg::bittype *>(pointeeType)
+          || dynamic_cast<const llvm::PointerType *>(pointeeType))
+      {
+        pointeeType = nullptr;
+      }
+      else if (auto arrayType = dynamic_cast<const llvm::arraytype *>(pointeeType))
+      {
+        pointeeType = &arrayType->element_type();
+      }
+      else
+      {
+        throw util::error(
+            "Unsupported GEP pointee type in RHLS simulation: " + pointeeType->debug_string());
+      }
+
+      // GEP offsets are signed
+      auto nbits = GetNumBits(*op->argument(n));
+      address += SignExtend(operands[n], nbits) * numBytes;
+    }
+    return { address };
+  }
+  else if (auto op = dynamic_cast<const trigger_op *>(&operation))
+  {
+    return { Mask(operands[1], *op->result(0)) };
+  }
+  else if (dynamic_cast<const print_op *>(&operation))
+  {
+    return { operands[0] };
+  }
+  else if (dynamic_cast<const llvm::UndefValueOperation *>(&operation) || IsStateOnly(operation))
+  {
+    return std::vector<uint64_t>(operation.nresults(), 0);
+  }
+
+  throw util::error("Unsupported operation in RHLS simulation: " + operation.debug_string());
+}
+
+/**
+ * Injects the value of a lambda argument once at the start of the simulation.
+ */
+class ArgumentUnit final : public SimulationUnit
+{
+public:
+  void
+  SetValue(uint64_t value) noexcept
+  {
+    Value_ = value;
+  }
+
+  void
+  ResetState() override
+  {
+    Pending_ = true;
+  }
+
+  void
+  ComputeOutputs() override
+  {
+    SetOutValid(0, Pending_, Value_);
+  }
+
+  void
+  ComputeReadies() override
+  {}
+
+  void
+  ClockEdge() override
+  {
+    if (OutFires(0))
+      Pending_ = false;
+  }
+
+private:
+  uint64_t Value_ = 0;
+  bool Pending_ = true;
+};
+
+/**
+ * Consumes all tokens. Used for lambda results and sink_op nodes.
+ */
+class SinkUnit final : public SimulationUnit
+{
+public:
+  void
+  ResetState() override
+  {
+    Received_ = false;
+    Value_ = 0;
+  }
+
+  void
+  ComputeOutputs() override
+  {}
+
+  void
+  ComputeReadies() override
+  {
+    SetInReady(0, true);
+  }
+
+  void
+  ClockEdge() override
+  {
+    if (InFires(0) && !Received_)
+    {
+      Received_ = true;
+      Value_ = InData(0);
+    }
+  }
+
+  [[nodiscard]] bool
+  HasReceived() const noexcept
+  {
+    return Received_;
+  }
+
+  [[nodiscard]] uint64_t
+  Value() const noexcept
+  {
+    return Value_;
+  }
+
+private:
+  bool Received_ = false;
+  uint64_t Value_ = 0;
+};
+
+/**
+ * A combinational operation that joins all its inputs.
+ */
+class OperationUnit final : public SimulationUnit
+{
+public:
+  explicit OperationUnit(const rvsdg::simple_op & operation)
+      : Operation_(&operation)
+  {}
+
+  void
+  ComputeOutputs() override
+  {
+    auto allValid = AllInputsValid();
+    if (!allValid)
+    {
+      for (size_t n = 0; n < NumOutputs(); n++)
+        SetOutValid(n, false);
+      return;
+    }
+
+    std::vector<uint64_t> operands;
+    for (size_t n = 0; n < NumInputs(); n++)
+      operands.push_back(InData(n));
+
+    auto results = Evaluate(*Operation_, operands);
+    for (size_t n = 0; n < NumOutputs(); n++)
+      SetOutValid(n, true, results[n]);
+  }
+
+  void
+  ComputeReadies() override
+  {
+    auto ready = AllInputsValid();
+    for (size_t n = 0; n < NumOutputs(); n++)
+      ready = ready && OutReady(n);
+
+    for (size_t n = 0; n < NumInputs(); n++)
+      SetInReady(n, ready);
+  }
+
+private:
+  const rvsdg::simple_op * Operation_;
+};
+
+/**
+ * Pass-through that counts the transfers or stall cycles of its channel. Used for perf_counter_op
+ * nodes.
+ */
+class PerformanceCounterUnit final : public SimulationUnit
+{
+public:
+  explicit PerformanceCounterUnit(const perf_counter_op & operation)
+      : Operation_(&operation),
+        Count_(0)
+  {}
+
+  void
+  ResetState() override
+  {
+    Count_ = 0;
+  }
+
+  void
+  ComputeOutputs() override
+  {
+    SetOutValid(0, InValid(0), InToken(0));
+  }
+
+  void
+  ComputeReadies() override
+  {
+    SetInReady(0, OutReady(0));
+  }
+
+  void
+  ClockEdge() override
+  {
+    if (Operation_->kind() == perf_counter_op::counter_kind::iterations)
+    {
+      if (InFires(0))
+        Count_++;
+    }
+    else if (InValid(0) && !OutReady(0))
+    {
+      Count_++;
+    }
+  }
+
+  [[nodiscard]] const perf_counter_op &
+  Operation() const noexcept
+  {
+    return *Operation_;
+  }
+
+  [[nodiscard]] size_t
+  Count() const noexcept
+  {
+    return Count_;
+  }
+
+private:
+  const perf_counter_op * Operation_;
+  size_t Count_;
+};
+
+/**
+ * Eager fork that joins all its inputs. Used for fork_op and state_gate_op nodes.
+ */
+class EagerForkUnit final : public SimulationUnit
+{
+public:
+  explicit EagerForkUnit(bool forwardsFirstInput)
+      : ForwardsFirstInput_(forwardsFirstInput)
+  {}
+
+  void
+  ResetState() override
+  {
+    Fired_.assign(NumOutputs(), false);
+  }
+
+  void
+  ComputeOutputs() override
+  {
+    auto allValid = AllInputsValid();
+    for (size_t n = 0; n < NumOutputs(); n++)
+    {
+      auto & token = InToken(ForwardsFirstInput_ ? 0 : n);
+      SetOutValid(n, allValid && !Fired_[n], token);
+    }
+  }
+
+  void
+  ComputeReadies() override
+  {
+    auto allFired = AllFired();
+    for (size_t n = 0; n < NumInputs(); n++)
+      SetInReady(n, allFired);
+  }
+
+  void
+  ClockEdge() override
+  {
+    if (AllFired())
+    {
+      Fired_.assign(NumOutputs(), false);
+      return;
+    }
+
+    for (size_t n = 0; n < NumOutputs(); n++)
+      Fired_[n] = Fired_[n] || OutFires(n);
+  }
+
+private:
+  [[nodiscard]] bool
+  AllFired() const noexcept
+  {
+    auto allFired = AllInputsValid();
+    for (size_t n = 0; n < NumOutputs(); n++)
+      allFired = allFired && (Fired_[n] || OutReady(n));
+
+    return allFired;
+  }
+
+  bool ForwardsFirstInput_;
+  std::vector<bool> Fired_;
+};
+
+/**
+ * Fork of a constant value. The input is always consumed and the outputs are valid whenever
+ * the input is valid.
+ */
+class ConstantForkUnit final : public SimulationUnit
+{
+public:
+  void
+  ComputeOutputs() override
+  {
+    for (size_t n = 0; n < NumOutputs(); n++)
+      SetOutValid(n, InValid(0), InToken(0));
+  }
+
+  void
+  ComputeReadies() override
+  {
+    SetInReady(0, true);
+  }
+};
+
+class BranchUnit final : public SimulationUnit
+{
+public:
+  void
+  ComputeOutputs() override
+  {
+    for (size_t n = 0; n < NumOutputs(); n++)
+      SetOutValid(n, InValid(0) && InData(0) == n && InValid(1), InToken(1));
+  }
+
+  void
+  ComputeReadies() override
+  {
+    if (!InValid(0))
+    {
+      SetInReady(0, false);
+      SetInReady(1, false);
+      return;
+    }
+
+    auto outReady = OutReady(InData(0));
+    SetInReady(0, outReady && InValid(1));
+    SetInReady(1, outReady);
+  }
+};
+
+/**
+ * Non-discarding multiplexer. Only the selected input is consumed.
+ */
+class MuxUnit final : public SimulationUnit
+{
+public:
+  void
+  ComputeOutputs() override
+  {
+    if (!InValid(0))
+    {
+      SetOutValid(0, false);
+      return;
+    }
+
+    auto selected = InData(0) + 1;
+    SetOutValid(0, InValid(selected), InToken(selected));
+  }
+
+  void
+  ComputeReadies() override
+  {
+    auto selected = InValid(0) ? InData(0) + 1 : 0;
+    for (size_t n = 1; n < NumInputs(); n++)
+      SetInReady(n, n == selected && OutReady(0));
+    SetInReady(0, selected != 0 && OutReady(0) && InValid(selected));
+  }
+};
+
+/**
+ * Discarding multiplexer. Every time a token is forwarded from the selected input, a token is
+ * discarded from each of the other inputs.
+ */
+class DiscardingMuxUnit final : public SimulationUnit
+{
+  static constexpr size_t MaxDiscards_ = 15;
+
+public:
+  void
+  ResetState() override
+  {
+    Discards_.assign(NumInputs(), 0);
+  }
+
+  void
+  ComputeOutputs() override
+  {
+    Selected_ = 0;
+    auto anyFull = std::any_of(
+        Discards_.begin(),
+        Discards_.end(),
+        [](size_t discards)
+        {
+          return discards == MaxDiscards_;
+        });
+    if (InValid(0) && !anyFull && Discards_[InData(0) + 1] == 0)
+      Selected_ = InData(0) + 1;
+
+    if (Selected_ == 0)
+    {
+      SetOutValid(0, false);
+      return;
+    }
+
+    SetOutValid(0, InValid(Selected_), InToken(Selected_));
+  }
+
+  void
+  ComputeReadies() override
+  {
+    auto outFires = Selected_ != 0 && OutValid(0) && OutReady(0);
+    SetInReady(0, outFires);
+    for (size_t n = 1; n < NumInputs(); n++)
+    {
+      if (n == Selected_)
+        SetInReady(n, OutReady(0));
+      else
+        SetInReady(n, Discards_[n] != 0 || outFires);
+    }
+  }
+
+  void
+  ClockEdge() override
+  {
+    auto outFires = Selected_ != 0 && OutFires(0);
+    for (size_t n = 1; n < NumInputs(); n++)
+    {
+      auto discard = outFires && n != Selected_;
+      auto fires = InFires(n);
+      if (Discards_[n] != 0 && fires && !discard)
+        Discards_[n]--;
+      else if (discard && !fires)
+        Discards_[n]++;
+    }
+  }
+
+private:
+  size_t Selected_ = 0;
+  std::vector<size_t> Discards_;
+};
+
+/**
+ * Forwards the first valid input.
+ */
+class MergeUnit final : public SimulationUnit
+{
+public:
+  void
+  ComputeOutputs() override
+  {
+    for (size_t n = 0; n < NumInputs(); n++)
+    {
+      if (InValid(n))
+      {
+        SetOutValid(0, true, InToken(n));
+        return;
+      }
+    }
+
+    SetOutValid(0, false);
+  }
+
+  void
+  ComputeReadies() override
+  {
+    auto selected = false;
+    for (size_t n = 0; n < NumInputs(); n++)
+    {
+      SetInReady(n, !selected && InValid(n) && OutReady(0));
+      selected = selected || InValid(n);
+    }
+  }
+};
+
+/**
+ * A FIFO buffer. Also used for predicate_buffer_op, which is a single-entry pass-through buffer
+ * that initially holds the predicate 0.
+ */
+class BufferUnit final : public SimulationUnit
+{
+public:
+  BufferUnit(
+      const rvsdg::simple_node * node,
+      size_t capacity,
+      bool passThrough,
+      std::vector<uint64_t> initialTokens = {})
+      : Node_(node),
+        Capacity_(capacity),
+        PassThrough_(passThrough),
+        InitialTokens_(std::move(initialTokens)),
+        MaxOccupancy_(0),
+        AccumulatedOccupancy_(0)
+  {}
+
+  void
+  ResetState() override
+  {
+    Tokens_.clear();
+    for (auto token : InitialTokens_)
+    {
+      Tokens_.emplace_back();
+      Tokens_.back().Data = token;
+    }
+    MaxOccupancy_ = Tokens_.size();
+    AccumulatedOccupancy_ = 0;
+  }
+
+  void
+  ComputeOutputs() override
+  {
+    if (!Tokens_.empty())
+      SetOutValid(0, true, Tokens_.front());
+    else
+      SetOutValid(0, PassThrough_ && InValid(0), InToken(0));
+  }
+
+  void
+  ComputeReadies() override
+  {
+    SetInReady(0, Tokens_.size() < Capacity_);
+  }
+
+  void
+  ClockEdge() override
+  {
+    AccumulatedOccupancy_ += Tokens_.size();
+
+    auto outFires = OutFires(0);
+    auto inFires = InFires(0);
+    if (Tokens_.empty() && outFires)
+    {
+      // The token passed through the buffer
+      return;
+    }
+
+    if (outFires)
+      Tokens_.pop_front();
+    if (inFires)
+      Tokens_.push_back(InToken(0));
+
+    MaxOccupancy_ = std::max(MaxOccupancy_, Tokens_.size());
+  }
+
+  [[nodiscard]] RhlsSimulator::BufferStatistics
+  GetStatistics() const
+  {
+    return { Node_, Capacity_, MaxOccupancy_, AccumulatedOccupancy_ };
+  }
+
+  [[nodiscard]] bool
+  IsBufferOp() const noexcept
+  {
+    return Node_ != nullptr;
+  }
+
+private:
+  const rvsdg::simple_node * Node_;
+  size_t Capacity_;
+  bool PassThrough_;
+  std::vector<uint64_t> InitialTokens_;
+
+  std::deque<SimulationToken> Tokens_;
+  size_t MaxOccupancy_;
+  size_t AccumulatedOccupancy_;
+};
+
+/**
+ * Holds a loop invariant value. Predicate 0 consumes a new value, predicate 1 reuses the stored
+ * one.
+ */
+class LoopConstantBufferUnit final : public SimulationUnit
+{
+public:
+  void
+  ResetState() override
+  {
+    Data_ = {};
+  }
+
+  void
+  ComputeOutputs() override
+  {
+    auto valid = InValid(0) && (InData(0) != 0 || InValid(1));
+    auto passThrough = InValid(1) && InData(0) == 0;
+    SetOutValid(0, valid, passThrough ? InToken(1) : Data_);
+  }
+
+  void
+  ComputeReadies() override
+  {
+    SetInReady(0, OutReady(0) && OutValid(0));
+    SetInReady(1, OutReady(0) && InData(0) == 0 && InValid(0));
+  }
+
+  void
+  ClockEdge() override
+  {
+    if (InFires(1))
+      Data_ = InToken(1);
+  }
+
+private:
+  SimulationToken Data_;
+};
+
+/**
+ * Load with registered outputs. Inputs: address, states..., memory data. Outputs: data,
+ * states..., address.
+ */
+class LoadUnit final : public SimulationUnit
+{
+public:
+  void
+  ResetState() override
+  {
+    Sent_ = false;
+    Valid_.assign(NumOutputs() - 1, false);
+    Data_.assign(NumOutputs() - 1, {});
+  }
+
+  void
+  ComputeOutputs() override
+  {
+    auto memData = NumInputs() - 1;
+    auto memAddress = NumOutputs() - 1;
+
+    SetOutValid(memAddress, CanRequest(), InToken(0));
+
+    if (Valid_[0])
+      SetOutValid(0, true, Data_[0]);
+    else
+      SetOutValid(0, Sent_ && InValid(memData), InToken(memData));
+
+    for (size_t n = 1; n < memAddress; n++)
+      SetOutValid(n, Valid_[n], Data_[n]);
+  }
+
+  void
+  ComputeReadies() override
+  {
+    auto memData = NumInputs() - 1;
+    auto memAddress = NumOutputs() - 1;
+
+    auto ready = CanRequest() && OutReady(memAddress);
+    for (size_t n = 0; n < memData; n++)
+      SetInReady(n, ready);
+    SetInReady(memData, Sent_);
+  }
+
+  void
+  ClockEdge() override
+  {
+    auto memData = NumInputs() - 1;
+    auto memAddress = NumOutputs() - 1;
+
+    for (size_t n = 1; n < memAddress; n++)
+    {
+      if (OutFires(n))
+        Valid_[n] = false;
+    }
+
+    if (OutFires(memAddress))
+    {
+      Sent_ = true;
+      for (size_t n = 1; n < memAddress; n++)
+      {
+        Valid_[n] = true;
+        Data_[n] = InToken(n);
+      }
+    }
+
+    if (InFires(memData))
+    {
+      Sent_ = false;
+      Valid_[0] = true;
+      Data_[0] = InToken(memData);
+    }
+
+    if (OutFires(0))
+      Valid_[0] = false;
+  }
+
+  [[nodiscard]] bool
+  IsBusy() const noexcept override
+  {
+    return Sent_;
+  }
+
+private:
+  [[nodiscard]] bool
+  CanRequest() const noexcept
+  {
+    if (Sent_)
+      return false;
+
+    for (size_t n = 0; n < NumInputs() - 1; n++)
+    {
+      if (!InValid(n))
+        return false;
+    }
+
+    return std::none_of(
+        Valid_.begin(),
+        Valid_.end(),
+        [](bool valid)
+        {
+          return valid;
+        });
+  }
+
+  bool Sent_ = false;
+  std::vector<bool> Valid_;
+  std::vector<SimulationToken> Data_;
+};
+
+/**
+ * Store with registered state outputs. Inputs: address, data, states... Outputs: states...,
+ * address, data.
+ */
+class StoreUnit final : public SimulationUnit
+{
+public:
+  void
+  ResetState() override
+  {
+    Valid_.assign(NumOutputs() - 2, false);
+    Data_.assign(NumOutputs() - 2, {});
+  }
+
+  void
+  ComputeOutputs() override
+  {
+    auto numStates = NumOutputs() - 2;
+    auto canRequest = CanRequest();
+    SetOutValid(numStates, canRequest, InToken(0));
+    SetOutValid(numStates + 1, canRequest, InToken(1));
+    for (size_t n = 0; n < numStates; n++)
+      SetOutValid(n, Valid_[n], Data_[n]);
+  }
+
+  void
+  ComputeReadies() override
+  {
+    auto numStates = NumOutputs() - 2;
+    auto ready = CanRequest() && OutReady(numStates) && OutReady(numStates + 1);
+    for (size_t n = 0; n < NumInputs(); n++)
+      SetInReady(n, ready);
+  }
+
+  void
+  ClockEdge() override
+  {
+    auto numStates = NumOutputs() - 2;
+    for (size_t n = 0; n < numStates; n++)
+    {
+      if (OutFires(n))
+        Valid_[n] = false;
+    }
+
+    if (OutFires(numStates))
+    {
+      for (size_t n = 0; n < numStates; n++)
+      {
+        Valid_[n] = true;
+        Data_[n] = InToken(n + 2);
+      }
+    }
+  }
+
+private:
+  [[nodiscard]] bool
+  CanRequest() const noexcept
+  {
+    return AllInputsValid()
+        && std::none_of(
+               Valid_.begin(),
+               Valid_.end(),
+               [](bool valid)
+               {
+                 return valid;
+               });
+  }
+
+  std::vector<bool> Valid_;
+  std::vector<SimulationToken> Data_;
+};
+
+/**
+ * Decoupled load. Address and data paths are independent.
+ */
+class DecoupledLoadUnit final : public SimulationUnit
+{
+public:
+  void
+  ComputeOutputs() override
+  {
+    SetOutValid(0, InValid(1), InToken(1));
+    SetOutValid(1, InValid(0), InToken(0));
+  }
+
+  void
+  ComputeReadies() override
+  {
+    SetInReady(0, OutReady(1));
+    SetInReady(1, OutReady(0));
+  }
+};
+
+/**
+ * Decoupled load that coalesces consecutive accesses to the same line into burst requests. The
+ * beats of the requested lines are collected in an unpacking buffer, from which the elements are
+ * served in the order of their addresses. Inputs: address, memory data, loop predicate. A loop
+ * predicate of zero marks the first address after the loop was entered, which always requests a
+ * new line.
+ */
+class BurstLoadUnit final : public SimulationUnit
+{
+  struct Element
+  {
+    size_t Offset;
+    bool NewLine;
+  };
+
+public:
+  explicit BurstLoadUnit(const burst_load_op & op)
+      : ElementBytes_(op.GetLoadedType()->nbits() / 8),
+        LineBytes_(ElementBytes_ * op.GetBurstLength()),
+        NumBeats_(op.GetNumBeats()),
+        Depth_(op.GetDepth())
+  {}
+
+  void
+  ResetState() override
+  {
+    LastLine_ = 0;
+    LastLineValid_ = false;
+    LineOpen_ = false;
+    NumOutstanding_ = 0;
+    Elements_.clear();
+    Lines_.clear();
+    Beats_.clear();
+  }
+
+  void
+  ComputeOutputs() override
+  {
+    auto line = InData(0) / LineBytes_;
+    auto valid = InValid(0) && InValid(2) && !IsFull();
+    SetOutValid(1, valid && IsNewLine(line) && CanIssue(), line * LineBytes_);
+
+    valid = !Elements_.empty() && Lines_.size() > GetLineIndex();
+    SetOutValid(0, valid, valid ? GetElement() : 0);
+  }
+
+  void
+  ComputeReadies() override
+  {
+    auto line = InData(0) / LineBytes_;
+    auto ready = InValid(0) && InValid(2) && !IsFull()
+        && (!IsNewLine(line) || (CanIssue() && OutReady(1)));
+    SetInReady(0, ready);
+    SetInReady(1, true);
+    SetInReady(2, ready);
+  }
+
+  void
+  ClockEdge() override
+  {
+    if (InFires(1))
+    {
+      Beats_.push_back(InData(1));
+      if (Beats_.size() == NumBeats_)
+      {
+        Lines_.push_back(std::move(Beats_));
+        Beats_.clear();
+      }
+    }
+
+    if (OutFires(0))
+    {
+      if (GetLineIndex() == 1)
+      {
+        // the element starts a new line, so the previous line has been consumed completely
+        Lines_.pop_front();
+        NumOutstanding_--;
+      }
+      LineOpen_ = true;
+      Elements_.pop_front();
+    }
+
+    if (InFires(0))
+    {
+      auto line = InData(0) / LineBytes_;
+      auto newLine = IsNewLine(line);
+      Elements_.push_back({ (InData(0) % LineBytes_) / ElementBytes_, newLine });
+      if (newLine)
+      {
+        LastLine_ = line;
+        LastLineValid_ = true;
+        NumOutstanding_++;
+      }
+    }
+  }
+
+private:
+  [[nodiscard]] bool
+  IsNewLine(uint64_t line) const noexcept
+  {
+    return InData(2) == 0 || !LastLineValid_ || line != LastLine_;
+  }
+
+  [[nodiscard]] bool
+  IsFull() const noexcept
+  {
+    return Elements_.size() >= Depth_ * LineBytes_ / ElementBytes_;
+  }
+
+  [[nodiscard]] bool
+  CanIssue() const noexcept
+  {
+    return NumOutstanding_ < Depth_;
+  }
+
+  [[nodiscard]] size_t
+  GetLineIndex() const noexcept
+  {
+    return Elements_.front().NewLine && LineOpen_ ? 1 : 0;
+  }
+
+  [[nodiscard]] uint64_t
+  GetElement() const
+  {
+    auto & beats = Lines_[GetLineIndex()];
+    auto byteOffset = Elements_.front().Offset * ElementBytes_;
+    auto value = beats[byteOffset / 8] >> (byteOffset % 8 * 8);
+    return ElementBytes_ < 8 ? value & ((uint64_t(1) << (ElementBytes_ * 8)) - 1) : value;
+  }
+
+  size_t ElementBytes_;
+  size_t LineBytes_;
+  size_t NumBeats_;
+  size_t Depth_;
+
+  uint64_t LastLine_ = 0;
+  bool LastLineValid_ = false;
+  bool LineOpen_ = false;
+  size_t NumOutstanding_ = 0;
+  std::deque<Element> Elements_;
+  std::deque<std::vector<uint64_t>> Lines_;
+  std::vector<uint64_t> Beats_;
+};
+
+/**
+ * Blocks addresses that are present in the queue. Inputs: check, enqueue, dequeue.
+ */
+class AddressQueueUnit final : public SimulationUnit
+{
+public:
+  AddressQueueUnit(size_t capacity, bool combinatorial)
+      : Capacity_(capacity),
+        Combinatorial_(combinatorial)
+  {}
+
+  void
+  ResetState() override
+  {
+    Queue_.clear();
+  }
+
+  void
+  ComputeOutputs() override
+  {
+    auto inQueue = std::find(Queue_.begin(), Queue_.end(), InData(0)) != Queue_.end();
+    if (Combinatorial_)
+      inQueue = inQueue || (InValid(1) && InData(1) == InData(0));
+
+    SetOutValid(0, InValid(0) && !inQueue, InToken(0));
+  }
+
+  void
+  ComputeReadies() override
+  {
+    SetInReady(0, OutValid(0) && OutReady(0));
+    SetInReady(1, Queue_.size() < Capacity_);
+    SetInReady(2, !Queue_.empty());
+  }
+
+  void
+  ClockEdge() override
+  {
+    if (InFires(2))
+      Queue_.pop_front();
+    if (InFires(1))
+      Queue_.push_back(InData(1));
+  }
+
+private:
+  size_t Capacity_;
+  bool Combinatorial_;
+  std::deque<uint64_t> Queue_;
+};
+
+/**
+ * Routes memory responses to the load with the corresponding id. Responses with unknown ids,
+ * e.g., for stores, are dropped.
+ */
+class MemoryResponseUnit final : public SimulationUnit
+{
+public:
+  explicit MemoryResponseUnit(const rvsdg::simple_node & node)
+  {
+    for (size_t n = 0; n < node.noutputs(); n++)
+      OutputTypes_.push_back(node.output(n)->Type());
+  }
+
+  void
+  ComputeOutputs() override
+  {
+    std::vector<bool> valid(NumOutputs(), false);
+    for (size_t n = 0; n < NumInputs(); n++)
+    {
+      auto id = InToken(n).Id;
+      if (InValid(n) && id < NumOutputs() && !valid[id])
+      {
+        valid[id] = true;
+        SetOutValid(id, true, Mask(InData(n), *OutputTypes_[id]));
+      }
+    }
+
+    for (size_t n = 0; n < NumOutputs(); n++)
+    {
+      if (!valid[n])
+        SetOutValid(n, false);
+    }
+  }
+
+  void
+  ComputeReadies() override
+  {
+    for (size_t n = 0; n < NumInputs(); n++)
+    {
+      auto id = InToken(n).Id;
+      SetInReady(n, !InValid(n) || id >= NumOutputs() || OutReady(id));
+    }
+  }
+
+private:
+  std::vector<std::shared_ptr<const rvsdg::Type>> OutputTypes_;
+};
+
+/**
+ * Arbitrates the requests of loads and stores with a fixed priority. Loads come first and are
+ * followed by the stores.
+ */
+class MemoryRequestUnit final : public SimulationUnit
+{
+public:
+  explicit MemoryRequestUnit(const rvsdg::simple_node & node)
+  {
+    auto op = util::AssertedCast<const mem_req_op>(&node.operation());
+    NumLoads_ = op->get_nloads();
+    for (auto & type : *op->GetLoadTypes())
+      LoadSizes_.push_back(GetRequestSize(*type));
+    for (auto & type : *op->GetStoreTypes())
+      StoreSizes_.push_back(GetRequestSize(*type));
+    for (size_t n = 0; n < node.noutputs(); n++)
+    {
+      auto type = util::AssertedCast<const bundletype>(&node.output(n)->type());
+      HasWrite_.push_back(type->get_element_type("write") != nullptr);
+    }
+  }
+
+  void
+  ComputeOutputs() override
+  {
+    Granted_.assign(NumInputs(), false);
+    for (size_t port = 0; port < NumOutputs(); port++)
+    {
+      SimulationToken request;
+      auto valid = false;
+      for (size_t n = 0; n < NumLoads_ && !valid; n++)
+      {
+        if (!Granted_[n] && InValid(n))
+        {
+          Granted_[n] = true;
+          valid = true;
+          request.Address = InData(n);
+          request.Size = LoadSizes_[n];
+          request.Id = n;
+        }
+      }
+      for (size_t n = 0; HasWrite_[port] && n < StoreSizes_.size() && !valid; n++)
+      {
+        auto address = NumLoads_ + 2 * n;
+        if (!Granted_[address] && InValid(address) && InValid(address + 1))
+        {
+          Granted_[address] = true;
+          Granted_[address + 1] = true;
+          valid = true;
+          request.Address = InData(address);
+          request.Data = InData(address + 1);
+          request.Size = StoreSizes_[n];
+          request.Id = NumLoads_ + n;
+          request.Write = true;
+        }
+      }
+      Ports_[port] = request.Id;
+      SetOutValid(port, valid, request);
+    }
+  }
+
+  void
+  ComputeReadies() override
+  {
+    std::vector<bool> ready(NumInputs(), false);
+    for (size_t port = 0; port < NumOutputs(); port++)
+    {
+      if (!OutValid(port))
+        continue;
+
+      auto id = Ports_[port];
+      if (id < NumLoads_)
+      {
+        ready[id] = OutReady(port);
+      }
+      else
+      {
+        auto address = NumLoads_ + 2 * (id - NumLoads_);
+        ready[address] = OutReady(port);
+        ready[address + 1] = OutReady(port);
+      }
+    }
+
+    for (size_t n = 0; n < NumInputs(); n++)
+      SetInReady(n, ready[n]);
+  }
+
+  void
+  ResetState() override
+  {
+    Granted_.assign(NumInputs(), false);
+    Ports_.assign(NumOutputs(), 0);
+  }
+
+private:
+  size_t NumLoads_;
+  std::vector<uint64_t> LoadSizes_;
+  std::vector<uint64_t> StoreSizes_;
+  std::vector<bool> HasWrite_;
+
+  std::vector<bool> Granted_;
+  std::vector<uint64_t> Ports_;
+};
+
+/**
+ * Memory attached to a request/response port pair of the lambda. Requests are always accepted
+ * and answered in order after a fixed latency. Requests of more than eight bytes are bursts, which
+ * are answered with one 64 bit beat per cycle.
+ */
+class MemoryPortUnit final : public SimulationUnit
+{
+  struct Response
+  {
+    size_t Cycle;
+    SimulationToken Token;
+  };
+
+public:
+  MemoryPortUnit(
+      RhlsSimulator & simulator,
+      const size_t & cycle,
+      size_t & numRequests,
+      size_t latency)
+      : Simulator_(&simulator),
+        Cycle_(&cycle),
+        NumRequests_(&numRequests),
+        Latency_(std::max<size_t>(latency, 1))
+  {}
+
+  void
+  ResetState() override
+  {
+    Responses_.clear();
+  }
+
+  void
+  ComputeOutputs() override
+  {
+    auto valid = !Responses_.empty() && Responses_.front().Cycle <= *Cycle_;
+    SetOutValid(0, valid, valid ? Responses_.front().Token : SimulationToken());
+  }
+
+  void
+  ComputeReadies() override
+  {
+    SetInReady(0, true);
+  }
+
+  void
+  ClockEdge() override
+  {
+    if (OutFires(0))
+      Responses_.pop_front();
+
+    if (!InFires(0))
+      return;
+
+    auto & request = InToken(0);
+    auto numBytes = size_t(1) << request.Size;
+    (*NumRequests_)++;
+    SimulationToken response;
+    response.Id = request.Id;
+    if (request.Write)
+    {
+      if (numBytes > 8)
+        throw util::error("Burst writes are not supported in RHLS simulation.");
+      Simulator_->WriteMemory(request.Address, request.Data, numBytes);
+      response.Data = 0xFFFFFFFF;
+      Responses_.push_back({ *Cycle_ + Latency_, response });
+      return;
+    }
+
+    // bursts queue up behind earlier responses, as the port delivers one beat per cycle
+    auto cycle = *Cycle_ + Latency_;
+    if (!Responses_.empty())
+      cycle = std::max(cycle, Responses_.back().Cycle + 1);
+    for (size_t offset = 0; offset < numBytes; offset += 8)
+    {
+      response.Data =
+          Simulator_->ReadMemory(request.Address + offset, std::min<size_t>(numBytes, 8));
+      Responses_.push_back({ cycle++, response });
+    }
+  }
+
+  [[nodiscard]] bool
+  IsBusy() const noexcept override
+  {
+    return !Responses_.empty();
+  }
+
+private:
+  RhlsSimulator * Simulator_;
+  const size_t * Cycle_;
+  size_t * NumRequests_;
+  size_t Latency_;
+  std::deque<Response> Responses_;
+};
+
+std::string
+GetOutputName(const rvsdg::output & output)
+{
+  if (auto nodeOutput = dynamic_cast<const rvsdg::node_output *>(&output))
+  {
+    return util::strfmt(nodeOutput->node()->operation().debug_string(), ":", output.index());
+  }
+
+  return util::strfmt("ARG:", output.index());
+}
+
+std::string
+GetInputName(const rvsdg::input & input)
+{
+  if (auto nodeInput = dynamic_cast<const rvsdg::node_input *>(&input))
+  {
+    return util::strfmt(nodeInput->node()->operation().debug_string(), ":", input.index());
+  }
+
+  return util::strfmt("RES:", input.index());
+}
+
+/**
+ * Traces \p output through the arguments and results of loop nodes to its producer.
+ */
+const rvsdg::output &
+TraceOrigin(const rvsdg::output & output)
+{
+  auto origin = &output;
+  for (size_t depth = 0;; depth++)
+  {
+    if (depth > 1000)
+      throw util::error("Unable to trace origin in RHLS simulation.");
+
+    if (auto argument = dynamic_cast<const EntryArgument *>(origin))
+    {
+      origin = argument->input()->origin();
+    }
+    else if (auto argument = dynamic_cast<const backedge_argument *>(origin))
+    {
+      origin = const_cast<backedge_argument *>(argument)->result()->origin();
+    }
+    else if (auto structuralOutput = dynamic_cast<const rvsdg::structural_output *>(origin))
+    {
+      if (!dynamic_cast<const loop_node *>(structuralOutput->node()))
+        throw util::error(
+            "Unsupported structural node in RHLS simulation: "
+            + structuralOutput->node()->operation().debug_string());
+
+      auto output = const_cast<rvsdg::structural_output *>(structuralOutput);
+      JLM_ASSERT(output->results.size() == 1);
+      origin = output->results.begin().ptr()->origin();
+    }
+    else
+    {
+      return *origin;
+    }
+  }
+}
+
+}
+
+RhlsSimulator::~RhlsSimulator() noexcept = default;
+
+RhlsSimulator::RhlsSimulator(const llvm::lambda::node & lambda)
+    : RhlsSimulator(lambda, Configuration())
+{}
+
+RhlsSimulator::RhlsSimulator(const llvm::lambda::node & lambda, Configuration configuration)
+    : Configuration_(std::move(configuration)),
+      NumCycles_(0),
+      NumMemoryRequests_(0)
+{
+  BuildUnits(lambda);
+}
+
+SimulationChannel &
+RhlsSimulator::GetChannel(const rvsdg::output & origin)
+{
+  auto & producer = TraceOrigin(origin);
+  auto it = ChannelMap_.find(&producer);
+  if (it != ChannelMap_.end())
+    return *it->second;
+
+  Channels_.push_back(std::make_unique<SimulationChannel>(producer));
+  ChannelMap_[&producer] = Channels_.back().get();
+  return *Channels_.back();
+}
+
+void
+RhlsSimulator::ConnectInputs(const rvsdg::node & node, SimulationUnit & unit)
+{
+  for (size_t n = 0; n < node.ninputs(); n++)
+    unit.AddInput(GetChannel(*node.input(n)->origin()), *node.input(n));
+
+  for (size_t n = 0; n < node.noutputs(); n++)
+  {
+    auto & channel = GetChannel(*node.output(n));
+    channel.SetIsConstant(node.ninputs() == 0);
+    unit.AddOutput(channel);
+  }
+}
+
+void
+RhlsSimulator::BuildUnits(rvsdg::Region & region)
+{
+  for (auto & node : rvsdg::topdown_traverser(&region))
+  {
+    if (auto loopNode = dynamic_cast<loop_node *>(node))
+    {
+      BuildUnits(*loopNode->subregion());
+      continue;
+    }
+
+    auto simpleNode = dynamic_cast<rvsdg::simple_node *>(node);
+    if (simpleNode == nullptr)
+      throw util::error(
+          "Unsupported structural node in RHLS simulation: " + node->operation().debug_string());
+
+    std::unique_ptr<SimulationUnit> unit;
+    auto & operation = simpleNode->operation();
+    if (auto op = dynamic_cast<const fork_op *>(&operation))
+    {
+      if (op->IsConstant())
+        unit = std::make_unique<ConstantForkUnit>();
+      else
+        unit = std::make_unique<EagerForkUnit>(true);
+    }
+    else if (dynamic_cast<const state_gate_op *>(&operation))
+    {
+      unit = std::make_unique<EagerForkUnit>(false);
+    }
+    else if (dynamic_cast<const branch_op *>(&operation))
+    {
+      unit = std::make_unique<BranchUnit>();
+    }
+    else if (auto op = dynamic_cast<const mux_op *>(&operation))
+    {
+      if (op->discarding)
+        unit = std::make_unique<DiscardingMuxUnit>();
+      else
+        unit = std::make_unique<MuxUnit>();
+    }
+    else if (dynamic_cast<const merge_op *>(&operation))
+    {
+      unit = std::make_unique<MergeUnit>();
+    }
+    else if (dynamic_cast<const sink_op *>(&operation))
+    {
+      unit = std::make_unique<SinkUnit>();
+    }
+    else if (auto op = dynamic_cast<const perf_counter_op *>(&operation))
+    {
+      unit = std::make_unique<PerformanceCounterUnit>(*op);
+    }
+    else if (auto op = dynamic_cast<const buffer_op *>(&operation))
+    {
+      unit = std::make_unique<BufferUnit>(simpleNode, op->capacity, op->pass_through);
+    }
+    else if (dynamic_cast<const predicate_buffer_op *>(&operation))
+    {
+      unit = std::make_unique<BufferUnit>(nullptr, 1, true, std::vector<uint64_t>({ 0 }));
+    }
+    else if (dynamic_cast<const loop_constant_buffer_op *>(&operation))
+    {
+      unit = std::make_unique<LoopConstantBufferUnit>();
+    }
+    else if (dynamic_cast<const load_op *>(&operation))
+    {
+      unit = std::make_unique<LoadUnit>();
+    }
+    else if (dynamic_cast<const store_op *>(&operation))
+    {
+      unit = std::make_unique<StoreUnit>();
+    }
+    else if (dynamic_cast<const decoupled_load_op *>(&operation))
+    {
+      unit = std::make_unique<DecoupledLoadUnit>();
+    }
+    else if (auto op = dynamic_cast<const burst_load_op *>(&operation))
+    {
+      unit = std::make_unique<BurstLoadUnit>(*op);
+    }
+    else if (auto op = dynamic_cast<const addr_queue_op *>(&operation))
+    {
+      unit = std::make_unique<AddressQueueUnit>(op->capacity, op->combinatorial);
+    }
+    else if (dynamic_cast<const mem_resp_op *>(&operation))
+    {
+      unit = std::make_unique<MemoryResponseUnit>(*simpleNode);
+    }
+    else if (dynamic_cast<const mem_req_op *>(&operation))
+    {
+      unit = std::make_unique<MemoryRequestUnit>(*simpleNode);
+    }
+    else if (
+        dynamic_cast<const local_mem_op *>(&operation)
+        || dynamic_cast<const local_mem_resp_op *>(&operation)
+        || dynamic_cast<const local_load_op *>(&operation)
+        || dynamic_cast<const local_store_op *>(&operation)
+        || dynamic_cast<const local_mem_req_op *>(&operation))
+    {
+      throw util::error(
+          "Local memories are not supported in RHLS simulation: " + operation.debug_string());
+    }
+    else
+    {
+      unit = std::make_unique<OperationUnit>(operation);
+    }
+
+    ConnectInputs(*simpleNode, *unit);
+    Units_.push_back(std::move(unit));
+  }
+}
+
+void
+RhlsSimulator::BuildUnits(const llvm::lambda::node & lambda)
+{
+  auto region = lambda.subregion();
+
+  std::vector<SimulationChannel *> responses;
+  for (size_t n = 0; n < region->narguments(); n++)
+  {
+    auto argument = region->argument(n);
+    if (rvsdg::is<bundletype>(argument->type()))
+    {
+      responses.push_back(&GetChannel(*argument));
+      continue;
+    }
+
+    auto unit = std::make_unique<ArgumentUnit>();
+    unit->AddOutput(GetChannel(*argument));
+    if (!rvsdg::is<rvsdg::StateType>(argument->type()))
+      Arguments_.push_back(unit.get());
+    Units_.push_back(std::move(unit));
+  }
+
+  BuildUnits(*region);
+
+  std::vector<const rvsdg::input *> requests;
+  for (size_t n = 0; n < region->nresults(); n++)
+  {
+    auto result = region->result(n);
+    if (rvsdg::is<bundletype>(result->type()))
+    {
+      requests.push_back(result);
+      continue;
+    }
+
+    auto unit = std::make_unique<SinkUnit>();
+    unit->AddInput(GetChannel(*result->origin()), *result);
+    Results_.push_back(unit.get());
+    if (!rvsdg::is<rvsdg::StateType>(result->type()))
+      ValueResults_.push_back(unit.get());
+    Units_.push_back(std::move(unit));
+  }
+
+  if (requests.size() != responses.size())
+    throw util::error("Mismatching number of memory request and response ports.");
+
+  for (size_t n = 0; n < requests.size(); n++)
+  {
+    auto it = Configuration_.PortLatencies.find(n);
+    auto latency =
+        it != Configuration_.PortLatencies.end() ? it->second : Configuration_.MemoryLatency;
+    auto unit = std::make_unique<MemoryPortUnit>(*this, NumCycles_, NumMemoryRequests_, latency);
+    unit->AddInput(GetChannel(*requests[n]->origin()), *requests[n]);
+    unit->AddOutput(*responses[n]);
+    Units_.push_back(std::move(unit));
+  }
+}
+
+void
+RhlsSimulator::ResetState()
+{
+  NumCycles_ = 0;
+  NumMemoryRequests_ = 0;
+  for (auto & channel : Channels_)
+    channel->ResetState();
+  for (auto & unit : Units_)
+    unit->ResetState();
+}
+
+bool
+RhlsSimulator::Step()
+{
+  for (auto & channel : Channels_)
+    channel->ResetSignals();
+
+  // Valid and data signals only depend on the state of the units and the valid and data signals
+  // of their inputs, while ready signals also depend on the valid signals. We therefore first
+  // propagate the valid signals until a fixed point is reached, followed by the ready signals.
+  auto propagate = [&](void (SimulationUnit::*compute)())
+  {
+    for (size_t iteration = 0;; iteration++)
+    {
+      if (iteration > Units_.size() + 1)
+        throw util::error("Combinational cycle detected in RHLS simulation.");
+
+      for (auto & unit : Units_)
+        ((*unit).*compute)();
+
+      auto modified = false;
+      for (auto & channel : Channels_)
+        modified = channel->ClearModified() || modified;
+
+      if (!modified)
+        break;
+    }
+  };
+  propagate(&SimulationUnit::ComputeOutputs);
+  propagate(&SimulationUnit::ComputeReadies);
+
+  auto progress = false;
+  for (auto & channel : Channels_)
+  {
+    if (!channel->IsConstant())
+    {
+      for (size_t n = 0; n < channel->NumConsumers(); n++)
+        progress = progress || channel->Fires(n);
+    }
+  }
+
+  for (auto & unit : Units_)
+  {
+    progress = progress || unit->IsBusy();
+    unit->ClockEdge();
+  }
+  for (auto & channel : Channels_)
+    channel->ClockEdge();
+
+  NumCycles_++;
+  return progress;
+}
+
+std::vector<uint64_t>
+RhlsSimulator::Run(const std::vector<uint64_t> & arguments)
+{
+  if (arguments.size() != Arguments_.size())
+    throw util::error(util::strfmt(
+        "Expected ",
+        Arguments_.size(),
+        " arguments for RHLS simulation, but got ",
+        arguments.size(),
+        "."));
+
+  ResetState();
+  for (size_t n = 0; n < arguments.size(); n++)
+    static_cast<ArgumentUnit *>(Arguments_[n])->SetValue(arguments[n]);
+
+  auto finished = [&]()
+  {
+    return std::all_of(
+        Results_.begin(),
+        Results_.end(),
+        [](SimulationUnit * unit)
+        {
+          return static_cast<SinkUnit *>(unit)->HasReceived();
+        });
+  };
+
+  while (!finished())
+  {
+    if (NumCycles_ >= Configuration_.MaxCycles)
+      throw util::error(util::strfmt(
+          "RHLS simulation did not finish within ",
+          Configuration_.MaxCycles,
+          " cycles."));
+
+    if (!Step())
+      throw util::error(util::strfmt("RHLS simulation deadlocked in cycle ", NumCycles_, "."));
+  }
+
+  std::vector<uint64_t> results;
+  for (auto unit : ValueResults_)
+    results.push_back(static_cast<SinkUnit *>(unit)->Value());
+
+  return results;
+}
+
+std::vector<RhlsSimulator::EdgeStatistics>
+RhlsSimulator::GetEdgeStatistics() const
+{
+  std::vector<EdgeStatistics> statistics;
+  for (auto & channel : Channels_)
+  {
+    for (size_t n = 0; n < channel->NumConsumers(); n++)
+    {
+      auto & consumer = channel->Consumer(n);
+      statistics.push_back({ &channel->Origin(),
+                             &consumer,
+                             GetOutputName(channel->Origin()) + " -> " + GetInputName(consumer),
+                             channel->NumTransfers(n),
+                             channel->NumStalls(n),
+                             channel->NumStarves(n) });
+    }
+  }
+
+  return statistics;
+}
+
+std::vector<RhlsSimulator::BufferStatistics>
+RhlsSimulator::GetBufferStatistics() const
+{
+  std::vector<BufferStatistics> statistics;
+  for (auto & unit : Units_)
+  {
+    auto buffer = dynamic_cast<const BufferUnit *>(unit.get());
+    if (buffer && buffer->IsBufferOp())
+      statistics.push_back(buffer->GetStatistics());
+  }
+
+  return statistics;
+}
+
+std::unordered_map<size_t, size_t>
+RhlsSimulator::GetPerformanceCounters() const
+{
+  std::unordered_map<size_t, size_t> counters;
+  for (auto & unit : Units_)
+  {
+    if (auto counter = dynamic_cast<const PerformanceCounterUnit *>(unit.get()))
+      counters[counter->Operation().id()] = counter->Count();
+  }
+
+  return counters;
+}
+
+size_t
+RhlsSimulator::GetNumStalls() const
+{
+  size_t numStalls = 0;
+  for (auto & edge : GetEdgeStatistics())
+    numStalls += edge.Stalls;
+
+  return numStalls;
+}
+
+std::string
+RhlsSimulator::ToString() const
+{
+  std::ostringstream report;
+  report << "Cycles: " << NumCycles_ << "\n";
+  report << "Memory requests: " << NumMemoryRequests_ << "\n";
+
+  auto edges = GetEdgeStatistics();
+  std::stable_sort(
+      edges.begin(),
+      edges.end(),
+      [](const EdgeStatistics & a, const EdgeStatistics & b)
+      {
+        return a.Stalls > b.Stalls;
+      });
+  report << "Stalls: " << GetNumStalls() << "\n";
+  for (auto & edge : edges)
+  {
+    if (edge.Stalls == 0)
+      break;
+
+    report << "  " << edge.Name << ": " << edge.Stalls << " stalls, " << edge.Transfers
+           << " transfers\n";
+  }
+
+  report << "Buffers:\n";
+  for (auto & buffer : GetBufferStatistics())
+  {
+    report << "  " << buffer.Node->operation().debug_string() << ": max " << buffer.MaxOccupancy
+           << "/" << buffer.Capacity << ", avg " << buffer.AverageOccupancy(NumCycles_) << "\n";
+  }
+
+  return report.str();
+}
+
+void
+RhlsSimulator::WriteMemory(uint64_t address, uint64_t value, size_t numBytes)
+{
+  JLM_ASSERT(numBytes <= 8);
+  for (size_t n = 0; n < numBytes; n++)
+    Memory_[address + n] = static_cast<uint8_t>(value >> (8 * n));
+}
+
+uint64_t
+RhlsSimulator::ReadMemory(uint64_t address, size_t numBytes) const
+{
+  JLM_ASSERT(numBytes <= 8);
+  uint64_t value = 0;
+  for (size_t n = 0; n < numBytes; n++)
+  {
+    auto it = Memory_.find(address + n);
+    if (it != Memory_.end())
+      value |= static_cast<uint64_t>(it->second) << (8 * n);
+  }
+
+  return value;
+}
+
+}
@@ -0,0 +1,222 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_HLS_UTIL_RHLSSIMULATOR_HPP
+#define JLM_HLS_UTIL_RHLSSIMULATOR_HPP
+
+#include <jlm/llvm/ir/operators/lambda.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace jlm::hls
+{
+
+class SimulationChannel;
+class SimulationUnit;
+
+/**
+ * Cycle-level simulator for RHLS dataflow graphs.
+ *
+ * The simulator operates on the lambda produced by rvsdg2rhls and models every node as an
+ * elastic circuit with valid/ready handshaking, following the semantics of the FIRRTL modules
+ * emitted by RhlsToFirrtlConverter. Loop nodes are flattened, i.e., entry arguments, exit results
+ * and back-edges become plain wires. Outputs with more than one user behave like an eager fork.
+ *
+ * Memory request/response bundles of the lambda are connected to a simple memory model with a
+ * configurable latency per port. Non-state arguments of the lambda are provided as a single token
+ * at the start of the simulation, and the simulation finishes once every non-bundle result
+ * received a token.
+ *
+ * This permits the evaluation of buffer sizing, loop pipelining, and memory latency changes in
+ * unit tests without Verilator.
+ */
+class RhlsSimulator final
+{
+public:
+  /**
+   * Configuration of the simulated environment.
+   */
+  struct Configuration
+  {
+    /**
+     * Latency in cycles of memory responses. Mirrors the default of the Verilator harness.
+     */
+    size_t MemoryLatency = 10;
+
+    /**
+     * Per port latency overrides. Ports without an entry use MemoryLatency.
+     */
+    std::unordered_map<size_t, size_t> PortLatencies = {};
+
+    /**
+     * Number of cycles after which the simulation is aborted.
+     */
+    size_t MaxCycles = 1000000;
+  };
+
+  /**
+   * Handshake statistics of a single producer/consumer edge.
+   */
+  struct EdgeStatistics
+  {
+    const rvsdg::output * Producer;
+    const rvsdg::input * Consumer;
+    std::string Name;
+
+    /**
+     * Number of tokens that were transferred over the edge.
+     */
+    size_t Transfers;
+
+    /**
+     * Number of cycles in which the producer offered a token that the consumer did not accept.
+     */
+    size_t Stalls;
+
+    /**
+     * Number of cycles in which the consumer was ready, but no token was offered.
+     */
+    size_t Starves;
+  };
+
+  /**
+   * Occupancy statistics of a single buffer_op.
+   */
+  struct BufferStatistics
+  {
+    const rvsdg::simple_node * Node;
+    size_t Capacity;
+    size_t MaxOccupancy;
+    size_t AccumulatedOccupancy;
+
+    [[nodiscard]] double
+    AverageOccupancy(size_t numCycles) const noexcept
+    {
+      return numCycles == 0 ? 0.0 : static_cast<double>(AccumulatedOccupancy) / numCycles;
+    }
+  };
+
+  ~RhlsSimulator() noexcept;
+
+  explicit RhlsSimulator(const llvm::lambda::node & lambda);
+
+  RhlsSimulator(const llvm::lambda::node & lambda, Configuration configuration);
+
+  RhlsSimulator(const RhlsSimulator &) = delete;
+
+  RhlsSimulator &
+  operator=(const RhlsSimulator &) = delete;
+
+  /**
+   * Simulates one invocation of the lambda.
+   *
+   * @param arguments Values for the non-state and non-bundle arguments of the lambda subregion,
+   * including context variables, in order.
+   *
+   * \return The values of the non-state and non-bundle results of the lambda.
+   *
+   * Throws util::error if the simulation deadlocks or exceeds the configured number of cycles.
+   */
+  std::vector<uint64_t>
+  Run(const std::vector<uint64_t> & arguments);
+
+  /**
+   * \return The number of cycles the last invocation took.
+   */
+  [[nodiscard]] size_t
+  GetNumCycles() const noexcept
+  {
+    return NumCycles_;
+  }
+
+  /**
+   * \return The number of requests the memory ports received in the last invocation. A burst
+   * counts as a single request.
+   */
+  [[nodiscard]] size_t
+  GetNumMemoryRequests() const noexcept
+  {
+    return NumMemoryRequests_;
+  }
+
+  [[nodiscard]] std::vector<EdgeStatistics>
+  GetEdgeStatistics() const;
+
+  [[nodiscard]] std::vector<BufferStatistics>
+  GetBufferStatistics() const;
+
+  /**
+   * \return The values of the perf_counter_op nodes in the last invocation, indexed by the id of
+   * the counters.
+   */
+  [[nodiscard]] std::unordered_map<size_t, size_t>
+  GetPerformanceCounters() const;
+
+  /**
+   * \return The total number of stall cycles over all edges.
+   */
+  [[nodiscard]] size_t
+  GetNumStalls() const;
+
+  /**
+   * \return A human-readable report with the number of cycles, the stalls per edge, and the
+   * occupancy of every buffer.
+   */
+  [[nodiscard]] std::string
+  ToString() const;
+
+  /**
+   * Writes \p numBytes bytes of \p value in little endian order to the simulated memory.
+   */
+  void
+  WriteMemory(uint64_t address, uint64_t value, size_t numBytes);
+
+  /**
+   * \return \p numBytes bytes read in little endian order from the simulated memory. Bytes that
+   * were never written are zero.
+   */
+  [[nodiscard]] uint64_t
+  ReadMemory(uint64_t address, size_t numBytes) const;
+
+private:
+  void
+  BuildUnits(const llvm::lambda::node & lambda);
+
+  void
+  BuildUnits(rvsdg::Region & region);
+
+  SimulationChannel &
+  GetChannel(const rvsdg::output & origin);
+
+  void
+  ConnectInputs(const rvsdg::node & node, SimulationUnit & unit);
+
+  void
+  ResetState();
+
+  bool
+  Step();
+
+  Configuration Configuration_;
+  size_t NumCycles_;
+  size_t NumMemoryRequests_;
+  std::unordered_map<uint64_t, uint8_t> Memory_;
+
+  std::vector<std::unique_ptr<SimulationChannel>> Channels_;
+  std::unordered_map<const rvsdg::output *, SimulationChannel *> ChannelMap_;
+  std::vector<std::unique_ptr<SimulationUnit>> Units_;
+
+  std::vector<SimulationUnit *> Arguments_;
+  std::vector<SimulationUnit *> Results_;
+  std::vector<SimulationUnit *> ValueResults_;
+};
+
+}
+
+#endif // JLM_HLS_UTIL_RHLSSIMULATOR_HPP
@@ -7,6 +7,7 @@
 #include <jlm/llvm/ir/cfg-structure.hpp>
 #include <jlm/llvm/ir/operators/operators.hpp>
 
+#include <atomic>
 #include <deque>
 #include <unordered_map>
 #include <unordered_set>
@@ -69,7 +70,7 @@ reinsert_tcloop(const tcloop & l)
 static const tacvariable *
 create_pvariable(basic_block & bb, std::shared_ptr<const rvsdg::ControlType> type)
 {
-  static size_t c = 0;
+  static std::atomic<size_t> c = 0;
   auto name = util::strfmt("#p", c++, "#");
   return bb.insert_before_branch(UndefValueOperation::Create(std::move(type), name))->result(0);
 }
@@ -77,7 +78,7 @@ create_pvariable(basic_block & bb, std::shared_ptr<const rvsdg::ControlType> typ
 static const tacvariable *
 create_qvariable(basic_block & bb, std::shared_ptr<const rvsdg::ControlType> type)
 {
-  static size_t c = 0;
+  static std::atomic<size_t> c = 0;
   auto name = util::strfmt("#q", c++, "#");
   return bb.append_last(UndefValueOperation::Create(std::move(type), name))->result(0);
 }
@@ -85,7 +86,7 @@ create_qvariable(basic_block & bb, std::shared_ptr<const rvsdg::ControlType> typ
 static const tacvariable *
 create_tvariable(basic_block & bb, std::shared_ptr<const rvsdg::ControlType> type)
 {
-  static size_t c = 0;
+  static std::atomic<size_t> c = 0;
   auto name = util::strfmt("#q", c++, "#");
   return bb.insert_before_branch(UndefValueOperation::Create(std::move(type), name))->result(0);
 }
@@ -93,7 +94,7 @@ create_tvariable(basic_block & bb, std::shared_ptr<const rvsdg::ControlType> typ
 static const tacvariable *
 create_rvariable(basic_block & bb)
 {
-  static size_t c = 0;
+  static std::atomic<size_t> c = 0;
   auto name = util::strfmt("#r", c++, "#");
 
   return bb.append_last(UndefValueOperation::Create(rvsdg::ControlType::Create(2), name))
@@ -16,6 +16,7 @@
 #include <jlm/rvsdg/binary.hpp>
 #include <jlm/rvsdg/gamma.hpp>
 #include <jlm/rvsdg/theta.hpp>
+#include <jlm/util/MemoryFootprint.hpp>
 #include <jlm/util/Statistics.hpp>
 #include <jlm/util/time.hpp>
 
@@ -299,14 +300,18 @@ public:
   Start(const ipgraph_module & interProceduralGraphModule) noexcept
   {
     AddMeasurement(Label::NumThreeAddressCodes, llvm::ntacs(interProceduralGraphModule));
+    AddMeasurements(ComputeMemoryFootprint(interProceduralGraphModule));
+    AddMeasurement(PeakRssBeforeLabel_, util::MemoryFootprint::GetPeakResidentSetSize());
     AddTimer(Label::Timer).start();
   }
 
   void
   End(const rvsdg::graph & graph) noexcept
   {
-    AddTimer(Label::Timer).stop();
+    GetTimer(Label::Timer).stop();
+    AddMeasurement(PeakRssAfterLabel_, util::MemoryFootprint::GetPeakResidentSetSize());
     AddMeasurement(Label::NumRvsdgNodes, rvsdg::nnodes(graph.root()));
+    AddMeasurements(rvsdg::ComputeMemoryFootprint(*graph.root()));
   }
 
   static std::unique_ptr<InterProceduralGraphToRvsdgStatistics>
@@ -314,6 +319,10 @@ public:
   {
     return std::make_unique<InterProceduralGraphToRvsdgStatistics>(sourceFileName);
   }
+
+private:
+  static inline const char * PeakRssBeforeLabel_ = "#BytesPeakRssBefore";
+  static inline const char * PeakRssAfterLabel_ = "#BytesPeakRssAfter";
 };
 
 class InterProceduralGraphToRvsdgStatisticsCollector final
@@ -1183,9 +1192,25 @@ ConvertStronglyConnectedComponent(
   }
 }
 
+/**
+ * Releases the CFGs of all function nodes in \p stronglyConnectedComponent. The components are
+ * only handed out with constant nodes by the inter-procedural graph, but the conversion has
+ * exclusive ownership of the module when this is invoked.
+ */
+static void
+ReleaseFunctionBodies(const std::unordered_set<const ipgraph_node *> & stronglyConnectedComponent)
+{
+  for (auto ipgNode : stronglyConnectedComponent)
+  {
+    if (auto functionNode = dynamic_cast<const function_node *>(ipgNode))
+      const_cast<function_node *>(functionNode)->ReleaseCfg();
+  }
+}
+
 static std::unique_ptr<RvsdgModule>
 ConvertInterProceduralGraphModule(
     ipgraph_module & interProceduralGraphModule,
+    bool releaseFunctionBodies,
     InterProceduralGraphToRvsdgStatisticsCollector & statisticsCollector)
 {
   auto rvsdgModule = RvsdgModule::Create(
@@ -1205,18 +1230,24 @@ ConvertInterProceduralGraphModule(
 
   auto stronglyConnectedComponents = interProceduralGraphModule.ipgraph().find_sccs();
   for (const auto & stronglyConnectedComponent : stronglyConnectedComponents)
+  {
     ConvertStronglyConnectedComponent(
         stronglyConnectedComponent,
         *graph,
         regionalizedVariableMap,
         statisticsCollector);
 
+    if (releaseFunctionBodies)
+      ReleaseFunctionBodies(stronglyConnectedComponent);
+  }
+
   return rvsdgModule;
 }
 
-std::unique_ptr<RvsdgModule>
+static std::unique_ptr<RvsdgModule>
 ConvertInterProceduralGraphModule(
     ipgraph_module & interProceduralGraphModule,
+    bool releaseFunctionBodies,
     util::StatisticsCollector & statisticsCollector)
 {
   InterProceduralGraphToRvsdgStatisticsCollector interProceduralGraphToRvsdgStatisticsCollector(
@@ -1227,6 +1258,7 @@ ConvertInterProceduralGraphModule(
   {
     return ConvertInterProceduralGraphModule(
         interProceduralGraphModule,
+        releaseFunctionBodies,
         interProceduralGraphToRvsdgStatisticsCollector);
   };
 
@@ -1238,4 +1270,21 @@ ConvertInterProceduralGraphModule(
   return rvsdgModule;
 }
 
+std::unique_ptr<RvsdgModule>
+ConvertInterProceduralGraphModule(
+    ipgraph_module & interProceduralGraphModule,
+    util::StatisticsCollector & statisticsCollector)
+{
+  return ConvertInterProceduralGraphModule(interProceduralGraphModule, false, statisticsCollector);
+}
+
+std::unique_ptr<RvsdgModule>
+ConvertInterProceduralGraphModule(
+    std::unique_ptr<ipgraph_module> interProceduralGraphModule,
+    util::StatisticsCollector & statisticsCollector)
+{
+  JLM_ASSERT(interProceduralGraphModule != nullptr);
+  return ConvertInterProceduralGraphModule(*interProceduralGraphModule, true, statisticsCollector);
+}
+
 }
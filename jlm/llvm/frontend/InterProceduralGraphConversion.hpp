@@ -24,6 +24,16 @@ ConvertInterProceduralGraphModule(
     ipgraph_module & interProceduralGraphModule,
     jlm::util::StatisticsCollector & statisticsCollector);
 
+/**
+ * Converts \p interProceduralGraphModule to an RVSDG module and consumes it in the process. The
+ * CFG of every function is released as soon as the function is converted to a lambda, which
+ * bounds the peak memory usage of the conversion for large modules.
+ */
+std::unique_ptr<RvsdgModule>
+ConvertInterProceduralGraphModule(
+    std::unique_ptr<ipgraph_module> interProceduralGraphModule,
+    jlm::util::StatisticsCollector & statisticsCollector);
+
 }
 
 #endif
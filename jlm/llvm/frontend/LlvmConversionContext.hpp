@@ -182,6 +182,12 @@ public:
     vmap_[value] = variable;
   }
 
+  inline void
+  erase_value(const ::llvm::Value * value) noexcept
+  {
+    vmap_.erase(value);
+  }
+
   const StructType::Declaration *
   lookup_declaration(const ::llvm::StructType * type)
   {
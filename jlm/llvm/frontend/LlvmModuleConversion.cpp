@@ -12,6 +12,7 @@
 #include <llvm/ADT/PostOrderIterator.h>
 #include <llvm/IR/BasicBlock.h>
 #include <llvm/IR/Function.h>
+#include <llvm/IR/InstIterator.h>
 #include <llvm/IR/Instructions.h>
 #include <llvm/IR/Module.h>
 
@@ -419,7 +420,19 @@ create_cfg(::llvm::Function & f, context & ctx)
 }
 
 static void
-convert_function(::llvm::Function & function, context & ctx)
+release_function_body(::llvm::Function & function, context & ctx)
+{
+  // The memory of the deleted instructions might be reused for the instructions of functions that
+  // are converted later on. Remove them from the context such that they cannot alias.
+  for (auto & instruction : ::llvm::instructions(function))
+    ctx.erase_value(&instruction);
+  ctx.set_basic_block_map(basic_block_map());
+
+  function.deleteBody();
+}
+
+static void
+convert_function(::llvm::Function & function, context & ctx, bool releaseBody)
 {
   if (function.isDeclaration())
     return;
@@ -429,6 +442,9 @@ convert_function(::llvm::Function & function, context & ctx)
   ctx.set_node(fv->function());
   fv->function()->add_cfg(create_cfg(function, ctx));
   ctx.set_node(nullptr);
+
+  if (releaseBody)
+    release_function_body(function, ctx);
 }
 
 static const llvm::linkage &
@@ -520,26 +536,39 @@ convert_global_value(::llvm::GlobalVariable & gv, context & ctx)
 }
 
 static void
-convert_globals(::llvm::Module & lm, context & ctx)
+convert_globals(::llvm::Module & lm, context & ctx, bool releaseFunctionBodies)
 {
   for (auto & gv : lm.globals())
     convert_global_value(gv, ctx);
 
   for (auto & f : lm.getFunctionList())
-    convert_function(f, ctx);
+    convert_function(f, ctx, releaseFunctionBodies);
 }
 
-std::unique_ptr<ipgraph_module>
-ConvertLlvmModule(::llvm::Module & m)
+static std::unique_ptr<ipgraph_module>
+ConvertLlvmModule(::llvm::Module & m, bool releaseFunctionBodies)
 {
   util::filepath fp(m.getSourceFileName());
   auto im = ipgraph_module::create(fp, m.getTargetTriple(), m.getDataLayoutStr());
 
   context ctx(*im);
   declare_globals(m, ctx);
-  convert_globals(m, ctx);
+  convert_globals(m, ctx, releaseFunctionBodies);
 
   return im;
 }
 
+std::unique_ptr<ipgraph_module>
+ConvertLlvmModule(::llvm::Module & m)
+{
+  return ConvertLlvmModule(m, false);
+}
+
+std::unique_ptr<ipgraph_module>
+ConvertLlvmModule(std::unique_ptr<::llvm::Module> m)
+{
+  JLM_ASSERT(m != nullptr);
+  return ConvertLlvmModule(*m, true);
+}
+
 }
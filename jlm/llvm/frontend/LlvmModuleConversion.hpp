@@ -28,6 +28,16 @@ ConvertAttributeKind(const ::llvm::Attribute::AttrKind & kind);
 std::unique_ptr<ipgraph_module>
 ConvertLlvmModule(::llvm::Module & module);
 
+/**
+ * Converts \p module to an inter-procedural graph module. In contrast to
+ * ConvertLlvmModule(::llvm::Module&), the LLVM module is consumed by the conversion: the body of
+ * every function is deleted as soon as it is converted to a CFG, and the module itself is disposed
+ * before returning. This keeps the peak memory usage of the conversion close to the size of the
+ * larger of the two modules instead of their sum.
+ */
+std::unique_ptr<ipgraph_module>
+ConvertLlvmModule(std::unique_ptr<::llvm::Module> module);
+
 }
 
 #endif
@@ -0,0 +1,184 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/llvm/frontend/UnreachableFunctionElimination.hpp>
+#include <jlm/util/common.hpp>
+#include <jlm/util/HashSet.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/InstIterator.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Support/Error.h>
+
+namespace jlm::llvm
+{
+
+class UnreachableFunctionEliminationStatistics final : public util::Statistics
+{
+public:
+  ~UnreachableFunctionEliminationStatistics() override = default;
+
+  explicit UnreachableFunctionEliminationStatistics(const util::filepath & sourceFile)
+      : Statistics(Statistics::Id::UnreachableFunctionElimination, sourceFile)
+  {}
+
+  void
+  Start(const ::llvm::Module & llvmModule) noexcept
+  {
+    AddMeasurement(NumFunctionsLabel_, llvmModule.getFunctionList().size());
+    AddTimer(Label::Timer).start();
+  }
+
+  void
+  Stop(size_t numSkippedFunctions) noexcept
+  {
+    GetTimer(Label::Timer).stop();
+    AddMeasurement(NumSkippedFunctionsLabel_, numSkippedFunctions);
+  }
+
+  static std::unique_ptr<UnreachableFunctionEliminationStatistics>
+  Create(const util::filepath & sourceFile)
+  {
+    return std::make_unique<UnreachableFunctionEliminationStatistics>(sourceFile);
+  }
+
+private:
+  static inline const char * NumFunctionsLabel_ = "#Functions";
+  static inline const char * NumSkippedFunctionsLabel_ = "#SkippedFunctions";
+};
+
+/**
+ * Computes the global values that are reachable from the externally visible global values of a
+ * module.
+ */
+class ReachabilityComputation final
+{
+public:
+  void
+  MarkReachable(::llvm::GlobalValue & globalValue)
+  {
+    if (Reachable_.Insert(&globalValue))
+      Worklist_.push_back(&globalValue);
+  }
+
+  void
+  Run()
+  {
+    while (!Worklist_.empty())
+    {
+      auto globalValue = Worklist_.back();
+      Worklist_.pop_back();
+
+      // The operands of a global value are its initializer, aliasee, personality function, etc.
+      for (auto & operand : globalValue->operands())
+        VisitValue(operand.get());
+
+      if (auto function = ::llvm::dyn_cast<::llvm::Function>(globalValue))
+        VisitFunctionBody(*function);
+    }
+  }
+
+  [[nodiscard]] bool
+  IsReachable(::llvm::GlobalValue & globalValue) const noexcept
+  {
+    return Reachable_.Contains(&globalValue);
+  }
+
+private:
+  void
+  VisitFunctionBody(::llvm::Function & function)
+  {
+    if (function.isMaterializable())
+    {
+      if (auto error = function.materialize())
+        throw util::error("Failed to materialize function " + function.getName().str() + ": "
+                          + ::llvm::toString(std::move(error)));
+    }
+
+    for (auto & instruction : ::llvm::instructions(function))
+    {
+      for (auto & operand : instruction.operands())
+        VisitValue(operand.get());
+    }
+  }
+
+  void
+  VisitValue(::llvm::Value * value)
+  {
+    if (auto globalValue = ::llvm::dyn_cast_or_null<::llvm::GlobalValue>(value))
+    {
+      MarkReachable(*globalValue);
+      return;
+    }
+
+    // Global values can be nested arbitrarily deep in constant expressions and aggregates
+    auto constant = ::llvm::dyn_cast_or_null<::llvm::Constant>(value);
+    if (constant == nullptr || !VisitedConstants_.Insert(constant))
+      return;
+
+    for (auto & operand : constant->operands())
+      VisitValue(operand.get());
+  }
+
+  util::HashSet<const ::llvm::GlobalValue *> Reachable_;
+  util::HashSet<const ::llvm::Constant *> VisitedConstants_;
+  std::vector<::llvm::GlobalValue *> Worklist_;
+};
+
+size_t
+EliminateUnreachableFunctions(
+    ::llvm::Module & llvmModule,
+    util::StatisticsCollector & statisticsCollector)
+{
+  auto statistics = UnreachableFunctionEliminationStatistics::Create(
+      util::filepath(llvmModule.getSourceFileName()));
+  statistics->Start(llvmModule);
+
+  ReachabilityComputation reachability;
+  for (auto & globalValue : llvmModule.global_values())
+  {
+    if (!globalValue.hasLocalLinkage())
+      reachability.MarkReachable(globalValue);
+  }
+  reachability.Run();
+
+  std::vector<::llvm::GlobalValue *> unreachableGlobalValues;
+  size_t numSkippedFunctions = 0;
+  for (auto & globalValue : llvmModule.global_values())
+  {
+    if (reachability.IsReachable(globalValue))
+      continue;
+
+    JLM_ASSERT(globalValue.hasLocalLinkage());
+    unreachableGlobalValues.push_back(&globalValue);
+    if (::llvm::isa<::llvm::Function>(globalValue) && !globalValue.isDeclaration())
+      numSkippedFunctions++;
+  }
+
+  // Unreachable global values can only be referenced by other unreachable global values. We
+  // first drop all their references such that they can subsequently be erased in any order.
+  for (auto globalValue : unreachableGlobalValues)
+  {
+    if (auto function = ::llvm::dyn_cast<::llvm::Function>(globalValue))
+      function->dropAllReferences();
+    else if (auto globalVariable = ::llvm::dyn_cast<::llvm::GlobalVariable>(globalValue))
+      globalVariable->dropAllReferences();
+    else
+      globalValue->dropAllReferences();
+  }
+  for (auto globalValue : unreachableGlobalValues)
+  {
+    globalValue->removeDeadConstantUsers();
+    globalValue->eraseFromParent();
+  }
+
+  statistics->Stop(numSkippedFunctions);
+  statisticsCollector.CollectDemandedStatistics(std::move(statistics));
+
+  return numSkippedFunctions;
+}
+
+}
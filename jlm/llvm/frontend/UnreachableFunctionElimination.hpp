@@ -0,0 +1,45 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_LLVM_FRONTEND_UNREACHABLEFUNCTIONELIMINATION_HPP
+#define JLM_LLVM_FRONTEND_UNREACHABLEFUNCTIONELIMINATION_HPP
+
+#include <cstddef>
+
+namespace llvm
+{
+class Module;
+}
+
+namespace jlm::util
+{
+class StatisticsCollector;
+}
+
+namespace jlm::llvm
+{
+
+/**
+ * Removes all functions and global variables with local linkage from \p llvmModule that are not
+ * reachable from an externally visible definition. Reachability is computed over the references of
+ * function bodies, global variable initializers, and aliases. This avoids the conversion of
+ * functions that would be discarded by dead node elimination after RVSDG construction anyway.
+ *
+ * Function bodies are materialized on demand, i.e., if \p llvmModule was lazily loaded from
+ * bitcode, the bodies of unreachable functions are never read.
+ *
+ * @param llvmModule The LLVM module from which unreachable functions are removed.
+ * @param statisticsCollector The collector for the UnreachableFunctionElimination statistics.
+ *
+ * @return The number of removed function definitions.
+ */
+size_t
+EliminateUnreachableFunctions(
+    ::llvm::Module & llvmModule,
+    util::StatisticsCollector & statisticsCollector);
+
+}
+
+#endif
@@ -4,6 +4,7 @@
  */
 
 #include <jlm/llvm/ir/ipgraph-module.hpp>
+#include <jlm/util/MemoryFootprint.hpp>
 
 namespace jlm::llvm
 {
@@ -11,4 +12,60 @@ namespace jlm::llvm
 gblvalue::~gblvalue()
 {}
 
+static size_t
+EstimateCfgNodeBytes(const cfg_node & node, size_t nodeSize)
+{
+  return nodeSize + node.noutedges() * (sizeof(std::unique_ptr<cfg_edge>) + sizeof(cfg_edge))
+       + util::MemoryFootprint::EstimateUnorderedContainerBytes(
+           node.ninedges(),
+           node.ninedges(),
+           sizeof(cfg_edge *));
+}
+
+static size_t
+EstimateThreeAddressCodeBytes(const tac & tac)
+{
+  // Every three-address code owns a copy of its operation
+  size_t numBytes = sizeof(llvm::tac) + sizeof(rvsdg::simple_op);
+  numBytes += tac.noperands() * (sizeof(const variable *) + sizeof(std::shared_ptr<rvsdg::Type>));
+  numBytes += tac.nresults()
+            * (sizeof(std::unique_ptr<tacvariable>) + sizeof(tacvariable)
+               + sizeof(std::shared_ptr<rvsdg::Type>));
+
+  return numBytes;
+}
+
+util::MemoryFootprint
+ComputeMemoryFootprint(const ipgraph_module & im)
+{
+  using Category = util::MemoryFootprint::Category;
+
+  util::MemoryFootprint memoryFootprint;
+  for (const auto & n : im.ipgraph())
+  {
+    auto f = dynamic_cast<const function_node *>(&n);
+    if (!f || !f->cfg())
+      continue;
+
+    auto & cfg = *f->cfg();
+    memoryFootprint.Add(Category::CfgNodes, EstimateCfgNodeBytes(*cfg.entry(), sizeof(cfg_node)));
+    memoryFootprint.Add(Category::CfgNodes, EstimateCfgNodeBytes(*cfg.exit(), sizeof(cfg_node)));
+    for (const auto & node : cfg)
+    {
+      auto & bb = *util::AssertedCast<const basic_block>(&node);
+      memoryFootprint.Add(Category::CfgNodes, EstimateCfgNodeBytes(bb, sizeof(basic_block)));
+
+      for (const auto & tac : bb.tacs())
+      {
+        // Every element of a taclist is a list node with two links
+        memoryFootprint.Add(
+            Category::ThreeAddressCodes,
+            EstimateThreeAddressCodeBytes(*tac) + 3 * sizeof(void *));
+      }
+    }
+  }
+
+  return memoryFootprint;
+}
+
 }
@@ -12,6 +12,13 @@
 
 #include <jlm/util/file.hpp>
 
+#include <atomic>
+
+namespace jlm::util
+{
+class MemoryFootprint;
+}
+
 namespace jlm::llvm
 {
 
@@ -128,7 +135,7 @@ public:
   inline llvm::variable *
   create_variable(std::shared_ptr<const jlm::rvsdg::Type> type)
   {
-    static uint64_t c = 0;
+    static std::atomic<uint64_t> c = 0;
     auto v = std::make_unique<llvm::variable>(std::move(type), jlm::util::strfmt("v", c++));
     auto pv = v.get();
     variables_.insert(std::move(v));
@@ -255,6 +262,15 @@ ntacs(const ipgraph_module & im)
   return ntacs;
 }
 
+/**
+ * Estimates the memory used by the three-address codes and the control flow graph nodes of the
+ * functions in \p im.
+ *
+ * @see util::MemoryFootprint
+ */
+util::MemoryFootprint
+ComputeMemoryFootprint(const ipgraph_module & im);
+
 }
 
 #endif
@@ -263,6 +263,16 @@ public:
   void
   add_cfg(std::unique_ptr<llvm::cfg> cfg);
 
+  /**
+   * \brief Removes the CFG from the function node and returns it. The function node has no body
+   * afterwards.
+   */
+  std::unique_ptr<llvm::cfg>
+  ReleaseCfg() noexcept
+  {
+    return std::move(cfg_);
+  }
+
   static inline function_node *
   create(
       llvm::ipgraph & ipg,
@@ -10,6 +10,7 @@
 #include <jlm/rvsdg/operation.hpp>
 #include <jlm/util/common.hpp>
 
+#include <atomic>
 #include <list>
 #include <memory>
 #include <vector>
@@ -169,7 +170,7 @@ private:
   static std::vector<std::string>
   create_names(size_t nnames)
   {
-    static size_t c = 0;
+    static std::atomic<size_t> c = 0;
     std::vector<std::string> names;
     for (size_t n = 0; n < nnames; n++)
       names.push_back(jlm::util::strfmt("tv", c++));
@@ -115,7 +115,8 @@ FunctionType::Create(
     std::vector<std::shared_ptr<const jlm::rvsdg::Type>> argumentTypes,
     std::vector<std::shared_ptr<const jlm::rvsdg::Type>> resultTypes)
 {
-  return std::make_shared<FunctionType>(std::move(argumentTypes), std::move(resultTypes));
+  return rvsdg::InternType(
+      std::make_shared<const FunctionType>(std::move(argumentTypes), std::move(resultTypes)));
 }
 
 PointerType::~PointerType() noexcept = default;
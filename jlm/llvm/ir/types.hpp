@@ -166,7 +166,7 @@ public:
   static std::shared_ptr<const arraytype>
   Create(std::shared_ptr<const rvsdg::ValueType> type, size_t nelements)
   {
-    return std::make_shared<arraytype>(std::move(type), nelements);
+    return rvsdg::InternType(std::make_shared<const arraytype>(std::move(type), nelements));
   }
 
 private:
@@ -321,13 +321,13 @@ public:
   static std::shared_ptr<const StructType>
   Create(const std::string & name, bool isPacked, const Declaration & declaration)
   {
-    return std::make_shared<StructType>(name, isPacked, declaration);
+    return rvsdg::InternType(std::make_shared<const StructType>(name, isPacked, declaration));
   }
 
   static std::shared_ptr<const StructType>
   Create(bool isPacked, const Declaration & declaration)
   {
-    return std::make_shared<StructType>(isPacked, declaration);
+    return rvsdg::InternType(std::make_shared<const StructType>(isPacked, declaration));
   }
 
 private:
@@ -463,7 +463,7 @@ public:
   static std::shared_ptr<const fixedvectortype>
   Create(std::shared_ptr<const rvsdg::ValueType> type, size_t size)
   {
-    return std::make_shared<fixedvectortype>(std::move(type), size);
+    return rvsdg::InternType(std::make_shared<const fixedvectortype>(std::move(type), size));
   }
 };
 
@@ -488,7 +488,7 @@ public:
   static std::shared_ptr<const scalablevectortype>
   Create(std::shared_ptr<const rvsdg::ValueType> type, size_t size)
   {
-    return std::make_shared<scalablevectortype>(std::move(type), size);
+    return rvsdg::InternType(std::make_shared<const scalablevectortype>(std::move(type), size));
   }
 };
 
@@ -0,0 +1,411 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/llvm/opt/GammaMerging.hpp>
+#include <jlm/rvsdg/control.hpp>
+#include <jlm/rvsdg/gamma.hpp>
+#include <jlm/rvsdg/substitution.hpp>
+#include <jlm/rvsdg/traverser.hpp>
+#include <jlm/util/HashSet.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <unordered_set>
+
+namespace jlm::llvm
+{
+
+class GammaMerging::Statistics final : public util::Statistics
+{
+  static constexpr const char * NumMergedGammas_ = "#MergedGammas";
+
+public:
+  ~Statistics() override = default;
+
+  explicit Statistics(const util::filepath & sourceFile)
+      : util::Statistics(Statistics::Id::GammaMerging, sourceFile)
+  {}
+
+  void
+  Start(const rvsdg::graph & graph) noexcept
+  {
+    AddMeasurement(Label::NumRvsdgNodesBefore, rvsdg::nnodes(graph.root()));
+    AddTimer(Label::Timer).start();
+  }
+
+  void
+  Stop(const rvsdg::graph & graph, size_t numMergedGammas) noexcept
+  {
+    GetTimer(Label::Timer).stop();
+    AddMeasurement(Label::NumRvsdgNodesAfter, rvsdg::nnodes(graph.root()));
+    AddMeasurement(NumMergedGammas_, numMergedGammas);
+  }
+
+  static std::unique_ptr<Statistics>
+  Create(const util::filepath & sourceFile)
+  {
+    return std::make_unique<Statistics>(sourceFile);
+  }
+};
+
+/**
+ * @return The match operation of the node producing \p output, or nullptr if \p output is not
+ * produced by a match node.
+ */
+static const rvsdg::match_op *
+GetMatchOperation(const rvsdg::output & output)
+{
+  auto node = rvsdg::output::GetNode(output);
+  return node ? dynamic_cast<const rvsdg::match_op *>(&node->operation()) : nullptr;
+}
+
+/**
+ * @return The alternative of the control constant producing \p output, or std::nullopt if
+ * \p output is not produced by a control constant.
+ */
+static std::optional<size_t>
+GetControlConstantAlternative(const rvsdg::output & output)
+{
+  auto node = rvsdg::output::GetNode(output);
+  if (node == nullptr || !rvsdg::is_ctlconstant_op(node->operation()))
+    return std::nullopt;
+
+  auto & operation = *util::AssertedCast<const rvsdg::ctlconstant_op>(&node->operation());
+  return operation.value().alternative();
+}
+
+/**
+ * Determines whether \p output transitively depends on an output of \p node. Both must be in the
+ * same region.
+ */
+static bool
+DependsOn(const rvsdg::output & output, const rvsdg::node & node)
+{
+  std::unordered_set<const rvsdg::node *> visited;
+  std::vector<const rvsdg::node *> worklist;
+
+  auto push = [&](const rvsdg::output & origin)
+  {
+    auto originNode = rvsdg::output::GetNode(origin);
+    if (originNode && visited.insert(originNode).second)
+      worklist.push_back(originNode);
+  };
+
+  push(output);
+  while (!worklist.empty())
+  {
+    auto currentNode = worklist.back();
+    worklist.pop_back();
+    if (currentNode == &node)
+      return true;
+
+    for (size_t n = 0; n < currentNode->ninputs(); n++)
+      push(*currentNode->input(n)->origin());
+  }
+
+  return false;
+}
+
+/**
+ * Determines whether \p gammaNode can be merged into \p targetGammaNode without introducing a
+ * cycle.
+ */
+static bool
+CanMerge(const rvsdg::GammaNode & targetGammaNode, const rvsdg::GammaNode & gammaNode)
+{
+  for (auto it = gammaNode.begin_entryvar(); it != gammaNode.end_entryvar(); it++)
+  {
+    auto & origin = *it->origin();
+    if (rvsdg::output::GetNode(origin) != &targetGammaNode
+        && DependsOn(origin, targetGammaNode))
+      return false;
+  }
+
+  for (size_t n = 0; n < targetGammaNode.ninputs(); n++)
+  {
+    if (DependsOn(*targetGammaNode.input(n)->origin(), gammaNode))
+      return false;
+  }
+
+  return true;
+}
+
+static rvsdg::GammaInput *
+GetOrCreateEntryVar(rvsdg::GammaNode & gammaNode, rvsdg::output & origin)
+{
+  for (auto user : origin)
+  {
+    auto gammaInput = dynamic_cast<rvsdg::GammaInput *>(user);
+    if (gammaInput && gammaInput->node() == &gammaNode && gammaInput != gammaNode.predicate())
+      return gammaInput;
+  }
+
+  return gammaNode.add_entryvar(&origin);
+}
+
+/**
+ * Copies the subregion alternativeMap[j] of \p gammaNode into the subregion j of
+ * \p targetGammaNode, diverts the users of all outputs of \p gammaNode to new exit variables of
+ * \p targetGammaNode, and removes \p gammaNode.
+ */
+static void
+Merge(
+    rvsdg::GammaNode & targetGammaNode,
+    rvsdg::GammaNode & gammaNode,
+    const std::vector<size_t> & alternativeMap)
+{
+  auto numSubregions = targetGammaNode.nsubregions();
+  JLM_ASSERT(alternativeMap.size() == numSubregions);
+
+  std::vector<rvsdg::SubstitutionMap> smaps(numSubregions);
+  for (auto it = gammaNode.begin_entryvar(); it != gammaNode.end_entryvar(); it++)
+  {
+    auto origin = it->origin();
+    if (rvsdg::output::GetNode(*origin) == &targetGammaNode)
+    {
+      auto targetOutput = util::AssertedCast<rvsdg::GammaOutput>(origin);
+      for (size_t n = 0; n < numSubregions; n++)
+        smaps[n].insert(it->argument(alternativeMap[n]), targetOutput->result(n)->origin());
+    }
+    else
+    {
+      auto entryVar = GetOrCreateEntryVar(targetGammaNode, *origin);
+      for (size_t n = 0; n < numSubregions; n++)
+        smaps[n].insert(it->argument(alternativeMap[n]), entryVar->argument(n));
+    }
+  }
+
+  for (size_t n = 0; n < numSubregions; n++)
+  {
+    gammaNode.subregion(alternativeMap[n])
+        ->copy(targetGammaNode.subregion(n), smaps[n], false, false);
+  }
+
+  for (auto it = gammaNode.begin_exitvar(); it != gammaNode.end_exitvar(); it++)
+  {
+    std::vector<rvsdg::output *> origins;
+    for (size_t n = 0; n < numSubregions; n++)
+      origins.push_back(smaps[n].lookup(it->result(alternativeMap[n])->origin()));
+
+    auto exitVar = targetGammaNode.add_exitvar(origins);
+    it->divert_users(exitVar);
+  }
+
+  remove(&gammaNode);
+}
+
+GammaMerging::~GammaMerging() = default;
+
+void
+GammaMerging::run(RvsdgModule & rvsdgModule, util::StatisticsCollector & statisticsCollector)
+{
+  auto & rvsdg = rvsdgModule.Rvsdg();
+  auto statistics = Statistics::Create(rvsdgModule.SourceFileName());
+
+  size_t numMergedGammas = 0;
+  statistics->Start(rvsdg);
+  MergeInRegion(*rvsdg.root(), numMergedGammas);
+  statistics->Stop(rvsdg, numMergedGammas);
+
+  statisticsCollector.CollectDemandedStatistics(std::move(statistics));
+}
+
+std::optional<std::vector<size_t>>
+GammaMerging::ComputeAlternativeMap(
+    const rvsdg::GammaNode & targetGammaNode,
+    const rvsdg::GammaNode & gammaNode)
+{
+  auto numTargetSubregions = targetGammaNode.nsubregions();
+  auto & predicate = *gammaNode.predicate()->origin();
+  auto & targetPredicate = *targetGammaNode.predicate()->origin();
+
+  // Both gamma nodes have the same predicate
+  if (&predicate == &targetPredicate)
+  {
+    std::vector<size_t> alternativeMap(numTargetSubregions);
+    for (size_t n = 0; n < numTargetSubregions; n++)
+      alternativeMap[n] = n;
+
+    return alternativeMap;
+  }
+
+  // The predicate is a control output of the target gamma node that is constant in every subregion
+  if (rvsdg::output::GetNode(predicate) == &targetGammaNode)
+  {
+    auto & output = *util::AssertedCast<const rvsdg::GammaOutput>(&predicate);
+
+    std::vector<size_t> alternativeMap;
+    for (size_t n = 0; n < numTargetSubregions; n++)
+    {
+      auto alternative = GetControlConstantAlternative(*output.result(n)->origin());
+      if (!alternative)
+        return std::nullopt;
+
+      alternativeMap.push_back(*alternative);
+    }
+
+    return alternativeMap;
+  }
+
+  // Both predicates are match results of the same value
+  auto match = GetMatchOperation(predicate);
+  auto targetMatch = GetMatchOperation(targetPredicate);
+  if (match == nullptr || targetMatch == nullptr)
+    return std::nullopt;
+
+  auto & value = *rvsdg::output::GetNode(predicate)->input(0)->origin();
+  auto & targetValue = *rvsdg::output::GetNode(targetPredicate)->input(0)->origin();
+  if (&value != &targetValue)
+    return std::nullopt;
+
+  std::vector<std::optional<size_t>> partialMap(numTargetSubregions);
+  auto addMapping = [&](size_t targetAlternative, size_t alternative)
+  {
+    auto & mapping = partialMap[targetAlternative];
+    if (mapping && *mapping != alternative)
+      return false;
+
+    mapping = alternative;
+    return true;
+  };
+
+  util::HashSet<uint64_t> values;
+  for (auto & [matchValue, _] : *match)
+    values.Insert(matchValue);
+  for (auto & [matchValue, _] : *targetMatch)
+    values.Insert(matchValue);
+
+  for (auto matchValue : values.Items())
+  {
+    if (!addMapping(targetMatch->alternative(matchValue), match->alternative(matchValue)))
+      return std::nullopt;
+  }
+
+  // All values that are not explicitly mapped by either match node take the default alternatives
+  auto nbits = match->nbits();
+  bool hasUnmappedValues = nbits >= 64 || values.Size() < (uint64_t(1) << nbits);
+  if (hasUnmappedValues
+      && !addMapping(targetMatch->default_alternative(), match->default_alternative()))
+    return std::nullopt;
+
+  // Subregions of the target gamma node that are never taken can be mapped to any subregion
+  std::vector<size_t> alternativeMap;
+  for (auto & mapping : partialMap)
+    alternativeMap.push_back(mapping.value_or(0));
+
+  return alternativeMap;
+}
+
+bool
+GammaMerging::EliminateReplicatedPredicates(rvsdg::GammaNode & gammaNode)
+{
+  bool eliminated = false;
+  for (auto it = gammaNode.begin_exitvar(); it != gammaNode.end_exitvar(); it++)
+  {
+    if (!rvsdg::is<rvsdg::ControlType>(it->type()) || it->nusers() == 0)
+      continue;
+
+    // An exit variable with more alternatives than the predicate cannot be replaced by it
+    if (*it->Type() != *gammaNode.predicate()->origin()->Type())
+      continue;
+
+    bool replicatesPredicate = true;
+    for (size_t n = 0; n < gammaNode.nsubregions() && replicatesPredicate; n++)
+    {
+      auto alternative = GetControlConstantAlternative(*it->result(n)->origin());
+      replicatesPredicate = alternative == n;
+    }
+
+    if (replicatesPredicate)
+    {
+      it->divert_users(gammaNode.predicate()->origin());
+      eliminated = true;
+    }
+  }
+
+  return eliminated;
+}
+
+rvsdg::GammaNode *
+GammaMerging::TryMerge(rvsdg::GammaNode & gammaNode)
+{
+  auto & predicate = *gammaNode.predicate()->origin();
+
+  // Collect all gamma nodes whose alternative could determine the alternative of gammaNode
+  std::vector<rvsdg::GammaNode *> candidates;
+  auto addGammaUsers = [&](const rvsdg::output & output)
+  {
+    for (auto user : output)
+    {
+      auto userGamma = dynamic_cast<rvsdg::GammaNode *>(rvsdg::input::GetNode(*user));
+      if (userGamma && userGamma != &gammaNode && user == userGamma->predicate())
+        candidates.push_back(userGamma);
+    }
+  };
+
+  addGammaUsers(predicate);
+  if (auto gammaOrigin = dynamic_cast<rvsdg::GammaNode *>(rvsdg::output::GetNode(predicate)))
+  {
+    candidates.push_back(gammaOrigin);
+  }
+  else if (GetMatchOperation(predicate))
+  {
+    auto & value = *rvsdg::output::GetNode(predicate)->input(0)->origin();
+    for (auto user : value)
+    {
+      auto userNode = rvsdg::input::GetNode(*user);
+      if (userNode && userNode->output(0) != &predicate
+          && rvsdg::is<rvsdg::match_op>(userNode->operation()))
+        addGammaUsers(*userNode->output(0));
+    }
+  }
+
+  for (auto targetGammaNode : candidates)
+  {
+    auto alternativeMap = ComputeAlternativeMap(*targetGammaNode, gammaNode);
+    if (alternativeMap && CanMerge(*targetGammaNode, gammaNode))
+    {
+      Merge(*targetGammaNode, gammaNode, *alternativeMap);
+      return targetGammaNode;
+    }
+  }
+
+  return nullptr;
+}
+
+void
+GammaMerging::MergeInRegion(rvsdg::Region & region, size_t & numMergedGammas)
+{
+  // Merging only removes the gamma node that is currently visited. Collect the structural nodes
+  // upfront, as the traverser would otherwise visit the content added to other gamma nodes.
+  std::vector<rvsdg::StructuralNode *> structuralNodes;
+  for (auto node : rvsdg::topdown_traverser(&region))
+  {
+    if (auto structuralNode = dynamic_cast<rvsdg::StructuralNode *>(node))
+      structuralNodes.push_back(structuralNode);
+  }
+
+  for (auto structuralNode : structuralNodes)
+  {
+    for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+      MergeInRegion(*structuralNode->subregion(n), numMergedGammas);
+
+    auto gammaNode = dynamic_cast<rvsdg::GammaNode *>(structuralNode);
+    if (gammaNode == nullptr)
+      continue;
+
+    EliminateReplicatedPredicates(*gammaNode);
+    if (auto targetGammaNode = TryMerge(*gammaNode))
+    {
+      numMergedGammas++;
+
+      // The merged subregions might contain further gamma nodes that can be merged
+      for (size_t n = 0; n < targetGammaNode->nsubregions(); n++)
+        MergeInRegion(*targetGammaNode->subregion(n), numMergedGammas);
+    }
+  }
+}
+
+}
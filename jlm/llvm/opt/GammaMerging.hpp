@@ -0,0 +1,96 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_LLVM_OPT_GAMMAMERGING_HPP
+#define JLM_LLVM_OPT_GAMMAMERGING_HPP
+
+#include <jlm/llvm/opt/optimization.hpp>
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace jlm::rvsdg
+{
+class GammaNode;
+class Region;
+}
+
+namespace jlm::llvm
+{
+
+class RvsdgModule;
+
+/** \brief Gamma Merging Optimization
+ *
+ * Gamma merging merges a gamma node into a preceding gamma node of the same region if the
+ * alternative taken by the first gamma node determines the alternative taken by the second one.
+ * The subregions of the second gamma node are copied into the corresponding subregions of the
+ * first gamma node, such that the branch is only evaluated once. A gamma node is merged if its
+ * predicate is:
+ *
+ * 1. the predicate of the other gamma node,
+ * 2. a match node result, and the predicate of the other gamma node is a match node result of the
+ *    same value whose alternatives determine the alternatives of the former match node, or
+ * 3. a control output of the other gamma node that is a control constant in every subregion. This
+ *    threads the predicate through the other gamma node.
+ *
+ * A gamma node is only merged if none of its inputs depend on the other gamma node other than
+ * through a direct output, and none of the inputs of the other gamma node depend on it.
+ *
+ * In addition, control outputs of gamma nodes that only replicate the gamma node's predicate are
+ * replaced by the predicate itself, which exposes further gamma nodes with identical predicates.
+ *
+ * @see jlm::hls::merge_gamma
+ */
+class GammaMerging final : public optimization
+{
+  class Statistics;
+
+public:
+  ~GammaMerging() override;
+
+  void
+  run(RvsdgModule & rvsdgModule, util::StatisticsCollector & statisticsCollector) override;
+
+  /**
+   * Determines which subregion of \p gammaNode is taken for every subregion taken by
+   * \p targetGammaNode, assuming both are evaluated with their current predicates.
+   *
+   * @return A vector that maps the subregion indices of \p targetGammaNode to the subregion
+   * indices of \p gammaNode, or std::nullopt if the alternative of \p gammaNode is not determined
+   * by the alternative of \p targetGammaNode.
+   */
+  [[nodiscard]] static std::optional<std::vector<size_t>>
+  ComputeAlternativeMap(
+      const rvsdg::GammaNode & targetGammaNode,
+      const rvsdg::GammaNode & gammaNode);
+
+  /**
+   * Diverts the users of all control outputs of \p gammaNode that replicate the predicate of
+   * \p gammaNode to the origin of the predicate.
+   *
+   * @return True if any users were diverted, otherwise false.
+   */
+  static bool
+  EliminateReplicatedPredicates(rvsdg::GammaNode & gammaNode);
+
+  /**
+   * Merges \p gammaNode into a gamma node of the same region if possible. The gamma node is
+   * removed on success.
+   *
+   * @return The gamma node \p gammaNode was merged into, or nullptr if it was not merged.
+   */
+  static rvsdg::GammaNode *
+  TryMerge(rvsdg::GammaNode & gammaNode);
+
+private:
+  static void
+  MergeInRegion(rvsdg::Region & region, size_t & numMergedGammas);
+};
+
+}
+
+#endif
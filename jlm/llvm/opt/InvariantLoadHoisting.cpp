@@ -0,0 +1,181 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/llvm/ir/operators/Load.hpp>
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/llvm/opt/InvariantLoadHoisting.hpp>
+#include <jlm/rvsdg/theta.hpp>
+#include <jlm/rvsdg/traverser.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <vector>
+
+namespace jlm::llvm
+{
+
+class InvariantLoadHoisting::Statistics final : public util::Statistics
+{
+  static constexpr const char * NumHoistedLoads_ = "#HoistedLoads";
+
+public:
+  ~Statistics() override = default;
+
+  explicit Statistics(const util::filepath & sourceFile)
+      : util::Statistics(Statistics::Id::InvariantLoadHoisting, sourceFile)
+  {}
+
+  void
+  Start(const rvsdg::graph & graph) noexcept
+  {
+    AddMeasurement(Label::NumRvsdgNodesBefore, rvsdg::nnodes(graph.root()));
+    AddTimer(Label::Timer).start();
+  }
+
+  void
+  Stop(const rvsdg::graph & graph, size_t numHoistedLoads) noexcept
+  {
+    GetTimer(Label::Timer).stop();
+    AddMeasurement(Label::NumRvsdgNodesAfter, rvsdg::nnodes(graph.root()));
+    AddMeasurement(NumHoistedLoads_, numHoistedLoads);
+  }
+
+  static std::unique_ptr<Statistics>
+  Create(const util::filepath & sourceFile)
+  {
+    return std::make_unique<Statistics>(sourceFile);
+  }
+};
+
+/**
+ * @return The theta input of \p output if \p output is the argument of a loop-invariant loop
+ * variable, otherwise nullptr.
+ */
+static rvsdg::ThetaInput *
+GetInvariantThetaInput(const rvsdg::output & output)
+{
+  auto argument = dynamic_cast<const rvsdg::RegionArgument *>(&output);
+  if (argument == nullptr)
+    return nullptr;
+
+  auto thetaInput = dynamic_cast<rvsdg::ThetaInput *>(argument->input());
+  if (thetaInput == nullptr || !rvsdg::is_invariant(thetaInput))
+    return nullptr;
+
+  return thetaInput;
+}
+
+/**
+ * Moves \p loadNode in front of \p thetaNode. The memory states are routed through the hoisted
+ * load before they enter \p thetaNode, such that the load remains sequenced before all operations
+ * that follow the theta node.
+ */
+static void
+HoistLoad(rvsdg::ThetaNode & thetaNode, LoadNonVolatileNode & loadNode)
+{
+  std::vector<rvsdg::output *> operands;
+  for (size_t n = 0; n < loadNode.ninputs(); n++)
+  {
+    auto thetaInput = GetInvariantThetaInput(*loadNode.input(n)->origin());
+    JLM_ASSERT(thetaInput != nullptr);
+    operands.push_back(thetaInput->origin());
+  }
+
+  auto & hoistedLoadNode =
+      LoadNonVolatileNode::CreateNode(*thetaNode.region(), loadNode.GetOperation(), operands);
+
+  for (size_t n = 1; n < loadNode.ninputs(); n++)
+  {
+    auto argument = loadNode.input(n)->origin();
+    GetInvariantThetaInput(*argument)->divert_to(hoistedLoadNode.output(n));
+    loadNode.output(n)->divert_users(argument);
+  }
+
+  auto loopVar = thetaNode.add_loopvar(&hoistedLoadNode.GetLoadedValueOutput());
+  loadNode.GetLoadedValueOutput().divert_users(loopVar->argument());
+  remove(&loadNode);
+}
+
+InvariantLoadHoisting::~InvariantLoadHoisting() noexcept = default;
+
+void
+InvariantLoadHoisting::run(
+    RvsdgModule & rvsdgModule,
+    util::StatisticsCollector & statisticsCollector)
+{
+  auto & rvsdg = rvsdgModule.Rvsdg();
+  auto statistics = Statistics::Create(rvsdgModule.SourceFileName());
+
+  size_t numHoistedLoads = 0;
+  statistics->Start(rvsdg);
+  HoistInRegion(*rvsdg.root(), numHoistedLoads);
+  statistics->Stop(rvsdg, numHoistedLoads);
+
+  statisticsCollector.CollectDemandedStatistics(std::move(statistics));
+}
+
+bool
+InvariantLoadHoisting::IsInvariantLoad(const LoadNonVolatileNode & loadNode)
+{
+  if (!dynamic_cast<const rvsdg::ThetaNode *>(loadNode.region()->node()))
+    return false;
+
+  // The address as well as all memory states must enter the loop unmodified
+  for (size_t n = 0; n < loadNode.ninputs(); n++)
+  {
+    if (GetInvariantThetaInput(*loadNode.input(n)->origin()) == nullptr)
+      return false;
+  }
+
+  return true;
+}
+
+size_t
+InvariantLoadHoisting::HoistLoads(rvsdg::ThetaNode & thetaNode)
+{
+  // Hoisting a load can render the loads that depend on its value loop-invariant. The loads are
+  // therefore collected and hoisted in topological order.
+  std::vector<LoadNonVolatileNode *> loadNodes;
+  for (auto node : rvsdg::topdown_traverser(thetaNode.subregion()))
+  {
+    if (auto loadNode = dynamic_cast<LoadNonVolatileNode *>(node))
+      loadNodes.push_back(loadNode);
+  }
+
+  size_t numHoistedLoads = 0;
+  for (auto loadNode : loadNodes)
+  {
+    if (!IsInvariantLoad(*loadNode))
+      continue;
+
+    HoistLoad(thetaNode, *loadNode);
+    numHoistedLoads++;
+  }
+
+  return numHoistedLoads;
+}
+
+void
+InvariantLoadHoisting::HoistInRegion(rvsdg::Region & region, size_t & numHoistedLoads)
+{
+  // Hoisting adds nodes to the region. Collect the structural nodes upfront, such that the
+  // traversal is not affected by it.
+  std::vector<rvsdg::StructuralNode *> structuralNodes;
+  for (auto & node : region.nodes)
+  {
+    if (auto structuralNode = dynamic_cast<rvsdg::StructuralNode *>(&node))
+      structuralNodes.push_back(structuralNode);
+  }
+
+  for (auto structuralNode : structuralNodes)
+  {
+    for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+      HoistInRegion(*structuralNode->subregion(n), numHoistedLoads);
+
+    if (auto thetaNode = dynamic_cast<rvsdg::ThetaNode *>(structuralNode))
+      numHoistedLoads += HoistLoads(*thetaNode);
+  }
+}
+
+}
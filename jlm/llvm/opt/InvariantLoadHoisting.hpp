@@ -0,0 +1,76 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_LLVM_OPT_INVARIANTLOADHOISTING_HPP
+#define JLM_LLVM_OPT_INVARIANTLOADHOISTING_HPP
+
+#include <jlm/llvm/opt/optimization.hpp>
+
+#include <cstddef>
+
+namespace jlm::rvsdg
+{
+class Region;
+class ThetaNode;
+}
+
+namespace jlm::llvm
+{
+
+class LoadNonVolatileNode;
+class RvsdgModule;
+
+/** \brief Invariant Load Hoisting Optimization
+ *
+ * Invariant load hoisting moves non-volatile loads out of theta nodes if they load the same value
+ * in every iteration. This is the case if the address of a load is an argument of a loop-invariant
+ * loop variable, and all memory states consumed by the load are arguments of loop-invariant loop
+ * variables, i.e., the memory locations represented by these states are not modified within the
+ * loop. The load is then executed once in front of the theta node, and the loaded value is routed
+ * into the theta node through a new loop-invariant loop variable. As the subregion of a theta node
+ * is executed at least once, this does not introduce any loads that were not performed before.
+ *
+ * The memory states can only distinguish the locations modified within a loop from the locations
+ * loaded within the loop if they are encoded per memory location, i.e., after the
+ * MemoryStateEncoder encoded the results of an alias analysis.
+ *
+ * Nested theta nodes are processed first, such that loads hoisted out of a nested theta node can
+ * be hoisted further out of the enclosing theta node.
+ */
+class InvariantLoadHoisting final : public optimization
+{
+  class Statistics;
+
+public:
+  ~InvariantLoadHoisting() noexcept override;
+
+  void
+  run(RvsdgModule & rvsdgModule, util::StatisticsCollector & statisticsCollector) override;
+
+  /**
+   * Determines whether \p loadNode loads the same value in every iteration of the theta node it
+   * is contained in.
+   *
+   * @return True if \p loadNode is a loop-invariant load, otherwise false.
+   */
+  [[nodiscard]] static bool
+  IsInvariantLoad(const LoadNonVolatileNode & loadNode);
+
+  /**
+   * Hoists all loop-invariant loads in the subregion of \p thetaNode in front of \p thetaNode.
+   *
+   * @return The number of hoisted loads.
+   */
+  static size_t
+  HoistLoads(rvsdg::ThetaNode & thetaNode);
+
+private:
+  static void
+  HoistInRegion(rvsdg::Region & region, size_t & numHoistedLoads);
+};
+
+}
+
+#endif
@@ -0,0 +1,526 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/llvm/ir/operators/Load.hpp>
+#include <jlm/llvm/ir/operators/MemoryStateOperations.hpp>
+#include <jlm/llvm/ir/operators/Store.hpp>
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/llvm/ir/types.hpp>
+#include <jlm/llvm/opt/alias-analyses/PointsToGraph.hpp>
+#include <jlm/llvm/opt/alias-analyses/Steensgaard.hpp>
+#include <jlm/llvm/opt/LoopFusion.hpp>
+#include <jlm/llvm/opt/unroll.hpp>
+#include <jlm/rvsdg/substitution.hpp>
+#include <jlm/rvsdg/theta.hpp>
+#include <jlm/rvsdg/traverser.hpp>
+#include <jlm/util/HashSet.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <unordered_map>
+#include <vector>
+
+namespace jlm::llvm
+{
+
+class LoopFusion::Statistics final : public util::Statistics
+{
+  static constexpr const char * NumFusedLoops_ = "#FusedLoops";
+
+public:
+  ~Statistics() override = default;
+
+  explicit Statistics(const util::filepath & sourceFile)
+      : util::Statistics(Statistics::Id::LoopFusion, sourceFile)
+  {}
+
+  void
+  Start(const rvsdg::graph & graph) noexcept
+  {
+    AddMeasurement(Label::NumRvsdgNodesBefore, rvsdg::nnodes(graph.root()));
+    AddTimer(Label::Timer).start();
+  }
+
+  void
+  Stop(const rvsdg::graph & graph, size_t numFusedLoops) noexcept
+  {
+    GetTimer(Label::Timer).stop();
+    AddMeasurement(Label::NumRvsdgNodesAfter, rvsdg::nnodes(graph.root()));
+    AddMeasurement(NumFusedLoops_, numFusedLoops);
+  }
+
+  static std::unique_ptr<Statistics>
+  Create(const util::filepath & sourceFile)
+  {
+    return std::make_unique<Statistics>(sourceFile);
+  }
+};
+
+/**
+ * @return True if \p set1 and \p set2 have at least one item in common, otherwise false.
+ */
+static bool
+Intersects(
+    const util::HashSet<const aa::PointsToGraph::MemoryNode *> & set1,
+    const util::HashSet<const aa::PointsToGraph::MemoryNode *> & set2)
+{
+  if (set1.Size() > set2.Size())
+    return Intersects(set2, set1);
+
+  for (auto & item : set1.Items())
+  {
+    if (set2.Contains(item))
+      return true;
+  }
+
+  return false;
+}
+
+/** \brief Loop fusion context
+ *
+ * The context summarizes the memory locations that are read and written by every theta node. The
+ * summaries are computed before any loops are fused, as the points-to graph does not contain the
+ * outputs of copied nodes.
+ */
+class LoopFusion::Context final
+{
+public:
+  class MemoryAccesses final
+  {
+  public:
+    [[nodiscard]] bool
+    IsEmpty() const noexcept
+    {
+      return !HasUnknownAccesses && Reads.Size() == 0 && Writes.Size() == 0;
+    }
+
+    /**
+     * Determines whether the accesses might conflict with \p other, i.e., whether one of them
+     * might write a memory location that is read or written by the other one.
+     */
+    [[nodiscard]] bool
+    ConflictsWith(const MemoryAccesses & other) const
+    {
+      if ((HasUnknownAccesses && !other.IsEmpty()) || (other.HasUnknownAccesses && !IsEmpty()))
+        return true;
+
+      return Intersects(Writes, other.Reads) || Intersects(Writes, other.Writes)
+          || Intersects(other.Writes, Reads);
+    }
+
+    void
+    UnionWith(const MemoryAccesses & other)
+    {
+      Reads.UnionWith(other.Reads);
+      Writes.UnionWith(other.Writes);
+      HasUnknownAccesses |= other.HasUnknownAccesses;
+    }
+
+    util::HashSet<const aa::PointsToGraph::MemoryNode *> Reads;
+    util::HashSet<const aa::PointsToGraph::MemoryNode *> Writes;
+
+    /**
+     * True if the loop contains operations with side effects on unknown memory locations, such
+     * as calls or volatile loads and stores.
+     */
+    bool HasUnknownAccesses = false;
+  };
+
+  [[nodiscard]] const MemoryAccesses &
+  GetMemoryAccesses(const rvsdg::ThetaNode & thetaNode) const
+  {
+    JLM_ASSERT(MemoryAccesses_.find(&thetaNode) != MemoryAccesses_.end());
+    return MemoryAccesses_.at(&thetaNode);
+  }
+
+  void
+  SetMemoryAccesses(const rvsdg::ThetaNode & thetaNode, MemoryAccesses memoryAccesses)
+  {
+    MemoryAccesses_[&thetaNode] = std::move(memoryAccesses);
+  }
+
+  static std::unique_ptr<Context>
+  Create(const rvsdg::graph & rvsdg, const aa::PointsToGraph & pointsToGraph)
+  {
+    auto context = std::make_unique<Context>();
+
+    MemoryAccesses memoryAccesses;
+    context->CollectMemoryAccesses(*rvsdg.root(), pointsToGraph, memoryAccesses);
+
+    return context;
+  }
+
+private:
+  void
+  CollectMemoryAccesses(
+      const rvsdg::Region & region,
+      const aa::PointsToGraph & pointsToGraph,
+      MemoryAccesses & memoryAccesses)
+  {
+    for (auto & node : region.nodes)
+    {
+      if (auto structuralNode = dynamic_cast<const rvsdg::StructuralNode *>(&node))
+      {
+        MemoryAccesses nodeAccesses;
+        for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+          CollectMemoryAccesses(*structuralNode->subregion(n), pointsToGraph, nodeAccesses);
+
+        memoryAccesses.UnionWith(nodeAccesses);
+        if (auto thetaNode = dynamic_cast<const rvsdg::ThetaNode *>(structuralNode))
+          SetMemoryAccesses(*thetaNode, std::move(nodeAccesses));
+      }
+      else if (auto loadNode = dynamic_cast<const LoadNonVolatileNode *>(&node))
+      {
+        auto & address = *loadNode->GetAddressInput().origin();
+        CollectTargets(pointsToGraph, address, memoryAccesses.Reads, memoryAccesses);
+      }
+      else if (auto storeNode = dynamic_cast<const StoreNonVolatileNode *>(&node))
+      {
+        auto & address = *storeNode->GetAddressInput().origin();
+        CollectTargets(pointsToGraph, address, memoryAccesses.Writes, memoryAccesses);
+      }
+      else if (!rvsdg::is<MemoryStateOperation>(&node))
+      {
+        for (size_t n = 0; n < node.ninputs(); n++)
+        {
+          auto & type = node.input(n)->type();
+          if (rvsdg::is<MemoryStateType>(type) || rvsdg::is<iostatetype>(type))
+            memoryAccesses.HasUnknownAccesses = true;
+        }
+      }
+    }
+  }
+
+  static void
+  CollectTargets(
+      const aa::PointsToGraph & pointsToGraph,
+      const rvsdg::output & address,
+      util::HashSet<const aa::PointsToGraph::MemoryNode *> & targets,
+      MemoryAccesses & memoryAccesses)
+  {
+    auto & registerNode = pointsToGraph.GetRegisterNode(address);
+    for (auto & target : registerNode.Targets())
+    {
+      if (&target == &pointsToGraph.GetUnknownMemoryNode())
+        memoryAccesses.HasUnknownAccesses = true;
+
+      targets.Insert(&target);
+    }
+  }
+
+  std::unordered_map<const rvsdg::ThetaNode *, MemoryAccesses> MemoryAccesses_;
+};
+
+/**
+ * Determines whether \p node depends on \p thetaNode through any other path than a state edge that
+ * directly connects an output of \p thetaNode with an input of \p node, or whether an output of
+ * \p thetaNode is connected to multiple inputs of \p node.
+ */
+static bool
+HasIndirectDependence(const rvsdg::node & node, const rvsdg::ThetaNode & thetaNode)
+{
+  util::HashSet<const rvsdg::output *> directOutputs;
+  util::HashSet<const rvsdg::node *> visited;
+  std::vector<const rvsdg::node *> worklist;
+  for (size_t n = 0; n < node.ninputs(); n++)
+  {
+    auto & origin = *node.input(n)->origin();
+    auto producer = rvsdg::output::GetNode(origin);
+    if (producer == &thetaNode)
+    {
+      auto & type = origin.type();
+      if (!rvsdg::is<MemoryStateType>(type) && !rvsdg::is<iostatetype>(type))
+        return true;
+      if (!directOutputs.Insert(&origin))
+        return true;
+    }
+    else if (producer && visited.Insert(producer))
+    {
+      worklist.push_back(producer);
+    }
+  }
+
+  while (!worklist.empty())
+  {
+    auto current = worklist.back();
+    worklist.pop_back();
+
+    if (current == &thetaNode)
+      return true;
+
+    // A node can only depend on the theta node if it is deeper than the theta node
+    if (current->depth() <= thetaNode.depth())
+      continue;
+
+    for (size_t n = 0; n < current->ninputs(); n++)
+    {
+      auto producer = rvsdg::output::GetNode(*current->input(n)->origin());
+      if (producer && visited.Insert(producer))
+        worklist.push_back(producer);
+    }
+  }
+
+  return false;
+}
+
+/**
+ * @return The index of the first input of \p node whose origin is \p origin, or the number of
+ * inputs of \p node if no such input exists.
+ */
+static size_t
+GetInputIndex(const rvsdg::node & node, const rvsdg::output & origin)
+{
+  size_t n = 0;
+  while (n < node.ninputs() && node.input(n)->origin() != &origin)
+    n++;
+
+  return n;
+}
+
+/**
+ * @return True if \p value1 and \p value2 are both known and equal, or if \p origin1 and
+ * \p origin2 are the same output, otherwise false.
+ */
+static bool
+HaveSameValue(
+    const rvsdg::output & origin1,
+    const rvsdg::bitvalue_repr * value1,
+    const rvsdg::output & origin2,
+    const rvsdg::bitvalue_repr * value2)
+{
+  if (value1 && value2)
+    return *value1 == *value2;
+
+  return &origin1 == &origin2;
+}
+
+/**
+ * @return The origin of \p output outside of its theta node if \p output is the argument of a
+ * loop variable, otherwise \p output itself.
+ */
+static const rvsdg::output &
+GetOuterOrigin(const rvsdg::output & output)
+{
+  if (auto argument = dynamic_cast<const rvsdg::RegionArgument *>(&output))
+    return *argument->input()->origin();
+
+  return output;
+}
+
+/**
+ * Determines whether the induction variables of two loops are initialized, updated, and compared
+ * in the same way, such that the loops iterate the same number of times.
+ */
+static bool
+HaveSameInductionVariables(
+    const rvsdg::ThetaNode & thetaNode1,
+    const InductionVariable & inductionVariable1,
+    const rvsdg::ThetaNode & thetaNode2,
+    const InductionVariable & inductionVariable2)
+{
+  auto matchNode1 = rvsdg::output::GetNode(*thetaNode1.predicate()->origin());
+  auto matchNode2 = rvsdg::output::GetNode(*thetaNode2.predicate()->origin());
+  auto & cmpNode1 = inductionVariable1.GetCompareNode();
+  auto & cmpNode2 = inductionVariable2.GetCompareNode();
+  auto & armNode1 = inductionVariable1.GetArithmeticNode();
+  auto & armNode2 = inductionVariable2.GetArithmeticNode();
+  if (matchNode1->operation() != matchNode2->operation()
+      || cmpNode1.operation() != cmpNode2.operation()
+      || armNode1.operation() != armNode2.operation())
+    return false;
+
+  // The operands must be in the same positions, as the operations are not necessarily commutative
+  if (inductionVariable1.IsEndFirstOperand() != inductionVariable2.IsEndFirstOperand()
+      || GetInputIndex(armNode1, inductionVariable1.GetArgument())
+             != GetInputIndex(armNode2, inductionVariable2.GetArgument()))
+    return false;
+
+  auto & init1 = inductionVariable1.GetInit();
+  auto & init2 = inductionVariable2.GetInit();
+  auto & step1 = inductionVariable1.GetStep();
+  auto & step2 = inductionVariable2.GetStep();
+  auto & end1 = inductionVariable1.GetEnd();
+  auto & end2 = inductionVariable2.GetEnd();
+  return HaveSameValue(
+             init1,
+             InductionVariable::GetValue(init1),
+             init2,
+             InductionVariable::GetValue(init2))
+      && HaveSameValue(
+             GetOuterOrigin(step1),
+             InductionVariable::GetValue(step1),
+             GetOuterOrigin(step2),
+             InductionVariable::GetValue(step2))
+      && HaveSameValue(
+             GetOuterOrigin(end1),
+             InductionVariable::GetValue(end1),
+             GetOuterOrigin(end2),
+             InductionVariable::GetValue(end2));
+}
+
+LoopFusion::~LoopFusion() noexcept = default;
+
+LoopFusion::LoopFusion() = default;
+
+void
+LoopFusion::run(RvsdgModule & rvsdgModule, util::StatisticsCollector & statisticsCollector)
+{
+  auto & rvsdg = rvsdgModule.Rvsdg();
+  auto statistics = Statistics::Create(rvsdgModule.SourceFileName());
+
+  statistics->Start(rvsdg);
+  aa::Steensgaard steensgaard;
+  auto pointsToGraph = steensgaard.Analyze(rvsdgModule);
+  Context_ = Context::Create(rvsdg, *pointsToGraph);
+
+  size_t numFusedLoops = 0;
+  FuseInRegion(*rvsdg.root(), numFusedLoops);
+  statistics->Stop(rvsdg, numFusedLoops);
+
+  statisticsCollector.CollectDemandedStatistics(std::move(statistics));
+
+  // Discard internal state to free up memory after we are done
+  Context_.reset();
+}
+
+bool
+LoopFusion::HaveEqualTripCounts(
+    const rvsdg::ThetaNode & thetaNode1,
+    const rvsdg::ThetaNode & thetaNode2)
+{
+  auto inductionVariable1 = InductionVariable::Create(thetaNode1);
+  auto inductionVariable2 = InductionVariable::Create(thetaNode2);
+  if (!inductionVariable1 || !inductionVariable2)
+    return false;
+
+  auto tripCount1 = inductionVariable1->GetTripCount();
+  auto tripCount2 = inductionVariable2->GetTripCount();
+  if (tripCount1 && tripCount2)
+    return *tripCount1 == *tripCount2;
+
+  return HaveSameInductionVariables(
+      thetaNode1,
+      *inductionVariable1,
+      thetaNode2,
+      *inductionVariable2);
+}
+
+rvsdg::ThetaNode &
+LoopFusion::Fuse(rvsdg::ThetaNode & firstThetaNode, rvsdg::ThetaNode & secondThetaNode)
+{
+  JLM_ASSERT(firstThetaNode.region() == secondThetaNode.region());
+  auto fusedThetaNode = rvsdg::ThetaNode::create(firstThetaNode.region());
+
+  rvsdg::SubstitutionMap smap;
+  std::vector<rvsdg::ThetaOutput *> firstLoopVars;
+  for (const auto & loopVar : firstThetaNode)
+  {
+    auto fusedLoopVar = fusedThetaNode->add_loopvar(loopVar->input()->origin());
+    smap.insert(loopVar->argument(), fusedLoopVar->argument());
+    firstLoopVars.push_back(fusedLoopVar);
+  }
+  firstThetaNode.subregion()->copy(fusedThetaNode->subregion(), smap, false, false);
+
+  // Loop variables that connect both theta nodes are threaded from the first loop body to the
+  // second loop body in every iteration
+  std::vector<rvsdg::ThetaOutput *> secondLoopVars;
+  for (const auto & loopVar : secondThetaNode)
+  {
+    auto origin = loopVar->input()->origin();
+    if (rvsdg::output::GetNode(*origin) == &firstThetaNode)
+    {
+      auto firstLoopVar = firstThetaNode.output(origin->index());
+      smap.insert(loopVar->argument(), smap.lookup(firstLoopVar->result()->origin()));
+      secondLoopVars.push_back(firstLoopVars[origin->index()]);
+    }
+    else
+    {
+      auto fusedLoopVar = fusedThetaNode->add_loopvar(origin);
+      smap.insert(loopVar->argument(), fusedLoopVar->argument());
+      secondLoopVars.push_back(fusedLoopVar);
+    }
+  }
+  secondThetaNode.subregion()->copy(fusedThetaNode->subregion(), smap, false, false);
+
+  fusedThetaNode->set_predicate(smap.lookup(firstThetaNode.predicate()->origin()));
+  for (size_t n = 0; n < firstLoopVars.size(); n++)
+  {
+    auto origin = firstThetaNode.output(n)->result()->origin();
+    firstLoopVars[n]->result()->divert_to(smap.lookup(origin));
+  }
+  for (size_t n = 0; n < secondLoopVars.size(); n++)
+  {
+    auto origin = secondThetaNode.output(n)->result()->origin();
+    secondLoopVars[n]->result()->divert_to(smap.lookup(origin));
+  }
+
+  // Remove the copy of the second loop's predicate computation
+  fusedThetaNode->subregion()->prune(false);
+
+  for (size_t n = 0; n < secondLoopVars.size(); n++)
+    secondThetaNode.output(n)->divert_users(secondLoopVars[n]);
+  remove(&secondThetaNode);
+
+  for (size_t n = 0; n < firstLoopVars.size(); n++)
+    firstThetaNode.output(n)->divert_users(firstLoopVars[n]);
+  remove(&firstThetaNode);
+
+  return *fusedThetaNode;
+}
+
+void
+LoopFusion::FuseInRegion(rvsdg::Region & region, size_t & numFusedLoops)
+{
+  // The theta nodes are collected in topological order, such that a theta node never depends on
+  // any of the theta nodes that follow it.
+  std::vector<rvsdg::StructuralNode *> structuralNodes;
+  for (auto node : rvsdg::topdown_traverser(&region))
+  {
+    if (auto structuralNode = dynamic_cast<rvsdg::StructuralNode *>(node))
+      structuralNodes.push_back(structuralNode);
+  }
+
+  std::vector<rvsdg::ThetaNode *> thetaNodes;
+  for (auto structuralNode : structuralNodes)
+  {
+    for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+      FuseInRegion(*structuralNode->subregion(n), numFusedLoops);
+
+    if (auto thetaNode = dynamic_cast<rvsdg::ThetaNode *>(structuralNode))
+      thetaNodes.push_back(thetaNode);
+  }
+
+  for (size_t i = 0; i < thetaNodes.size(); i++)
+  {
+    for (size_t j = i + 1; j < thetaNodes.size(); j++)
+    {
+      if (thetaNodes[j] == nullptr || !CanFuse(*thetaNodes[i], *thetaNodes[j]))
+        continue;
+
+      auto memoryAccesses = Context_->GetMemoryAccesses(*thetaNodes[i]);
+      memoryAccesses.UnionWith(Context_->GetMemoryAccesses(*thetaNodes[j]));
+
+      auto & fusedThetaNode = Fuse(*thetaNodes[i], *thetaNodes[j]);
+      Context_->SetMemoryAccesses(fusedThetaNode, std::move(memoryAccesses));
+      thetaNodes[i] = &fusedThetaNode;
+      thetaNodes[j] = nullptr;
+      numFusedLoops++;
+    }
+  }
+}
+
+bool
+LoopFusion::CanFuse(rvsdg::ThetaNode & firstThetaNode, rvsdg::ThetaNode & secondThetaNode) const
+{
+  auto & memoryAccesses = Context_->GetMemoryAccesses(firstThetaNode);
+  if (memoryAccesses.ConflictsWith(Context_->GetMemoryAccesses(secondThetaNode)))
+    return false;
+
+  if (HasIndirectDependence(secondThetaNode, firstThetaNode))
+    return false;
+
+  return HaveEqualTripCounts(firstThetaNode, secondThetaNode);
+}
+
+}
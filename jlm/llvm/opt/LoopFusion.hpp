@@ -0,0 +1,100 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_LLVM_OPT_LOOPFUSION_HPP
+#define JLM_LLVM_OPT_LOOPFUSION_HPP
+
+#include <jlm/llvm/opt/optimization.hpp>
+
+#include <cstddef>
+#include <memory>
+
+namespace jlm::rvsdg
+{
+class Region;
+class ThetaNode;
+}
+
+namespace jlm::llvm
+{
+
+class RvsdgModule;
+
+/** \brief Loop Fusion Optimization
+ *
+ * Loop fusion merges two theta nodes of the same region into a single theta node if both iterate
+ * the same number of times. The loop bodies are placed next to each other in the subregion of the
+ * fused theta node, which halves the loop overhead and enables further optimizations across the
+ * loop bodies.
+ *
+ * The trip counts of the theta nodes are determined with the induction variable pattern matching
+ * of InductionVariable. Two theta nodes have equal trip counts if both trip counts are statically
+ * known and equal, or if both loops compare and update their induction variables with the same
+ * operations on the same initial, step, and end values.
+ *
+ * Two theta nodes can only be fused if the second theta node depends on the first theta node only
+ * through memory and I/O states that directly connect them. These states are threaded through both
+ * loop bodies in every iteration of the fused theta node. This is only legal if the loops do not
+ * access the same memory locations, which is determined with the points-to graph computed by
+ * Steensgaard's analysis.
+ */
+class LoopFusion final : public optimization
+{
+  class Context;
+  class Statistics;
+
+public:
+  ~LoopFusion() noexcept override;
+
+  LoopFusion();
+
+  LoopFusion(const LoopFusion &) = delete;
+
+  LoopFusion(LoopFusion &&) = delete;
+
+  LoopFusion &
+  operator=(const LoopFusion &) = delete;
+
+  LoopFusion &
+  operator=(LoopFusion &&) = delete;
+
+  void
+  run(RvsdgModule & rvsdgModule, util::StatisticsCollector & statisticsCollector) override;
+
+  /**
+   * Determines whether \p thetaNode1 and \p thetaNode2 iterate the same number of times. The
+   * theta nodes are not modified.
+   *
+   * @return True if both theta nodes are known to have equal trip counts, otherwise false.
+   */
+  static bool
+  HaveEqualTripCounts(const rvsdg::ThetaNode & thetaNode1, const rvsdg::ThetaNode & thetaNode2);
+
+  /**
+   * Fuses \p firstThetaNode and \p secondThetaNode into a single theta node, and removes both of
+   * them. Loop variables of \p secondThetaNode whose inputs originate from \p firstThetaNode are
+   * merged with the respective loop variables of \p firstThetaNode. The loop predicate is taken
+   * from \p firstThetaNode.
+   *
+   * The legality of the transformation is not checked.
+   *
+   * @return The fused theta node.
+   */
+  static rvsdg::ThetaNode &
+  Fuse(rvsdg::ThetaNode & firstThetaNode, rvsdg::ThetaNode & secondThetaNode);
+
+private:
+  void
+  FuseInRegion(rvsdg::Region & region, size_t & numFusedLoops);
+
+  [[nodiscard]] bool
+  CanFuse(rvsdg::ThetaNode & firstThetaNode, rvsdg::ThetaNode & secondThetaNode) const;
+
+  std::unique_ptr<Context> Context_;
+};
+
+}
+
+#endif
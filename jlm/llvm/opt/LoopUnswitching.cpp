@@ -0,0 +1,321 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/llvm/opt/LoopUnswitching.hpp>
+#include <jlm/rvsdg/control.hpp>
+#include <jlm/rvsdg/gamma.hpp>
+#include <jlm/rvsdg/simple-node.hpp>
+#include <jlm/rvsdg/substitution.hpp>
+#include <jlm/rvsdg/theta.hpp>
+#include <jlm/rvsdg/traverser.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace jlm::llvm
+{
+
+class LoopUnswitching::Statistics final : public util::Statistics
+{
+  static constexpr const char * NumUnswitchedLoops_ = "#UnswitchedLoops";
+
+public:
+  ~Statistics() override = default;
+
+  explicit Statistics(const util::filepath & sourceFile)
+      : util::Statistics(Statistics::Id::LoopUnswitching, sourceFile)
+  {}
+
+  void
+  Start(const rvsdg::graph & graph) noexcept
+  {
+    AddMeasurement(Label::NumRvsdgNodesBefore, rvsdg::nnodes(graph.root()));
+    AddTimer(Label::Timer).start();
+  }
+
+  void
+  Stop(const rvsdg::graph & graph, size_t numUnswitchedLoops) noexcept
+  {
+    GetTimer(Label::Timer).stop();
+    AddMeasurement(Label::NumRvsdgNodesAfter, rvsdg::nnodes(graph.root()));
+    AddMeasurement(NumUnswitchedLoops_, numUnswitchedLoops);
+  }
+
+  static std::unique_ptr<Statistics>
+  Create(const util::filepath & sourceFile)
+  {
+    return std::make_unique<Statistics>(sourceFile);
+  }
+};
+
+/**
+ * @return True if \p type is a state type other than a control type, i.e., it sequences
+ * operations with side effects.
+ */
+static bool
+IsSideEffectType(const rvsdg::Type & type)
+{
+  return rvsdg::is<rvsdg::StateType>(type) && !rvsdg::is<rvsdg::ControlType>(type);
+}
+
+/**
+ * Determines whether \p output is loop-invariant in the subregion of \p thetaNode, and collects
+ * the simple nodes computing it in \p nodes.
+ */
+static bool
+IsLoopInvariant(
+    const rvsdg::ThetaNode & thetaNode,
+    const rvsdg::output & output,
+    std::unordered_map<const rvsdg::output *, bool> & cache,
+    std::unordered_set<rvsdg::node *> & nodes)
+{
+  if (auto it = cache.find(&output); it != cache.end())
+    return it->second;
+
+  bool isInvariant = false;
+  if (auto argument = dynamic_cast<const rvsdg::RegionArgument *>(&output))
+  {
+    auto input = dynamic_cast<const rvsdg::ThetaInput *>(argument->input());
+    isInvariant = argument->region() == thetaNode.subregion() && input
+               && rvsdg::is_invariant(input);
+  }
+  else if (auto node = dynamic_cast<rvsdg::simple_node *>(rvsdg::output::GetNode(output)))
+  {
+    JLM_ASSERT(node->region() == thetaNode.subregion());
+
+    isInvariant = true;
+    for (size_t n = 0; n < node->noutputs() && isInvariant; n++)
+      isInvariant = !IsSideEffectType(node->output(n)->type());
+    for (size_t n = 0; n < node->ninputs() && isInvariant; n++)
+    {
+      auto & origin = *node->input(n)->origin();
+      isInvariant = !IsSideEffectType(origin.type())
+                 && IsLoopInvariant(thetaNode, origin, cache, nodes);
+    }
+
+    if (isInvariant)
+      nodes.insert(node);
+  }
+
+  cache[&output] = isInvariant;
+  return isInvariant;
+}
+
+/**
+ * Collects the simple nodes computing the predicate of \p gammaNode, ordered by their depth.
+ *
+ * @return True if the predicate is loop-invariant, otherwise false.
+ */
+static bool
+CollectPredicateNodes(
+    const rvsdg::ThetaNode & thetaNode,
+    const rvsdg::GammaNode & gammaNode,
+    std::vector<rvsdg::node *> & predicateNodes)
+{
+  std::unordered_map<const rvsdg::output *, bool> cache;
+  std::unordered_set<rvsdg::node *> nodes;
+  if (!IsLoopInvariant(thetaNode, *gammaNode.predicate()->origin(), cache, nodes))
+    return false;
+
+  predicateNodes.assign(nodes.begin(), nodes.end());
+  std::sort(
+      predicateNodes.begin(),
+      predicateNodes.end(),
+      [](const rvsdg::node * node1, const rvsdg::node * node2)
+      {
+        return node1->depth() < node2->depth();
+      });
+
+  return true;
+}
+
+/**
+ * @return The number of nodes added by unswitching \p thetaNode over \p gammaNode.
+ */
+static size_t
+ComputeCodeGrowth(const rvsdg::ThetaNode & thetaNode, const rvsdg::GammaNode & gammaNode)
+{
+  auto numLoopNodes = rvsdg::nnodes(thetaNode.subregion()) + 1;
+  return numLoopNodes * (gammaNode.nsubregions() - 1);
+}
+
+/**
+ * Replaces \p gammaNode with the content of its subregion \p alternative.
+ */
+static void
+InlineGammaAlternative(rvsdg::GammaNode & gammaNode, size_t alternative)
+{
+  rvsdg::SubstitutionMap smap;
+  for (auto it = gammaNode.begin_entryvar(); it != gammaNode.end_entryvar(); it++)
+    smap.insert(it->argument(alternative), it->origin());
+
+  gammaNode.subregion(alternative)->copy(gammaNode.region(), smap, false, false);
+
+  for (auto it = gammaNode.begin_exitvar(); it != gammaNode.end_exitvar(); it++)
+    it->divert_users(smap.lookup(it->result(alternative)->origin()));
+
+  remove(&gammaNode);
+}
+
+LoopUnswitching::~LoopUnswitching() = default;
+
+void
+LoopUnswitching::run(RvsdgModule & rvsdgModule, util::StatisticsCollector & statisticsCollector)
+{
+  auto & rvsdg = rvsdgModule.Rvsdg();
+  auto statistics = Statistics::Create(rvsdgModule.SourceFileName());
+
+  size_t numUnswitchedLoops = 0;
+  statistics->Start(rvsdg);
+  UnswitchInRegion(*rvsdg.root(), numUnswitchedLoops);
+  statistics->Stop(rvsdg, numUnswitchedLoops);
+
+  statisticsCollector.CollectDemandedStatistics(std::move(statistics));
+}
+
+rvsdg::GammaNode *
+LoopUnswitching::FindInvariantGamma(const rvsdg::ThetaNode & thetaNode)
+{
+  for (auto & node : thetaNode.subregion()->nodes)
+  {
+    auto gammaNode = dynamic_cast<rvsdg::GammaNode *>(&node);
+    if (gammaNode == nullptr || gammaNode->noutputs() == 0)
+      continue;
+
+    std::vector<rvsdg::node *> predicateNodes;
+    if (CollectPredicateNodes(thetaNode, *gammaNode, predicateNodes))
+      return gammaNode;
+  }
+
+  return nullptr;
+}
+
+rvsdg::GammaNode *
+LoopUnswitching::UnswitchLoop(rvsdg::ThetaNode & thetaNode, size_t maxCodeGrowth)
+{
+  auto oldGamma = FindInvariantGamma(thetaNode);
+  if (oldGamma == nullptr || ComputeCodeGrowth(thetaNode, *oldGamma) > maxCodeGrowth)
+    return nullptr;
+
+  // Copy the nodes computing the predicate in front of the theta node
+  std::vector<rvsdg::node *> predicateNodes;
+  CollectPredicateNodes(thetaNode, *oldGamma, predicateNodes);
+
+  rvsdg::SubstitutionMap smap;
+  for (const auto & loopVar : thetaNode)
+    smap.insert(loopVar->argument(), loopVar->input()->origin());
+  for (auto node : predicateNodes)
+    node->copy(thetaNode.region(), smap);
+
+  auto numAlternatives = oldGamma->nsubregions();
+  auto newGamma =
+      rvsdg::GammaNode::create(smap.lookup(oldGamma->predicate()->origin()), numAlternatives);
+
+  std::unordered_map<rvsdg::output *, rvsdg::GammaInput *> entryVars;
+  for (const auto & loopVar : thetaNode)
+  {
+    auto origin = loopVar->input()->origin();
+    if (entryVars.find(origin) == entryVars.end())
+      entryVars[origin] = newGamma->add_entryvar(origin);
+  }
+
+  // Create a copy of the theta node for every alternative, and specialize the copied gamma node
+  std::vector<std::vector<rvsdg::output *>> exitVarOrigins(thetaNode.noutputs());
+  for (size_t alternative = 0; alternative < numAlternatives; alternative++)
+  {
+    auto newTheta = rvsdg::ThetaNode::create(newGamma->subregion(alternative));
+
+    rvsdg::SubstitutionMap rmap;
+    std::vector<rvsdg::ThetaOutput *> newLoopVars;
+    for (const auto & oldLoopVar : thetaNode)
+    {
+      auto entryVar = entryVars[oldLoopVar->input()->origin()];
+      auto newLoopVar = newTheta->add_loopvar(entryVar->argument(alternative));
+      rmap.insert(oldLoopVar->argument(), newLoopVar->argument());
+      newLoopVars.push_back(newLoopVar);
+    }
+
+    thetaNode.subregion()->copy(newTheta->subregion(), rmap, false, false);
+    newTheta->set_predicate(rmap.lookup(thetaNode.predicate()->origin()));
+    for (size_t n = 0; n < newLoopVars.size(); n++)
+    {
+      auto oldLoopVar = thetaNode.output(n);
+      newLoopVars[n]->result()->divert_to(rmap.lookup(oldLoopVar->result()->origin()));
+      exitVarOrigins[n].push_back(newLoopVars[n]);
+    }
+
+    auto copiedGamma = util::AssertedCast<rvsdg::GammaNode>(
+        rvsdg::output::GetNode(*rmap.lookup(oldGamma->output(0))));
+    InlineGammaAlternative(*copiedGamma, alternative);
+  }
+
+  for (size_t n = 0; n < thetaNode.noutputs(); n++)
+  {
+    auto exitVar = newGamma->add_exitvar(exitVarOrigins[n]);
+    thetaNode.output(n)->divert_users(exitVar);
+  }
+  remove(&thetaNode);
+
+  return newGamma;
+}
+
+void
+LoopUnswitching::UnswitchInRegion(rvsdg::Region & region, size_t & numUnswitchedLoops) const
+{
+  // Unswitching replaces theta nodes with gamma nodes. Collect the structural nodes upfront, such
+  // that the replacements are not visited again.
+  std::vector<rvsdg::StructuralNode *> structuralNodes;
+  for (auto node : rvsdg::topdown_traverser(&region))
+  {
+    if (auto structuralNode = dynamic_cast<rvsdg::StructuralNode *>(node))
+      structuralNodes.push_back(structuralNode);
+  }
+
+  for (auto structuralNode : structuralNodes)
+  {
+    for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+      UnswitchInRegion(*structuralNode->subregion(n), numUnswitchedLoops);
+
+    if (auto thetaNode = dynamic_cast<rvsdg::ThetaNode *>(structuralNode))
+      UnswitchRecursively(*thetaNode, MaxCodeGrowth_, numUnswitchedLoops);
+  }
+}
+
+void
+LoopUnswitching::UnswitchRecursively(
+    rvsdg::ThetaNode & thetaNode,
+    size_t budget,
+    size_t & numUnswitchedLoops)
+{
+  auto gammaNode = FindInvariantGamma(thetaNode);
+  if (gammaNode == nullptr)
+    return;
+
+  auto codeGrowth = ComputeCodeGrowth(thetaNode, *gammaNode);
+  auto newGamma = UnswitchLoop(thetaNode, budget);
+  if (newGamma == nullptr)
+    return;
+  numUnswitchedLoops++;
+
+  // The loop copies might contain further gamma nodes with loop-invariant predicates. Split the
+  // remaining budget evenly among them.
+  auto remainingBudget = (budget - codeGrowth) / newGamma->nsubregions();
+  for (size_t n = 0; n < newGamma->nsubregions(); n++)
+  {
+    for (auto & node : newGamma->subregion(n)->nodes)
+    {
+      if (auto newTheta = dynamic_cast<rvsdg::ThetaNode *>(&node))
+      {
+        UnswitchRecursively(*newTheta, remainingBudget, numUnswitchedLoops);
+        break;
+      }
+    }
+  }
+}
+
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_LLVM_OPT_LOOPUNSWITCHING_HPP
+#define JLM_LLVM_OPT_LOOPUNSWITCHING_HPP
+
+#include <jlm/llvm/opt/optimization.hpp>
+
+#include <cstddef>
+
+namespace jlm::rvsdg
+{
+class GammaNode;
+class Region;
+class ThetaNode;
+}
+
+namespace jlm::llvm
+{
+
+class RvsdgModule;
+
+/** \brief Loop Unswitching Optimization
+ *
+ * Loop unswitching hoists a gamma node out of a theta node if the gamma node's predicate only
+ * depends on loop-invariant values. The theta node is replaced by a new gamma node with the same
+ * predicate, and every subregion of the new gamma node receives a copy of the theta node in which
+ * the original gamma node is replaced by the content of the respective subregion. The branch is
+ * then evaluated once before the loop instead of in every iteration, and the loop bodies become
+ * simpler and more amenable to other optimizations, such as loop unrolling.
+ *
+ * A value in a theta node's subregion is loop-invariant if it is an argument of an invariant loop
+ * variable, or the output of a simple node whose inputs are all loop-invariant and that neither
+ * consumes nor produces states. The nodes computing the predicate are copied in front of the theta
+ * node. As the subregion of a theta node is executed at least once, this does not introduce any
+ * computations that were not performed before.
+ *
+ * Every unswitched loop copies the entire loop body once per additional gamma alternative. The
+ * code-growth budget limits the number of nodes that are added for a single loop, including the
+ * growth from unswitching the resulting loops again.
+ */
+class LoopUnswitching final : public optimization
+{
+  class Statistics;
+
+public:
+  static constexpr size_t DefaultMaxCodeGrowth = 256;
+
+  ~LoopUnswitching() override;
+
+  /**
+   * @param maxCodeGrowth The maximum number of nodes that may be added for unswitching a loop.
+   */
+  explicit LoopUnswitching(size_t maxCodeGrowth = DefaultMaxCodeGrowth)
+      : MaxCodeGrowth_(maxCodeGrowth)
+  {}
+
+  [[nodiscard]] size_t
+  GetMaxCodeGrowth() const noexcept
+  {
+    return MaxCodeGrowth_;
+  }
+
+  void
+  run(RvsdgModule & rvsdgModule, util::StatisticsCollector & statisticsCollector) override;
+
+  /**
+   * Finds a gamma node in the subregion of \p thetaNode whose predicate only depends on
+   * loop-invariant values.
+   *
+   * @return The gamma node, or nullptr if no such gamma node exists.
+   */
+  [[nodiscard]] static rvsdg::GammaNode *
+  FindInvariantGamma(const rvsdg::ThetaNode & thetaNode);
+
+  /**
+   * Unswitches \p thetaNode if it contains a gamma node with a loop-invariant predicate and the
+   * number of nodes added does not exceed \p maxCodeGrowth. The theta node is removed on success.
+   *
+   * @return The gamma node replacing \p thetaNode, or nullptr if the loop was not unswitched.
+   */
+  static rvsdg::GammaNode *
+  UnswitchLoop(rvsdg::ThetaNode & thetaNode, size_t maxCodeGrowth);
+
+private:
+  void
+  UnswitchInRegion(rvsdg::Region & region, size_t & numUnswitchedLoops) const;
+
+  static void
+  UnswitchRecursively(rvsdg::ThetaNode & thetaNode, size_t budget, size_t & numUnswitchedLoops);
+
+  size_t MaxCodeGrowth_;
+};
+
+}
+
+#endif
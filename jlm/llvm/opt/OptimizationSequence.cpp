@@ -5,6 +5,8 @@
 
 #include <jlm/llvm/ir/RvsdgModule.hpp>
 #include <jlm/llvm/opt/OptimizationSequence.hpp>
+#include <jlm/rvsdg/region.hpp>
+#include <jlm/util/MemoryFootprint.hpp>
 #include <jlm/util/Statistics.hpp>
 #include <jlm/util/time.hpp>
 
@@ -43,6 +45,27 @@ public:
 
 OptimizationSequence::~OptimizationSequence() noexcept = default;
 
+/**
+ * Adds the memory footprint of the RVSDG of \p rvsdgModule to all statistics collected from the
+ * \p firstStatistics-th statistics on, i.e., to the statistics of the pass that just ran. The
+ * footprint is only computed if it is demanded and the pass collected statistics, as it requires
+ * a traversal of the entire graph.
+ */
+static void
+AddMemoryFootprint(
+    const RvsdgModule & rvsdgModule,
+    size_t firstStatistics,
+    util::StatisticsCollector & statisticsCollector)
+{
+  if (!statisticsCollector.GetSettings().IsDemanded(util::Statistics::Id::MemoryFootprint)
+      || firstStatistics == statisticsCollector.NumCollectedStatistics())
+    return;
+
+  auto memoryFootprint = rvsdg::ComputeMemoryFootprint(*rvsdgModule.Rvsdg().root());
+  for (size_t n = firstStatistics; n < statisticsCollector.NumCollectedStatistics(); n++)
+    statisticsCollector.GetCollectedStatistics(n).AddMeasurements(memoryFootprint);
+}
+
 void
 OptimizationSequence::run(
     RvsdgModule & rvsdgModule,
@@ -53,11 +76,15 @@ OptimizationSequence::run(
 
   for (const auto & optimization : Optimizations_)
   {
+    auto firstStatistics = statisticsCollector.NumCollectedStatistics();
     optimization->run(rvsdgModule, statisticsCollector);
+    AddMemoryFootprint(rvsdgModule, firstStatistics, statisticsCollector);
   }
 
   statistics->EndMeasuring(rvsdgModule.Rvsdg());
+  auto firstStatistics = statisticsCollector.NumCollectedStatistics();
   statisticsCollector.CollectDemandedStatistics(std::move(statistics));
+  AddMemoryFootprint(rvsdgModule, firstStatistics, statisticsCollector);
 }
 
 }
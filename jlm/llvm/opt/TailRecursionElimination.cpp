@@ -0,0 +1,481 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/llvm/ir/operators/call.hpp>
+#include <jlm/llvm/ir/operators/lambda.hpp>
+#include <jlm/llvm/ir/operators/operators.hpp>
+#include <jlm/llvm/ir/operators/Phi.hpp>
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/llvm/opt/DeadNodeElimination.hpp>
+#include <jlm/llvm/opt/TailRecursionElimination.hpp>
+#include <jlm/rvsdg/bitstring/arithmetic.hpp>
+#include <jlm/rvsdg/bitstring/constant.hpp>
+#include <jlm/rvsdg/control.hpp>
+#include <jlm/rvsdg/gamma.hpp>
+#include <jlm/rvsdg/theta.hpp>
+#include <jlm/rvsdg/traverser.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <optional>
+
+namespace jlm::llvm
+{
+
+class TailRecursionElimination::Statistics final : public util::Statistics
+{
+  static constexpr const char * NumTransformedFunctions_ = "#TransformedFunctions";
+  static constexpr const char * NumRemovedPhiNodes_ = "#RemovedPhiNodes";
+
+public:
+  ~Statistics() override = default;
+
+  explicit Statistics(const util::filepath & sourceFile)
+      : util::Statistics(Statistics::Id::TailRecursionElimination, sourceFile)
+  {}
+
+  void
+  Start(const rvsdg::graph & graph) noexcept
+  {
+    AddMeasurement(Label::NumRvsdgNodesBefore, rvsdg::nnodes(graph.root()));
+    AddTimer(Label::Timer).start();
+  }
+
+  void
+  Stop(const rvsdg::graph & graph, size_t numTransformedFunctions, size_t numRemovedPhiNodes)
+      noexcept
+  {
+    GetTimer(Label::Timer).stop();
+    AddMeasurement(Label::NumRvsdgNodesAfter, rvsdg::nnodes(graph.root()));
+    AddMeasurement(NumTransformedFunctions_, numTransformedFunctions);
+    AddMeasurement(NumRemovedPhiNodes_, numRemovedPhiNodes);
+  }
+
+  static std::unique_ptr<Statistics>
+  Create(const util::filepath & sourceFile)
+  {
+    return std::make_unique<Statistics>(sourceFile);
+  }
+};
+
+/**
+ * Describes the recursive tail calls of a lambda node whose results all originate from a single
+ * gamma node.
+ */
+struct TailRecursion
+{
+  rvsdg::GammaNode * GammaNode = nullptr;
+
+  /**
+   * The gamma output of every lambda result.
+   */
+  std::vector<rvsdg::GammaOutput *> Results;
+
+  /**
+   * The recursive tail call of every gamma subregion, or nullptr for a base case subregion.
+   */
+  std::vector<CallNode *> TailCalls;
+
+  /**
+   * The node accumulating the respective lambda result, or nullptr if the result is returned
+   * unchanged from the tail calls.
+   */
+  std::vector<rvsdg::node *> Accumulators;
+};
+
+/**
+ * @return The neutral element of the operation of \p node if it is an associative and commutative
+ * bit operation, otherwise std::nullopt.
+ */
+static std::optional<int64_t>
+GetNeutralElement(const rvsdg::node & node)
+{
+  if (rvsdg::is<rvsdg::bitadd_op>(&node) || rvsdg::is<rvsdg::bitor_op>(&node)
+      || rvsdg::is<rvsdg::bitxor_op>(&node))
+    return 0;
+
+  if (rvsdg::is<rvsdg::bitmul_op>(&node))
+    return 1;
+
+  if (rvsdg::is<rvsdg::bitand_op>(&node))
+    return -1;
+
+  return std::nullopt;
+}
+
+static bool
+IsRecursiveCall(const CallNode & callNode, const lambda::node & lambdaNode)
+{
+  auto classifier = CallNode::ClassifyCall(callNode);
+  return classifier->IsRecursiveDirectCall()
+      && &classifier->GetLambdaOutput() == lambdaNode.output();
+}
+
+/**
+ * @return The recursive call of \p lambdaNode producing \p output, or nullptr if \p output is not
+ * produced by such a call.
+ */
+static CallNode *
+GetRecursiveCall(const rvsdg::output & output, const lambda::node & lambdaNode)
+{
+  auto callNode = dynamic_cast<CallNode *>(rvsdg::output::GetNode(output));
+  return callNode && IsRecursiveCall(*callNode, lambdaNode) ? callNode : nullptr;
+}
+
+/**
+ * Determines the recursive tail calls of \p lambdaNode, assuming the lambda results originate
+ * from \p resultOrigins.
+ *
+ * @return A description of the tail calls, or std::nullopt if the lambda node is not
+ * tail-recursive.
+ */
+static std::optional<TailRecursion>
+AnalyzeTailRecursion(
+    const lambda::node & lambdaNode,
+    const std::vector<rvsdg::output *> & resultOrigins)
+{
+  if (resultOrigins.empty())
+    return std::nullopt;
+
+  TailRecursion tailRecursion;
+  tailRecursion.GammaNode =
+      dynamic_cast<rvsdg::GammaNode *>(rvsdg::output::GetNode(*resultOrigins[0]));
+  if (tailRecursion.GammaNode == nullptr)
+    return std::nullopt;
+
+  auto & gammaNode = *tailRecursion.GammaNode;
+  for (auto origin : resultOrigins)
+  {
+    if (rvsdg::output::GetNode(*origin) != &gammaNode)
+      return std::nullopt;
+
+    tailRecursion.Results.push_back(util::AssertedCast<rvsdg::GammaOutput>(origin));
+  }
+
+  auto numResults = resultOrigins.size();
+  tailRecursion.Accumulators.resize(numResults, nullptr);
+
+  size_t numBaseCases = 0;
+  for (size_t n = 0; n < gammaNode.nsubregions(); n++)
+  {
+    CallNode * tailCall = nullptr;
+    std::vector<rvsdg::node *> accumulators(numResults, nullptr);
+    for (size_t i = 0; i < numResults && (i == 0 || tailCall); i++)
+    {
+      auto & origin = *tailRecursion.Results[i]->result(n)->origin();
+      auto callNode = GetRecursiveCall(origin, lambdaNode);
+      if (callNode == nullptr)
+      {
+        // The result might accumulate the output of the tail call
+        auto node = rvsdg::output::GetNode(origin);
+        if (node && node->ninputs() == 2 && GetNeutralElement(*node) && origin.nusers() == 1)
+        {
+          for (size_t k = 0; k < 2 && callNode == nullptr; k++)
+          {
+            auto operandCall = GetRecursiveCall(*node->input(k)->origin(), lambdaNode);
+            auto otherCall = GetRecursiveCall(*node->input(1 - k)->origin(), lambdaNode);
+            if (operandCall && operandCall != otherCall)
+            {
+              callNode = operandCall;
+              accumulators[i] = node;
+            }
+          }
+        }
+      }
+
+      if (i == 0)
+        tailCall = callNode;
+      else if (callNode != tailCall)
+        return std::nullopt;
+    }
+
+    if (tailCall == nullptr)
+    {
+      numBaseCases++;
+      tailRecursion.TailCalls.push_back(nullptr);
+      continue;
+    }
+
+    // Every result must stem from the respective call output, and the call outputs must not be
+    // used otherwise
+    if (tailCall->NumArguments() != lambdaNode.nfctarguments()
+        || tailCall->NumResults() != numResults)
+      return std::nullopt;
+
+    for (size_t i = 0; i < numResults; i++)
+    {
+      auto callOutput = tailCall->Result(i);
+      auto & origin = *tailRecursion.Results[i]->result(n)->origin();
+      auto accumulator = accumulators[i];
+      if (callOutput->nusers() != 1)
+        return std::nullopt;
+      if (accumulator == nullptr && &origin != callOutput)
+        return std::nullopt;
+      if (accumulator && rvsdg::input::GetNode(**callOutput->begin()) != accumulator)
+        return std::nullopt;
+
+      // All tail calls must accumulate a result with the same operation
+      auto & knownAccumulator = tailRecursion.Accumulators[i];
+      if (accumulator && knownAccumulator
+          && accumulator->operation() != knownAccumulator->operation())
+        return std::nullopt;
+      if (accumulator)
+        knownAccumulator = accumulator;
+    }
+
+    tailRecursion.TailCalls.push_back(tailCall);
+  }
+
+  if (numBaseCases == 0 || numBaseCases == gammaNode.nsubregions())
+    return std::nullopt;
+
+  return tailRecursion;
+}
+
+/**
+ * @return The initial value of the loop variable for result \p index of \p lambdaNode.
+ */
+static rvsdg::output *
+CreateInitialResultValue(
+    lambda::node & lambdaNode,
+    const TailRecursion & tailRecursion,
+    size_t index)
+{
+  auto & region = *lambdaNode.subregion();
+  auto type = lambdaNode.fctresult(index)->Type();
+
+  if (auto accumulator = tailRecursion.Accumulators[index])
+  {
+    auto & bitType = *util::AssertedCast<const rvsdg::bittype>(type.get());
+    return rvsdg::create_bitconstant(&region, bitType.nbits(), *GetNeutralElement(*accumulator));
+  }
+
+  // States are initialized with the respective lambda argument
+  if (rvsdg::is<rvsdg::StateType>(*type))
+  {
+    for (size_t n = 0; n < lambdaNode.nfctarguments(); n++)
+    {
+      auto argument = lambdaNode.fctargument(n);
+      if (*argument->Type() == *type)
+        return argument;
+    }
+  }
+
+  return UndefValueOperation::Create(region, type);
+}
+
+TailRecursionElimination::~TailRecursionElimination() = default;
+
+void
+TailRecursionElimination::run(
+    RvsdgModule & rvsdgModule,
+    util::StatisticsCollector & statisticsCollector)
+{
+  auto & rvsdg = rvsdgModule.Rvsdg();
+  auto statistics = Statistics::Create(rvsdgModule.SourceFileName());
+
+  size_t numTransformedFunctions = 0;
+  size_t numRemovedPhiNodes = 0;
+  statistics->Start(rvsdg);
+  EliminateInRegion(*rvsdg.root(), numTransformedFunctions, numRemovedPhiNodes);
+  statistics->Stop(rvsdg, numTransformedFunctions, numRemovedPhiNodes);
+
+  statisticsCollector.CollectDemandedStatistics(std::move(statistics));
+}
+
+bool
+TailRecursionElimination::EliminateTailRecursion(lambda::node & lambdaNode)
+{
+  auto & lambdaRegion = *lambdaNode.subregion();
+  auto numResults = lambdaNode.nfctresults();
+
+  std::vector<rvsdg::output *> resultOrigins;
+  for (size_t n = 0; n < numResults; n++)
+    resultOrigins.push_back(lambdaNode.fctresult(n)->origin());
+
+  auto tailRecursion = AnalyzeTailRecursion(lambdaNode, resultOrigins);
+  if (!tailRecursion)
+    return false;
+
+  // The gamma outputs must only be used by the lambda results, as everything else in the lambda
+  // region is evaluated once per iteration
+  auto & gammaNode = *tailRecursion->GammaNode;
+  for (size_t n = 0; n < gammaNode.noutputs(); n++)
+  {
+    for (auto user : *gammaNode.output(n))
+    {
+      if (!dynamic_cast<lambda::result *>(user))
+        return false;
+    }
+  }
+
+  std::vector<rvsdg::node *> nodes;
+  for (auto node : rvsdg::topdown_traverser(&lambdaRegion))
+    nodes.push_back(node);
+
+  std::vector<rvsdg::output *> initialResultValues;
+  for (size_t n = 0; n < numResults; n++)
+    initialResultValues.push_back(CreateInitialResultValue(lambdaNode, *tailRecursion, n));
+
+  // Create a theta node with loop variables for the lambda arguments and results
+  auto thetaNode = rvsdg::ThetaNode::create(&lambdaRegion);
+
+  rvsdg::SubstitutionMap smap;
+  std::vector<rvsdg::ThetaOutput *> argumentLoopVars;
+  for (size_t n = 0; n < lambdaNode.nfctarguments(); n++)
+  {
+    auto loopVar = thetaNode->add_loopvar(lambdaNode.fctargument(n));
+    smap.insert(lambdaNode.fctargument(n), loopVar->argument());
+    argumentLoopVars.push_back(loopVar);
+  }
+  for (size_t n = 0; n < lambdaNode.ncvarguments(); n++)
+  {
+    auto loopVar = thetaNode->add_loopvar(lambdaNode.cvargument(n));
+    smap.insert(lambdaNode.cvargument(n), loopVar->argument());
+  }
+
+  std::vector<rvsdg::ThetaOutput *> resultLoopVars;
+  for (auto initialValue : initialResultValues)
+    resultLoopVars.push_back(thetaNode->add_loopvar(initialValue));
+
+  for (auto node : nodes)
+    node->copy(thetaNode->subregion(), smap);
+
+  // Retrieve the tail calls of the copied lambda body
+  for (auto & origin : resultOrigins)
+    origin = smap.lookup(origin);
+  auto copiedTailRecursion = AnalyzeTailRecursion(lambdaNode, resultOrigins);
+  JLM_ASSERT(copiedTailRecursion);
+  auto & copiedGammaNode = *copiedTailRecursion->GammaNode;
+
+  std::vector<rvsdg::GammaInput *> argumentEntryVars;
+  for (auto loopVar : argumentLoopVars)
+    argumentEntryVars.push_back(copiedGammaNode.add_entryvar(loopVar->argument()));
+
+  std::vector<rvsdg::GammaInput *> resultEntryVars;
+  for (auto loopVar : resultLoopVars)
+    resultEntryVars.push_back(copiedGammaNode.add_entryvar(loopVar->argument()));
+
+  // Compute the loop predicate and the values of the loop variables for the next iteration. The
+  // tail calls continue the loop with their arguments, while base cases exit the loop.
+  std::vector<rvsdg::output *> predicateOrigins;
+  std::vector<std::vector<rvsdg::output *>> argumentOrigins(argumentLoopVars.size());
+  std::vector<std::vector<rvsdg::output *>> resultValueOrigins(numResults);
+  for (size_t n = 0; n < copiedGammaNode.nsubregions(); n++)
+  {
+    auto subregion = copiedGammaNode.subregion(n);
+    auto tailCall = copiedTailRecursion->TailCalls[n];
+    predicateOrigins.push_back(rvsdg::control_constant(subregion, 2, tailCall ? 1 : 0));
+
+    for (size_t i = 0; i < argumentLoopVars.size(); i++)
+    {
+      argumentOrigins[i].push_back(
+          tailCall ? tailCall->Argument(i)->origin() : argumentEntryVars[i]->argument(n));
+    }
+
+    for (size_t i = 0; i < numResults; i++)
+    {
+      auto accumulatedValue = resultEntryVars[i]->argument(n);
+      auto & origin = *copiedTailRecursion->Results[i]->result(n)->origin();
+      auto accumulator = copiedTailRecursion->Accumulators[i];
+
+      rvsdg::output * value = nullptr;
+      if (tailCall == nullptr)
+      {
+        value = accumulator ? accumulator->copy(subregion, { accumulatedValue, &origin })->output(0)
+                            : &origin;
+      }
+      else if (rvsdg::output::GetNode(origin) == tailCall)
+      {
+        value = accumulatedValue;
+      }
+      else
+      {
+        auto node = rvsdg::output::GetNode(origin);
+        std::vector<rvsdg::output *> operands;
+        for (size_t k = 0; k < node->ninputs(); k++)
+        {
+          auto operand = node->input(k)->origin();
+          operands.push_back(operand == tailCall->Result(i) ? accumulatedValue : operand);
+        }
+        value = node->copy(subregion, operands)->output(0);
+      }
+
+      resultValueOrigins[i].push_back(value);
+    }
+  }
+
+  thetaNode->set_predicate(copiedGammaNode.add_exitvar(predicateOrigins));
+  for (size_t n = 0; n < argumentLoopVars.size(); n++)
+    argumentLoopVars[n]->result()->divert_to(copiedGammaNode.add_exitvar(argumentOrigins[n]));
+  for (size_t n = 0; n < numResults; n++)
+  {
+    resultLoopVars[n]->result()->divert_to(copiedGammaNode.add_exitvar(resultValueOrigins[n]));
+    lambdaNode.fctresult(n)->divert_to(resultLoopVars[n]);
+  }
+
+  // Remove the original lambda body and the copied tail calls
+  DeadNodeElimination deadNodeElimination;
+  deadNodeElimination.run(lambdaRegion);
+  lambdaNode.PruneLambdaInputs();
+
+  return true;
+}
+
+bool
+TailRecursionElimination::RemovePhiNode(phi::node & phiNode)
+{
+  for (auto it = phiNode.begin_rv(); it != phiNode.end_rv(); it++)
+  {
+    if (!it->argument()->IsDead())
+      return false;
+  }
+
+  rvsdg::SubstitutionMap smap;
+  for (auto it = phiNode.begin_cv(); it != phiNode.end_cv(); it++)
+    smap.insert(it->argument(), it->origin());
+
+  phiNode.subregion()->copy(phiNode.region(), smap, false, false);
+
+  for (auto it = phiNode.begin_rv(); it != phiNode.end_rv(); it++)
+    it->divert_users(smap.lookup(it->result()->origin()));
+
+  remove(&phiNode);
+  return true;
+}
+
+void
+TailRecursionElimination::EliminateInRegion(
+    rvsdg::Region & region,
+    size_t & numTransformedFunctions,
+    size_t & numRemovedPhiNodes)
+{
+  std::vector<rvsdg::StructuralNode *> structuralNodes;
+  for (auto node : rvsdg::topdown_traverser(&region))
+  {
+    if (auto structuralNode = dynamic_cast<rvsdg::StructuralNode *>(node))
+      structuralNodes.push_back(structuralNode);
+  }
+
+  for (auto structuralNode : structuralNodes)
+  {
+    for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+      EliminateInRegion(*structuralNode->subregion(n), numTransformedFunctions, numRemovedPhiNodes);
+
+    auto phiNode = dynamic_cast<phi::node *>(structuralNode);
+    if (phiNode == nullptr)
+      continue;
+
+    for (auto lambdaNode : phi::node::ExtractLambdaNodes(*phiNode))
+    {
+      if (EliminateTailRecursion(*lambdaNode))
+        numTransformedFunctions++;
+    }
+
+    if (RemovePhiNode(*phiNode))
+      numRemovedPhiNodes++;
+  }
+}
+
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_LLVM_OPT_TAILRECURSIONELIMINATION_HPP
+#define JLM_LLVM_OPT_TAILRECURSIONELIMINATION_HPP
+
+#include <jlm/llvm/opt/optimization.hpp>
+
+#include <cstddef>
+
+namespace jlm::rvsdg
+{
+class Region;
+}
+
+namespace jlm::llvm
+{
+
+namespace lambda
+{
+class node;
+}
+
+namespace phi
+{
+class node;
+}
+
+class RvsdgModule;
+
+/** \brief Tail Recursion Elimination Optimization
+ *
+ * Tail Recursion Elimination (TRE) replaces the recursive tail calls of a lambda node within a phi
+ * node with a theta node that iterates over the lambda body. A lambda node is transformed if all
+ * its results originate from a single gamma node in the lambda region, and every subregion of the
+ * gamma node either:
+ *
+ * 1. contains no recursive tail call, i.e., it is a base case of the recursion, or
+ * 2. contains a single recursive direct call whose outputs are only used by the respective gamma
+ *    results. A value result might also be an associative and commutative bit operation (add, mul,
+ *    and, or, xor) of the call output and a value independent of the call. Such results are
+ *    accumulated in a loop variable that is initialized with the neutral element of the operation.
+ *
+ * The arguments of a tail call become the loop variables of the next iteration, such that memory
+ * and I/O states are threaded through the theta node instead of the call node. All users of gamma
+ * outputs must be lambda results, as the lambda body is evaluated once per iteration.
+ *
+ * A phi node is removed if none of its recursion variables are used after the transformation.
+ */
+class TailRecursionElimination final : public optimization
+{
+  class Statistics;
+
+public:
+  ~TailRecursionElimination() override;
+
+  void
+  run(RvsdgModule & rvsdgModule, util::StatisticsCollector & statisticsCollector) override;
+
+  /**
+   * Replaces the recursive tail calls of \p lambdaNode with a theta node.
+   *
+   * @return True if \p lambdaNode was transformed, otherwise false.
+   */
+  static bool
+  EliminateTailRecursion(lambda::node & lambdaNode);
+
+  /**
+   * Removes \p phiNode and moves its content to the parent region if none of its recursion
+   * variables are used.
+   *
+   * @return True if \p phiNode was removed, otherwise false.
+   */
+  static bool
+  RemovePhiNode(phi::node & phiNode);
+
+private:
+  static void
+  EliminateInRegion(
+      rvsdg::Region & region,
+      size_t & numTransformedFunctions,
+      size_t & numRemovedPhiNodes);
+};
+
+}
+
+#endif
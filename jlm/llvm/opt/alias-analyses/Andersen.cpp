@@ -6,6 +6,7 @@
 #include <jlm/llvm/opt/alias-analyses/Andersen.hpp>
 #include <jlm/llvm/opt/alias-analyses/PointsToGraph.hpp>
 #include <jlm/rvsdg/traverser.hpp>
+#include <jlm/util/MemoryFootprint.hpp>
 #include <jlm/util/Statistics.hpp>
 
 namespace jlm::llvm::aa
@@ -406,6 +407,7 @@ public:
   {
     AddMeasurement(NumSetInsertionAttempts_, set.GetNumSetInsertionAttempts());
     AddMeasurement(NumExplicitPointeesRemoved_, set.GetNumExplicitPointeesRemoved());
+    AddMeasurements(set.ComputeMemoryFootprint());
 
     size_t numUnificationRoots = 0;
 
@@ -566,6 +568,7 @@ public:
     auto [numEdges, numPointsToRelations] = pointsToGraph.NumEdges();
     AddMeasurement(Label::NumPointsToGraphEdges, numEdges);
     AddMeasurement(Label::NumPointsToGraphPointsToRelations, numPointsToRelations);
+    AddMeasurements(pointsToGraph.ComputeMemoryFootprint());
   }
 
   void
@@ -9,6 +9,7 @@
 #include <jlm/llvm/opt/alias-analyses/DifferencePropagation.hpp>
 #include <jlm/llvm/opt/alias-analyses/LazyCycleDetection.hpp>
 #include <jlm/llvm/opt/alias-analyses/OnlineCycleDetection.hpp>
+#include <jlm/util/MemoryFootprint.hpp>
 #include <jlm/util/Worklist.hpp>
 
 #include <limits>
@@ -81,6 +82,18 @@ PointerObjectSet::NumMemoryPointerObjectsCanPoint() const noexcept
   return count;
 }
 
+util::MemoryFootprint
+PointerObjectSet::ComputeMemoryFootprint() const
+{
+  size_t numBytes = util::MemoryFootprint::EstimateBytes(PointsToSets_);
+  for (auto & pointsToSet : PointsToSets_)
+    numBytes += pointsToSet.EstimateHeapBytes();
+
+  util::MemoryFootprint memoryFootprint;
+  memoryFootprint.Add(util::MemoryFootprint::Category::PointsToSets, numBytes);
+  return memoryFootprint;
+}
+
 PointerObjectIndex
 PointerObjectSet::CreateRegisterPointerObject(const rvsdg::output & rvsdgOutput)
 {
@@ -535,7 +548,9 @@ bool
 StoreConstraint::ApplyDirectly(PointerObjectSet & set)
 {
   bool modified = false;
-  for (PointerObjectIndex x : set.GetPointsToSet(Pointer_).Items())
+  // Make a copy of the set, as x may be unified with pointer, such that P(pointer) grows
+  const auto pointees = set.GetPointsToSet(Pointer_);
+  for (PointerObjectIndex x : pointees.Items())
     modified |= set.MakePointsToSetSuperset(x, Value_);
 
   // If external in P(pointer), P(external) should become a superset of P(value)
@@ -551,7 +566,9 @@ bool
 LoadConstraint::ApplyDirectly(PointerObjectSet & set)
 {
   bool modified = false;
-  for (PointerObjectIndex x : set.GetPointsToSet(Pointer_).Items())
+  // Make a copy of the set, as loaded may be unified with pointer, such that P(pointer) grows
+  const auto pointees = set.GetPointsToSet(Pointer_);
+  for (PointerObjectIndex x : pointees.Items())
     modified |= set.MakePointsToSetSuperset(Value_, x);
 
   // P(pointer) "contains" external, then P(loaded) should also "contain" it
@@ -728,8 +745,10 @@ FunctionCallConstraint::ApplyDirectly(PointerObjectSet & set)
     modified |= set.MarkAsPointingToExternal(index);
   };
 
-  // For each possible function target, connect parameters and return values to the call node
-  for (const auto target : set.GetPointsToSet(Pointer_).Items())
+  // For each possible function target, connect parameters and return values to the call node.
+  // Make a copy of the set, as the arguments and results may be unified with the function pointer
+  const auto targets = set.GetPointsToSet(Pointer_);
+  for (const auto target : targets.Items())
   {
     const auto kind = set.GetPointerObjectKind(target);
     if (kind == PointerObjectKind::ImportMemoryObject)
@@ -14,6 +14,7 @@
 #include <jlm/util/GraphWriter.hpp>
 #include <jlm/util/HashSet.hpp>
 #include <jlm/util/Math.hpp>
+#include <jlm/util/MemoryFootprint.hpp>
 
 #include <cstdint>
 #include <optional>
@@ -215,6 +216,14 @@ public:
   [[nodiscard]] size_t
   NumMemoryPointerObjectsCanPoint() const noexcept;
 
+  /**
+   * Estimates the memory used by the points-to sets of all PointerObjects.
+   *
+   * @see util::MemoryFootprint::Category::PointsToSets
+   */
+  [[nodiscard]] util::MemoryFootprint
+  ComputeMemoryFootprint() const;
+
   /**
    * Creates a PointerObject of Register kind and maps the rvsdg output to the new PointerObject.
    * The rvsdg output can not already be associated with a PointerObject.
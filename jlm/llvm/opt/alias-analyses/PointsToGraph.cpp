@@ -193,6 +193,30 @@ PointsToGraph::NumEdges() const noexcept
   return std::make_pair(numEdges, numPointsToRelations);
 }
 
+util::MemoryFootprint
+PointsToGraph::ComputeMemoryFootprint() const
+{
+  size_t numBytes = 0;
+  auto addNodes = [&](auto iterable)
+  {
+    for (const Node & node : iterable)
+      numBytes += node.EstimateEdgeBytes();
+  };
+
+  addNodes(AllocaNodes());
+  addNodes(DeltaNodes());
+  addNodes(ImportNodes());
+  addNodes(LambdaNodes());
+  addNodes(MallocNodes());
+  addNodes(RegisterNodes());
+  numBytes += GetExternalMemoryNode().EstimateEdgeBytes();
+  numBytes += GetUnknownMemoryNode().EstimateEdgeBytes();
+
+  util::MemoryFootprint memoryFootprint;
+  memoryFootprint.Add(util::MemoryFootprint::Category::PointsToGraphEdges, numBytes);
+  return memoryFootprint;
+}
+
 bool
 PointsToGraph::IsSupergraphOf(const jlm::llvm::aa::PointsToGraph & subgraph) const
 {
@@ -488,6 +512,13 @@ PointsToGraph::Node::HasSource(const PointsToGraph::Node & source) const
   return Sources_.find(const_cast<Node *>(&source)) != Sources_.end();
 }
 
+size_t
+PointsToGraph::Node::EstimateEdgeBytes() const noexcept
+{
+  return util::MemoryFootprint::EstimateBytes(Targets_)
+       + util::MemoryFootprint::EstimateBytes(Sources_);
+}
+
 void
 PointsToGraph::Node::AddEdge(PointsToGraph::MemoryNode & target)
 {
@@ -12,6 +12,7 @@
 #include <jlm/util/common.hpp>
 #include <jlm/util/HashSet.hpp>
 #include <jlm/util/iterator_range.hpp>
+#include <jlm/util/MemoryFootprint.hpp>
 
 #include <memory>
 #include <string>
@@ -371,6 +372,15 @@ public:
   [[nodiscard]] std::pair<size_t, size_t>
   NumEdges() const noexcept;
 
+  /**
+   * Estimates the memory used by the edges of the PointsToGraph, i.e., the target and source sets
+   * of all nodes.
+   *
+   * @see util::MemoryFootprint::Category::PointsToGraphEdges
+   */
+  [[nodiscard]] util::MemoryFootprint
+  ComputeMemoryFootprint() const;
+
   /**
    * Checks if this PointsToGraph is a supergraph of \p subgraph.
    * Every node and every edge in the subgraph needs to have corresponding nodes and edges
@@ -510,6 +520,12 @@ public:
     return Sources_.size();
   }
 
+  /**
+   * @return The estimated heap memory of the target and source sets of the node.
+   */
+  [[nodiscard]] size_t
+  EstimateEdgeBytes() const noexcept;
+
   virtual std::string
   DebugString() const = 0;
 
@@ -10,7 +10,9 @@
 #include <jlm/rvsdg/gamma.hpp>
 #include <jlm/rvsdg/theta.hpp>
 #include <jlm/rvsdg/traverser.hpp>
+#include <jlm/util/MemoryFootprint.hpp>
 #include <jlm/util/Statistics.hpp>
+#include <jlm/util/UnionFind.hpp>
 
 namespace jlm::llvm::aa
 {
@@ -72,6 +74,11 @@ operator&(PointsToFlags lhs, PointsToFlags rhs)
       static_cast<underlyingType>(lhs) & static_cast<underlyingType>(rhs));
 }
 
+/**
+ * The dense index of a location, which is used to track the disjoint location sets.
+ */
+using LocationIndex = uint32_t;
+
 /** \brief Location class
  *
  * This class represents an abstract location in the program.
@@ -83,7 +90,8 @@ public:
 
   constexpr explicit Location(PointsToFlags pointsToFlags)
       : PointsToFlags_(pointsToFlags),
-        PointsTo_(nullptr)
+        PointsTo_(nullptr),
+        Index_(std::numeric_limits<LocationIndex>::max())
   {}
 
   Location(const Location &) = delete;
@@ -144,6 +152,21 @@ public:
     PointsToFlags_ = pointsToFlags;
   }
 
+  /**
+   * @return The dense index of the location within the Steensgaard::Context.
+   */
+  [[nodiscard]] LocationIndex
+  GetIndex() const noexcept
+  {
+    return Index_;
+  }
+
+  void
+  SetIndex(LocationIndex index) noexcept
+  {
+    Index_ = index;
+  }
+
   template<typename L>
   static bool
   Is(const Location & location) noexcept
@@ -158,6 +181,7 @@ public:
 private:
   PointsToFlags PointsToFlags_;
   Location * PointsTo_;
+  LocationIndex Index_;
 };
 
 /**
@@ -532,16 +556,74 @@ public:
   }
 };
 
-using DisjointLocationSet = util::disjointset<Location *>;
+/**
+ * The members of all disjoint location sets at a given point in time, stored contiguously per set.
+ */
+class LocationSets final
+{
+  using LocationRange = util::iterator_range<std::vector<Location *>::const_iterator>;
+
+public:
+  LocationSets(
+      const std::vector<std::unique_ptr<Location>> & locations,
+      const util::UnionFind<LocationIndex> & unionFind)
+      : Offsets_(locations.size() + 1, 0),
+        Members_(locations.size(), nullptr)
+  {
+    // Sort the locations by the index of their root location with a counting sort
+    std::vector<LocationIndex> roots(locations.size());
+    for (size_t n = 0; n < locations.size(); n++)
+    {
+      roots[n] = unionFind.Find(n);
+      Offsets_[roots[n] + 1]++;
+      if (roots[n] == n)
+        RootLocations_.push_back(locations[n].get());
+    }
+
+    for (size_t n = 0; n < locations.size(); n++)
+      Offsets_[n + 1] += Offsets_[n];
+
+    std::vector<size_t> next(Offsets_.begin(), Offsets_.end() - 1);
+    for (size_t n = 0; n < locations.size(); n++)
+      Members_[next[roots[n]]++] = locations[n].get();
+  }
+
+  /**
+   * @return The root locations of all disjoint sets.
+   */
+  [[nodiscard]] const std::vector<Location *> &
+  RootLocations() const noexcept
+  {
+    return RootLocations_;
+  }
+
+  /**
+   * @return The locations of the set with root location \p rootLocation.
+   */
+  [[nodiscard]] LocationRange
+  Members(const Location & rootLocation) const noexcept
+  {
+    auto index = rootLocation.GetIndex();
+    return { Members_.begin() + Offsets_[index], Members_.begin() + Offsets_[index + 1] };
+  }
+
+private:
+  std::vector<Location *> RootLocations_;
+
+  // The members of the set with root location index i are stored in
+  // Members_[Offsets_[i]] to Members_[Offsets_[i + 1] - 1]
+  std::vector<size_t> Offsets_;
+  std::vector<Location *> Members_;
+};
 
 /** \brief Context class
+ *
+ * Every location is identified by a dense index, which is used to track the disjoint location
+ * sets in an array-based union-find data structure.
  */
 class Steensgaard::Context final
 {
 public:
-  using DisjointLocationSetConstRange =
-      util::iterator_range<const DisjointLocationSet::set_iterator>;
-
   ~Context() = default;
 
   Context() = default;
@@ -556,70 +638,66 @@ public:
   Context &
   operator=(Context &&) = delete;
 
-  [[nodiscard]] DisjointLocationSetConstRange
-  Sets() const
+  /**
+   * @return The members of all disjoint location sets.
+   */
+  [[nodiscard]] LocationSets
+  ComputeSets() const
+  {
+    return LocationSets(Locations_, UnionFind_);
+  }
+
+  /**
+   * @return The root locations of all disjoint sets.
+   */
+  [[nodiscard]] std::vector<Location *>
+  CollectRootLocations() const
   {
-    return { DisjointLocationSet_.begin(), DisjointLocationSet_.end() };
+    std::vector<Location *> rootLocations;
+    rootLocations.reserve(UnionFind_.NumSets());
+    for (auto & location : Locations_)
+    {
+      if (UnionFind_.IsRoot(location->GetIndex()))
+        rootLocations.push_back(location.get());
+    }
+
+    return rootLocations;
   }
 
   Location &
   InsertAllocaLocation(const jlm::rvsdg::node & node)
   {
-    Locations_.push_back(AllocaLocation::Create(node));
-    auto location = Locations_.back().get();
-    DisjointLocationSet_.insert(location);
-
-    return *location;
+    return InsertLocation(AllocaLocation::Create(node));
   }
 
   Location &
   InsertMallocLocation(const jlm::rvsdg::node & node)
   {
-    Locations_.push_back(MallocLocation::Create(node));
-    auto location = Locations_.back().get();
-    DisjointLocationSet_.insert(location);
-
-    return *location;
+    return InsertLocation(MallocLocation::Create(node));
   }
 
   Location &
   InsertLambdaLocation(const lambda::node & lambda)
   {
-    Locations_.push_back(LambdaLocation::Create(lambda));
-    auto location = Locations_.back().get();
-    DisjointLocationSet_.insert(location);
-
-    return *location;
+    return InsertLocation(LambdaLocation::Create(lambda));
   }
 
   Location &
   InsertDeltaLocation(const delta::node & delta)
   {
-    Locations_.push_back(DeltaLocation::Create(delta));
-    auto location = Locations_.back().get();
-    DisjointLocationSet_.insert(location);
-
-    return *location;
+    return InsertLocation(DeltaLocation::Create(delta));
   }
 
   Location &
   InsertImportLocation(const GraphImport & graphImport)
   {
-    Locations_.push_back(ImportLocation::Create(graphImport));
-    auto location = Locations_.back().get();
-    DisjointLocationSet_.insert(location);
-
-    return *location;
+    return InsertLocation(ImportLocation::Create(graphImport));
   }
 
   Location &
   InsertDummyLocation()
   {
-    Locations_.push_back(DummyLocation::Create());
-    auto location = Locations_.back().get();
-    DisjointLocationSet_.insert(location);
-
-    return *location;
+    return InsertLocation(DummyLocation::Create());
   }
 
   /**
@@ -675,28 +753,16 @@ public:
     return InsertRegisterLocation(output, PointsToFlags::PointsToNone);
   }
 
-  /**
-   * Returns the disjoint set for Location \p location.
-   *
-   * @param location A Location.
-   * @return The disjoint set the location is part of.
-   */
-  const DisjointLocationSet::set &
-  GetSet(Location & location) const
-  {
-    return *DisjointLocationSet_.find(&location);
-  }
-
   size_t
   NumDisjointSets() const noexcept
   {
-    return DisjointLocationSet_.nsets();
+    return UnionFind_.NumSets();
   }
 
   size_t
   NumLocations() const noexcept
   {
-    return DisjointLocationSet_.nvalues();
+    return Locations_.size();
   }
 
   /**
@@ -706,9 +772,9 @@ public:
    * @return The set's root location.
    */
   Location &
-  GetRootLocation(Location & location) const
+  GetRootLocation(const Location & location) const
   {
-    return *GetSet(location).value();
+    return *Locations_[UnionFind_.Find(location.GetIndex())];
   }
 
   /**
@@ -753,12 +819,11 @@ public:
   std::string
   ToDot() const
   {
-    auto toDotNode = [](const DisjointLocationSet::set & set)
+    auto sets = ComputeSets();
+    auto toDotNode = [&](const Location * rootLocation)
     {
-      auto rootLocation = set.value();
-
       std::string setLabel;
-      for (auto & location : set)
+      for (auto location : sets.Members(*rootLocation))
       {
         auto unknownLabel = location->PointsToUnknownMemory() ? "{U}" : "";
         auto pointsToEscapedMemoryLabel = location->PointsToEscapedMemory() ? "{E}" : "";
@@ -788,27 +853,26 @@ public:
         }
       }
 
-      return jlm::util::strfmt("{ ", (intptr_t)&set, " [label = \"", setLabel, "\"]; }");
+      return jlm::util::strfmt("{ ", (intptr_t)rootLocation, " [label = \"", setLabel, "\"]; }");
     };
 
-    auto toDotEdge =
-        [](const DisjointLocationSet::set & set, const DisjointLocationSet::set & pointsToSet)
+    auto toDotEdge = [](const Location * rootLocation, const Location * pointsToRootLocation)
     {
-      return jlm::util::strfmt((intptr_t)&set, " -> ", (intptr_t)&pointsToSet);
+      return jlm::util::strfmt((intptr_t)rootLocation, " -> ", (intptr_t)pointsToRootLocation);
     };
 
     std::string str;
     str.append("digraph DisjointLocationSetGraph {\n");
 
-    for (auto & set : DisjointLocationSet_)
+    for (auto rootLocation : sets.RootLocations())
     {
-      str += toDotNode(set) + "\n";
+      str += toDotNode(rootLocation) + "\n";
 
-      auto pointsTo = set.value()->GetPointsTo();
+      auto pointsTo = rootLocation->GetPointsTo();
       if (pointsTo != nullptr)
       {
-        auto pointsToSet = DisjointLocationSet_.find(pointsTo);
-        str += toDotEdge(set, *pointsToSet) + "\n";
+        auto & pointsToRootLocation = GetRootLocation(*pointsTo);
+        str += toDotEdge(rootLocation, &pointsToRootLocation) + "\n";
       }
     }
 
@@ -856,6 +920,16 @@ public:
   }
 
 private:
+  Location &
+  InsertLocation(std::unique_ptr<Location> location)
+  {
+    location->SetIndex(UnionFind_.MakeSet());
+    JLM_ASSERT(location->GetIndex() == Locations_.size());
+
+    Locations_.push_back(std::move(location));
+    return *Locations_.back();
+  }
+
   RegisterLocation &
   InsertRegisterLocation(const jlm::rvsdg::output & output, PointsToFlags pointsToFlags)
   {
@@ -865,8 +939,7 @@ private:
     auto registerLocationPointer = registerLocation.get();
 
     LocationMap_[&output] = registerLocationPointer;
-    DisjointLocationSet_.insert(registerLocationPointer);
-    Locations_.push_back(std::move(registerLocation));
+    InsertLocation(std::move(registerLocation));
 
     return *registerLocationPointer;
   }
@@ -874,10 +947,12 @@ private:
   Location &
   Merge(Location & location1, Location & location2)
   {
-    return *DisjointLocationSet_.merge(&location1, &location2)->value();
+    return *Locations_[UnionFind_.Union(location1.GetIndex(), location2.GetIndex())];
   }
 
-  DisjointLocationSet DisjointLocationSet_;
+  util::UnionFind<LocationIndex> UnionFind_;
+
+  // All locations, indexed by their location index
   std::vector<std::unique_ptr<Location>> Locations_;
   std::unordered_map<const jlm::rvsdg::output *, RegisterLocation *> LocationMap_;
 };
@@ -961,6 +1036,7 @@ public:
     AddMeasurement(
         NumUnknownMemorySourcesLabel_,
         pointsToGraph.GetUnknownMemoryNode().NumSources());
+    AddMeasurements(pointsToGraph.ComputeMemoryFootprint());
   }
 
   void
@@ -1848,15 +1924,16 @@ Steensgaard::MarkAsEscaped(const rvsdg::output & output)
 void
 Steensgaard::PropagatePointsToFlags()
 {
+  // No sets are merged while propagating the flags
+  auto rootLocations = Context_->CollectRootLocations();
+
   bool pointsToFlagsChanged;
   do
   {
     pointsToFlagsChanged = false;
 
-    for (auto & set : Context_->Sets())
+    for (auto location : rootLocations)
     {
-      auto location = set.value();
-
       // Nothing needs to be done if this set does not point to another set
       if (!location->GetPointsTo())
       {
@@ -1900,16 +1977,14 @@ Steensgaard::CreatePointsToGraphMemoryNode(const Location & location, PointsToGr
 util::HashSet<PointsToGraph::MemoryNode *>
 Steensgaard::CollectEscapedMemoryNodes(
     const util::HashSet<RegisterLocation *> & escapingRegisterLocations,
-    const std::unordered_map<
-        const util::disjointset<Location *>::set *,
-        std::vector<PointsToGraph::MemoryNode *>> & memoryNodesInSet) const
+    const std::vector<std::vector<PointsToGraph::MemoryNode *>> & memoryNodesInSet) const
 {
   // Initialize working set
   util::HashSet<Location *> toVisit;
   for (auto registerLocation : escapingRegisterLocations.Items())
   {
-    auto & set = Context_->GetSet(*registerLocation);
-    if (auto pointsToLocation = set.value()->GetPointsTo())
+    auto & rootLocation = Context_->GetRootLocation(*registerLocation);
+    if (auto pointsToLocation = rootLocation.GetPointsTo())
     {
       toVisit.Insert(pointsToLocation);
     }
@@ -1917,29 +1992,29 @@ Steensgaard::CollectEscapedMemoryNodes(
 
   // Collect escaped memory nodes
   util::HashSet<PointsToGraph::MemoryNode *> escapedMemoryNodes;
-  util::HashSet<const DisjointLocationSet::set *> visited;
+  std::vector<bool> visited(Context_->NumLocations(), false);
   while (!toVisit.IsEmpty())
   {
     auto moduleEscapingLocation = *toVisit.Items().begin();
     toVisit.Remove(moduleEscapingLocation);
 
-    auto & set = Context_->GetSet(*moduleEscapingLocation);
+    auto & rootLocation = Context_->GetRootLocation(*moduleEscapingLocation);
 
     // Check if we already visited this set to avoid an endless loop
-    if (visited.Contains(&set))
+    if (visited[rootLocation.GetIndex()])
     {
       continue;
     }
-    visited.Insert(&set);
+    visited[rootLocation.GetIndex()] = true;
 
-    auto & memoryNodes = memoryNodesInSet.at(&set);
+    auto & memoryNodes = memoryNodesInSet[rootLocation.GetIndex()];
     for (auto & memoryNode : memoryNodes)
     {
       memoryNode->MarkAsModuleEscaping();
       escapedMemoryNodes.Insert(memoryNode);
     }
 
-    if (auto pointsToLocation = set.value()->GetPointsTo())
+    if (auto pointsToLocation = rootLocation.GetPointsTo())
     {
       toVisit.Insert(pointsToLocation);
     }
@@ -1953,24 +2028,25 @@ Steensgaard::ConstructPointsToGraph() const
 {
   auto pointsToGraph = PointsToGraph::Create();
 
-  // All the memory nodes within a set
-  std::unordered_map<const DisjointLocationSet::set *, std::vector<PointsToGraph::MemoryNode *>>
-      memoryNodesInSet;
+  auto sets = Context_->ComputeSets();
+
+  // All the memory nodes within a set, indexed by the index of the set's root location
+  std::vector<std::vector<PointsToGraph::MemoryNode *>> memoryNodesInSet(Context_->NumLocations());
 
   // All register locations that are marked as RegisterLocation::HasEscaped()
   util::HashSet<RegisterLocation *> escapingRegisterLocations;
 
-  // Mapping between locations and points-to graph nodes
-  std::unordered_map<const Location *, PointsToGraph::Node *> locationMap;
+  // Mapping between locations and points-to graph nodes, indexed by the location index
+  std::vector<PointsToGraph::Node *> locationMap(Context_->NumLocations(), nullptr);
 
   // Create points-to graph nodes
-  for (auto & locationSet : Context_->Sets())
+  for (auto rootLocation : sets.RootLocations())
   {
-    memoryNodesInSet[&locationSet] = {};
+    auto & memoryNodes = memoryNodesInSet[rootLocation->GetIndex()];
 
     util::HashSet<const rvsdg::output *> registers;
     util::HashSet<RegisterLocation *> registerLocations;
-    for (auto & location : locationSet)
+    for (auto location : sets.Members(*rootLocation))
     {
       if (auto registerLocation = dynamic_cast<RegisterLocation *>(location))
       {
@@ -1983,8 +2059,8 @@ Steensgaard::ConstructPointsToGraph() const
       else if (Location::Is<MemoryLocation>(*location))
       {
         auto & pointsToGraphNode = CreatePointsToGraphMemoryNode(*location, *pointsToGraph);
-        memoryNodesInSet[&locationSet].push_back(&pointsToGraphNode);
-        locationMap[location] = &pointsToGraphNode;
+        memoryNodes.push_back(&pointsToGraphNode);
+        locationMap[location->GetIndex()] = &pointsToGraphNode;
       }
       else if (Location::Is<DummyLocation>(*location))
       {
@@ -2003,21 +2079,21 @@ Steensgaard::ConstructPointsToGraph() const
     {
       auto & pointsToGraphNode = PointsToGraph::RegisterNode::Create(*pointsToGraph, registers);
       for (auto registerLocation : registerLocations.Items())
-        locationMap[registerLocation] = &pointsToGraphNode;
+        locationMap[registerLocation->GetIndex()] = &pointsToGraphNode;
     }
   }
 
   auto escapedMemoryNodes = CollectEscapedMemoryNodes(escapingRegisterLocations, memoryNodesInSet);
 
   // Create points-to graph edges
-  for (auto & set : Context_->Sets())
+  for (auto rootLocation : sets.RootLocations())
   {
-    bool pointsToUnknown = set.value()->PointsToUnknownMemory();
-    bool pointsToExternalMemory = set.value()->PointsToExternalMemory();
-    bool pointsToEscapedMemory = set.value()->PointsToEscapedMemory();
+    bool pointsToUnknown = rootLocation->PointsToUnknownMemory();
+    bool pointsToExternalMemory = rootLocation->PointsToExternalMemory();
+    bool pointsToEscapedMemory = rootLocation->PointsToEscapedMemory();
 
     bool handledRegisterLocations = false;
-    for (auto & location : set)
+    for (auto location : sets.Members(*rootLocation))
     {
       // We can ignore dummy nodes. They only exist for structural purposes in the Steensgaard
       // analysis and have no equivalent in the points-to graph.
@@ -2035,7 +2111,7 @@ Steensgaard::ConstructPointsToGraph() const
         handledRegisterLocations = true;
       }
 
-      auto & pointsToGraphNode = *locationMap[location];
+      auto & pointsToGraphNode = *locationMap[location->GetIndex()];
 
       if (pointsToUnknown && !Location::Is<LambdaLocation>(*location))
         pointsToGraphNode.AddEdge(pointsToGraph->GetUnknownMemoryNode());
@@ -2050,10 +2126,10 @@ Steensgaard::ConstructPointsToGraph() const
       }
 
       // Add edges to all memory nodes the location points to
-      if (auto pointsToLocation = set.value()->GetPointsTo())
+      if (auto pointsToLocation = rootLocation->GetPointsTo())
       {
-        auto & pointsToSet = Context_->GetSet(*pointsToLocation);
-        auto & memoryNodes = memoryNodesInSet[&pointsToSet];
+        auto & pointsToRootLocation = Context_->GetRootLocation(*pointsToLocation);
+        auto & memoryNodes = memoryNodesInSet[pointsToRootLocation.GetIndex()];
 
         for (auto & memoryNode : memoryNodes)
           pointsToGraphNode.AddEdge(*memoryNode);
@@ -7,7 +7,6 @@
 #define JLM_LLVM_OPT_ALIAS_ANALYSES_STEENSGAARD_HPP
 
 #include <jlm/llvm/opt/alias-analyses/AliasAnalysis.hpp>
-#include <jlm/util/disjointset.hpp>
 
 namespace jlm::rvsdg
 {
@@ -214,9 +213,7 @@ private:
   [[nodiscard]] util::HashSet<PointsToGraph::MemoryNode *>
   CollectEscapedMemoryNodes(
       const util::HashSet<RegisterLocation *> & escapingRegisterLocations,
-      const std::unordered_map<
-          const util::disjointset<Location *>::set *,
-          std::vector<PointsToGraph::MemoryNode *>> & memoryNodesInSet) const;
+      const std::vector<std::vector<PointsToGraph::MemoryNode *>> & memoryNodesInSet) const;
 
   /**
    * Resolves all points-to graph nodes that were marked throughout the analysis as pointing
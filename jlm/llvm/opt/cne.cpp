@@ -171,6 +171,16 @@ private:
 
 /* mark phase */
 
+/**
+ * Simple operations are shared between nodes, see rvsdg::InternOperation(), which makes the
+ * identity check succeed in the common case.
+ */
+static bool
+equal(const rvsdg::operation & operation1, const rvsdg::operation & operation2)
+{
+  return &operation1 == &operation2 || operation1 == operation2;
+}
+
 static bool
 congruent(jlm::rvsdg::output * o1, jlm::rvsdg::output * o2, vset & vs, cnectx & ctx)
 {
@@ -231,7 +241,7 @@ congruent(jlm::rvsdg::output * o1, jlm::rvsdg::output * o2, vset & vs, cnectx &
   }
 
   if (jlm::rvsdg::is<jlm::rvsdg::simple_op>(n1) && jlm::rvsdg::is<jlm::rvsdg::simple_op>(n2)
-      && n1->operation() == n2->operation() && n1->ninputs() == n2->ninputs()
+      && equal(n1->operation(), n2->operation()) && n1->ninputs() == n2->ninputs()
       && o1->index() == o2->index())
   {
     for (size_t n = 0; n < n1->ninputs(); n++)
@@ -391,7 +401,7 @@ mark(const jlm::rvsdg::simple_node * node, cnectx & ctx)
   {
     for (const auto & other : node->region()->top_nodes)
     {
-      if (&other != node && node->operation() == other.operation())
+      if (&other != node && equal(node->operation(), other.operation()))
       {
         ctx.mark(node, &other);
         break;
@@ -107,35 +107,112 @@ is_idv(jlm::rvsdg::input * input)
   return jlm::rvsdg::output::GetNode(*tinput->result()->origin()) == node;
 }
 
-std::unique_ptr<jlm::rvsdg::bitvalue_repr>
-unrollinfo::niterations() const noexcept
+/**
+ * Computes the number of iterations of a loop whose induction variable starts at \p init and is
+ * updated with \p step until the comparison \p compareOperation with \p end fails.
+ *
+ * \return The number of iterations, or nullptr if it can not be determined.
+ */
+static std::unique_ptr<jlm::rvsdg::bitvalue_repr>
+ComputeTripCount(
+    const rvsdg::operation & compareOperation,
+    bool isAdditive,
+    const jlm::rvsdg::bitvalue_repr & init,
+    const jlm::rvsdg::bitvalue_repr & step,
+    const jlm::rvsdg::bitvalue_repr & end,
+    size_t nbits)
 {
-  if (!is_known() || step_value() == 0)
+  if (step == 0)
     return nullptr;
 
-  auto start = is_additive() ? *init_value() : *end_value();
-  auto step = is_additive() ? *step_value() : step_value()->neg();
-  auto end = is_additive() ? *end_value() : *init_value();
+  auto start = isAdditive ? init : end;
+  auto increment = isAdditive ? step : step.neg();
+  auto last = isAdditive ? end : init;
 
-  if (is_eqcmp(cmpnode()->operation()))
-    end = end.add({ nbits(), 1 });
+  if (is_eqcmp(compareOperation))
+    last = last.add({ nbits, 1 });
 
-  auto range = end.sub(start);
+  auto range = last.sub(start);
   if (range.is_negative())
     return nullptr;
 
-  if (range.umod(step) != 0)
+  if (range.umod(increment) != 0)
     return nullptr;
 
-  return std::make_unique<jlm::rvsdg::bitvalue_repr>(range.udiv(step));
+  return std::make_unique<jlm::rvsdg::bitvalue_repr>(range.udiv(increment));
+}
+
+std::unique_ptr<jlm::rvsdg::bitvalue_repr>
+unrollinfo::niterations() const noexcept
+{
+  if (!is_known())
+    return nullptr;
+
+  return ComputeTripCount(
+      cmpoperation(),
+      is_additive(),
+      *init_value(),
+      *step_value(),
+      *end_value(),
+      nbits());
 }
 
 std::unique_ptr<unrollinfo>
 unrollinfo::create(rvsdg::ThetaNode * theta)
+{
+  auto inductionVariable = InductionVariable::Create(*theta);
+  if (!inductionVariable)
+    return nullptr;
+
+  auto endarg = push_from_theta(inductionVariable->End_);
+  auto steparg = push_from_theta(inductionVariable->Step_);
+  return std::unique_ptr<unrollinfo>(new unrollinfo(
+      inductionVariable->CompareNode_,
+      inductionVariable->ArithmeticNode_,
+      inductionVariable->Argument_,
+      steparg,
+      endarg));
+}
+
+/* InductionVariable methods */
+
+std::unique_ptr<jlm::rvsdg::bitvalue_repr>
+InductionVariable::GetTripCount() const
+{
+  auto init = GetValue(GetInit());
+  auto step = GetValue(GetStep());
+  auto end = GetValue(GetEnd());
+  if (!init || !step || !end)
+    return nullptr;
+
+  auto & compareOperation =
+      *util::AssertedCast<const jlm::rvsdg::bitcompare_op>(&CompareNode_->operation());
+  return ComputeTripCount(
+      compareOperation,
+      jlm::rvsdg::is<jlm::rvsdg::bitadd_op>(ArithmeticNode_),
+      *init,
+      *step,
+      *end,
+      compareOperation.type().nbits());
+}
+
+const jlm::rvsdg::bitvalue_repr *
+InductionVariable::GetValue(const rvsdg::output & output) noexcept
+{
+  auto node = producer(&output);
+  auto op = node ? dynamic_cast<const jlm::rvsdg::bitconstant_op *>(&node->operation()) : nullptr;
+  if (!op || !op->value().is_known())
+    return nullptr;
+
+  return &op->value();
+}
+
+std::unique_ptr<InductionVariable>
+InductionVariable::Create(const rvsdg::ThetaNode & theta)
 {
   using namespace jlm::rvsdg;
 
-  auto matchnode = jlm::rvsdg::output::GetNode(*theta->predicate()->origin());
+  auto matchnode = jlm::rvsdg::output::GetNode(*theta.predicate()->origin());
   if (!is<match_op>(matchnode))
     return nullptr;
 
@@ -166,9 +243,8 @@ unrollinfo::create(rvsdg::ThetaNode * theta)
   if (!is_theta_invariant(step))
     return nullptr;
 
-  auto endarg = push_from_theta(end);
-  auto steparg = push_from_theta(step);
-  return std::unique_ptr<unrollinfo>(new unrollinfo(cmpnode, armnode, idv, steparg, endarg));
+  return std::unique_ptr<InductionVariable>(
+      new InductionVariable(*cmpnode, *armnode, *idv, *step, *end));
 }
 
 /* loop unrolling */
@@ -327,6 +403,23 @@ unroll_known_theta(const unrollinfo & ui, size_t factor)
   add_remainder(ui, smap, factor);
 }
 
+/**
+ * Creates the comparison of \p ui between \p arm and \p end in the operand order of the original
+ * comparison.
+ */
+static jlm::rvsdg::output *
+create_cmp(
+    rvsdg::Region * region,
+    const unrollinfo & ui,
+    jlm::rvsdg::output * arm,
+    jlm::rvsdg::output * end)
+{
+  auto endFirst = ui.cmpnode()->input(0)->origin() == ui.end();
+  auto operands = endFirst ? std::vector<jlm::rvsdg::output *>({ end, arm })
+                           : std::vector<jlm::rvsdg::output *>({ arm, end });
+  return jlm::rvsdg::simple_node::create_normalized(region, ui.cmpoperation(), operands)[0];
+}
+
 static jlm::rvsdg::output *
 create_unrolled_gamma_predicate(const unrollinfo & ui, size_t factor)
 {
@@ -339,8 +432,7 @@ create_unrolled_gamma_predicate(const unrollinfo & ui, size_t factor)
   auto mul = jlm::rvsdg::bitmul_op::create(nbits, step, uf);
   auto arm =
       jlm::rvsdg::simple_node::create_normalized(region, ui.armoperation(), { ui.init(), mul })[0];
-  /* FIXME: order of operands */
-  auto cmp = jlm::rvsdg::simple_node::create_normalized(region, ui.cmpoperation(), { arm, end })[0];
+  auto cmp = create_cmp(region, ui, arm, end);
   auto pred = jlm::rvsdg::match(1, { { 1, 1 } }, 0, 2, cmp);
 
   return pred;
@@ -369,8 +461,7 @@ create_unrolled_theta_predicate(
   auto uf = create_bitconstant(region, nbits, factor);
   auto mul = bitmul_op::create(nbits, step, uf);
   auto arm = simple_node::create_normalized(region, ui.armoperation(), { idv->origin(), mul })[0];
-  /* FIXME: order of operands */
-  auto cmp = simple_node::create_normalized(region, ui.cmpoperation(), { arm, iend->origin() })[0];
+  auto cmp = create_cmp(region, ui, arm, iend->origin());
   auto pred = match(1, { { 1, 1 } }, 0, 2, cmp);
 
   return pred;
@@ -383,8 +474,7 @@ create_residual_gamma_predicate(const rvsdg::SubstitutionMap & smap, const unrol
   auto idv = smap.lookup(ui.theta()->output(ui.idv()->input()->index()));
   auto end = ui.end()->input()->origin();
 
-  /* FIXME: order of operands */
-  auto cmp = jlm::rvsdg::simple_node::create_normalized(region, ui.cmpoperation(), { idv, end })[0];
+  auto cmp = create_cmp(region, ui, idv, end);
   auto pred = jlm::rvsdg::match(1, { { 1, 1 } }, 0, 2, cmp);
 
   return pred;
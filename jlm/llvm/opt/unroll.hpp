@@ -43,6 +43,117 @@ private:
   size_t factor_;
 };
 
+/**
+ * \brief Induction variable that determines the trip count of a theta node.
+ *
+ * The predicate of the theta node is computed by a match of a comparison between the updated
+ * induction variable and a theta invariant end value. The induction variable is updated by adding
+ * a theta invariant step to it, or by subtracting the step from it. The end and step values are
+ * either constants in the theta subregion or invariant loop variables.
+ *
+ * In contrast to unrollinfo::create(), recognizing the induction variable does not modify the
+ * theta node.
+ */
+class InductionVariable final
+{
+  InductionVariable(
+      rvsdg::node & compareNode,
+      rvsdg::node & arithmeticNode,
+      rvsdg::RegionArgument & argument,
+      rvsdg::output & step,
+      rvsdg::output & end)
+      : CompareNode_(&compareNode),
+        ArithmeticNode_(&arithmeticNode),
+        Argument_(&argument),
+        Step_(&step),
+        End_(&end)
+  {}
+
+public:
+  [[nodiscard]] const rvsdg::node &
+  GetCompareNode() const noexcept
+  {
+    return *CompareNode_;
+  }
+
+  /**
+   * \return The node that adds the step to, or subtracts it from, the induction variable.
+   */
+  [[nodiscard]] const rvsdg::node &
+  GetArithmeticNode() const noexcept
+  {
+    return *ArithmeticNode_;
+  }
+
+  /**
+   * \return The argument of the loop variable of the induction variable.
+   */
+  [[nodiscard]] const rvsdg::RegionArgument &
+  GetArgument() const noexcept
+  {
+    return *Argument_;
+  }
+
+  /**
+   * \return The initial value of the induction variable, which is defined outside of the theta
+   * node.
+   */
+  [[nodiscard]] const rvsdg::output &
+  GetInit() const noexcept
+  {
+    return *Argument_->input()->origin();
+  }
+
+  [[nodiscard]] const rvsdg::output &
+  GetStep() const noexcept
+  {
+    return *Step_;
+  }
+
+  [[nodiscard]] const rvsdg::output &
+  GetEnd() const noexcept
+  {
+    return *End_;
+  }
+
+  /**
+   * \return True if the end value is the first operand of the comparison.
+   */
+  [[nodiscard]] bool
+  IsEndFirstOperand() const noexcept
+  {
+    return CompareNode_->input(0)->origin() == End_;
+  }
+
+  /**
+   * \return The number of iterations of the theta node if the initial, step, and end values are
+   * known constants, otherwise nullptr.
+   */
+  [[nodiscard]] std::unique_ptr<rvsdg::bitvalue_repr>
+  GetTripCount() const;
+
+  /**
+   * \return The value of \p output if it is produced by a constant, otherwise nullptr.
+   */
+  static const rvsdg::bitvalue_repr *
+  GetValue(const rvsdg::output & output) noexcept;
+
+  /**
+   * \return The induction variable of \p theta, or nullptr if it can not be recognized.
+   */
+  static std::unique_ptr<InductionVariable>
+  Create(const rvsdg::ThetaNode & theta);
+
+private:
+  rvsdg::node * CompareNode_;
+  rvsdg::node * ArithmeticNode_;
+  rvsdg::RegionArgument * Argument_;
+  rvsdg::output * Step_;
+  rvsdg::output * End_;
+
+  friend class unrollinfo;
+};
+
 class unrollinfo final
 {
 public:
@@ -13,6 +13,7 @@
 #include <jlm/rvsdg/traverser.hpp>
 
 #include <llvm/Support/raw_os_ostream.h>
+#include <mlir/Bytecode/BytecodeWriter.h>
 #include <mlir/IR/Verifier.h>
 
 #include <mlir/IR/Builders.h>
@@ -29,8 +30,76 @@
 namespace jlm::mlir
 {
 
+class JlmToMlirConversionStatistics final : public util::Statistics
+{
+  const char * ConversionTimerLabel_ = "ConversionTime";
+  const char * PrintTimerLabel_ = "PrintTime";
+  const char * FormatLabel_ = "Format";
+
+public:
+  ~JlmToMlirConversionStatistics() override = default;
+
+  explicit JlmToMlirConversionStatistics(const util::filepath & sourceFile)
+      : Statistics(Statistics::Id::JlmToMlirConversion, sourceFile)
+  {}
+
+  void
+  StartConversion(const rvsdg::graph & graph)
+  {
+    AddMeasurement(Label::NumRvsdgNodes, rvsdg::nnodes(graph.root()));
+    AddTimer(ConversionTimerLabel_).start();
+  }
+
+  void
+  StopConversion()
+  {
+    GetTimer(ConversionTimerLabel_).stop();
+  }
+
+  void
+  StartPrinting(JlmToMlirConverter::Format format)
+  {
+    AddMeasurement(
+        FormatLabel_,
+        std::string(format == JlmToMlirConverter::Format::Bytecode ? "bytecode" : "text"));
+    AddTimer(PrintTimerLabel_).start();
+  }
+
+  void
+  StopPrinting()
+  {
+    GetTimer(PrintTimerLabel_).stop();
+  }
+
+  static std::unique_ptr<JlmToMlirConversionStatistics>
+  Create(const util::filepath & sourceFile)
+  {
+    return std::make_unique<JlmToMlirConversionStatistics>(sourceFile);
+  }
+};
+
+static void
+PrintToStream(
+    ::mlir::rvsdg::OmegaNode & omega,
+    ::llvm::raw_ostream & os,
+    JlmToMlirConverter::Format format)
+{
+  if (format == JlmToMlirConverter::Format::Bytecode)
+  {
+    if (failed(::mlir::writeBytecodeToFile(omega, os)))
+      throw util::error("Writing RVSDG-MLIR bytecode failed");
+  }
+  else
+  {
+    omega.print(os);
+  }
+}
+
 void
-JlmToMlirConverter::Print(::mlir::rvsdg::OmegaNode & omega, const util::filepath & filePath)
+JlmToMlirConverter::Print(
+    ::mlir::rvsdg::OmegaNode & omega,
+    const util::filepath & filePath,
+    Format format)
 {
   if (failed(::mlir::verify(omega)))
   {
@@ -40,13 +109,15 @@ JlmToMlirConverter::Print(::mlir::rvsdg::OmegaNode & omega, const util::filepath
   if (filePath == "")
   {
     ::llvm::raw_os_ostream os(std::cout);
-    omega.print(os);
+    PrintToStream(omega, os, format);
   }
   else
   {
     std::error_code ec;
     ::llvm::raw_fd_ostream os(filePath.to_str(), ec);
-    omega.print(os);
+    if (ec)
+      throw util::error("Cannot open " + filePath.to_str() + ": " + ec.message());
+    PrintToStream(omega, os, format);
   }
 }
 
@@ -56,6 +127,42 @@ JlmToMlirConverter::ConvertModule(const llvm::RvsdgModule & rvsdgModule)
   return ConvertOmega(rvsdgModule.Rvsdg());
 }
 
+::mlir::rvsdg::OmegaNode
+JlmToMlirConverter::ConvertModule(
+    const llvm::RvsdgModule & rvsdgModule,
+    util::StatisticsCollector & statisticsCollector)
+{
+  auto statistics = JlmToMlirConversionStatistics::Create(rvsdgModule.SourceFileName());
+
+  statistics->StartConversion(rvsdgModule.Rvsdg());
+  auto omega = ConvertOmega(rvsdgModule.Rvsdg());
+  statistics->StopConversion();
+
+  statisticsCollector.CollectDemandedStatistics(std::move(statistics));
+  return omega;
+}
+
+void
+JlmToMlirConverter::ConvertAndPrint(
+    const llvm::RvsdgModule & rvsdgModule,
+    const util::filepath & filePath,
+    Format format,
+    util::StatisticsCollector & statisticsCollector)
+{
+  auto statistics = JlmToMlirConversionStatistics::Create(rvsdgModule.SourceFileName());
+
+  statistics->StartConversion(rvsdgModule.Rvsdg());
+  auto omega = ConvertOmega(rvsdgModule.Rvsdg());
+  statistics->StopConversion();
+
+  statistics->StartPrinting(format);
+  Print(omega, filePath, format);
+  statistics->StopPrinting();
+  omega->destroy();
+
+  statisticsCollector.CollectDemandedStatistics(std::move(statistics));
+}
+
 ::mlir::rvsdg::OmegaNode
 JlmToMlirConverter::ConvertOmega(const rvsdg::graph & graph)
 {
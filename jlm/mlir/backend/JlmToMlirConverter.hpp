@@ -14,6 +14,7 @@
 #include <jlm/rvsdg/bitstring/arithmetic.hpp>
 #include <jlm/rvsdg/gamma.hpp>
 #include <jlm/rvsdg/theta.hpp>
+#include <jlm/util/Statistics.hpp>
 
 // MLIR RVSDG dialects
 #include <JLM/JLMDialect.h>
@@ -53,13 +54,34 @@ public:
   JlmToMlirConverter &
   operator=(JlmToMlirConverter &&) = delete;
 
+  /**
+   * The formats MLIR RVSDG can be printed in.
+   */
+  enum class Format
+  {
+    /**
+     * The human readable textual form.
+     */
+    Text,
+
+    /**
+     * The MLIR bytecode, which is considerably faster to print and parse than the textual form.
+     */
+    Bytecode
+  };
+
   /**
    * Prints MLIR RVSDG to a file.
    * \param omega The MLIR RVSDG Omega node to be printed.
-   * \param filePath The path to the file to print the MLIR to.
+   * \param filePath The path to the file to print the MLIR to. The MLIR is printed to stdout if
+   * the path is empty.
+   * \param format The format the MLIR is printed in.
    */
   static void
-  Print(::mlir::rvsdg::OmegaNode & omega, const util::filepath & filePath);
+  Print(
+      ::mlir::rvsdg::OmegaNode & omega,
+      const util::filepath & filePath,
+      Format format = Format::Text);
 
   /**
    * Converts an RVSDG module to MLIR RVSDG.
@@ -71,6 +93,32 @@ public:
   ::mlir::rvsdg::OmegaNode
   ConvertModule(const llvm::RvsdgModule & rvsdgModule);
 
+  /**
+   * Converts an RVSDG module to MLIR RVSDG and collects the conversion time.
+   * \param rvsdgModule The RVSDG module to be converted.
+   * \param statisticsCollector The collector for the JlmToMlirConversion statistics.
+   * \return An MLIR RVSDG OmegaNode, see ConvertModule(const llvm::RvsdgModule&).
+   */
+  ::mlir::rvsdg::OmegaNode
+  ConvertModule(
+      const llvm::RvsdgModule & rvsdgModule,
+      util::StatisticsCollector & statisticsCollector);
+
+  /**
+   * Converts an RVSDG module to MLIR RVSDG and prints it to a file. The conversion and printing
+   * times are collected separately.
+   * \param rvsdgModule The RVSDG module to be converted.
+   * \param filePath The path to the file to print the MLIR to, see Print().
+   * \param format The format the MLIR is printed in.
+   * \param statisticsCollector The collector for the JlmToMlirConversion statistics.
+   */
+  void
+  ConvertAndPrint(
+      const llvm::RvsdgModule & rvsdgModule,
+      const util::filepath & filePath,
+      Format format,
+      util::StatisticsCollector & statisticsCollector);
+
 private:
   /**
    * Converts an omega and all nodes in its (sub)region(s) to an MLIR RVSDG OmegaNode.
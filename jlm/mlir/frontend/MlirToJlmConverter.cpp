@@ -6,7 +6,10 @@
 
 #include <jlm/mlir/frontend/MlirToJlmConverter.hpp>
 
+#include <llvm/Support/MemoryBuffer.h>
 #include <llvm/Support/raw_os_ostream.h>
+#include <llvm/Support/SourceMgr.h>
+#include <mlir/Bytecode/BytecodeReader.h>
 #include <mlir/Parser/Parser.h>
 #include <mlir/Transforms/TopologicalSortUtils.h>
 
@@ -26,17 +29,103 @@
 namespace jlm::mlir
 {
 
+class MlirToJlmConversionStatistics final : public util::Statistics
+{
+  const char * ParseTimerLabel_ = "ParseTime";
+  const char * ConversionTimerLabel_ = "ConversionTime";
+  const char * FormatLabel_ = "Format";
+
+public:
+  ~MlirToJlmConversionStatistics() override = default;
+
+  explicit MlirToJlmConversionStatistics(const util::filepath & sourceFile)
+      : Statistics(Statistics::Id::MlirToJlmConversion, sourceFile)
+  {}
+
+  void
+  StartParsing(bool isBytecode)
+  {
+    AddMeasurement(FormatLabel_, std::string(isBytecode ? "bytecode" : "text"));
+    AddTimer(ParseTimerLabel_).start();
+  }
+
+  void
+  StopParsing()
+  {
+    GetTimer(ParseTimerLabel_).stop();
+  }
+
+  void
+  StartConversion()
+  {
+    AddTimer(ConversionTimerLabel_).start();
+  }
+
+  void
+  StopConversion(const rvsdg::graph & graph)
+  {
+    AddMeasurement(Label::NumRvsdgNodes, rvsdg::nnodes(graph.root()));
+    GetTimer(ConversionTimerLabel_).stop();
+  }
+
+  static std::unique_ptr<MlirToJlmConversionStatistics>
+  Create(const util::filepath & sourceFile)
+  {
+    return std::make_unique<MlirToJlmConversionStatistics>(sourceFile);
+  }
+};
+
 std::unique_ptr<llvm::RvsdgModule>
 MlirToJlmConverter::ReadAndConvertMlir(const util::filepath & filePath)
 {
+  util::StatisticsCollector statisticsCollector;
+  return ReadAndConvertMlir(filePath, statisticsCollector);
+}
+
+std::unique_ptr<llvm::RvsdgModule>
+MlirToJlmConverter::ReadAndConvertMlir(
+    const util::filepath & filePath,
+    util::StatisticsCollector & statisticsCollector)
+{
+  auto statistics = MlirToJlmConversionStatistics::Create(filePath);
+
+  auto buffer = ::llvm::MemoryBuffer::getFileOrSTDIN(filePath.to_str());
+  if (!buffer)
+    throw util::error("Cannot open " + filePath.to_str() + ": " + buffer.getError().message());
+
+  // The parser dispatches to the bytecode reader for bytecode files
+  statistics->StartParsing(::mlir::isBytecode((*buffer)->getMemBufferRef()));
+  ::llvm::SourceMgr sourceManager;
+  sourceManager.AddNewSourceBuffer(std::move(*buffer), ::llvm::SMLoc());
   auto config = ::mlir::ParserConfig(Context_.get());
   std::unique_ptr<::mlir::Block> block = std::make_unique<::mlir::Block>();
-  auto result = ::mlir::parseSourceFile(filePath.to_str(), block.get(), config);
+  auto result = ::mlir::parseSourceFile(sourceManager, block.get(), config);
   if (result.failed())
-  {
-    JLM_ASSERT("Parsing MLIR input file failed.");
-  }
-  return ConvertMlir(block);
+    throw util::error("Parsing MLIR input file " + filePath.to_str() + " failed.");
+  statistics->StopParsing();
+
+  statistics->StartConversion();
+  auto rvsdgModule = ConvertMlir(block);
+  statistics->StopConversion(rvsdgModule->Rvsdg());
+
+  statisticsCollector.CollectDemandedStatistics(std::move(statistics));
+  return rvsdgModule;
+}
+
+std::unique_ptr<llvm::RvsdgModule>
+MlirToJlmConverter::ConvertOmegaNode(
+    ::mlir::rvsdg::OmegaNode & omega,
+    util::StatisticsCollector & statisticsCollector)
+{
+  auto statistics = MlirToJlmConversionStatistics::Create(util::filepath(""));
+
+  statistics->StartConversion();
+  auto rvsdgModule = llvm::RvsdgModule::Create(util::filepath(""), std::string(), std::string());
+  ConvertOmega(*omega.getOperation(), *rvsdgModule->Rvsdg().root());
+  statistics->StopConversion(rvsdgModule->Rvsdg());
+
+  statisticsCollector.CollectDemandedStatistics(std::move(statistics));
+  return rvsdgModule;
 }
 
 std::unique_ptr<llvm::RvsdgModule>
@@ -339,10 +428,9 @@ MlirToJlmConverter::ConvertOperation(
   }
   else if (auto sitofpOp = ::mlir::dyn_cast<::mlir::arith::SIToFPOp>(&mlirOperation))
   {
-    auto & inputType = inputs[0]->type();
-    std::shared_ptr<const rvsdg::Type> inputTypePtr(&inputType);
+    auto inputTypePtr = inputs[0]->Type();
     auto mlirOutputType = sitofpOp.getType();
-    std::shared_ptr<rvsdg::Type> outputType = ConvertType(mlirOutputType);
+    auto outputType = ConvertType(mlirOutputType);
     auto op = llvm::sitofp_op(inputTypePtr, outputType);
     return rvsdg::simple_node::create(
         &rvsdgRegion,
@@ -378,7 +466,7 @@ MlirToJlmConverter::ConvertOperation(
     }
 
     auto callOperation =
-        llvm::CallOperation(std::make_shared<llvm::FunctionType>(argumentTypes, resultTypes));
+        llvm::CallOperation(llvm::FunctionType::Create(argumentTypes, resultTypes));
     return rvsdg::simple_node::create(
         &rvsdgRegion,
         callOperation,
@@ -419,7 +507,7 @@ MlirToJlmConverter::ConvertOperation(
   else if (auto UndefOp = ::mlir::dyn_cast<::mlir::jlm::Undef>(&mlirOperation))
   {
     auto type = UndefOp.getResult().getType();
-    std::shared_ptr<jlm::rvsdg::Type> jlmType = ConvertType(type);
+    auto jlmType = ConvertType(type);
     auto jlmUndefOutput = jlm::llvm::UndefValueOperation::Create(rvsdgRegion, jlmType);
     return rvsdg::output::GetNode(*jlmUndefOutput);
   }
@@ -429,11 +517,11 @@ MlirToJlmConverter::ConvertOperation(
   else if (auto AllocaOp = ::mlir::dyn_cast<::mlir::jlm::Alloca>(&mlirOperation))
   {
     auto outputType = AllocaOp.getValueType();
-    std::shared_ptr<jlm::rvsdg::Type> jlmType = ConvertType(outputType);
+    auto jlmType = ConvertType(outputType);
     auto jlmValueType = std::dynamic_pointer_cast<const rvsdg::ValueType>(jlmType);
 
     auto jlmBitType = dynamic_cast<const jlm::rvsdg::bittype *>(&inputs[0]->type());
-    auto bitTypePrt = std::make_shared<const jlm::rvsdg::bittype>(jlmBitType->nbits());
+    auto bitTypePrt = jlm::rvsdg::bittype::Create(jlmBitType->nbits());
 
     auto allocaOp = jlm::llvm::alloca_op(jlmValueType, bitTypePrt, AllocaOp.getAlignment());
 
@@ -464,7 +552,7 @@ MlirToJlmConverter::ConvertOperation(
     auto address = inputs[0];
     auto memoryStateInputs = std::vector(std::next(inputs.begin()), inputs.end());
     auto outputType = LoadOp.getOutput().getType();
-    std::shared_ptr<jlm::rvsdg::Type> jlmType = ConvertType(outputType);
+    auto jlmType = ConvertType(outputType);
     auto jlmValueType = std::dynamic_pointer_cast<const rvsdg::ValueType>(jlmType);
     auto & loadNode = jlm::llvm::LoadNonVolatileNode::CreateNode(
         *address,
@@ -476,7 +564,7 @@ MlirToJlmConverter::ConvertOperation(
   else if (auto GepOp = ::mlir::dyn_cast<::mlir::LLVM::GEPOp>(&mlirOperation))
   {
     auto elemType = GepOp.getElemType();
-    std::shared_ptr<jlm::rvsdg::Type> pointeeType = ConvertType(elemType);
+    auto pointeeType = ConvertType(elemType);
     auto pointeeValueType = std::dynamic_pointer_cast<const rvsdg::ValueType>(pointeeType);
 
     auto jlmGepOp = jlm::llvm::GetElementPtrOperation::Create(
@@ -553,7 +641,7 @@ MlirToJlmConverter::ConvertOperation(
     auto terminator = deltaBlock.getTerminator();
 
     auto mlirOutputType = terminator->getOperand(0).getType();
-    std::shared_ptr<rvsdg::Type> outputType = ConvertType(mlirOutputType);
+    auto outputType = ConvertType(mlirOutputType);
     auto outputValueType = std::dynamic_pointer_cast<const rvsdg::ValueType>(outputType);
     auto linakgeString = mlirDeltaNode.getLinkage().str();
     auto rvsdgDeltaNode = llvm::delta::node::Create(
@@ -746,55 +834,55 @@ MlirToJlmConverter::ConvertLambda(
   return rvsdgLambda;
 }
 
-std::unique_ptr<rvsdg::Type>
+std::shared_ptr<const rvsdg::Type>
 MlirToJlmConverter::ConvertType(::mlir::Type & type)
 {
   if (auto ctrlType = ::mlir::dyn_cast<::mlir::rvsdg::RVSDG_CTRLType>(type))
   {
-    return std::make_unique<rvsdg::ControlType>(ctrlType.getNumOptions());
+    return rvsdg::ControlType::Create(ctrlType.getNumOptions());
   }
   else if (auto intType = ::mlir::dyn_cast<::mlir::IntegerType>(type))
   {
-    return std::make_unique<rvsdg::bittype>(intType.getWidth());
+    return rvsdg::bittype::Create(intType.getWidth());
   }
   else if (::mlir::isa<::mlir::Float16Type>(type))
   {
-    return std::make_unique<llvm::fptype>(llvm::fpsize::half);
+    return llvm::fptype::Create(llvm::fpsize::half);
   }
   else if (::mlir::isa<::mlir::Float32Type>(type))
   {
-    return std::make_unique<llvm::fptype>(llvm::fpsize::flt);
+    return llvm::fptype::Create(llvm::fpsize::flt);
   }
   else if (::mlir::isa<::mlir::Float64Type>(type))
   {
-    return std::make_unique<llvm::fptype>(llvm::fpsize::dbl);
+    return llvm::fptype::Create(llvm::fpsize::dbl);
   }
   else if (::mlir::isa<::mlir::Float80Type>(type))
   {
-    return std::make_unique<llvm::fptype>(llvm::fpsize::x86fp80);
+    return llvm::fptype::Create(llvm::fpsize::x86fp80);
   }
   else if (::mlir::isa<::mlir::Float128Type>(type))
   {
-    return std::make_unique<llvm::fptype>(llvm::fpsize::fp128);
+    return llvm::fptype::Create(llvm::fpsize::fp128);
   }
   else if (::mlir::isa<::mlir::rvsdg::MemStateEdgeType>(type))
   {
-    return std::make_unique<llvm::MemoryStateType>();
+    return llvm::MemoryStateType::Create();
   }
   else if (::mlir::isa<::mlir::rvsdg::IOStateEdgeType>(type))
   {
-    return std::make_unique<llvm::iostatetype>();
+    return llvm::iostatetype::Create();
   }
   else if (::mlir::isa<::mlir::LLVM::LLVMPointerType>(type))
   {
-    return std::make_unique<llvm::PointerType>();
+    return llvm::PointerType::Create();
   }
   else if (auto arrayType = ::mlir::dyn_cast<::mlir::LLVM::LLVMArrayType>(type))
   {
     auto mlirElementType = arrayType.getElementType();
-    std::shared_ptr<rvsdg::Type> elementType = ConvertType(mlirElementType);
+    auto elementType = ConvertType(mlirElementType);
     auto elemenValueType = std::dynamic_pointer_cast<const rvsdg::ValueType>(elementType);
-    return std::make_unique<llvm::arraytype>(elemenValueType, arrayType.getNumElements());
+    return llvm::arraytype::Create(elemenValueType, arrayType.getNumElements());
   }
   else
   {
@@ -13,6 +13,7 @@
 #include <jlm/rvsdg/bitstring/constant.hpp>
 #include <jlm/rvsdg/gamma.hpp>
 #include <jlm/rvsdg/theta.hpp>
+#include <jlm/util/Statistics.hpp>
 
 #include <JLM/JLMDialect.h>
 #include <JLM/JLMOps.h>
@@ -52,13 +53,39 @@ public:
   operator=(MlirToJlmConverter &&) = delete;
 
   /**
-   * Reads RVSDG MLIR from a file and converts it,
+   * Reads RVSDG MLIR from a file and converts it. The file can either contain the textual form or
+   * the bytecode of the MLIR, which is detected automatically.
    * \param filePath The path to the file containing RVSDG MLIR IR.
    * \return The converted RVSDG graph.
    */
   std::unique_ptr<llvm::RvsdgModule>
   ReadAndConvertMlir(const util::filepath & filePath);
 
+  /**
+   * Reads RVSDG MLIR from a file and converts it. The parsing and conversion times are collected
+   * separately.
+   * \param filePath The path to the file containing RVSDG MLIR IR.
+   * \param statisticsCollector The collector for the MlirToJlmConversion statistics.
+   * \return The converted RVSDG graph.
+   */
+  std::unique_ptr<llvm::RvsdgModule>
+  ReadAndConvertMlir(
+      const util::filepath & filePath,
+      util::StatisticsCollector & statisticsCollector);
+
+  /**
+   * Converts an in-memory MLIR RVSDG omega node without going through a file, e.g., the omega
+   * returned by JlmToMlirConverter::ConvertModule(). The omega remains owned by the caller, but
+   * the operations in its region might be reordered.
+   * \param omega The MLIR RVSDG omega node to be converted.
+   * \param statisticsCollector The collector for the MlirToJlmConversion statistics.
+   * \return The converted RVSDG graph.
+   */
+  std::unique_ptr<llvm::RvsdgModule>
+  ConvertOmegaNode(
+      ::mlir::rvsdg::OmegaNode & omega,
+      util::StatisticsCollector & statisticsCollector);
+
   /**
    * Converts the MLIR block and all operations in it, including their respective regions.
    * \param block The RVSDG MLIR block to be converted.
@@ -208,7 +235,7 @@ private:
    * \param type The MLIR type to be converted.
    * \result The converted RVSDG type.
    */
-  static std::unique_ptr<rvsdg::Type>
+  static std::shared_ptr<const rvsdg::Type>
   ConvertType(::mlir::Type & type);
 
   std::unique_ptr<::mlir::MLIRContext> Context_;
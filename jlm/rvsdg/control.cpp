@@ -68,7 +68,7 @@ ControlType::Create(std::size_t nalternatives)
   }
   else
   {
-    return std::make_shared<ControlType>(nalternatives);
+    return InternType(std::make_shared<const ControlType>(nalternatives));
   }
 }
 
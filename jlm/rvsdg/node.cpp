@@ -188,7 +188,7 @@ node_output::GetOwner() const noexcept
 
 /* node class */
 
-node::node(std::unique_ptr<jlm::rvsdg::operation> op, rvsdg::Region * region)
+node::node(std::shared_ptr<const jlm::rvsdg::operation> op, rvsdg::Region * region)
     : depth_(0),
       graph_(region->graph()),
       region_(region),
@@ -633,7 +633,7 @@ class node
 public:
   virtual ~node();
 
-  node(std::unique_ptr<jlm::rvsdg::operation> op, rvsdg::Region * region);
+  node(std::shared_ptr<const jlm::rvsdg::operation> op, rvsdg::Region * region);
 
   inline const jlm::rvsdg::operation &
   operation() const noexcept
@@ -886,7 +886,7 @@ private:
   size_t depth_;
   jlm::rvsdg::graph * graph_;
   rvsdg::Region * region_;
-  std::unique_ptr<jlm::rvsdg::operation> operation_;
+  std::shared_ptr<const jlm::rvsdg::operation> operation_;
   std::vector<std::unique_ptr<node_input>> inputs_;
   std::vector<std::unique_ptr<node_output>> outputs_;
 };
@@ -7,6 +7,12 @@
 #include <jlm/rvsdg/graph.hpp>
 #include <jlm/rvsdg/simple-normal-form.hpp>
 #include <jlm/rvsdg/structural-normal-form.hpp>
+#include <jlm/util/Hash.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
 
 namespace jlm::rvsdg
 {
@@ -57,6 +63,150 @@ simple_op::normal_form(jlm::rvsdg::graph * graph) noexcept
   return static_cast<jlm::rvsdg::simple_normal_form *>(graph->node_normal_form(typeid(simple_op)));
 }
 
+/**
+ * Maps the type of a simple operation, its parameters, and the types of its operands and results
+ * to the shared instances of these operations. The table only holds weak references, such that
+ * operations are freed with the last node using them. Expired entries are removed like in the type
+ * interning table, i.e., when their bucket is visited, or by a sweep over all buckets once the
+ * number of entries has doubled since the last sweep.
+ */
+class OperationInterningTable final
+{
+  static constexpr size_t MaxBucketSize_ = 8;
+  static constexpr size_t MinSweepThreshold_ = 64;
+
+public:
+  std::shared_ptr<const simple_op>
+  Intern(const simple_op & operation)
+  {
+    std::lock_guard<std::mutex> guard(Mutex_);
+
+    auto & bucket = Buckets_[ComputeHash(operation)];
+    for (auto it = bucket.begin(); it != bucket.end();)
+    {
+      if (auto sharedOperation = it->lock())
+      {
+        if (HaveIdenticalTypes(*sharedOperation, operation) && *sharedOperation == operation)
+          return sharedOperation;
+        it++;
+      }
+      else
+      {
+        it = bucket.erase(it);
+        NumEntries_--;
+      }
+    }
+
+    std::shared_ptr<const simple_op> sharedOperation(
+        static_cast<simple_op *>(operation.copy().release()));
+    // Operations that are not equal to themselves cannot be shared
+    if (!(*sharedOperation == *sharedOperation))
+      return sharedOperation;
+
+    if (bucket.size() == MaxBucketSize_)
+    {
+      bucket.pop_front();
+      NumEntries_--;
+    }
+    bucket.push_back(sharedOperation);
+    if (++NumEntries_ > SweepThreshold_)
+      Sweep();
+
+    return sharedOperation;
+  }
+
+  static OperationInterningTable &
+  Get()
+  {
+    // Intentionally leaked, such that nodes can still be destroyed during static destruction
+    static auto table = new OperationInterningTable();
+    return *table;
+  }
+
+private:
+  /**
+   * Not all operations compare all their operand and result types in operator==(), but a shared
+   * operation must have exactly the types of the node using it.
+   */
+  static bool
+  HaveIdenticalTypes(const simple_op & operation1, const simple_op & operation2) noexcept
+  {
+    if (typeid(operation1) != typeid(operation2)
+        || operation1.narguments() != operation2.narguments()
+        || operation1.nresults() != operation2.nresults())
+      return false;
+
+    for (size_t n = 0; n < operation1.narguments(); n++)
+    {
+      if (operation1.argument(n) != operation2.argument(n))
+        return false;
+    }
+    for (size_t n = 0; n < operation1.nresults(); n++)
+    {
+      if (operation1.result(n) != operation2.result(n))
+        return false;
+    }
+
+    return true;
+  }
+
+  /**
+   * Types with parameters are interned, which permits to hash their addresses. The parameters of
+   * the operation itself, e.g., the value of a constant or the mapping of a match, are covered by
+   * its debug string. Otherwise, all constants of a type would end up in the same bucket.
+   */
+  static std::size_t
+  ComputeHash(const simple_op & operation)
+  {
+    std::size_t seed = typeid(operation).hash_code();
+    util::CombineHashesWithSeed(seed, std::hash<std::string>()(operation.debug_string()));
+    for (size_t n = 0; n < operation.narguments(); n++)
+      util::CombineHashesWithSeed(seed, std::hash<const Type *>()(operation.argument(n).get()));
+    for (size_t n = 0; n < operation.nresults(); n++)
+      util::CombineHashesWithSeed(seed, std::hash<const Type *>()(operation.result(n).get()));
+
+    return seed;
+  }
+
+  /**
+   * Removes the expired entries of all buckets, and erases the buckets that become empty.
+   */
+  void
+  Sweep()
+  {
+    NumEntries_ = 0;
+    for (auto it = Buckets_.begin(); it != Buckets_.end();)
+    {
+      auto & bucket = it->second;
+      bucket.erase(
+          std::remove_if(
+              bucket.begin(),
+              bucket.end(),
+              [](const std::weak_ptr<const simple_op> & operation)
+              {
+                return operation.expired();
+              }),
+          bucket.end());
+
+      NumEntries_ += bucket.size();
+      it = bucket.empty() ? Buckets_.erase(it) : std::next(it);
+    }
+
+    SweepThreshold_ = std::max(MinSweepThreshold_, 2 * NumEntries_);
+  }
+
+  std::mutex Mutex_;
+  std::unordered_map<std::size_t, std::deque<std::weak_ptr<const simple_op>>> Buckets_;
+  size_t NumEntries_ = 0;
+  size_t SweepThreshold_ = MinSweepThreshold_;
+};
+
+std::shared_ptr<const simple_op>
+InternOperation(const simple_op & operation)
+{
+  return OperationInterningTable::Get().Intern(operation);
+}
+
 /* structural operation */
 
 bool
@@ -38,10 +38,14 @@ public:
   virtual std::unique_ptr<jlm::rvsdg::operation>
   copy() const = 0;
 
+  /**
+   * Simple operations are shared between nodes, see InternOperation(). The identity check avoids
+   * the structural comparison for nodes with a shared operation.
+   */
   inline bool
   operator!=(const operation & other) const noexcept
   {
-    return !(*this == other);
+    return this != &other && !(*this == other);
   }
 
   static jlm::rvsdg::node_normal_form *
@@ -93,6 +97,22 @@ private:
   std::vector<std::shared_ptr<const rvsdg::Type>> results_;
 };
 
+/**
+ * Returns an instance of \p operation that can be shared between nodes. Equal simple operations,
+ * i.e., operations that are equal according to operation::operator==(), are represented by the
+ * same instance as long as they are used by a node. Operations that are not equal to themselves,
+ * e.g., operations with an identity, are always copied.
+ *
+ * Only a bounded number of distinct operations with the same operand and result types is kept
+ * for sharing, such that operations with many different parameters, e.g., constants, do not
+ * degrade the lookup. The least recently interned operation is evicted first.
+ *
+ * @param operation The operation to intern.
+ * @return A shared instance of \p operation.
+ */
+std::shared_ptr<const simple_op>
+InternOperation(const simple_op & operation);
+
 /* structural operation */
 
 class structural_op : public operation
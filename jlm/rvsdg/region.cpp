@@ -6,10 +6,13 @@
 
 #include <jlm/rvsdg/graph.hpp>
 #include <jlm/rvsdg/notifiers.hpp>
+#include <jlm/rvsdg/simple-node.hpp>
 #include <jlm/rvsdg/structural-node.hpp>
 #include <jlm/rvsdg/substitution.hpp>
 #include <jlm/rvsdg/traverser.hpp>
 #include <jlm/util/AnnotationMap.hpp>
+#include <jlm/util/HashSet.hpp>
+#include <jlm/util/MemoryFootprint.hpp>
 
 namespace jlm::rvsdg
 {
@@ -542,4 +545,115 @@ ninputs(const rvsdg::Region * region) noexcept
   return n;
 }
 
+static void
+AddTypeFootprint(
+    const Type & type,
+    util::HashSet<const Type *> & types,
+    util::MemoryFootprint & memoryFootprint)
+{
+  // The dynamic size of a type is unknown, but types with parameters are interned and shared
+  if (types.Insert(&type))
+    memoryFootprint.Add(util::MemoryFootprint::Category::RvsdgTypes, sizeof(Type));
+}
+
+static void
+AddOutputFootprint(
+    const output & output,
+    size_t outputSize,
+    util::HashSet<const Type *> & types,
+    util::MemoryFootprint & memoryFootprint)
+{
+  using Category = util::MemoryFootprint::Category;
+
+  memoryFootprint.Add(Category::RvsdgOutputs, outputSize);
+  // The bucket count of the user set is not exposed and approximated by a load factor of one
+  memoryFootprint.Add(
+      Category::RvsdgUserSets,
+      util::MemoryFootprint::EstimateUnorderedContainerBytes(
+          output.nusers(),
+          output.nusers(),
+          sizeof(input *)));
+  AddTypeFootprint(output.type(), types, memoryFootprint);
+}
+
+static void
+AddOperationFootprint(
+    const operation & operation,
+    util::HashSet<const rvsdg::operation *> & operations,
+    util::HashSet<const Type *> & types,
+    util::MemoryFootprint & memoryFootprint)
+{
+  if (!operations.Insert(&operation))
+    return;
+
+  auto simpleOperation = dynamic_cast<const simple_op *>(&operation);
+  if (!simpleOperation)
+  {
+    memoryFootprint.Add(util::MemoryFootprint::Category::RvsdgOperations, sizeof(structural_op));
+    return;
+  }
+
+  auto numTypes = simpleOperation->narguments() + simpleOperation->nresults();
+  memoryFootprint.Add(
+      util::MemoryFootprint::Category::RvsdgOperations,
+      sizeof(simple_op) + numTypes * sizeof(std::shared_ptr<const Type>));
+  for (size_t n = 0; n < simpleOperation->narguments(); n++)
+    AddTypeFootprint(*simpleOperation->argument(n), types, memoryFootprint);
+  for (size_t n = 0; n < simpleOperation->nresults(); n++)
+    AddTypeFootprint(*simpleOperation->result(n), types, memoryFootprint);
+}
+
+static void
+ComputeMemoryFootprint(
+    const rvsdg::Region & region,
+    util::HashSet<const operation *> & operations,
+    util::HashSet<const Type *> & types,
+    util::MemoryFootprint & memoryFootprint)
+{
+  using Category = util::MemoryFootprint::Category;
+
+  memoryFootprint.Add(
+      Category::RvsdgRegions,
+      sizeof(Region) + (region.narguments() + region.nresults()) * sizeof(void *));
+  for (size_t n = 0; n < region.narguments(); n++)
+    AddOutputFootprint(*region.argument(n), sizeof(RegionArgument), types, memoryFootprint);
+  memoryFootprint.Add(Category::RvsdgInputs, region.nresults() * sizeof(RegionResult));
+
+  for (const auto & node : region.nodes)
+  {
+    auto structuralNode = dynamic_cast<const StructuralNode *>(&node);
+    auto inputSize = structuralNode ? sizeof(structural_input) : sizeof(node_input);
+    auto outputSize = structuralNode ? sizeof(structural_output) : sizeof(node_output);
+
+    memoryFootprint.Add(
+        Category::RvsdgNodes,
+        (structuralNode ? sizeof(StructuralNode) : sizeof(simple_node))
+            + (node.ninputs() + node.noutputs()) * sizeof(void *));
+    memoryFootprint.Add(Category::RvsdgInputs, node.ninputs() * inputSize);
+    for (size_t n = 0; n < node.noutputs(); n++)
+      AddOutputFootprint(*node.output(n), outputSize, types, memoryFootprint);
+    AddOperationFootprint(node.operation(), operations, types, memoryFootprint);
+
+    if (structuralNode)
+    {
+      memoryFootprint.Add(
+          Category::RvsdgNodes,
+          structuralNode->nsubregions() * sizeof(std::unique_ptr<Region>));
+      for (size_t r = 0; r < structuralNode->nsubregions(); r++)
+        ComputeMemoryFootprint(*structuralNode->subregion(r), operations, types, memoryFootprint);
+    }
+  }
+}
+
+util::MemoryFootprint
+ComputeMemoryFootprint(const rvsdg::Region & region)
+{
+  util::HashSet<const operation *> operations;
+  util::HashSet<const Type *> types;
+  util::MemoryFootprint memoryFootprint;
+  ComputeMemoryFootprint(region, operations, types, memoryFootprint);
+
+  return memoryFootprint;
+}
+
 } // namespace
@@ -18,6 +18,7 @@ namespace jlm::util
 {
 class Annotation;
 class AnnotationMap;
+class MemoryFootprint;
 }
 
 namespace jlm::rvsdg
@@ -702,6 +703,16 @@ nsimpnodes(const rvsdg::Region * region) noexcept;
 size_t
 ninputs(const rvsdg::Region * region) noexcept;
 
+/**
+ * Estimates the memory used by the nodes, inputs, outputs, operations, types, and regions of
+ * \p region and its subregions. Operations and types that are shared between nodes are only
+ * accounted once.
+ *
+ * @see util::MemoryFootprint
+ */
+util::MemoryFootprint
+ComputeMemoryFootprint(const rvsdg::Region & region);
+
 /**
  * \brief Checks if this is a result of a region inside a node of specified type.
  *
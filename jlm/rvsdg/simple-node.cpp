@@ -49,7 +49,7 @@ simple_node::simple_node(
     rvsdg::Region * region,
     const jlm::rvsdg::simple_op & op,
     const std::vector<jlm::rvsdg::output *> & operands)
-    : node(op.copy(), region)
+    : node(InternOperation(op), region)
 {
   if (operation().narguments() != operands.size())
     throw jlm::util::error(jlm::util::strfmt(
@@ -5,6 +5,12 @@
  */
 
 #include <jlm/rvsdg/type.hpp>
+#include <jlm/util/common.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace jlm::rvsdg
 {
@@ -15,4 +21,113 @@ ValueType::~ValueType() noexcept = default;
 
 StateType::~StateType() noexcept = default;
 
+/**
+ * Maps the hash of a type to the canonical instances with this hash. The table only holds weak
+ * references, such that types that are no longer in use are freed. Their entries are removed the
+ * next time their bucket is visited, or by a sweep over all buckets once the number of entries has
+ * doubled since the last sweep. The table therefore stays proportional to the number of live types.
+ */
+class TypeInterningTable final
+{
+  static constexpr size_t MinSweepThreshold_ = 64;
+
+public:
+  std::shared_ptr<const Type>
+  Intern(std::shared_ptr<const Type> type)
+  {
+    std::lock_guard<std::mutex> guard(Mutex_);
+
+    auto & bucket = Buckets_[type->ComputeHash()];
+    for (auto it = bucket.begin(); it != bucket.end();)
+    {
+      if (auto canonicalType = it->lock())
+      {
+        if (*canonicalType == *type)
+          return canonicalType;
+        it++;
+      }
+      else
+      {
+        it = bucket.erase(it);
+        NumEntries_--;
+      }
+    }
+
+    bucket.push_back(type);
+    if (++NumEntries_ > SweepThreshold_)
+      Sweep();
+
+    return type;
+  }
+
+  size_t
+  NumTypes()
+  {
+    std::lock_guard<std::mutex> guard(Mutex_);
+
+    size_t numTypes = 0;
+    for (auto & [hash, bucket] : Buckets_)
+    {
+      for (auto & type : bucket)
+        numTypes += type.expired() ? 0 : 1;
+    }
+
+    return numTypes;
+  }
+
+  static TypeInterningTable &
+  Get()
+  {
+    // Intentionally leaked, such that types can still be freed during static destruction
+    static auto table = new TypeInterningTable();
+    return *table;
+  }
+
+private:
+  /**
+   * Removes the expired entries of all buckets, and erases the buckets that become empty.
+   */
+  void
+  Sweep()
+  {
+    NumEntries_ = 0;
+    for (auto it = Buckets_.begin(); it != Buckets_.end();)
+    {
+      auto & bucket = it->second;
+      bucket.erase(
+          std::remove_if(
+              bucket.begin(),
+              bucket.end(),
+              [](const std::weak_ptr<const Type> & type)
+              {
+                return type.expired();
+              }),
+          bucket.end());
+
+      NumEntries_ += bucket.size();
+      it = bucket.empty() ? Buckets_.erase(it) : std::next(it);
+    }
+
+    SweepThreshold_ = std::max(MinSweepThreshold_, 2 * NumEntries_);
+  }
+
+  std::mutex Mutex_;
+  std::unordered_map<std::size_t, std::vector<std::weak_ptr<const Type>>> Buckets_;
+  size_t NumEntries_ = 0;
+  size_t SweepThreshold_ = MinSweepThreshold_;
+};
+
+std::shared_ptr<const Type>
+InternType(std::shared_ptr<const Type> type)
+{
+  JLM_ASSERT(type != nullptr);
+  return TypeInterningTable::Get().Intern(std::move(type));
+}
+
+size_t
+NumInternedTypes()
+{
+  return TypeInterningTable::Get().NumTypes();
+}
+
 }
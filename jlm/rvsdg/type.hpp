@@ -26,10 +26,14 @@ public:
   virtual bool
   operator==(const jlm::rvsdg::Type & other) const noexcept = 0;
 
+  /**
+   * Types created through InternType() are unique, i.e., two such types are only equal if they
+   * are the same instance. The identity check avoids the structural comparison in this case.
+   */
   inline bool
   operator!=(const jlm::rvsdg::Type & other) const noexcept
   {
-    return !(*this == other);
+    return this != &other && !(*this == other);
   }
 
   virtual std::string
@@ -66,6 +70,41 @@ protected:
   {}
 };
 
+/**
+ * Returns the canonical instance of all types that are structurally equal to \p type, i.e., that
+ * are equal according to Type::operator==() and Type::ComputeHash(). The first type interned with
+ * a certain structure becomes the canonical instance, and stays it for as long as it is referenced.
+ *
+ * The Create() methods of the types with parameters intern their instances, such that equal types
+ * are represented by the same instance and their comparison reduces to an identity check.
+ *
+ * @param type A type allocated on the heap.
+ * @return The canonical instance of \p type.
+ */
+std::shared_ptr<const Type>
+InternType(std::shared_ptr<const Type> type);
+
+/**
+ * @see InternType(std::shared_ptr<const Type>)
+ */
+template<class T>
+std::shared_ptr<const T>
+InternType(std::shared_ptr<const T> type)
+{
+  static_assert(
+      std::is_base_of<jlm::rvsdg::Type, T>::value,
+      "Template parameter T must be derived from jlm::rvsdg::Type.");
+
+  return std::static_pointer_cast<const T>(
+      InternType(std::static_pointer_cast<const jlm::rvsdg::Type>(std::move(type))));
+}
+
+/**
+ * @return The number of canonical type instances that are currently alive.
+ */
+[[nodiscard]] size_t
+NumInternedTypes();
+
 template<class T>
 static inline bool
 is(const jlm::rvsdg::Type & type) noexcept
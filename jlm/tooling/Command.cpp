@@ -8,6 +8,7 @@
 #include <jlm/llvm/backend/rvsdg2jlm/rvsdg2jlm.hpp>
 #include <jlm/llvm/frontend/InterProceduralGraphConversion.hpp>
 #include <jlm/llvm/frontend/LlvmModuleConversion.hpp>
+#include <jlm/llvm/frontend/UnreachableFunctionElimination.hpp>
 #include <jlm/llvm/ir/ipgraph-module.hpp>
 #include <jlm/llvm/ir/RvsdgModule.hpp>
 #include <jlm/llvm/opt/alias-analyses/AgnosticMemoryNodeProvider.hpp>
@@ -17,18 +18,24 @@
 #include <jlm/llvm/opt/alias-analyses/Steensgaard.hpp>
 #include <jlm/llvm/opt/cne.hpp>
 #include <jlm/llvm/opt/DeadNodeElimination.hpp>
+#include <jlm/llvm/opt/GammaMerging.hpp>
 #include <jlm/llvm/opt/inlining.hpp>
+#include <jlm/llvm/opt/InvariantLoadHoisting.hpp>
 #include <jlm/llvm/opt/InvariantValueRedirection.hpp>
 #include <jlm/llvm/opt/inversion.hpp>
+#include <jlm/llvm/opt/LoopFusion.hpp>
+#include <jlm/llvm/opt/LoopUnswitching.hpp>
 #include <jlm/llvm/opt/OptimizationSequence.hpp>
 #include <jlm/llvm/opt/pull.hpp>
 #include <jlm/llvm/opt/push.hpp>
 #include <jlm/llvm/opt/reduction.hpp>
 #include <jlm/llvm/opt/RvsdgTreePrinter.hpp>
+#include <jlm/llvm/opt/TailRecursionElimination.hpp>
 #include <jlm/llvm/opt/unroll.hpp>
 #include <jlm/rvsdg/view.hpp>
 #include <jlm/tooling/Command.hpp>
 #include <jlm/tooling/CommandPaths.hpp>
+#include <jlm/tooling/JlmOptServer.hpp>
 
 #ifdef ENABLE_MLIR
 #include <jlm/mlir/backend/JlmToMlirConverter.hpp>
@@ -37,6 +44,7 @@
 
 #include <llvm/IR/LLVMContext.h>
 #include <llvm/IRReader/IRReader.h>
+#include <llvm/Support/Error.h>
 #include <llvm/Support/raw_os_ostream.h>
 #include <llvm/Support/SourceMgr.h>
 
@@ -288,10 +296,16 @@ JlmOptCommand::~JlmOptCommand() = default;
 
 JlmOptCommand::JlmOptCommand(
     std::string programName,
-    const jlm::tooling::JlmOptCommandLineOptions & commandLineOptions)
+    const jlm::tooling::JlmOptCommandLineOptions & commandLineOptions,
+    util::filepath serverSocket)
     : ProgramName_(std::move(programName)),
-      CommandLineOptions_(std::move(commandLineOptions))
+      CommandLineOptions_(std::move(commandLineOptions)),
+      ServerSocket_(std::move(serverSocket))
 {
+  // The optimizations are run by the server if the command is processed by one
+  if (!ServerSocket_.to_str().empty())
+    return;
+
   for (auto optimizationId : CommandLineOptions_.GetOptimizationIds())
   {
     if (auto it = Optimizations_.find(optimizationId); it == Optimizations_.end())
@@ -341,6 +355,12 @@ JlmOptCommand::ToString() const
 void
 JlmOptCommand::Run() const
 {
+  if (!ServerSocket_.to_str().empty())
+  {
+    JlmOptServer::SubmitJob(ServerSocket_, CommandLineOptions_);
+    return;
+  }
+
   jlm::util::StatisticsCollector statisticsCollector(
       CommandLineOptions_.GetStatisticsCollectorSettings());
 
@@ -399,10 +419,18 @@ JlmOptCommand::CreateOptimization(
     return std::make_unique<llvm::DeadNodeElimination>();
   case JlmOptCommandLineOptions::OptimizationId::FunctionInlining:
     return std::make_unique<llvm::fctinline>();
+  case JlmOptCommandLineOptions::OptimizationId::GammaMerging:
+    return std::make_unique<llvm::GammaMerging>();
+  case JlmOptCommandLineOptions::OptimizationId::InvariantLoadHoisting:
+    return std::make_unique<llvm::InvariantLoadHoisting>();
   case JlmOptCommandLineOptions::OptimizationId::InvariantValueRedirection:
     return std::make_unique<llvm::InvariantValueRedirection>();
+  case JlmOptCommandLineOptions::OptimizationId::LoopFusion:
+    return std::make_unique<llvm::LoopFusion>();
   case JlmOptCommandLineOptions::OptimizationId::LoopUnrolling:
     return std::make_unique<llvm::loopunroll>(4);
+  case JlmOptCommandLineOptions::OptimizationId::LoopUnswitching:
+    return std::make_unique<llvm::LoopUnswitching>();
   case JlmOptCommandLineOptions::OptimizationId::NodePullIn:
     return std::make_unique<llvm::pullin>();
   case JlmOptCommandLineOptions::OptimizationId::NodePushOut:
@@ -412,6 +440,8 @@ JlmOptCommand::CreateOptimization(
   case JlmOptCommandLineOptions::OptimizationId::RvsdgTreePrinter:
     return std::make_unique<llvm::RvsdgTreePrinter>(
         CommandLineOptions_.GetRvsdgTreePrinterConfiguration());
+  case JlmOptCommandLineOptions::OptimizationId::TailRecursionElimination:
+    return std::make_unique<llvm::TailRecursionElimination>();
   case JlmOptCommandLineOptions::OptimizationId::ThetaGammaInversion:
     return std::make_unique<llvm::tginversion>();
   default:
@@ -424,27 +454,35 @@ JlmOptCommand::ParseLlvmIrFile(
     const util::filepath & llvmIrFile,
     util::StatisticsCollector & statisticsCollector) const
 {
-  ::llvm::LLVMContext llvmContext;
-  ::llvm::SMDiagnostic diagnostic;
-  auto llvmModule = ::llvm::parseIRFile(llvmIrFile.to_str(), diagnostic, llvmContext);
-
-  if (llvmModule == nullptr)
+  std::unique_ptr<llvm::ipgraph_module> interProceduralGraphModule;
   {
-    std::string errors;
-    ::llvm::raw_string_ostream os(errors);
-    diagnostic.print(ProgramName_.c_str(), os);
-    throw util::error(errors);
-  }
+    ::llvm::LLVMContext llvmContext;
+    ::llvm::SMDiagnostic diagnostic;
+    // Bitcode files are loaded lazily such that the bodies of unreachable functions are never read
+    auto llvmModule = ::llvm::getLazyIRFileModule(llvmIrFile.to_str(), diagnostic, llvmContext);
 
-  auto interProceduralGraphModule = llvm::ConvertLlvmModule(*llvmModule);
+    if (llvmModule == nullptr)
+    {
+      std::string errors;
+      ::llvm::raw_string_ostream os(errors);
+      diagnostic.print(ProgramName_.c_str(), os);
+      throw util::error(errors);
+    }
 
-  // Dispose of Llvm module. It is no longer needed.
-  llvmModule.reset();
+    llvm::EliminateUnreachableFunctions(*llvmModule, statisticsCollector);
+    if (auto error = llvmModule->materializeAll())
+      throw util::error(::llvm::toString(std::move(error)));
 
-  auto rvsdgModule =
-      llvm::ConvertInterProceduralGraphModule(*interProceduralGraphModule, statisticsCollector);
+    // The conversion consumes the LLVM module and releases function bodies as it progresses. The
+    // LLVM context, which owns all types and constants, is disposed at the end of this scope.
+    interProceduralGraphModule = llvm::ConvertLlvmModule(std::move(llvmModule));
+  }
 
-  return rvsdgModule;
+  // The conversion consumes the inter-procedural graph module and releases the CFG of every
+  // function as soon as its lambda is built.
+  return llvm::ConvertInterProceduralGraphModule(
+      std::move(interProceduralGraphModule),
+      statisticsCollector);
 }
 
 std::unique_ptr<llvm::RvsdgModule>
@@ -454,7 +492,7 @@ JlmOptCommand::ParseMlirIrFile(
 {
 #ifdef ENABLE_MLIR
   jlm::mlir::MlirToJlmConverter rvsdggen;
-  return rvsdggen.ReadAndConvertMlir(mlirIrFile);
+  return rvsdggen.ReadAndConvertMlir(mlirIrFile, statisticsCollector);
 #else
   JLM_UNREACHABLE(
       "This version of jlm-opt has not been compiled with support for the MLIR backend\n");
@@ -543,12 +581,14 @@ void
 JlmOptCommand::PrintAsMlir(
     const llvm::RvsdgModule & rvsdgModule,
     const util::filepath & outputFile,
-    util::StatisticsCollector &)
+    bool printBytecode,
+    util::StatisticsCollector & statisticsCollector)
 {
 #ifdef ENABLE_MLIR
+  auto format = printBytecode ? jlm::mlir::JlmToMlirConverter::Format::Bytecode
+                              : jlm::mlir::JlmToMlirConverter::Format::Text;
   jlm::mlir::JlmToMlirConverter mlirgen;
-  auto omega = mlirgen.ConvertModule(rvsdgModule);
-  mlirgen.Print(omega, outputFile);
+  mlirgen.ConvertAndPrint(rvsdgModule, outputFile, format, statisticsCollector);
 #else
   throw util::error(
       "This version of jlm-opt has not been compiled with support for the MLIR backend\n");
@@ -622,7 +662,11 @@ JlmOptCommand::PrintRvsdgModule(
   }
   else if (outputFormat == tooling::JlmOptCommandLineOptions::OutputFormat::Mlir)
   {
-    PrintAsMlir(rvsdgModule, outputFile, statisticsCollector);
+    PrintAsMlir(rvsdgModule, outputFile, false, statisticsCollector);
+  }
+  else if (outputFormat == tooling::JlmOptCommandLineOptions::OutputFormat::MlirBytecode)
+  {
+    PrintAsMlir(rvsdgModule, outputFile, true, statisticsCollector);
   }
   else if (outputFormat == tooling::JlmOptCommandLineOptions::OutputFormat::Tree)
   {
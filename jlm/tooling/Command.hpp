@@ -341,7 +341,16 @@ class JlmOptCommand final : public Command
 public:
   ~JlmOptCommand() override;
 
-  JlmOptCommand(std::string programName, const JlmOptCommandLineOptions & commandLineOptions);
+  /**
+   * @param programName The name of the jlm-opt program.
+   * @param commandLineOptions The jlm-opt command line options.
+   * @param serverSocket The socket of a running jlm-opt server that processes the command. The
+   * command is processed within the current process if the path is empty.
+   */
+  JlmOptCommand(
+      std::string programName,
+      const JlmOptCommandLineOptions & commandLineOptions,
+      util::filepath serverSocket = util::filepath(""));
 
   [[nodiscard]] std::string
   ToString() const override;
@@ -353,10 +362,13 @@ public:
   Create(
       CommandGraph & commandGraph,
       std::string programName,
-      const JlmOptCommandLineOptions & commandLineOptions)
+      const JlmOptCommandLineOptions & commandLineOptions,
+      util::filepath serverSocket = util::filepath(""))
   {
-    auto command =
-        std::make_unique<JlmOptCommand>(std::move(programName), std::move(commandLineOptions));
+    auto command = std::make_unique<JlmOptCommand>(
+        std::move(programName),
+        std::move(commandLineOptions),
+        std::move(serverSocket));
     return CommandGraph::Node::Create(commandGraph, std::move(command));
   }
 
@@ -366,6 +378,12 @@ public:
     return CommandLineOptions_;
   }
 
+  [[nodiscard]] const util::filepath &
+  GetServerSocket() const noexcept
+  {
+    return ServerSocket_;
+  }
+
   static void
   PrintRvsdgModule(
       llvm::RvsdgModule & rvsdgModule,
@@ -410,6 +428,7 @@ private:
   PrintAsMlir(
       const llvm::RvsdgModule & rvsdgModule,
       const util::filepath & outputFile,
+      bool printBytecode,
       util::StatisticsCollector & statisticsCollector);
 
   static void
@@ -432,6 +451,7 @@ private:
 
   std::string ProgramName_;
   JlmOptCommandLineOptions CommandLineOptions_;
+  util::filepath ServerSocket_;
   std::unordered_map<JlmOptCommandLineOptions::OptimizationId, std::unique_ptr<llvm::optimization>>
       Optimizations_ = {};
 };
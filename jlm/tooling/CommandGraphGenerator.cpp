@@ -145,8 +145,11 @@ JlcCommandGraphGenerator::GenerateCommandGraph(const JlcCommandLineOptions & com
           jlm::llvm::RvsdgTreePrinter::Configuration(tempDirectory, {}),
           commandLineOptions.JlmOptOptimizations_);
 
-      auto & jlmOptCommandNode =
-          JlmOptCommand::Create(*commandGraph, "jlm-opt", std::move(jlmOptCommandLineOptions));
+      auto & jlmOptCommandNode = JlmOptCommand::Create(
+          *commandGraph,
+          "jlm-opt",
+          std::move(jlmOptCommandLineOptions),
+          commandLineOptions.JlmOptServerSocket_);
       lastNode->AddEdge(jlmOptCommandNode);
       lastNode = &jlmOptCommandNode;
     }
@@ -21,6 +21,7 @@
 #include <jlm/tooling/CommandLine.hpp>
 
 #include <llvm/Support/CommandLine.h>
+#include <llvm/Support/raw_ostream.h>
 
 #include <unordered_map>
 
@@ -85,6 +86,7 @@ JlcCommandLineOptions::Reset() noexcept
   IncludePaths_.clear();
   Flags_.clear();
   JlmOptOptimizations_.clear();
+  JlmOptServerSocket_ = util::filepath("");
 
   Compilations_.clear();
 }
@@ -97,6 +99,55 @@ JlmOptCommandLineOptions::Reset() noexcept
   OutputFormat_ = OutputFormat::Llvm;
   StatisticsCollectorSettings_ = util::StatisticsCollectorSettings();
   OptimizationIds_.clear();
+  ServerSocket_ = util::filepath("");
+  NumServerWorkers_ = 0;
+}
+
+std::vector<std::string>
+JlmOptCommandLineOptions::ToCommandLineArguments() const
+{
+  using Annotation = llvm::RvsdgTreePrinter::Configuration::Annotation;
+  static std::unordered_map<Annotation, const char *> annotationArguments(
+      { { Annotation::NumRvsdgNodes, "NumRvsdgNodes" },
+        { Annotation::NumMemoryStateInputsOutputs, "NumMemoryStateInputsOutputs" } });
+
+  std::vector<std::string> arguments;
+  if (InputFormat_ != InputFormat::Llvm)
+    arguments.push_back("--input-format=" + std::string(ToCommandLineArgument(InputFormat_)));
+
+  arguments.push_back("--output-format=" + std::string(ToCommandLineArgument(OutputFormat_)));
+
+  for (auto optimizationId : OptimizationIds_)
+    arguments.push_back("--" + std::string(ToCommandLineArgument(optimizationId)));
+
+  auto statisticsDirectory = StatisticsCollectorSettings_.GetFilePath().path();
+  if (!statisticsDirectory.empty())
+  {
+    arguments.push_back("-s");
+    arguments.push_back(statisticsDirectory);
+  }
+
+  for (auto statisticsId : StatisticsCollectorSettings_.GetDemandedStatistics().Items())
+    arguments.push_back("--" + std::string(ToCommandLineArgument(statisticsId)));
+
+  std::string annotations;
+  for (auto annotation : RvsdgTreePrinterConfiguration_.RequiredAnnotations().Items())
+  {
+    JLM_ASSERT(annotationArguments.find(annotation) != annotationArguments.end());
+    annotations += (annotations.empty() ? "" : ",") + std::string(annotationArguments[annotation]);
+  }
+  if (!annotations.empty())
+    arguments.push_back("--annotations=" + annotations);
+
+  if (!OutputFile_.to_str().empty())
+  {
+    arguments.push_back("-o");
+    arguments.push_back(OutputFile_.to_str());
+  }
+
+  arguments.push_back(InputFile_.to_str());
+
+  return arguments;
 }
 
 JlmOptCommandLineOptions::OptimizationId
@@ -117,15 +168,22 @@ JlmOptCommandLineOptions::FromCommandLineArgumentToOptimizationId(
         { OptimizationCommandLineArgument::DeadNodeElimination_,
           OptimizationId::DeadNodeElimination },
         { OptimizationCommandLineArgument::FunctionInlining_, OptimizationId::FunctionInlining },
+        { OptimizationCommandLineArgument::GammaMerging_, OptimizationId::GammaMerging },
+        { OptimizationCommandLineArgument::InvariantLoadHoisting_,
+          OptimizationId::InvariantLoadHoisting },
         { OptimizationCommandLineArgument::InvariantValueRedirection_,
           OptimizationId::InvariantValueRedirection },
         { OptimizationCommandLineArgument::NodePushOut_, OptimizationId::NodePushOut },
         { OptimizationCommandLineArgument::NodePullIn_, OptimizationId::NodePullIn },
         { OptimizationCommandLineArgument::NodeReduction_, OptimizationId::NodeReduction },
         { OptimizationCommandLineArgument::RvsdgTreePrinter_, OptimizationId::RvsdgTreePrinter },
+        { OptimizationCommandLineArgument::TailRecursionElimination_,
+          OptimizationId::TailRecursionElimination },
         { OptimizationCommandLineArgument::ThetaGammaInversion_,
           OptimizationId::ThetaGammaInversion },
-        { OptimizationCommandLineArgument::LoopUnrolling_, OptimizationId::LoopUnrolling } });
+        { OptimizationCommandLineArgument::LoopFusion_, OptimizationId::LoopFusion },
+        { OptimizationCommandLineArgument::LoopUnrolling_, OptimizationId::LoopUnrolling },
+        { OptimizationCommandLineArgument::LoopUnswitching_, OptimizationId::LoopUnswitching } });
 
   if (map.find(commandLineArgument) != map.end())
     return map[commandLineArgument];
@@ -150,13 +208,20 @@ JlmOptCommandLineOptions::ToCommandLineArgument(OptimizationId optimizationId)
         { OptimizationId::DeadNodeElimination,
           OptimizationCommandLineArgument::DeadNodeElimination_ },
         { OptimizationId::FunctionInlining, OptimizationCommandLineArgument::FunctionInlining_ },
+        { OptimizationId::GammaMerging, OptimizationCommandLineArgument::GammaMerging_ },
+        { OptimizationId::InvariantLoadHoisting,
+          OptimizationCommandLineArgument::InvariantLoadHoisting_ },
         { OptimizationId::InvariantValueRedirection,
           OptimizationCommandLineArgument::InvariantValueRedirection_ },
+        { OptimizationId::LoopFusion, OptimizationCommandLineArgument::LoopFusion_ },
         { OptimizationId::LoopUnrolling, OptimizationCommandLineArgument::LoopUnrolling_ },
+        { OptimizationId::LoopUnswitching, OptimizationCommandLineArgument::LoopUnswitching_ },
         { OptimizationId::NodePullIn, OptimizationCommandLineArgument::NodePullIn_ },
         { OptimizationId::NodePushOut, OptimizationCommandLineArgument::NodePushOut_ },
         { OptimizationId::NodeReduction, OptimizationCommandLineArgument::NodeReduction_ },
         { OptimizationId::RvsdgTreePrinter, OptimizationCommandLineArgument::RvsdgTreePrinter_ },
+        { OptimizationId::TailRecursionElimination,
+          OptimizationCommandLineArgument::TailRecursionElimination_ },
         { OptimizationId::ThetaGammaInversion,
           OptimizationCommandLineArgument::ThetaGammaInversion_ } });
 
@@ -221,15 +286,23 @@ JlmOptCommandLineOptions::GetStatisticsIdCommandLineArguments()
       "print-agnostic-memory-node-provisioning" },
     { util::Statistics::Id::AndersenAnalysis, "print-andersen-analysis" },
     { util::Statistics::Id::Annotation, "print-annotation-time" },
+    { util::Statistics::Id::BitwidthMinimization, "print-bitwidth-minimization" },
     { util::Statistics::Id::CommonNodeElimination, "print-cne-stat" },
     { util::Statistics::Id::ControlFlowRecovery, "print-cfr-time" },
     { util::Statistics::Id::DataNodeToDelta, "printDataNodeToDelta" },
     { util::Statistics::Id::DeadNodeElimination, "print-dne-stat" },
     { util::Statistics::Id::FunctionInlining, "print-iln-stat" },
+    { util::Statistics::Id::GammaMerging, "print-gamma-merging" },
+    { util::Statistics::Id::InvariantLoadHoisting, "print-invariant-load-hoisting" },
     { util::Statistics::Id::InvariantValueRedirection, "printInvariantValueRedirection" },
+    { util::Statistics::Id::JlmToMlirConversion, "print-jlm-mlir-conversion" },
     { util::Statistics::Id::JlmToRvsdgConversion, "print-jlm-rvsdg-conversion" },
+    { util::Statistics::Id::LoopFusion, "print-loop-fusion" },
     { util::Statistics::Id::LoopUnrolling, "print-unroll-stat" },
+    { util::Statistics::Id::LoopUnswitching, "print-loop-unswitching" },
+    { util::Statistics::Id::MemoryFootprint, "print-memory-footprint" },
     { util::Statistics::Id::MemoryStateEncoder, "print-basicencoder-encoding" },
+    { util::Statistics::Id::MlirToJlmConversion, "print-mlir-jlm-conversion" },
     { util::Statistics::Id::PullNodes, "print-pull-stat" },
     { util::Statistics::Id::PushNodes, "print-push-stat" },
     { util::Statistics::Id::ReduceNodes, "print-reduction-stat" },
@@ -239,8 +312,11 @@ JlmOptCommandLineOptions::GetStatisticsIdCommandLineArguments()
     { util::Statistics::Id::RvsdgOptimization, "print-rvsdg-optimization" },
     { util::Statistics::Id::RvsdgTreePrinter, "print-rvsdg-tree" },
     { util::Statistics::Id::SteensgaardAnalysis, "print-steensgaard-analysis" },
+    { util::Statistics::Id::TailRecursionElimination, "print-tail-recursion-elimination" },
     { util::Statistics::Id::ThetaGammaInversion, "print-ivt-stat" },
-    { util::Statistics::Id::TopDownMemoryNodeEliminator, "TopDownMemoryNodeEliminator" }
+    { util::Statistics::Id::TopDownMemoryNodeEliminator, "TopDownMemoryNodeEliminator" },
+    { util::Statistics::Id::UnreachableFunctionElimination,
+      "print-unreachable-function-elimination" }
   };
 
   auto firstIndex = static_cast<size_t>(util::Statistics::Id::FirstEnumValue);
@@ -253,9 +329,13 @@ const std::unordered_map<JlmOptCommandLineOptions::OutputFormat, std::string_vie
 JlmOptCommandLineOptions::GetOutputFormatCommandLineArguments()
 {
   static std::unordered_map<OutputFormat, std::string_view> mapping = {
-    { OutputFormat::Ascii, "ascii" }, { OutputFormat::Dot, "dot" },
-    { OutputFormat::Llvm, "llvm" },   { OutputFormat::Mlir, "mlir" },
-    { OutputFormat::Tree, "tree" },   { OutputFormat::Xml, "xml" }
+    { OutputFormat::Ascii, "ascii" },
+    { OutputFormat::Dot, "dot" },
+    { OutputFormat::Llvm, "llvm" },
+    { OutputFormat::Mlir, "mlir" },
+    { OutputFormat::MlirBytecode, "mlirbc" },
+    { OutputFormat::Tree, "tree" },
+    { OutputFormat::Xml, "xml" }
   };
 
   auto firstIndex = static_cast<size_t>(OutputFormat::FirstEnumValue);
@@ -272,6 +352,21 @@ JlmHlsCommandLineOptions::Reset() noexcept
   OutputFormat_ = OutputFormat::Firrtl;
   HlsFunction_ = "";
   ExtractHlsFunction_ = false;
+  GenerateLoopReport_ = false;
+  GenerateResourceReport_ = false;
+  GenerateBitwidthReport_ = false;
+  GenerateBufferReport_ = false;
+  AddPerformanceCounters_ = false;
+  CoalesceLoads_ = false;
+  MinimizeBitwidths_ = false;
+  ShareResources_ = false;
+  PartitionLocalMemories_ = false;
+  MaxUnrollFactor_ = 1;
+  TargetII_ = 1;
+  MemoryModel_ = MemoryModel::FixedLatency;
+  MemoryLatency_ = 10;
+  MemoryBandwidth_ = 8;
+  MemoryMaxOutstanding_ = 8;
 }
 
 void
@@ -438,6 +533,11 @@ JlcCommandLineParser::ParseCommandLineArguments(int argc, const char * const * a
       cl::desc("jlm-opt optimization. Run 'jlm-opt -help' for viable options."),
       cl::value_desc("jlmopt"));
 
+  cl::opt<std::string> jlmOptServerSocket(
+      "jlm-opt-server",
+      cl::desc("Send the jlm-opt compile jobs to the jlm-opt server listening on <socket>."),
+      cl::value_desc("socket"));
+
   cl::opt<bool> verbose(
       "v",
       cl::ValueDisallowed,
@@ -503,15 +603,27 @@ JlcCommandLineParser::ParseCommandLineArguments(int argc, const char * const * a
           CreateStatisticsOption(
               util::Statistics::Id::FunctionInlining,
               "Collect function inlining pass statistics."),
+          CreateStatisticsOption(
+              util::Statistics::Id::GammaMerging,
+              "Collect gamma merging pass statistics."),
+          CreateStatisticsOption(
+              util::Statistics::Id::InvariantLoadHoisting,
+              "Collect invariant load hoisting pass statistics."),
           CreateStatisticsOption(
               util::Statistics::Id::InvariantValueRedirection,
               "Collect invariant value redirection pass statistics."),
           CreateStatisticsOption(
               util::Statistics::Id::JlmToRvsdgConversion,
               "Collect Jlm to RVSDG conversion pass statistics."),
+          CreateStatisticsOption(
+              util::Statistics::Id::LoopFusion,
+              "Collect loop fusion pass statistics."),
           CreateStatisticsOption(
               util::Statistics::Id::LoopUnrolling,
               "Collect loop unrolling pass statistics."),
+          CreateStatisticsOption(
+              util::Statistics::Id::LoopUnswitching,
+              "Collect loop unswitching pass statistics."),
           CreateStatisticsOption(
               util::Statistics::Id::PullNodes,
               "Collect node pull pass statistics."),
@@ -539,6 +651,9 @@ JlcCommandLineParser::ParseCommandLineArguments(int argc, const char * const * a
           CreateStatisticsOption(
               util::Statistics::Id::SteensgaardAnalysis,
               "Collect Steensgaard alias analysis pass statistics."),
+          CreateStatisticsOption(
+              util::Statistics::Id::TailRecursionElimination,
+              "Collect tail recursion elimination pass statistics."),
           CreateStatisticsOption(
               util::Statistics::Id::ThetaGammaInversion,
               "Collect theta-gamma inversion pass statistics.")),
@@ -614,6 +729,7 @@ JlcCommandLineParser::ParseCommandLineArguments(int argc, const char * const * a
   CommandLineOptions_.JlmOptOptimizations_ = jlmOptOptimizations;
   CommandLineOptions_.JlmOptPassStatistics_ = util::HashSet<util::Statistics::Id>(
       { jlmOptPassStatistics.begin(), jlmOptPassStatistics.end() });
+  CommandLineOptions_.JlmOptServerSocket_ = util::filepath(jlmOptServerSocket);
   CommandLineOptions_.Verbose_ = verbose;
   CommandLineOptions_.Rdynamic_ = rDynamic;
   CommandLineOptions_.Suppress_ = suppress;
@@ -724,15 +840,36 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, const char * const
           CreateStatisticsOption(
               util::Statistics::Id::FunctionInlining,
               "Write function inlining statistics to file."),
+          CreateStatisticsOption(
+              util::Statistics::Id::GammaMerging,
+              "Write gamma merging statistics to file."),
+          CreateStatisticsOption(
+              util::Statistics::Id::InvariantLoadHoisting,
+              "Write invariant load hoisting statistics to file."),
           CreateStatisticsOption(
               util::Statistics::Id::InvariantValueRedirection,
               "Write invariant value redirection statistics to file."),
+          CreateStatisticsOption(
+              util::Statistics::Id::JlmToMlirConversion,
+              "Write RVSDG to MLIR conversion statistics to file."),
           CreateStatisticsOption(
               util::Statistics::Id::JlmToRvsdgConversion,
               "Write Jlm to RVSDG conversion statistics to file."),
+          CreateStatisticsOption(
+              util::Statistics::Id::LoopFusion,
+              "Write loop fusion statistics to file."),
           CreateStatisticsOption(
               util::Statistics::Id::LoopUnrolling,
               "Write loop unrolling statistics to file."),
+          CreateStatisticsOption(
+              util::Statistics::Id::LoopUnswitching,
+              "Write loop unswitching statistics to file."),
+          CreateStatisticsOption(
+              util::Statistics::Id::MemoryFootprint,
+              "Add the memory footprint of the RVSDG after every pass to its statistics."),
+          CreateStatisticsOption(
+              util::Statistics::Id::MlirToJlmConversion,
+              "Write MLIR to RVSDG conversion statistics to file."),
           CreateStatisticsOption(
               util::Statistics::Id::PullNodes,
               "Write node pull statistics to file."),
@@ -760,9 +897,15 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, const char * const
           CreateStatisticsOption(
               util::Statistics::Id::SteensgaardAnalysis,
               "Write Steensgaard analysis statistics to file."),
+          CreateStatisticsOption(
+              util::Statistics::Id::TailRecursionElimination,
+              "Write tail recursion elimination statistics to file."),
           CreateStatisticsOption(
               util::Statistics::Id::ThetaGammaInversion,
-              "Write theta-gamma inversion statistics to file.")),
+              "Write theta-gamma inversion statistics to file."),
+          CreateStatisticsOption(
+              util::Statistics::Id::UnreachableFunctionElimination,
+              "Write unreachable function elimination statistics to file.")),
       cl::desc("Write statistics"));
 
 #ifdef ENABLE_MLIR
@@ -780,7 +923,7 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, const char * const
           ::clEnumValN(
               mlirInputFormat,
               JlmOptCommandLineOptions::ToCommandLineArgument(mlirInputFormat),
-              "Input MLIR")),
+              "Input MLIR, either textual or bytecode")),
       cl::init(llvmInputFormat));
 #else
   auto inputFormat = JlmOptCommandLineOptions::InputFormat::Llvm;
@@ -797,6 +940,9 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, const char * const
               "Output LLVM IR [default]"),
 #ifdef ENABLE_MLIR
           CreateOutputFormatOption(JlmOptCommandLineOptions::OutputFormat::Mlir, "Output MLIR"),
+          CreateOutputFormatOption(
+              JlmOptCommandLineOptions::OutputFormat::MlirBytecode,
+              "Output MLIR bytecode"),
 #endif
           CreateOutputFormatOption(
               JlmOptCommandLineOptions::OutputFormat::Tree,
@@ -812,14 +958,20 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, const char * const
   auto commonNodeElimination = JlmOptCommandLineOptions::OptimizationId::CommonNodeElimination;
   auto deadNodeElimination = JlmOptCommandLineOptions::OptimizationId::DeadNodeElimination;
   auto functionInlining = JlmOptCommandLineOptions::OptimizationId::FunctionInlining;
+  auto gammaMerging = JlmOptCommandLineOptions::OptimizationId::GammaMerging;
+  auto invariantLoadHoisting = JlmOptCommandLineOptions::OptimizationId::InvariantLoadHoisting;
   auto invariantValueRedirection =
       JlmOptCommandLineOptions::OptimizationId::InvariantValueRedirection;
   auto nodePushOut = JlmOptCommandLineOptions::OptimizationId::NodePushOut;
   auto nodePullIn = JlmOptCommandLineOptions::OptimizationId::NodePullIn;
   auto nodeReduction = JlmOptCommandLineOptions::OptimizationId::NodeReduction;
   auto rvsdgTreePrinter = JlmOptCommandLineOptions::OptimizationId::RvsdgTreePrinter;
+  auto tailRecursionElimination =
+      JlmOptCommandLineOptions::OptimizationId::TailRecursionElimination;
   auto thetaGammaInversion = JlmOptCommandLineOptions::OptimizationId::ThetaGammaInversion;
+  auto loopFusion = JlmOptCommandLineOptions::OptimizationId::LoopFusion;
   auto loopUnrolling = JlmOptCommandLineOptions::OptimizationId::LoopUnrolling;
+  auto loopUnswitching = JlmOptCommandLineOptions::OptimizationId::LoopUnswitching;
 
   cl::list<JlmOptCommandLineOptions::OptimizationId> optimizationIds(
       cl::values(
@@ -851,6 +1003,14 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, const char * const
               functionInlining,
               JlmOptCommandLineOptions::ToCommandLineArgument(functionInlining),
               "Function Inlining"),
+          ::clEnumValN(
+              gammaMerging,
+              JlmOptCommandLineOptions::ToCommandLineArgument(gammaMerging),
+              "Gamma Merging"),
+          ::clEnumValN(
+              invariantLoadHoisting,
+              JlmOptCommandLineOptions::ToCommandLineArgument(invariantLoadHoisting),
+              "Invariant Load Hoisting"),
           ::clEnumValN(
               invariantValueRedirection,
               JlmOptCommandLineOptions::ToCommandLineArgument(invariantValueRedirection),
@@ -871,14 +1031,26 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, const char * const
               rvsdgTreePrinter,
               JlmOptCommandLineOptions::ToCommandLineArgument(rvsdgTreePrinter),
               "Rvsdg Tree Printer"),
+          ::clEnumValN(
+              tailRecursionElimination,
+              JlmOptCommandLineOptions::ToCommandLineArgument(tailRecursionElimination),
+              "Tail Recursion Elimination"),
           ::clEnumValN(
               thetaGammaInversion,
               JlmOptCommandLineOptions::ToCommandLineArgument(thetaGammaInversion),
               "Theta-Gamma Inversion"),
+          ::clEnumValN(
+              loopFusion,
+              JlmOptCommandLineOptions::ToCommandLineArgument(loopFusion),
+              "Loop Fusion"),
           ::clEnumValN(
               loopUnrolling,
               JlmOptCommandLineOptions::ToCommandLineArgument(loopUnrolling),
-              "Loop Unrolling")),
+              "Loop Unrolling"),
+          ::clEnumValN(
+              loopUnswitching,
+              JlmOptCommandLineOptions::ToCommandLineArgument(loopUnswitching),
+              "Loop Unswitching")),
       cl::desc("Perform optimization"));
 
   cl::list<llvm::RvsdgTreePrinter::Configuration::Annotation> rvsdgTreePrinterAnnotations(
@@ -894,7 +1066,25 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, const char * const
       cl::CommaSeparated,
       cl::desc("Comma separated list of RVSDG tree printer annotations"));
 
-  cl::ParseCommandLineOptions(argc, argv);
+  cl::opt<std::string> serverSocket(
+      "server",
+      cl::init(""),
+      cl::desc("Run as a server that accepts compile jobs on the Unix domain socket <socket>."),
+      cl::value_desc("socket"));
+
+  cl::opt<unsigned> numServerWorkers(
+      "server-workers",
+      cl::init(0),
+      cl::desc("Number of worker threads in server mode. Default is the number of hardware "
+               "threads."),
+      cl::value_desc("#"));
+
+  // Report errors instead of terminating the process, as the parser is also used for the jobs
+  // of a jlm-opt server
+  std::string errorMessage;
+  raw_string_ostream errorStream(errorMessage);
+  if (!cl::ParseCommandLineOptions(argc, argv, "", &errorStream))
+    throw CommandLineParser::Exception(errorStream.str());
 
   jlm::util::filepath statisticsDirectoryFilePath(statisticDirectory);
   if (!statisticsDirectoryFilePath.Exists() && !statisticsDirectoryFilePath.IsDirectory())
@@ -929,6 +1119,7 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, const char * const
           statisticsDirectoryFilePath,
           std::move(demandedAnnotations)),
       std::move(optimizationIds));
+  CommandLineOptions_->SetServerConfiguration(util::filepath(serverSocket), numServerWorkers);
 
   return *CommandLineOptions_;
 }
@@ -976,6 +1167,90 @@ JlmHlsCommandLineParser::ParseCommandLineArguments(int argc, const char * const
       cl::Prefix,
       cl::desc("Extracts function specified by hls-function"));
 
+  cl::opt<bool> generateLoopReport(
+      "loop-report",
+      cl::desc("Write the initiation interval and critical recurrence of every loop"));
+
+  cl::opt<bool> generateResourceReport(
+      "resource-report",
+      cl::desc("Write the estimated area and latency of expensive operators"));
+
+  cl::opt<bool> generateBitwidthReport(
+      "bitwidth-report",
+      cl::desc("Write the number of narrowed operations and the datapath bits saved"));
+
+  cl::opt<bool> generateBufferReport(
+      "buffer-report",
+      cl::desc("Write the number and total capacity of the inserted buffers"));
+
+  cl::opt<bool> addPerformanceCounters(
+      "perf-counters",
+      cl::desc("Instrument the circuit with loop iteration and stall counters"));
+
+  cl::opt<bool> coalesceLoads(
+      "burst-loads",
+      cl::desc("Coalesce unit-stride loads in loops into burst requests (dot output only)"));
+
+  cl::opt<bool> minimizeBitwidths(
+      "bitwidth-minimization",
+      cl::desc("Narrow datapaths to the value ranges of their operations"));
+
+  cl::opt<bool> shareResources(
+      "resource-sharing",
+      cl::desc("Share expensive operators across exclusive branches"));
+
+  cl::opt<bool> partitionLocalMemories(
+      "partition-memories",
+      cl::desc("Partition local memories into banks that can be accessed in parallel"));
+
+  cl::opt<unsigned> maxUnrollFactor(
+      "hls-unroll",
+      cl::init(1),
+      cl::desc("Unroll innermost loops by at most the given factor [default: 1, no unrolling]"),
+      cl::value_desc("factor"));
+
+  cl::opt<unsigned> targetII(
+      "target-ii",
+      cl::init(1),
+      cl::desc("Initiation interval the buffers are sized for [default: 1]"),
+      cl::value_desc("cycles"));
+
+  cl::opt<JlmHlsCommandLineOptions::MemoryModel> memoryModel(
+      "memory-model",
+      cl::values(
+          ::clEnumValN(
+              JlmHlsCommandLineOptions::MemoryModel::FixedLatency,
+              "fixed",
+              "Every request completes after a fixed latency [default]"),
+          ::clEnumValN(
+              JlmHlsCommandLineOptions::MemoryModel::Bandwidth,
+              "bandwidth",
+              "Fixed latency with limited bandwidth and outstanding requests"),
+          ::clEnumValN(
+              JlmHlsCommandLineOptions::MemoryModel::Dram,
+              "dram",
+              "Banked memory with row buffers")),
+      cl::init(JlmHlsCommandLineOptions::MemoryModel::FixedLatency),
+      cl::desc("Select the memory model of the Verilator harness"));
+
+  cl::opt<unsigned> memoryLatency(
+      "memory-latency",
+      cl::init(10),
+      cl::desc("Latency of a memory request in cycles, used by the harness and buffer sizing"),
+      cl::value_desc("cycles"));
+
+  cl::opt<unsigned> memoryBandwidth(
+      "memory-bandwidth",
+      cl::init(8),
+      cl::desc("Bytes per cycle transferred by a memory port"),
+      cl::value_desc("bytes"));
+
+  cl::opt<unsigned> memoryMaxOutstanding(
+      "memory-outstanding",
+      cl::init(8),
+      cl::desc("Maximum number of outstanding requests of a memory port"),
+      cl::value_desc("requests"));
+
   cl::opt<JlmHlsCommandLineOptions::OutputFormat> format(
       cl::values(
           ::clEnumValN(
@@ -994,10 +1269,38 @@ JlmHlsCommandLineParser::ParseCommandLineArguments(int argc, const char * const
     throw jlm::util::error(
         "jlm-hls: --hls-function is not specified.\n         which is required for --extract\n");
 
+  if (coalesceLoads && format == JlmHlsCommandLineOptions::OutputFormat::Firrtl)
+    throw jlm::util::error("jlm-hls: --burst-loads is not supported for FIRRTL output.\n");
+
+  if (maxUnrollFactor == 0)
+    throw jlm::util::error("jlm-hls: --hls-unroll must be greater than zero.\n");
+
+  if (targetII == 0)
+    throw jlm::util::error("jlm-hls: --target-ii must be greater than zero.\n");
+
+  if (memoryBandwidth == 0 || memoryMaxOutstanding == 0)
+    throw jlm::util::error(
+        "jlm-hls: --memory-bandwidth and --memory-outstanding must be greater than zero.\n");
+
   CommandLineOptions_.InputFile_ = inputFile;
   CommandLineOptions_.HlsFunction_ = std::move(hlsFunction);
   CommandLineOptions_.OutputFiles_ = outputFolder;
   CommandLineOptions_.ExtractHlsFunction_ = extractHlsFunction;
+  CommandLineOptions_.GenerateLoopReport_ = generateLoopReport;
+  CommandLineOptions_.GenerateResourceReport_ = generateResourceReport;
+  CommandLineOptions_.GenerateBitwidthReport_ = generateBitwidthReport;
+  CommandLineOptions_.GenerateBufferReport_ = generateBufferReport;
+  CommandLineOptions_.AddPerformanceCounters_ = addPerformanceCounters;
+  CommandLineOptions_.CoalesceLoads_ = coalesceLoads;
+  CommandLineOptions_.MinimizeBitwidths_ = minimizeBitwidths;
+  CommandLineOptions_.ShareResources_ = shareResources;
+  CommandLineOptions_.PartitionLocalMemories_ = partitionLocalMemories;
+  CommandLineOptions_.MaxUnrollFactor_ = maxUnrollFactor;
+  CommandLineOptions_.TargetII_ = targetII;
+  CommandLineOptions_.MemoryModel_ = memoryModel;
+  CommandLineOptions_.MemoryLatency_ = memoryLatency;
+  CommandLineOptions_.MemoryBandwidth_ = memoryBandwidth;
+  CommandLineOptions_.MemoryMaxOutstanding_ = memoryMaxOutstanding;
   CommandLineOptions_.OutputFormat_ = format;
 
   return CommandLineOptions_;
@@ -56,6 +56,7 @@ public:
     Dot,
     Llvm,
     Mlir,
+    MlirBytecode,
     Tree,
     Xml,
 
@@ -73,12 +74,17 @@ public:
     CommonNodeElimination,
     DeadNodeElimination,
     FunctionInlining,
+    GammaMerging,
+    InvariantLoadHoisting,
     InvariantValueRedirection,
+    LoopFusion,
     LoopUnrolling,
+    LoopUnswitching,
     NodePullIn,
     NodePushOut,
     NodeReduction,
     RvsdgTreePrinter,
+    TailRecursionElimination,
     ThetaGammaInversion,
 
     LastEnumValue // must always be the last enum value, used for iteration
@@ -146,6 +152,42 @@ public:
     return RvsdgTreePrinterConfiguration_;
   }
 
+  /**
+   * The Unix domain socket on which jlm-opt accepts compile jobs when it runs as a server. The
+   * path is empty if jlm-opt does not run as a server.
+   */
+  [[nodiscard]] const util::filepath &
+  GetServerSocket() const noexcept
+  {
+    return ServerSocket_;
+  }
+
+  /**
+   * The number of worker threads that process compile jobs when jlm-opt runs as a server. Zero
+   * selects the number of hardware threads.
+   */
+  [[nodiscard]] size_t
+  GetNumServerWorkers() const noexcept
+  {
+    return NumServerWorkers_;
+  }
+
+  void
+  SetServerConfiguration(util::filepath serverSocket, size_t numServerWorkers)
+  {
+    ServerSocket_ = std::move(serverSocket);
+    NumServerWorkers_ = numServerWorkers;
+  }
+
+  /**
+   * Converts the options back to command line arguments, such that parsing the arguments with
+   * JlmOptCommandLineParser yields the same options. The server configuration is not included.
+   *
+   * @return The command line arguments, excluding the program name.
+   */
+  [[nodiscard]] std::vector<std::string>
+  ToCommandLineArguments() const;
+
   static OptimizationId
   FromCommandLineArgumentToOptimizationId(const std::string & commandLineArgument);
 
@@ -192,6 +234,8 @@ private:
   util::StatisticsCollectorSettings StatisticsCollectorSettings_;
   std::vector<OptimizationId> OptimizationIds_;
   llvm::RvsdgTreePrinter::Configuration RvsdgTreePrinterConfiguration_;
+  util::filepath ServerSocket_ = util::filepath("");
+  size_t NumServerWorkers_ = 0;
 
   struct OptimizationCommandLineArgument
   {
@@ -202,13 +246,18 @@ private:
     inline static const char * CommonNodeElimination_ = "CommonNodeElimination";
     inline static const char * DeadNodeElimination_ = "DeadNodeElimination";
     inline static const char * FunctionInlining_ = "FunctionInlining";
+    inline static const char * GammaMerging_ = "GammaMerging";
+    inline static const char * InvariantLoadHoisting_ = "InvariantLoadHoisting";
     inline static const char * InvariantValueRedirection_ = "InvariantValueRedirection";
     inline static const char * NodePullIn_ = "NodePullIn";
     inline static const char * NodePushOut_ = "NodePushOut";
     inline static const char * ThetaGammaInversion_ = "ThetaGammaInversion";
+    inline static const char * LoopFusion_ = "LoopFusion";
     inline static const char * LoopUnrolling_ = "LoopUnrolling";
+    inline static const char * LoopUnswitching_ = "LoopUnswitching";
     inline static const char * NodeReduction_ = "NodeReduction";
     inline static const char * RvsdgTreePrinter_ = "RvsdgTreePrinter";
+    inline static const char * TailRecursionElimination_ = "TailRecursionElimination";
   };
 
   static const util::BijectiveMap<util::Statistics::Id, std::string_view> &
@@ -255,7 +304,8 @@ public:
         Md_(false),
         OptimizationLevel_(OptimizationLevel::O0),
         LanguageStandard_(LanguageStandard::None),
-        OutputFile_("a.out")
+        OutputFile_("a.out"),
+        JlmOptServerSocket_("")
   {}
 
   static std::string
@@ -289,6 +339,10 @@ public:
   std::vector<JlmOptCommandLineOptions::OptimizationId> JlmOptOptimizations_;
   util::HashSet<util::Statistics::Id> JlmOptPassStatistics_;
 
+  // The socket of a running jlm-opt server that processes the jlm-opt compile jobs. The jobs
+  // are processed within jlc if the path is empty.
+  util::filepath JlmOptServerSocket_;
+
   std::vector<Compilation> Compilations_;
 };
 
@@ -391,11 +445,36 @@ public:
     Dot
   };
 
+  /**
+   * Memory timing model of the generated Verilator harness, see MemoryModelConfiguration.
+   */
+  enum class MemoryModel
+  {
+    FixedLatency,
+    Bandwidth,
+    Dram
+  };
+
   JlmHlsCommandLineOptions()
       : InputFile_(""),
         OutputFiles_(""),
         OutputFormat_(OutputFormat::Firrtl),
-        ExtractHlsFunction_(false)
+        ExtractHlsFunction_(false),
+        GenerateLoopReport_(false),
+        GenerateResourceReport_(false),
+        GenerateBitwidthReport_(false),
+        GenerateBufferReport_(false),
+        AddPerformanceCounters_(false),
+        CoalesceLoads_(false),
+        MinimizeBitwidths_(false),
+        ShareResources_(false),
+        PartitionLocalMemories_(false),
+        MaxUnrollFactor_(1),
+        TargetII_(1),
+        MemoryModel_(MemoryModel::FixedLatency),
+        MemoryLatency_(10),
+        MemoryBandwidth_(8),
+        MemoryMaxOutstanding_(8)
   {}
 
   void
@@ -406,6 +485,21 @@ public:
   OutputFormat OutputFormat_;
   std::string HlsFunction_;
   bool ExtractHlsFunction_;
+  bool GenerateLoopReport_;
+  bool GenerateResourceReport_;
+  bool GenerateBitwidthReport_;
+  bool GenerateBufferReport_;
+  bool AddPerformanceCounters_;
+  bool CoalesceLoads_;
+  bool MinimizeBitwidths_;
+  bool ShareResources_;
+  bool PartitionLocalMemories_;
+  size_t MaxUnrollFactor_;
+  size_t TargetII_;
+  MemoryModel MemoryModel_;
+  size_t MemoryLatency_;
+  size_t MemoryBandwidth_;
+  size_t MemoryMaxOutstanding_;
 };
 
 /**
@@ -0,0 +1,488 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/tooling/Command.hpp>
+#include <jlm/tooling/JlmOptServer.hpp>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+
+namespace jlm::tooling
+{
+
+// Bounds on the size of requests, which protect the server against malformed requests
+static const uint32_t MaxNumArguments = 1 << 16;
+static const uint32_t MaxStringLength = 1 << 20;
+
+namespace
+{
+
+/**
+ * Owns a file descriptor and closes it on destruction.
+ */
+class FileDescriptor final
+{
+public:
+  ~FileDescriptor() noexcept
+  {
+    if (Fd_ >= 0)
+      close(Fd_);
+  }
+
+  explicit FileDescriptor(int fd)
+      : Fd_(fd)
+  {}
+
+  FileDescriptor(const FileDescriptor &) = delete;
+
+  FileDescriptor(FileDescriptor && other) noexcept
+      : Fd_(other.Release())
+  {}
+
+  FileDescriptor &
+  operator=(const FileDescriptor &) = delete;
+
+  FileDescriptor &
+  operator=(FileDescriptor &&) = delete;
+
+  [[nodiscard]] int
+  Get() const noexcept
+  {
+    return Fd_;
+  }
+
+  int
+  Release() noexcept
+  {
+    auto fd = Fd_;
+    Fd_ = -1;
+    return fd;
+  }
+
+private:
+  int Fd_;
+};
+
+}
+
+static util::error
+CreateSystemError(const std::string & message)
+{
+  return util::error(message + ": " + std::strerror(errno));
+}
+
+static sockaddr_un
+CreateSocketAddress(const util::filepath & socketPath)
+{
+  sockaddr_un address{};
+  address.sun_family = AF_UNIX;
+
+  auto path = socketPath.to_str();
+  if (path.empty() || path.size() >= sizeof(address.sun_path))
+    throw util::error("Invalid jlm-opt server socket path: " + path);
+
+  std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+  return address;
+}
+
+static void
+WriteBytes(int fd, const void * data, size_t size)
+{
+  auto bytes = static_cast<const char *>(data);
+  while (size > 0)
+  {
+    // MSG_NOSIGNAL avoids that a vanished peer terminates the process with SIGPIPE
+    auto numWritten = send(fd, bytes, size, MSG_NOSIGNAL);
+    if (numWritten < 0 && errno == EINTR)
+      continue;
+    if (numWritten < 0)
+      throw CreateSystemError("Failed to write to jlm-opt server connection");
+
+    bytes += numWritten;
+    size -= numWritten;
+  }
+}
+
+static void
+ReadBytes(int fd, void * data, size_t size)
+{
+  auto bytes = static_cast<char *>(data);
+  while (size > 0)
+  {
+    auto numRead = recv(fd, bytes, size, 0);
+    if (numRead < 0 && errno == EINTR)
+      continue;
+    if (numRead < 0)
+      throw CreateSystemError("Failed to read from jlm-opt server connection");
+    if (numRead == 0)
+      throw util::error("jlm-opt server connection closed unexpectedly");
+
+    bytes += numRead;
+    size -= numRead;
+  }
+}
+
+static void
+WriteUint32(int fd, uint32_t value)
+{
+  WriteBytes(fd, &value, sizeof(value));
+}
+
+static uint32_t
+ReadUint32(int fd)
+{
+  uint32_t value = 0;
+  ReadBytes(fd, &value, sizeof(value));
+  return value;
+}
+
+static void
+WriteString(int fd, const std::string & string)
+{
+  if (string.size() > MaxStringLength)
+    throw util::error("String exceeds the jlm-opt server limit");
+
+  WriteUint32(fd, string.size());
+  WriteBytes(fd, string.data(), string.size());
+}
+
+static std::string
+ReadString(int fd)
+{
+  auto length = ReadUint32(fd);
+  if (length > MaxStringLength)
+    throw util::error("String exceeds the jlm-opt server limit");
+
+  std::string string(length, '\0');
+  ReadBytes(fd, string.data(), length);
+  return string;
+}
+
+static FileDescriptor
+ConnectToServer(const util::filepath & socketPath)
+{
+  auto address = CreateSocketAddress(socketPath);
+
+  FileDescriptor connection(socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0));
+  if (connection.Get() < 0)
+    throw CreateSystemError("Failed to create socket");
+
+  if (connect(connection.Get(), reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0)
+    throw CreateSystemError("Failed to connect to jlm-opt server at " + socketPath.to_str());
+
+  return connection;
+}
+
+/**
+ * Sends a request to the server listening on \p socketPath and waits for the response.
+ *
+ * @throws util::error if the server cannot be reached or the response indicates a failure.
+ */
+static void
+SendRequest(
+    const util::filepath & socketPath,
+    uint32_t requestKind,
+    const std::vector<std::string> & arguments)
+{
+  auto connection = ConnectToServer(socketPath);
+
+  WriteUint32(connection.Get(), requestKind);
+  WriteUint32(connection.Get(), arguments.size());
+  for (auto & argument : arguments)
+    WriteString(connection.Get(), argument);
+
+  auto status = ReadUint32(connection.Get());
+  auto message = ReadString(connection.Get());
+  if (status != 0)
+    throw util::error(message);
+}
+
+static void
+SendResponse(int connection, uint32_t status, const std::string & message)
+{
+  WriteUint32(connection, status);
+  WriteString(connection, message);
+}
+
+/**
+ * Resolves all relative paths of \p commandLineOptions against the current working directory.
+ */
+static JlmOptCommandLineOptions
+MakePathsAbsolute(const JlmOptCommandLineOptions & commandLineOptions)
+{
+  auto makeAbsolute = [](const util::filepath & path)
+  {
+    if (path.to_str().empty())
+      return path;
+
+    return util::filepath(std::filesystem::absolute(path.to_str()).string());
+  };
+
+  auto & statisticsCollectorSettings = commandLineOptions.GetStatisticsCollectorSettings();
+  auto & treePrinterConfiguration = commandLineOptions.GetRvsdgTreePrinterConfiguration();
+
+  return JlmOptCommandLineOptions(
+      makeAbsolute(commandLineOptions.GetInputFile()),
+      commandLineOptions.GetInputFormat(),
+      makeAbsolute(commandLineOptions.GetOutputFile()),
+      commandLineOptions.GetOutputFormat(),
+      util::StatisticsCollectorSettings(
+          makeAbsolute(statisticsCollectorSettings.GetFilePath()),
+          statisticsCollectorSettings.GetDemandedStatistics()),
+      llvm::RvsdgTreePrinter::Configuration(
+          makeAbsolute(treePrinterConfiguration.OutputDirectory()),
+          treePrinterConfiguration.RequiredAnnotations()),
+      commandLineOptions.GetOptimizationIds());
+}
+
+/**
+ * @return True if \p argument is one of the options of LLVM's command line parser that print
+ * information and terminate the process, such as --help or --version.
+ */
+static bool
+IsTerminatingOption(const std::string & argument)
+{
+  auto name = argument.substr(0, argument.find('='));
+  name.erase(0, name.find_first_not_of('-'));
+
+  return name.compare(0, 4, "help") == 0 || name == "version" || name == "print-options"
+      || name == "print-all-options";
+}
+
+/**
+ * Parses the command line arguments of a compile job.
+ *
+ * The command line parser is built on the global option registry of LLVM, and jobs are therefore
+ * parsed one at a time.
+ *
+ * @throws util::error if the arguments are malformed or request help or version information.
+ */
+static JlmOptCommandLineOptions
+ParseJobArguments(const std::string & programName, const std::vector<std::string> & arguments)
+{
+  static std::mutex parserMutex;
+
+  for (auto & argument : arguments)
+  {
+    if (IsTerminatingOption(argument))
+      throw util::error("jlm-opt server jobs do not support " + argument + ".");
+  }
+
+  std::vector<const char *> argv({ programName.c_str() });
+  for (auto & argument : arguments)
+    argv.push_back(argument.c_str());
+
+  std::lock_guard<std::mutex> guard(parserMutex);
+  JlmOptCommandLineParser parser;
+  return parser.ParseCommandLineArguments(static_cast<int>(argv.size()), argv.data());
+}
+
+JlmOptServer::~JlmOptServer() noexcept = default;
+
+JlmOptServer::JlmOptServer(std::string programName, util::filepath socketPath, size_t numWorkers)
+    : ProgramName_(std::move(programName)),
+      SocketPath_(std::move(socketPath)),
+      NumWorkers_(numWorkers != 0 ? numWorkers : std::max(std::thread::hardware_concurrency(), 1u)),
+      ShutdownRequested_(false)
+{}
+
+void
+JlmOptServer::Run()
+{
+  auto address = CreateSocketAddress(SocketPath_);
+
+  FileDescriptor listener(socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0));
+  if (listener.Get() < 0)
+    throw CreateSystemError("Failed to create socket");
+
+  // Replace the socket of a previous server that was not shut down properly
+  unlink(SocketPath_.to_str().c_str());
+  if (bind(listener.Get(), reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0)
+    throw CreateSystemError("Failed to bind socket " + SocketPath_.to_str());
+
+  if (listen(listener.Get(), SOMAXCONN) < 0)
+    throw CreateSystemError("Failed to listen on socket " + SocketPath_.to_str());
+
+  ShutdownRequested_ = false;
+  for (size_t n = 0; n < NumWorkers_; n++)
+    Workers_.emplace_back(&JlmOptServer::ProcessJobs, this);
+
+  int shutdownConnection = -1;
+  try
+  {
+    while (shutdownConnection < 0)
+    {
+      auto connection = accept4(listener.Get(), nullptr, nullptr, SOCK_CLOEXEC);
+      if (connection < 0 && errno == EINTR)
+        continue;
+      if (connection < 0)
+        throw CreateSystemError("Failed to accept connection on " + SocketPath_.to_str());
+
+      // Requests are small, and are therefore read before they are handed to the workers
+      FileDescriptor connectionDescriptor(connection);
+      Job job{ connection, {} };
+      uint32_t requestKind = 0;
+      try
+      {
+        requestKind = ReadUint32(connection);
+        auto numArguments = ReadUint32(connection);
+        if (numArguments > MaxNumArguments)
+          throw util::error("Number of arguments exceeds the jlm-opt server limit");
+
+        for (uint32_t n = 0; n < numArguments; n++)
+          job.Arguments.push_back(ReadString(connection));
+      }
+      catch (util::error &)
+      {
+        // Drop malformed requests and requests of clients that went away
+        continue;
+      }
+
+      if (requestKind == static_cast<uint32_t>(RequestKind::Shutdown))
+      {
+        shutdownConnection = connectionDescriptor.Release();
+      }
+      else if (requestKind == static_cast<uint32_t>(RequestKind::Job))
+      {
+        std::lock_guard<std::mutex> guard(Mutex_);
+        Jobs_.push_back(std::move(job));
+        connectionDescriptor.Release();
+        JobAvailable_.notify_one();
+      }
+      else
+      {
+        try
+        {
+          SendResponse(connection, 1, "Unknown jlm-opt server request.");
+        }
+        catch (util::error &)
+        {}
+      }
+    }
+  }
+  catch (...)
+  {
+    StopWorkers();
+    unlink(SocketPath_.to_str().c_str());
+    throw;
+  }
+
+  StopWorkers();
+  unlink(SocketPath_.to_str().c_str());
+
+  // Only acknowledge the shutdown once all jobs are completed
+  FileDescriptor shutdownConnectionDescriptor(shutdownConnection);
+  try
+  {
+    SendResponse(shutdownConnection, 0, "");
+  }
+  catch (util::error &)
+  {}
+}
+
+void
+JlmOptServer::StopWorkers()
+{
+  {
+    std::lock_guard<std::mutex> guard(Mutex_);
+    ShutdownRequested_ = true;
+  }
+  JobAvailable_.notify_all();
+
+  for (auto & worker : Workers_)
+    worker.join();
+  Workers_.clear();
+}
+
+void
+JlmOptServer::ProcessJobs()
+{
+  while (true)
+  {
+    std::unique_lock<std::mutex> lock(Mutex_);
+    JobAvailable_.wait(
+        lock,
+        [&]()
+        {
+          return !Jobs_.empty() || ShutdownRequested_;
+        });
+
+    // Outstanding jobs are completed before a worker terminates
+    if (Jobs_.empty())
+      return;
+
+    auto job = std::move(Jobs_.front());
+    Jobs_.pop_front();
+    lock.unlock();
+
+    ProcessJob(job);
+  }
+}
+
+void
+JlmOptServer::ProcessJob(const Job & job) const
+{
+  FileDescriptor connection(job.Connection);
+
+  uint32_t status = 0;
+  std::string message;
+  try
+  {
+    auto commandLineOptions = ParseJobArguments(ProgramName_, job.Arguments);
+    if (commandLineOptions.GetOutputFile().to_str().empty())
+      throw util::error("jlm-opt server jobs require an output file.");
+
+    JlmOptCommand command(ProgramName_, commandLineOptions);
+    command.Run();
+  }
+  catch (std::exception & e)
+  {
+    status = 1;
+    message = e.what();
+  }
+
+  try
+  {
+    SendResponse(connection.Get(), status, message);
+  }
+  catch (util::error &)
+  {
+    // The client went away, and there is nobody left to report to
+  }
+}
+
+void
+JlmOptServer::SubmitJob(
+    const util::filepath & socketPath,
+    const JlmOptCommandLineOptions & commandLineOptions)
+{
+  if (commandLineOptions.GetOutputFile().to_str().empty())
+    throw util::error("jlm-opt server jobs require an output file.");
+
+  auto arguments = MakePathsAbsolute(commandLineOptions).ToCommandLineArguments();
+  SubmitJob(socketPath, arguments);
+}
+
+void
+JlmOptServer::SubmitJob(
+    const util::filepath & socketPath,
+    const std::vector<std::string> & arguments)
+{
+  SendRequest(socketPath, static_cast<uint32_t>(RequestKind::Job), arguments);
+}
+
+void
+JlmOptServer::RequestShutdown(const util::filepath & socketPath)
+{
+  SendRequest(socketPath, static_cast<uint32_t>(RequestKind::Shutdown), {});
+}
+
+}
@@ -0,0 +1,141 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_TOOLING_JLMOPTSERVER_HPP
+#define JLM_TOOLING_JLMOPTSERVER_HPP
+
+#include <jlm/tooling/CommandLine.hpp>
+#include <jlm/util/file.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace jlm::tooling
+{
+
+/**
+ * A persistent jlm-opt process that accepts compile jobs over a local Unix domain socket and
+ * processes them with a pool of worker threads. This amortizes the process startup, the static
+ * initialization, and the warm-up of caches over many compilations.
+ *
+ * A compile job consists of jlm-opt command line arguments as produced by
+ * JlmOptCommandLineOptions::ToCommandLineArguments(). The arguments are parsed by the server, and
+ * the job is run as a JlmOptCommand. All paths of a job must be absolute, as the working
+ * directory of the server is unrelated to the ones of its clients. A job must write its output
+ * to a file, as the standard output of the server is shared by all jobs.
+ *
+ * The protocol is a single request and response per connection. All integers are 32-bit
+ * unsigned integers in host byte order, and strings are prefixed by their length:
+ *
+ * - Request: request kind, number of arguments, arguments
+ * - Response: status (zero on success), error message
+ */
+class JlmOptServer final
+{
+  enum class RequestKind : uint32_t
+  {
+    Job = 0,
+    Shutdown = 1,
+  };
+
+  struct Job
+  {
+    int Connection;
+    std::vector<std::string> Arguments;
+  };
+
+public:
+  ~JlmOptServer() noexcept;
+
+  /**
+   * @param programName The program name used for parsing the arguments of compile jobs.
+   * @param socketPath The path of the Unix domain socket the server listens on. An existing
+   * file at the path is replaced.
+   * @param numWorkers The number of worker threads. Zero selects the number of hardware threads.
+   */
+  JlmOptServer(std::string programName, util::filepath socketPath, size_t numWorkers);
+
+  JlmOptServer(const JlmOptServer &) = delete;
+
+  JlmOptServer(JlmOptServer &&) = delete;
+
+  JlmOptServer &
+  operator=(const JlmOptServer &) = delete;
+
+  JlmOptServer &
+  operator=(JlmOptServer &&) = delete;
+
+  [[nodiscard]] size_t
+  NumWorkers() const noexcept
+  {
+    return NumWorkers_;
+  }
+
+  /**
+   * Listens on the socket and processes compile jobs until a shutdown request is received. All
+   * jobs received before the shutdown request are completed before the function returns.
+   *
+   * @throws util::error if the socket cannot be set up.
+   */
+  void
+  Run();
+
+  /**
+   * Sends a compile job to the server listening on \p socketPath and waits for its completion.
+   * Relative paths in \p commandLineOptions are resolved against the current working directory.
+   *
+   * @throws util::error if the server cannot be reached or the job failed.
+   */
+  static void
+  SubmitJob(const util::filepath & socketPath, const JlmOptCommandLineOptions & commandLineOptions);
+
+  /**
+   * Sends a compile job given by the jlm-opt command line \p arguments, without the program name,
+   * to the server listening on \p socketPath and waits for its completion. Relative paths in
+   * \p arguments are resolved against the working directory of the server.
+   *
+   * @throws util::error if the server cannot be reached, the arguments are malformed, or the job
+   * failed.
+   */
+  static void
+  SubmitJob(const util::filepath & socketPath, const std::vector<std::string> & arguments);
+
+  /**
+   * Requests the server listening on \p socketPath to shut down, and waits until the server
+   * completed all outstanding jobs.
+   *
+   * @throws util::error if the server cannot be reached.
+   */
+  static void
+  RequestShutdown(const util::filepath & socketPath);
+
+private:
+  void
+  ProcessJobs();
+
+  void
+  ProcessJob(const Job & job) const;
+
+  void
+  StopWorkers();
+
+  std::string ProgramName_;
+  util::filepath SocketPath_;
+  size_t NumWorkers_;
+
+  std::vector<std::thread> Workers_;
+  std::mutex Mutex_;
+  std::condition_variable JobAvailable_;
+  std::deque<Job> Jobs_;
+  bool ShutdownRequested_;
+};
+
+}
+
+#endif // JLM_TOOLING_JLMOPTSERVER_HPP
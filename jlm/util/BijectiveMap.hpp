@@ -7,8 +7,7 @@
 #define JLM_UTIL_BIJECTIVE_MAP_HPP
 
 #include <jlm/util/common.hpp>
-
-#include <unordered_map>
+#include <jlm/util/FlatHashTable.hpp>
 
 namespace jlm::util
 {
@@ -21,8 +20,20 @@ namespace jlm::util
 template<typename K, typename V>
 class BijectiveMap
 {
-  using ForwardMapType = std::unordered_map<K, const V>;
-  using ReverseMapType = std::unordered_map<V, const K>;
+  template<typename Pair>
+  struct First final
+  {
+    const typename Pair::first_type &
+    operator()(const Pair & pair) const noexcept
+    {
+      return pair.first;
+    }
+  };
+
+  using ForwardPairType = std::pair<const K, const V>;
+  using ReversePairType = std::pair<const V, const K>;
+  using ForwardMapType = FlatHashTable<ForwardPairType, K, First<ForwardPairType>, std::hash<K>>;
+  using ReverseMapType = FlatHashTable<ReversePairType, V, First<ReversePairType>, std::hash<V>>;
 
 public:
   using ItemType = std::pair<const K, const V>;
@@ -33,14 +44,14 @@ public:
     using iterator_category = std::forward_iterator_tag;
     using value_type = ItemType;
     using difference_type = std::ptrdiff_t;
-    using pointer = ItemType *;
-    using reference = ItemType &;
+    using pointer = const ItemType *;
+    using reference = const ItemType &;
 
     friend BijectiveMap;
 
     ConstIterator() = default;
 
-    explicit ConstIterator(const typename ForwardMapType::const_iterator & it)
+    explicit ConstIterator(const typename ForwardMapType::ConstIterator & it)
         : It_(it)
     {}
 
@@ -84,7 +95,7 @@ public:
     }
 
   private:
-    typename ForwardMapType::const_iterator It_;
+    typename ForwardMapType::ConstIterator It_;
   };
 
   ~BijectiveMap() noexcept = default;
@@ -132,8 +143,8 @@ public:
   void
   Clear() noexcept
   {
-    ForwardMap_.clear();
-    ReverseMap_.clear();
+    ForwardMap_.Clear();
+    ReverseMap_.Clear();
   }
 
   /**
@@ -142,8 +153,8 @@ public:
   [[nodiscard]] std::size_t
   Size() const noexcept
   {
-    JLM_ASSERT(ForwardMap_.size() == ReverseMap_.size());
-    return ForwardMap_.size();
+    JLM_ASSERT(ForwardMap_.Size() == ReverseMap_.Size());
+    return ForwardMap_.Size();
   }
 
   /**
@@ -159,8 +170,8 @@ public:
     if (HasKey(key) || HasValue(value))
       return false;
 
-    ForwardMap_.insert({ key, value });
-    ReverseMap_.insert({ value, key });
+    ForwardMap_.Insert({ key, value });
+    ReverseMap_.Insert({ value, key });
     return true;
   }
 
@@ -212,7 +223,7 @@ public:
   [[nodiscard]] bool
   HasKey(const K & key) const noexcept
   {
-    return ForwardMap_.find(key) != ForwardMap_.end();
+    return ForwardMap_.Contains(key);
   }
 
   /**
@@ -223,7 +234,7 @@ public:
   [[nodiscard]] bool
   HasValue(const V & value) const noexcept
   {
-    return ReverseMap_.find(value) != ReverseMap_.end();
+    return ReverseMap_.Contains(value);
   }
 
   /**
@@ -234,7 +245,7 @@ public:
   [[nodiscard]] const V &
   LookupKey(const K & key) const
   {
-    auto it = ForwardMap_.find(key);
+    auto it = ForwardMap_.Find(key);
     if (it == ForwardMap_.end())
       throw jlm::util::error("Key not found in BijectiveMap");
     return it->second;
@@ -248,7 +259,7 @@ public:
   [[nodiscard]] const K &
   LookupValue(const V & value) const
   {
-    auto it = ReverseMap_.find(value);
+    auto it = ReverseMap_.Find(value);
     if (it == ReverseMap_.end())
       throw jlm::util::error("Value not found in BijectiveMap");
     return it->second;
@@ -262,7 +273,7 @@ public:
   [[nodiscard]] ConstIterator
   begin() const noexcept
   {
-    return ConstIterator(ForwardMap_.cbegin());
+    return ConstIterator(ForwardMap_.begin());
   }
 
   /**
@@ -273,7 +284,7 @@ public:
   [[nodiscard]] ConstIterator
   end() const noexcept
   {
-    return ConstIterator(ForwardMap_.cend());
+    return ConstIterator(ForwardMap_.end());
   }
 
   /**
@@ -286,9 +297,9 @@ public:
   ConstIterator
   Erase(ConstIterator it)
   {
-    const size_t removed = ReverseMap_.erase(it->second);
-    JLM_ASSERT(removed == 1);
-    const auto nextForwardIt = ForwardMap_.erase(it.It_);
+    [[maybe_unused]] const bool removed = ReverseMap_.Erase(it->second);
+    JLM_ASSERT(removed);
+    const auto nextForwardIt = ForwardMap_.Erase(it.It_);
     return ConstIterator(nextForwardIt);
   }
 
@@ -300,7 +311,7 @@ public:
   bool
   RemoveKey(const K & key)
   {
-    auto it = ForwardMap_.find(key);
+    auto it = ForwardMap_.Find(key);
     if (it == ForwardMap_.end())
       return false;
 
@@ -316,14 +327,14 @@ public:
   bool
   RemoveValue(const V & value)
   {
-    auto it = ReverseMap_.find(value);
+    auto it = ReverseMap_.Find(value);
     if (it == ReverseMap_.end())
       return false;
 
-    auto removed = ForwardMap_.erase(it->second);
-    JLM_ASSERT(removed == 1);
+    [[maybe_unused]] const bool removed = ForwardMap_.Erase(it->second);
+    JLM_ASSERT(removed);
 
-    ReverseMap_.erase(it);
+    ReverseMap_.Erase(it);
     return true;
   }
 
@@ -397,7 +408,17 @@ public:
   operator==(const BijectiveMap & other) const noexcept
   {
     // We only need to compare forward maps, as reverse maps are uniquely defined by the forward map
-    return ForwardMap_ == other.ForwardMap_;
+    if (Size() != other.Size())
+      return false;
+
+    for (auto & [key, value] : ForwardMap_)
+    {
+      auto it = other.ForwardMap_.Find(key);
+      if (it == other.ForwardMap_.end() || it->second != value)
+        return false;
+    }
+
+    return true;
   }
 
   /**
@@ -0,0 +1,674 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_UTIL_FLATHASHTABLE_HPP
+#define JLM_UTIL_FLATHASHTABLE_HPP
+
+#include <jlm/util/common.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace jlm::util
+{
+
+namespace detail
+{
+
+/**
+ * The control byte of a slot in a FlatHashTable. Full slots store the lower seven bits of the hash
+ * of their item, i.e., a non-negative value, while empty and deleted slots have the sign bit set.
+ */
+using ControlByte = int8_t;
+
+inline constexpr ControlByte EmptyControlByte = -128;
+inline constexpr ControlByte DeletedControlByte = -2;
+
+/**
+ * A mask over the slots of a probed group, in which every set bit denotes a matching slot.
+ * @tparam Shift The log2 of the number of bits per slot in the mask.
+ */
+template<unsigned Shift>
+class GroupMask final
+{
+public:
+  explicit GroupMask(uint64_t mask) noexcept
+      : Mask_(mask)
+  {}
+
+  explicit operator bool() const noexcept
+  {
+    return Mask_ != 0;
+  }
+
+  /**
+   * @return The offset of the first matching slot within the group.
+   */
+  [[nodiscard]] size_t
+  LowestIndex() const noexcept
+  {
+    JLM_ASSERT(Mask_ != 0);
+    return static_cast<size_t>(__builtin_ctzll(Mask_)) >> Shift;
+  }
+
+  void
+  ClearLowest() noexcept
+  {
+    Mask_ &= Mask_ - 1;
+  }
+
+private:
+  uint64_t Mask_;
+};
+
+#if defined(__SSE2__)
+
+/**
+ * A group of 16 consecutive control bytes that are matched in parallel with SSE2 instructions.
+ */
+class ControlGroup final
+{
+public:
+  static constexpr size_t Width = 16;
+
+  using Mask = GroupMask<0>;
+
+  explicit ControlGroup(const ControlByte * control) noexcept
+      : Control_(_mm_loadu_si128(reinterpret_cast<const __m128i *>(control)))
+  {}
+
+  [[nodiscard]] Mask
+  Match(ControlByte hash) const noexcept
+  {
+    return Mask(ToMask(_mm_cmpeq_epi8(_mm_set1_epi8(hash), Control_)));
+  }
+
+  [[nodiscard]] Mask
+  MatchEmpty() const noexcept
+  {
+    return Match(EmptyControlByte);
+  }
+
+  [[nodiscard]] Mask
+  MatchEmptyOrDeleted() const noexcept
+  {
+    return Mask(ToMask(Control_));
+  }
+
+private:
+  static uint64_t
+  ToMask(__m128i vector) noexcept
+  {
+    return static_cast<uint32_t>(_mm_movemask_epi8(vector));
+  }
+
+  __m128i Control_;
+};
+
+#else
+
+/**
+ * A group of 8 consecutive control bytes that are matched in parallel within a 64-bit word.
+ */
+class ControlGroup final
+{
+  static constexpr uint64_t LeastSignificantBits = 0x0101010101010101ULL;
+  static constexpr uint64_t MostSignificantBits = 0x8080808080808080ULL;
+
+public:
+  static constexpr size_t Width = 8;
+
+  using Mask = GroupMask<3>;
+
+  explicit ControlGroup(const ControlByte * control) noexcept
+  {
+    std::memcpy(&Control_, control, sizeof(Control_));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    Control_ = __builtin_bswap64(Control_);
+#endif
+  }
+
+  /**
+   * Might report false positives for bytes following a matching byte. This is harmless as the
+   * items of all matching slots are compared anyway.
+   */
+  [[nodiscard]] Mask
+  Match(ControlByte hash) const noexcept
+  {
+    auto x = Control_ ^ (LeastSignificantBits * static_cast<uint8_t>(hash));
+    return Mask((x - LeastSignificantBits) & ~x & MostSignificantBits);
+  }
+
+  [[nodiscard]] Mask
+  MatchEmpty() const noexcept
+  {
+    return Mask(Control_ & (~Control_ << 6) & MostSignificantBits);
+  }
+
+  [[nodiscard]] Mask
+  MatchEmptyOrDeleted() const noexcept
+  {
+    return Mask(Control_ & MostSignificantBits);
+  }
+
+private:
+  uint64_t Control_;
+};
+
+#endif
+
+}
+
+/**
+ * An open-addressing hash table that stores its items inline in a single array of slots. Every
+ * slot has an associated control byte that marks it as empty, deleted, or full, and in the latter
+ * case also stores seven bits of the hash of its item. Lookups probe whole groups of control bytes
+ * at once, and only compare the items of slots whose control byte matches.
+ *
+ * Erasing an item leaves a tombstone behind, such that the positions of all other items remain
+ * unchanged and iterators to them stay valid. Insertions can grow the table, which moves all items
+ * and invalidates all iterators and references to items.
+ *
+ * This is the common core of HashSet and BijectiveMap.
+ *
+ * @tparam SlotType The type of the stored items.
+ * @tparam KeyType The type of the keys by which items are looked up.
+ * @tparam KeyOf A functor returning the key of an item.
+ * @tparam HashFunctor A functor hashing keys.
+ * @tparam KeyEqual A functor comparing keys for equality.
+ */
+template<
+    typename SlotType,
+    typename KeyType,
+    typename KeyOf,
+    typename HashFunctor,
+    typename KeyEqual = std::equal_to<KeyType>>
+class FlatHashTable final
+{
+  using Group = detail::ControlGroup;
+  using ControlByte = detail::ControlByte;
+
+public:
+  class ConstIterator final
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = SlotType;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const SlotType *;
+    using reference = const SlotType &;
+
+    ConstIterator() = default;
+
+  private:
+    friend FlatHashTable;
+
+    ConstIterator(const FlatHashTable * table, size_t index) noexcept
+        : Table_(table),
+          Index_(index)
+    {}
+
+  public:
+    const SlotType &
+    operator*() const noexcept
+    {
+      return Table_->GetSlot(Index_);
+    }
+
+    const SlotType *
+    operator->() const noexcept
+    {
+      return &operator*();
+    }
+
+    ConstIterator &
+    operator++() noexcept
+    {
+      Index_ = Table_->NextFullSlot(Index_ + 1);
+      return *this;
+    }
+
+    ConstIterator
+    operator++(int) noexcept
+    {
+      ConstIterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    bool
+    operator==(const ConstIterator & other) const noexcept
+    {
+      return Table_ == other.Table_ && Index_ == other.Index_;
+    }
+
+    bool
+    operator!=(const ConstIterator & other) const noexcept
+    {
+      return !operator==(other);
+    }
+
+  private:
+    const FlatHashTable * Table_ = nullptr;
+    size_t Index_ = 0;
+  };
+
+  ~FlatHashTable() noexcept
+  {
+    DestroySlots();
+  }
+
+  FlatHashTable() noexcept = default;
+
+  FlatHashTable(const FlatHashTable & other)
+  {
+    Reserve(other.Size());
+    for (auto & slot : other)
+      InsertUnique(slot);
+  }
+
+  FlatHashTable(FlatHashTable && other) noexcept
+      : Control_(std::move(other.Control_)),
+        Slots_(std::exchange(other.Slots_, nullptr)),
+        Capacity_(std::exchange(other.Capacity_, 0)),
+        Size_(std::exchange(other.Size_, 0)),
+        NumDeleted_(std::exchange(other.NumDeleted_, 0))
+  {}
+
+  FlatHashTable &
+  operator=(const FlatHashTable & other)
+  {
+    if (this != &other)
+      *this = FlatHashTable(other);
+
+    return *this;
+  }
+
+  FlatHashTable &
+  operator=(FlatHashTable && other) noexcept
+  {
+    if (this == &other)
+      return *this;
+
+    DestroySlots();
+    Control_ = std::move(other.Control_);
+    Slots_ = std::exchange(other.Slots_, nullptr);
+    Capacity_ = std::exchange(other.Capacity_, 0);
+    Size_ = std::exchange(other.Size_, 0);
+    NumDeleted_ = std::exchange(other.NumDeleted_, 0);
+    return *this;
+  }
+
+  [[nodiscard]] size_t
+  Size() const noexcept
+  {
+    return Size_;
+  }
+
+  [[nodiscard]] size_t
+  Capacity() const noexcept
+  {
+    return Capacity_;
+  }
+
+  [[nodiscard]] ConstIterator
+  begin() const noexcept
+  {
+    return ConstIterator(this, NextFullSlot(0));
+  }
+
+  [[nodiscard]] ConstIterator
+  end() const noexcept
+  {
+    return ConstIterator(this, Capacity_);
+  }
+
+  /**
+   * Destroys all items, but keeps the allocated slots.
+   */
+  void
+  Clear() noexcept
+  {
+    for (size_t n = 0; n < Capacity_; n++)
+    {
+      if (IsFull(Control_[n]))
+        Slots_[n].~SlotType();
+    }
+
+    if (Capacity_ != 0)
+      std::memset(Control_.get(), detail::EmptyControlByte, Capacity_ + Group::Width);
+
+    Size_ = 0;
+    NumDeleted_ = 0;
+  }
+
+  /**
+   * Grows the table such that it can hold at least \p size items without rehashing.
+   */
+  void
+  Reserve(size_t size)
+  {
+    if (size <= MaxLoad(Capacity_) - NumDeleted_)
+      return;
+
+    auto capacity = std::max(Capacity_, Group::Width);
+    while (MaxLoad(capacity) < size)
+      capacity *= 2;
+
+    Rehash(capacity);
+  }
+
+  [[nodiscard]] ConstIterator
+  Find(const KeyType & key) const noexcept
+  {
+    return ConstIterator(this, FindIndex(key));
+  }
+
+  [[nodiscard]] bool
+  Contains(const KeyType & key) const noexcept
+  {
+    return FindIndex(key) != Capacity_;
+  }
+
+  /**
+   * Inserts \p slot if there is no item with the same key in the table.
+   * @return An iterator to the item with the key of \p slot, and whether \p slot was inserted.
+   */
+  std::pair<ConstIterator, bool>
+  Insert(SlotType slot)
+  {
+    auto & key = KeyOf()(slot);
+    auto hash = ComputeHash(key);
+    auto index = FindIndex(key, hash);
+    if (index != Capacity_)
+      return { ConstIterator(this, index), false };
+
+    index = PrepareInsert(hash);
+    new (&Slots_[index]) SlotType(std::move(slot));
+    return { ConstIterator(this, index), true };
+  }
+
+  /**
+   * Removes the item \p it points to.
+   * @return An iterator to the item following the removed item.
+   */
+  ConstIterator
+  Erase(ConstIterator it) noexcept
+  {
+    JLM_ASSERT(it.Table_ == this && it.Index_ < Capacity_ && IsFull(Control_[it.Index_]));
+
+    Slots_[it.Index_].~SlotType();
+    SetControl(it.Index_, detail::DeletedControlByte);
+    Size_--;
+    NumDeleted_++;
+
+    return ConstIterator(this, NextFullSlot(it.Index_ + 1));
+  }
+
+  /**
+   * Removes the item with the given \p key.
+   * @return True if an item was removed, otherwise false.
+   */
+  bool
+  Erase(const KeyType & key) noexcept
+  {
+    auto index = FindIndex(key);
+    if (index == Capacity_)
+      return false;
+
+    Erase(ConstIterator(this, index));
+    return true;
+  }
+
+  /**
+   * @return The number of bytes allocated for the control bytes and slots.
+   */
+  [[nodiscard]] size_t
+  EstimateHeapBytes() const noexcept
+  {
+    if (Capacity_ == 0)
+      return 0;
+
+    return Capacity_ * sizeof(SlotType) + Capacity_ + Group::Width;
+  }
+
+private:
+  static bool
+  IsFull(ControlByte control) noexcept
+  {
+    return control >= 0;
+  }
+
+  /**
+   * The maximum number of full and deleted slots of a table with the given \p capacity, which
+   * corresponds to a load factor of 7/8. This guarantees that every probe sequence terminates at an
+   * empty slot.
+   */
+  static size_t
+  MaxLoad(size_t capacity) noexcept
+  {
+    return capacity - capacity / 8;
+  }
+
+  /**
+   * Mixes the bits of the user provided hash, as many hash functions, e.g., std::hash for pointers
+   * and integers, are the identity function. The lower seven bits of the result are stored in the
+   * control bytes, and the remaining bits select the start of the probe sequence.
+   */
+  static uint64_t
+  ComputeHash(const KeyType & key) noexcept
+  {
+    uint64_t hash = HashFunctor()(key);
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    return hash;
+  }
+
+  static ControlByte
+  H2(uint64_t hash) noexcept
+  {
+    return static_cast<ControlByte>(hash & 0x7f);
+  }
+
+  static size_t
+  H1(uint64_t hash) noexcept
+  {
+    return static_cast<size_t>(hash >> 7);
+  }
+
+  const SlotType &
+  GetSlot(size_t index) const noexcept
+  {
+    JLM_ASSERT(index < Capacity_ && IsFull(Control_[index]));
+    return Slots_[index];
+  }
+
+  size_t
+  NextFullSlot(size_t index) const noexcept
+  {
+    while (index < Capacity_ && !IsFull(Control_[index]))
+      index++;
+
+    return index;
+  }
+
+  /**
+   * Sets the control byte of the slot with the given \p index. The control bytes of the first
+   * group are mirrored after the last slot, such that a group can be loaded from any position.
+   */
+  void
+  SetControl(size_t index, ControlByte control) noexcept
+  {
+    Control_[index] = control;
+    if (index < Group::Width)
+      Control_[Capacity_ + index] = control;
+  }
+
+  size_t
+  FindIndex(const KeyType & key) const noexcept
+  {
+    return FindIndex(key, ComputeHash(key));
+  }
+
+  /**
+   * @return The index of the slot holding \p key, or the capacity if there is no such slot.
+   */
+  size_t
+  FindIndex(const KeyType & key, uint64_t hash) const noexcept
+  {
+    if (Size_ == 0)
+      return Capacity_;
+
+    auto mask = Capacity_ - 1;
+    auto position = H1(hash) & mask;
+    size_t step = 0;
+    while (true)
+    {
+      Group group(&Control_[position]);
+      for (auto match = group.Match(H2(hash)); match; match.ClearLowest())
+      {
+        auto index = (position + match.LowestIndex()) & mask;
+        if (KeyEqual()(KeyOf()(Slots_[index]), key))
+          return index;
+      }
+
+      if (group.MatchEmpty())
+        return Capacity_;
+
+      step += Group::Width;
+      position = (position + step) & mask;
+      JLM_ASSERT(step < Capacity_ + Group::Width);
+    }
+  }
+
+  /**
+   * @return The index of the first empty or deleted slot in the probe sequence of \p hash.
+   */
+  size_t
+  FindFirstNonFull(uint64_t hash) const noexcept
+  {
+    auto mask = Capacity_ - 1;
+    auto position = H1(hash) & mask;
+    size_t step = 0;
+    while (true)
+    {
+      Group group(&Control_[position]);
+      if (auto match = group.MatchEmptyOrDeleted())
+        return (position + match.LowestIndex()) & mask;
+
+      step += Group::Width;
+      position = (position + step) & mask;
+      JLM_ASSERT(step < Capacity_ + Group::Width);
+    }
+  }
+
+  /**
+   * Marks a slot in the probe sequence of \p hash as full, growing the table if necessary.
+   * @return The index of the slot, which is left for the caller to construct the item in.
+   */
+  size_t
+  PrepareInsert(uint64_t hash)
+  {
+    if (Size_ + NumDeleted_ + 1 > MaxLoad(Capacity_))
+    {
+      // Only grow the table if the deleted slots cannot make up for it
+      if (Capacity_ == 0)
+        Rehash(Group::Width);
+      else if (Size_ + 1 > MaxLoad(Capacity_) / 2)
+        Rehash(Capacity_ * 2);
+      else
+        Rehash(Capacity_);
+    }
+
+    auto index = FindFirstNonFull(hash);
+    if (Control_[index] == detail::DeletedControlByte)
+      NumDeleted_--;
+
+    SetControl(index, H2(hash));
+    Size_++;
+    return index;
+  }
+
+  /**
+   * Inserts \p slot, which must not be present in the table, without growing the table.
+   */
+  void
+  InsertUnique(const SlotType & slot)
+  {
+    auto hash = ComputeHash(KeyOf()(slot));
+    auto index = PrepareInsert(hash);
+    new (&Slots_[index]) SlotType(slot);
+  }
+
+  /**
+   * Moves all items into a new table with the given \p capacity, which must be a power of two.
+   */
+  void
+  Rehash(size_t capacity)
+  {
+    JLM_ASSERT(capacity >= Group::Width && (capacity & (capacity - 1)) == 0);
+    JLM_ASSERT(MaxLoad(capacity) > Size_);
+
+    auto oldControl = std::move(Control_);
+    auto oldSlots = Slots_;
+    auto oldCapacity = Capacity_;
+
+    Control_ = std::make_unique<ControlByte[]>(capacity + Group::Width);
+    std::memset(Control_.get(), detail::EmptyControlByte, capacity + Group::Width);
+    Slots_ = std::allocator<SlotType>().allocate(capacity);
+    Capacity_ = capacity;
+    NumDeleted_ = 0;
+
+    for (size_t n = 0; n < oldCapacity; n++)
+    {
+      if (!IsFull(oldControl[n]))
+        continue;
+
+      auto hash = ComputeHash(KeyOf()(oldSlots[n]));
+      auto index = FindFirstNonFull(hash);
+      SetControl(index, H2(hash));
+      new (&Slots_[index]) SlotType(std::move(oldSlots[n]));
+      oldSlots[n].~SlotType();
+    }
+
+    if (oldSlots != nullptr)
+      std::allocator<SlotType>().deallocate(oldSlots, oldCapacity);
+  }
+
+  void
+  DestroySlots() noexcept
+  {
+    if (Slots_ == nullptr)
+      return;
+
+    for (size_t n = 0; n < Capacity_; n++)
+    {
+      if (IsFull(Control_[n]))
+        Slots_[n].~SlotType();
+    }
+
+    std::allocator<SlotType>().deallocate(Slots_, Capacity_);
+    Slots_ = nullptr;
+  }
+
+  std::unique_ptr<ControlByte[]> Control_;
+  SlotType * Slots_ = nullptr;
+  size_t Capacity_ = 0;
+  size_t Size_ = 0;
+  size_t NumDeleted_ = 0;
+};
+
+}
+
+#endif // JLM_UTIL_FLATHASHTABLE_HPP
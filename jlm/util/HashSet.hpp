@@ -6,6 +6,7 @@
 #ifndef JLM_UTIL_HASHSET_HPP
 #define JLM_UTIL_HASHSET_HPP
 
+#include <jlm/util/FlatHashTable.hpp>
 #include <jlm/util/Hash.hpp>
 #include <jlm/util/iterator_range.hpp>
 
@@ -17,12 +18,25 @@ namespace jlm::util
 /**
  * Represents a set of values. A set is a collection that contains no duplicate elements, and
  * whose elements are in no particular order.
+ *
+ * The items are stored inline in a FlatHashTable. Removing items keeps all other iterators valid,
+ * but inserting items can move all items and invalidates iterators and references to them.
+ *
  * @tparam ItemType The type of the items in the hash set.
  */
 template<typename ItemType, typename HashFunctor = Hash<ItemType>>
 class HashSet
 {
-  using InternalSet = std::unordered_set<ItemType, HashFunctor>;
+  struct Identity final
+  {
+    const ItemType &
+    operator()(const ItemType & item) const noexcept
+    {
+      return item;
+    }
+  };
+
+  using InternalSet = FlatHashTable<ItemType, ItemType, Identity, HashFunctor>;
 
 public:
   class ItemConstIterator final
@@ -31,18 +45,18 @@ public:
     using iterator_category = std::forward_iterator_tag;
     using value_type = ItemType;
     using difference_type = std::ptrdiff_t;
-    using pointer = ItemType *;
-    using reference = ItemType &;
+    using pointer = const ItemType *;
+    using reference = const ItemType &;
 
   private:
     friend HashSet;
 
-    explicit ItemConstIterator(const typename InternalSet::const_iterator & it)
+    explicit ItemConstIterator(const typename InternalSet::ConstIterator & it)
         : It_(it)
     {}
 
   public:
-    [[nodiscard]] ItemType *
+    [[nodiscard]] const ItemType *
     Item() const noexcept
     {
       return It_.operator->();
@@ -54,7 +68,7 @@ public:
       return It_.operator*();
     }
 
-    ItemType *
+    const ItemType *
     operator->() const
     {
       return Item();
@@ -88,7 +102,7 @@ public:
     }
 
   private:
-    typename InternalSet::const_iterator It_;
+    typename InternalSet::ConstIterator It_;
   };
 
   ~HashSet() noexcept = default;
@@ -97,8 +111,10 @@ public:
 
   template<class InputIt>
   HashSet(InputIt begin, InputIt end)
-      : Set_(begin, end)
-  {}
+  {
+    for (auto it = begin; it != end; ++it)
+      Insert(*it);
+  }
 
   HashSet(const HashSet & other)
       : Set_(other.Set_)
@@ -109,12 +125,12 @@ public:
   {}
 
   HashSet(std::initializer_list<ItemType> initializerList)
-      : Set_(initializerList)
+      : HashSet(initializerList.begin(), initializerList.end())
   {}
 
   template<typename OtherHashFunctor>
   explicit HashSet(const std::unordered_set<ItemType, OtherHashFunctor> & other)
-      : Set_(other.begin(), other.end())
+      : HashSet(other.begin(), other.end())
   {}
 
   HashSet &
@@ -137,7 +153,7 @@ public:
   void
   Clear() noexcept
   {
-    Set_.clear();
+    Set_.Clear();
   }
 
   /**
@@ -149,7 +165,7 @@ public:
   bool
   Contains(const ItemType & item) const noexcept
   {
-    return Set_.find(item) != Set_.end();
+    return Set_.Contains(item);
   }
 
   /**
@@ -186,7 +202,7 @@ public:
   [[nodiscard]] std::size_t
   Size() const noexcept
   {
-    return Set_.size();
+    return Set_.Size();
   }
 
   /**
@@ -200,6 +216,19 @@ public:
     return Size() == 0;
   }
 
+  /**
+   * Estimates the heap memory used by the set, i.e., the slot array and its control bytes.
+   *
+   * @return The estimated number of bytes.
+   *
+   * @see MemoryFootprint
+   */
+  [[nodiscard]] std::size_t
+  EstimateHeapBytes() const noexcept
+  {
+    return Set_.EstimateHeapBytes();
+  }
+
   /**
    * Inserts the specified item to a set.
    *
@@ -209,9 +238,19 @@ public:
   bool
   Insert(ItemType item)
   {
-    auto size = Size();
-    Set_.emplace(std::move(item));
-    return (size != Size());
+    return Set_.Insert(std::move(item)).second;
+  }
+
+  /**
+   * Reserves space for at least \p size items, such that inserting up to \p size items does not
+   * move any items.
+   *
+   * @param size The number of items to reserve space for.
+   */
+  void
+  Reserve(std::size_t size)
+  {
+    Set_.Reserve(size);
   }
 
   /**
@@ -266,7 +305,7 @@ public:
   bool
   Remove(ItemType item)
   {
-    return Set_.erase(item) != 0;
+    return Set_.Erase(item);
   }
 
   /**
@@ -287,7 +326,7 @@ public:
     {
       if (match(*it))
       {
-        it = Set_.erase(it);
+        it = Set_.Erase(it);
         numRemoved++;
       }
       else
@@ -307,7 +346,7 @@ public:
   ItemConstIterator
   Erase(ItemConstIterator iterator)
   {
-    return ItemConstIterator(Set_.erase(iterator.It_));
+    return ItemConstIterator(Set_.Erase(iterator.It_));
   }
 
   /**
@@ -0,0 +1,88 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/util/MemoryFootprint.hpp>
+#include <jlm/util/strfmt.hpp>
+
+#include <sys/resource.h>
+
+#include <unordered_map>
+
+namespace jlm::util
+{
+
+size_t
+MemoryFootprint::Total() const noexcept
+{
+  size_t total = 0;
+  for (auto numBytes : NumBytes_)
+    total += numBytes;
+
+  return total;
+}
+
+MemoryFootprint &
+MemoryFootprint::operator+=(const MemoryFootprint & other) noexcept
+{
+  for (size_t n = 0; n < NumCategories_; n++)
+    NumBytes_[n] += other.NumBytes_[n];
+
+  return *this;
+}
+
+const char *
+MemoryFootprint::GetLabel(Category category)
+{
+  static std::unordered_map<Category, const char *> labels({
+      { Category::RvsdgNodes, "#BytesRvsdgNodes" },
+      { Category::RvsdgInputs, "#BytesRvsdgInputs" },
+      { Category::RvsdgOutputs, "#BytesRvsdgOutputs" },
+      { Category::RvsdgUserSets, "#BytesRvsdgUserSets" },
+      { Category::RvsdgOperations, "#BytesRvsdgOperations" },
+      { Category::RvsdgTypes, "#BytesRvsdgTypes" },
+      { Category::RvsdgRegions, "#BytesRvsdgRegions" },
+      { Category::ThreeAddressCodes, "#BytesThreeAddressCodes" },
+      { Category::CfgNodes, "#BytesCfgNodes" },
+      { Category::PointsToSets, "#BytesPointsToSets" },
+      { Category::PointsToGraphEdges, "#BytesPointsToGraphEdges" },
+  });
+  JLM_ASSERT(labels.size() == NumCategories_);
+
+  auto it = labels.find(category);
+  JLM_ASSERT(it != labels.end());
+  return it->second;
+}
+
+size_t
+MemoryFootprint::GetPeakResidentSetSize() noexcept
+{
+  struct rusage usage = {};
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
+    return 0;
+
+#if defined(__APPLE__)
+  // macOS reports the maximum resident set size in bytes
+  return usage.ru_maxrss;
+#else
+  // Linux reports the maximum resident set size in kilobytes
+  return usage.ru_maxrss * 1024;
+#endif
+}
+
+std::string
+MemoryFootprint::ToString() const
+{
+  std::string str;
+  for (size_t n = 0; n < NumCategories_; n++)
+  {
+    auto category = static_cast<Category>(static_cast<size_t>(Category::FirstEnumValue) + n + 1);
+    str += strfmt(GetLabel(category), ": ", NumBytes_[n], "\n");
+  }
+  str += strfmt(TotalLabel_, ": ", Total(), "\n");
+
+  return str;
+}
+
+}
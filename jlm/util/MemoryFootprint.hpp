@@ -0,0 +1,145 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_UTIL_MEMORYFOOTPRINT_HPP
+#define JLM_UTIL_MEMORYFOOTPRINT_HPP
+
+#include <jlm/util/common.hpp>
+
+#include <array>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace jlm::util
+{
+
+/**
+ * Accumulates the number of bytes used by the data structures of the compiler, broken down into
+ * categories. The numbers are estimates: they account for the objects and the heap memory of the
+ * containers owned by them, but not for the overhead of the memory allocator.
+ */
+class MemoryFootprint final
+{
+public:
+  enum class Category
+  {
+    FirstEnumValue, // must always be the first enum value, used for iteration
+
+    RvsdgNodes,
+    RvsdgInputs,
+    RvsdgOutputs,
+    RvsdgUserSets,
+    RvsdgOperations,
+    RvsdgTypes,
+    RvsdgRegions,
+    ThreeAddressCodes,
+    CfgNodes,
+    PointsToSets,
+    PointsToGraphEdges,
+
+    LastEnumValue // must always be the last enum value, used for iteration
+  };
+
+  void
+  Add(Category category, size_t numBytes) noexcept
+  {
+    NumBytes_[Index(category)] += numBytes;
+  }
+
+  [[nodiscard]] size_t
+  Get(Category category) const noexcept
+  {
+    return NumBytes_[Index(category)];
+  }
+
+  /**
+   * @return The number of bytes of all categories.
+   */
+  [[nodiscard]] size_t
+  Total() const noexcept;
+
+  MemoryFootprint &
+  operator+=(const MemoryFootprint & other) noexcept;
+
+  /**
+   * @return The statistics measurement label of \p category, e.g., "#BytesRvsdgNodes".
+   */
+  [[nodiscard]] static const char *
+  GetLabel(Category category);
+
+  /**
+   * @return A string with one line per category of the form "label: bytes".
+   */
+  [[nodiscard]] std::string
+  ToString() const;
+
+  template<typename T>
+  [[nodiscard]] static size_t
+  EstimateBytes(const std::vector<T> & vector) noexcept
+  {
+    return vector.capacity() * sizeof(T);
+  }
+
+  /**
+   * Estimates the heap memory of an unordered container with the node layout of libstdc++, i.e.,
+   * a bucket array and one allocation per element holding a next pointer, the element, and the
+   * cached hash code.
+   */
+  template<typename T, typename Hash, typename Equal>
+  [[nodiscard]] static size_t
+  EstimateBytes(const std::unordered_set<T, Hash, Equal> & set) noexcept
+  {
+    return EstimateUnorderedContainerBytes(set.bucket_count(), set.size(), sizeof(T));
+  }
+
+  template<typename K, typename V, typename Hash, typename Equal>
+  [[nodiscard]] static size_t
+  EstimateBytes(const std::unordered_map<K, V, Hash, Equal> & map) noexcept
+  {
+    return EstimateUnorderedContainerBytes(
+        map.bucket_count(),
+        map.size(),
+        sizeof(typename std::unordered_map<K, V, Hash, Equal>::value_type));
+  }
+
+  /**
+   * @return The peak resident set size of the process in bytes, i.e., the high-water mark of the
+   * physical memory used so far, or 0 if it cannot be determined on the host.
+   */
+  [[nodiscard]] static size_t
+  GetPeakResidentSetSize() noexcept;
+
+  [[nodiscard]] static size_t
+  EstimateUnorderedContainerBytes(
+      size_t numBuckets,
+      size_t numElements,
+      size_t elementSize) noexcept
+  {
+    return numBuckets * sizeof(void *)
+         + numElements * (sizeof(void *) + elementSize + sizeof(size_t));
+  }
+
+private:
+  static inline const char * TotalLabel_ = "#BytesTotal";
+
+  static constexpr size_t NumCategories_ =
+      static_cast<size_t>(Category::LastEnumValue) - static_cast<size_t>(Category::FirstEnumValue)
+      - 1;
+
+  static size_t
+  Index(Category category) noexcept
+  {
+    JLM_ASSERT(category != Category::FirstEnumValue && category != Category::LastEnumValue);
+    return static_cast<size_t>(category) - static_cast<size_t>(Category::FirstEnumValue) - 1;
+  }
+
+  std::array<size_t, NumCategories_> NumBytes_ = {};
+};
+
+}
+
+#endif // JLM_UTIL_MEMORYFOOTPRINT_HPP
@@ -7,6 +7,7 @@
 #include <jlm/util/Statistics.hpp>
 
 #include <jlm/util/BijectiveMap.hpp>
+#include <jlm/util/MemoryFootprint.hpp>
 #include <jlm/util/strfmt.hpp>
 
 #include <string_view>
@@ -23,15 +24,23 @@ GetStatisticsIdNames()
     { Statistics::Id::AgnosticMemoryNodeProvisioning, "AgnosticMemoryNodeProvider" },
     { Statistics::Id::AndersenAnalysis, "AndersenAnalysis" },
     { Statistics::Id::Annotation, "Annotation" },
+    { Statistics::Id::BitwidthMinimization, "BitwidthMinimization" },
     { Statistics::Id::CommonNodeElimination, "CNE" },
     { Statistics::Id::ControlFlowRecovery, "ControlFlowRestructuring" },
     { Statistics::Id::DataNodeToDelta, "DataNodeToDeltaStatistics" },
     { Statistics::Id::DeadNodeElimination, "DeadNodeElimination" },
     { Statistics::Id::FunctionInlining, "ILN" },
+    { Statistics::Id::GammaMerging, "GammaMerging" },
+    { Statistics::Id::JlmToMlirConversion, "JlmToMlirConversion" },
     { Statistics::Id::JlmToRvsdgConversion, "ControlFlowGraphToLambda" },
+    { Statistics::Id::LoopFusion, "LoopFusion" },
     { Statistics::Id::LoopUnrolling, "UNROLL" },
+    { Statistics::Id::LoopUnswitching, "LoopUnswitching" },
+    { Statistics::Id::InvariantLoadHoisting, "InvariantLoadHoisting" },
     { Statistics::Id::InvariantValueRedirection, "InvariantValueRedirection" },
+    { Statistics::Id::MemoryFootprint, "MemoryFootprint" },
     { Statistics::Id::MemoryStateEncoder, "MemoryStateEncoder" },
+    { Statistics::Id::MlirToJlmConversion, "MlirToJlmConversion" },
     { Statistics::Id::PullNodes, "PULL" },
     { Statistics::Id::PushNodes, "PUSH" },
     { Statistics::Id::ReduceNodes, "RED" },
@@ -41,8 +50,10 @@ GetStatisticsIdNames()
     { Statistics::Id::RvsdgOptimization, "RVSDGOPTIMIZATION" },
     { Statistics::Id::RvsdgTreePrinter, "RvsdgTreePrinter" },
     { Statistics::Id::SteensgaardAnalysis, "SteensgaardAnalysis" },
+    { Statistics::Id::TailRecursionElimination, "TailRecursionElimination" },
     { Statistics::Id::ThetaGammaInversion, "IVT" },
-    { Statistics::Id::TopDownMemoryNodeEliminator, "TopDownMemoryNodeEliminator" }
+    { Statistics::Id::TopDownMemoryNodeEliminator, "TopDownMemoryNodeEliminator" },
+    { Statistics::Id::UnreachableFunctionElimination, "UnreachableFunctionElimination" }
   };
   // Make sure every Statistic is mentioned in the mapping
   auto lastIdx = static_cast<size_t>(Statistics::Id::LastEnumValue);
@@ -121,6 +132,21 @@ Statistics::GetMeasurements() const
   return { Measurements_.begin(), Measurements_.end() };
 }
 
+void
+Statistics::AddMeasurements(const MemoryFootprint & memoryFootprint)
+{
+  using Category = MemoryFootprint::Category;
+
+  for (auto c = static_cast<size_t>(Category::FirstEnumValue) + 1;
+       c != static_cast<size_t>(Category::LastEnumValue);
+       c++)
+  {
+    auto category = static_cast<Category>(c);
+    if (auto numBytes = memoryFootprint.Get(category))
+      AddMeasurement(MemoryFootprint::GetLabel(category), static_cast<uint64_t>(numBytes));
+  }
+}
+
 bool
 Statistics::HasTimer(const std::string & name) const noexcept
 {
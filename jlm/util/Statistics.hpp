@@ -20,6 +20,8 @@
 namespace jlm::util
 {
 
+class MemoryFootprint;
+
 /**
  * \brief Statistics Interface
  */
@@ -34,15 +36,23 @@ public:
     AgnosticMemoryNodeProvisioning,
     AndersenAnalysis,
     Annotation,
+    BitwidthMinimization,
     CommonNodeElimination,
     ControlFlowRecovery,
     DataNodeToDelta,
     DeadNodeElimination,
     FunctionInlining,
+    GammaMerging,
+    InvariantLoadHoisting,
     InvariantValueRedirection,
+    JlmToMlirConversion,
     JlmToRvsdgConversion,
+    LoopFusion,
     LoopUnrolling,
+    LoopUnswitching,
+    MemoryFootprint,
     MemoryStateEncoder,
+    MlirToJlmConversion,
     PullNodes,
     PushNodes,
     ReduceNodes,
@@ -52,8 +62,10 @@ public:
     RvsdgOptimization,
     RvsdgTreePrinter,
     SteensgaardAnalysis,
+    TailRecursionElimination,
     ThetaGammaInversion,
     TopDownMemoryNodeEliminator,
+    UnreachableFunctionElimination,
 
     LastEnumValue // must always be the last enum value, used for iteration
   };
@@ -158,6 +170,13 @@ public:
   [[nodiscard]] util::iterator_range<TimerList::const_iterator>
   GetTimers() const;
 
+  /**
+   * Adds one measurement for every non-empty category of \p memoryFootprint, labeled with
+   * MemoryFootprint::GetLabel(). Requires that none of these measurements already exist.
+   */
+  void
+  AddMeasurements(const MemoryFootprint & memoryFootprint);
+
 protected:
   /**
    * Adds a measurement, identified by \p name, with the given value.
@@ -411,6 +430,16 @@ public:
     return CollectedStatistics_.size();
   }
 
+  /**
+   * @return The statistics that was collected as the \p index-th statistics.
+   */
+  [[nodiscard]] Statistics &
+  GetCollectedStatistics(size_t index) const noexcept
+  {
+    JLM_ASSERT(index < CollectedStatistics_.size());
+    return *CollectedStatistics_[index];
+  }
+
   /**
    * Checks if the pass statistics is demanded.
    *
@@ -0,0 +1,155 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_UTIL_UNIONFIND_HPP
+#define JLM_UTIL_UNIONFIND_HPP
+
+#include <jlm/util/common.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace jlm::util
+{
+
+/**
+ * A union-find data structure over the dense indices 0, 1, ..., NumElements() - 1. Elements are
+ * stored in flat parent and rank arrays, i.e., no allocation is performed per element or set.
+ * Find() uses path halving and Union() uses union by rank, which gives a near constant amortized
+ * cost for both operations.
+ *
+ * In contrast to disjointset, this class does not store any values. Users are expected to keep
+ * their own arrays indexed by the element indices.
+ *
+ * @tparam IndexType The unsigned integral type of the element indices.
+ *
+ * @see disjointset
+ */
+template<typename IndexType = uint32_t>
+class UnionFind final
+{
+  static_assert(std::is_integral_v<IndexType> && std::is_unsigned_v<IndexType>);
+
+public:
+  UnionFind() = default;
+
+  /**
+   * Adds a new element to its own singleton set.
+   *
+   * @return The index of the new element.
+   */
+  IndexType
+  MakeSet()
+  {
+    JLM_ASSERT(Parent_.size() < std::numeric_limits<IndexType>::max());
+
+    auto index = static_cast<IndexType>(Parent_.size());
+    Parent_.push_back(index);
+    Rank_.push_back(0);
+    NumSets_++;
+
+    return index;
+  }
+
+  /**
+   * Reserves space for \p numElements elements.
+   */
+  void
+  Reserve(size_t numElements)
+  {
+    Parent_.reserve(numElements);
+    Rank_.reserve(numElements);
+  }
+
+  /**
+   * Finds the root of the set containing \p element. Halves the path from \p element to the root,
+   * which does not change any of the sets.
+   *
+   * @param element The index of an element.
+   * @return The index of the root element of the set.
+   */
+  [[nodiscard]] IndexType
+  Find(IndexType element) const noexcept
+  {
+    JLM_ASSERT(element < Parent_.size());
+
+    while (Parent_[element] != element)
+    {
+      Parent_[element] = Parent_[Parent_[element]];
+      element = Parent_[element];
+    }
+
+    return element;
+  }
+
+  /**
+   * Merges the sets containing \p element1 and \p element2.
+   *
+   * @return The index of the root element of the merged set.
+   */
+  IndexType
+  Union(IndexType element1, IndexType element2) noexcept
+  {
+    auto root1 = Find(element1);
+    auto root2 = Find(element2);
+    if (root1 == root2)
+      return root1;
+
+    // Union by rank: Attach the shallower tree below the root of the deeper tree
+    if (Rank_[root1] < Rank_[root2])
+      std::swap(root1, root2);
+
+    Parent_[root2] = root1;
+    if (Rank_[root1] == Rank_[root2])
+      Rank_[root1]++;
+
+    NumSets_--;
+    return root1;
+  }
+
+  [[nodiscard]] bool
+  IsRoot(IndexType element) const noexcept
+  {
+    JLM_ASSERT(element < Parent_.size());
+    return Parent_[element] == element;
+  }
+
+  [[nodiscard]] size_t
+  NumElements() const noexcept
+  {
+    return Parent_.size();
+  }
+
+  [[nodiscard]] size_t
+  NumSets() const noexcept
+  {
+    return NumSets_;
+  }
+
+  /**
+   * @return The number of bytes allocated for the parent and rank arrays.
+   */
+  [[nodiscard]] size_t
+  EstimateHeapBytes() const noexcept
+  {
+    return Parent_.capacity() * sizeof(IndexType) + Rank_.capacity() * sizeof(uint8_t);
+  }
+
+private:
+  // Path halving in Find() is not observable from the outside
+  mutable std::vector<IndexType> Parent_;
+
+  // An upper bound on the height of each tree. It is at most log2(NumElements()).
+  std::vector<uint8_t> Rank_;
+
+  size_t NumSets_ = 0;
+};
+
+}
+
+#endif // JLM_UTIL_UNIONFIND_HPP
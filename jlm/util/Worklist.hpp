@@ -12,12 +12,159 @@
 #include <limits>
 #include <queue>
 #include <stack>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
 namespace jlm::util
 {
 
+namespace detail
+{
+
+/**
+ * Converts a work item of integral type to an index into the dense storage of a worklist.
+ */
+template<typename T>
+size_t
+WorkItemToIndex(T item) noexcept
+{
+  if constexpr (std::is_signed_v<T>)
+    JLM_ASSERT(item >= 0);
+
+  return static_cast<size_t>(item);
+}
+
+/**
+ * Tracks the set of work items that are currently on a worklist.
+ * @tparam T the type of the work items.
+ */
+template<typename T, typename Enable = void>
+class WorkItemSet final
+{
+public:
+  bool
+  Insert(T item)
+  {
+    return Items_.Insert(item);
+  }
+
+  [[nodiscard]] bool
+  Contains(T item) const noexcept
+  {
+    return Items_.Contains(item);
+  }
+
+  void
+  Remove(T item)
+  {
+    Items_.Remove(item);
+  }
+
+  [[nodiscard]] bool
+  IsEmpty() const noexcept
+  {
+    return Items_.IsEmpty();
+  }
+
+private:
+  util::HashSet<T> Items_;
+};
+
+/**
+ * Specialization for integral work items, such as the dense PointerObjectIndex values used by the
+ * points-to solvers. Membership is tracked in a bitvector indexed by the work item.
+ */
+template<typename T>
+class WorkItemSet<T, std::enable_if_t<std::is_integral_v<T>>> final
+{
+public:
+  bool
+  Insert(T item)
+  {
+    const auto index = WorkItemToIndex(item);
+    if (index >= OnList_.size())
+      OnList_.resize(std::max(index + 1, OnList_.size() * 2), false);
+
+    if (OnList_[index])
+      return false;
+
+    OnList_[index] = true;
+    NumItems_++;
+    return true;
+  }
+
+  [[nodiscard]] bool
+  Contains(T item) const noexcept
+  {
+    const auto index = WorkItemToIndex(item);
+    return index < OnList_.size() && OnList_[index];
+  }
+
+  void
+  Remove(T item)
+  {
+    if (!Contains(item))
+      return;
+
+    OnList_[WorkItemToIndex(item)] = false;
+    NumItems_--;
+  }
+
+  [[nodiscard]] bool
+  IsEmpty() const noexcept
+  {
+    return NumItems_ == 0;
+  }
+
+private:
+  std::vector<bool> OnList_;
+  size_t NumItems_ = 0;
+};
+
+/**
+ * Maps work items to the moment they were last fired, as used by the LRF worklists.
+ * Work items that have never been fired are mapped to 0.
+ * @tparam T the type of the work items.
+ */
+template<typename T, typename Enable = void>
+class LastFireMap final
+{
+public:
+  size_t &
+  operator[](T item)
+  {
+    return LastFire_[item];
+  }
+
+private:
+  std::unordered_map<T, size_t> LastFire_;
+};
+
+/**
+ * Specialization for integral work items, storing the last fire of each work item in a flat array
+ * indexed by the work item.
+ */
+template<typename T>
+class LastFireMap<T, std::enable_if_t<std::is_integral_v<T>>> final
+{
+public:
+  size_t &
+  operator[](T item)
+  {
+    const auto index = WorkItemToIndex(item);
+    if (index >= LastFire_.size())
+      LastFire_.resize(std::max(index + 1, LastFire_.size() * 2), 0);
+
+    return LastFire_[index];
+  }
+
+private:
+  std::vector<size_t> LastFire_;
+};
+
+}
+
 /**
  * Class for managing a set of work items, that are waiting to be visited by an algorithm.
  * The implementation decides in what order remaining work items should be processed.
@@ -67,6 +214,7 @@ public:
 /**
  * Worklist implementation using a stack.
  * Pushing a work item that is already on the stack is a no-op.
+ * For integral work items, membership is tracked in a bitvector instead of a hash set.
  * @tparam T the type of the work items.
  * @see Worklist
  */
@@ -103,7 +251,7 @@ public:
 
 private:
   // Tracking which work items are already on the list
-  util::HashSet<T> OnList_;
+  detail::WorkItemSet<T> OnList_;
 
   // The stack used to order the work items
   std::stack<T> WorkItems_;
@@ -112,6 +260,7 @@ private:
 /**
  * Worklist implementation using a queue.
  * Pushing a work item that is already in the queue is a no-op.
+ * For integral work items, membership is tracked in a bitvector instead of a hash set.
  * @tparam T the type of the work items.
  * @see Worklist
  */
@@ -148,7 +297,7 @@ public:
 
 private:
   // Tracking which work items are already on the list
-  util::HashSet<T> OnList_;
+  detail::WorkItemSet<T> OnList_;
 
   // The queue used to order the items
   std::queue<T> WorkItems_;
@@ -162,6 +311,7 @@ private:
  *   A. Kanamori and D. Weise "Worklist management strategies for Dataflow Analysis" (1994),
  * and used in
  *   Pierce's "Online cycle detection and difference propagation for pointer analysis" (2003).
+ * For integral work items, the time stamps are kept in a flat array indexed by the work item.
  * @tparam T the type of the work items.
  * @see Worklist
  */
@@ -218,7 +368,7 @@ private:
 
   // For each work item, when the item was last fired.
   // If the work item is currently in the queue, InQueueSentinelValue is used instead
-  std::unordered_map<T, size_t> LastFire_;
+  detail::LastFireMap<T> LastFire_;
 };
 
 /**
@@ -229,6 +379,7 @@ private:
  * Two-phase LRF is presented by
  *   B. Hardekopf and C. Lin "The And and the Grasshopper: Fast and Accurate Pointer Analysis
  *   for Millions of Lines of Code" (2007)
+ * For integral work items, the time stamps are kept in a flat array indexed by the work item.
  * @tparam T the type of the work items.
  * @see Worklist
  */
@@ -291,7 +442,7 @@ private:
 
   // For each work item, when the item was last fired.
   // If the work item is currently in the queue, InQueueSentinelValue is used instead
-  std::unordered_map<T, size_t> LastFire_;
+  detail::LastFireMap<T> LastFire_;
 };
 
 /**
@@ -299,6 +450,7 @@ private:
  * but without providing any kind of iteration interface for accessing them.
  * Each work item must be explicitly removed by name.
  * Used to implement the Topological worklist policy, which is not technically a worklist policy.
+ * For integral work items, membership is tracked in a bitvector instead of a hash set.
  * @tparam T the type of the work items.
  * @see Worklist
  */
@@ -341,7 +493,7 @@ public:
   }
 
 private:
-  util::HashSet<T> PushedItems_;
+  detail::WorkItemSet<T> PushedItems_;
 };
 
 }
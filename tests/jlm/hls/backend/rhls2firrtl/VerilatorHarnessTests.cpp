@@ -0,0 +1,90 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+
+#include <jlm/hls/backend/rhls2firrtl/verilator-harness-hls.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/add-forks.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/add-sinks.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/mem-conv.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/mem-sep.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/memstate-conv.hpp>
+#include <jlm/llvm/ir/operators.hpp>
+
+/**
+ * Creates a function that returns the value pointed to by its argument and converts it to RHLS.
+ */
+static std::unique_ptr<jlm::llvm::RvsdgModule>
+CreateLoad()
+{
+  using namespace jlm::llvm;
+
+  auto rvsdgModule = RvsdgModule::Create(jlm::util::filepath("test.ll"), "", "");
+  auto nf = rvsdgModule->Rvsdg().node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+
+  auto b32 = jlm::rvsdg::bittype::Create(32);
+  auto functionType = FunctionType::Create(
+      { PointerType::Create(), MemoryStateType::Create() },
+      { b32, MemoryStateType::Create() });
+
+  auto lambda = lambda::node::create(
+      rvsdgModule->Rvsdg().root(),
+      functionType,
+      "test",
+      linkage::external_linkage);
+
+  auto loadOutput = LoadNonVolatileNode::Create(
+      lambda->fctargument(0),
+      { lambda->fctargument(1) },
+      b32,
+      32);
+
+  auto lambdaOutput = lambda->finalize({ loadOutput[0], loadOutput[1] });
+  GraphExport::Create(*lambdaOutput, "f");
+
+  jlm::hls::mem_sep_argument(*rvsdgModule);
+  jlm::hls::MemoryConverter(*rvsdgModule);
+  jlm::hls::memstate_conv(*rvsdgModule);
+  jlm::hls::add_sinks(*rvsdgModule);
+  jlm::hls::add_forks(*rvsdgModule);
+
+  return rvsdgModule;
+}
+
+static int
+TestMemoryModel()
+{
+  using namespace jlm::hls;
+
+  // Arrange
+  auto rvsdgModule = CreateLoad();
+
+  MemoryModelConfiguration configuration;
+  configuration.Kind = MemoryModelConfiguration::Model::Dram;
+  configuration.Latency = 7;
+  configuration.MaxOutstanding = 3;
+
+  // Act
+  VerilatorHarnessHLS defaultHarness(jlm::util::filepath("test.v"));
+  auto defaultText = defaultHarness.run(*rvsdgModule);
+  VerilatorHarnessHLS dramHarness(jlm::util::filepath("test.v"), configuration);
+  auto dramText = dramHarness.run(*rvsdgModule);
+
+  // Assert
+  // The fixed latency model is the default and mirrors the previous behavior of the harness
+  assert(defaultText.find("#define MEM_MODEL 0\n") != std::string::npos);
+  assert(defaultText.find("#define MEM_LATENCY 10\n") != std::string::npos);
+
+  assert(dramText.find("#define MEM_MODEL 2\n") != std::string::npos);
+  assert(dramText.find("#define MEM_LATENCY 7\n") != std::string::npos);
+  assert(dramText.find("#define MEM_MAX_OUTSTANDING 3\n") != std::string::npos);
+  assert(dramText.find("mem_port_model mem_port[1];") != std::string::npos);
+  assert(dramText.find("mem_port[0].accept(") != std::string::npos);
+  assert(dramText.find("print_statistics") != std::string::npos);
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER("jlm/hls/backend/rhls2firrtl/VerilatorHarnessTests-MemoryModel", TestMemoryModel)
@@ -0,0 +1,175 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+
+#include <jlm/hls/backend/rvsdg2rhls/add-buffers.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/add-forks.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/ThetaConversion.hpp>
+#include <jlm/hls/ir/hls.hpp>
+#include <jlm/hls/util/RhlsSimulator.hpp>
+#include <jlm/llvm/ir/operators.hpp>
+#include <jlm/rvsdg/theta.hpp>
+
+static const jlm::hls::buffer_op *
+GetBuffer(const jlm::rvsdg::output & output)
+{
+  JLM_ASSERT(output.nusers() == 1);
+  auto input = jlm::util::AssertedCast<jlm::rvsdg::node_input>(*output.begin());
+  return dynamic_cast<const jlm::hls::buffer_op *>(&input->node()->operation());
+}
+
+static int
+TestReconvergentPaths()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::hls;
+
+  // Arrange
+  auto b32 = jlm::rvsdg::bittype::Create(32);
+  auto ft = FunctionType::Create({ b32 }, { b32 });
+
+  RvsdgModule rm(jlm::util::filepath(""), "", "");
+  auto nf = rm.Rvsdg().node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+
+  auto lambda = lambda::node::create(rm.Rvsdg().root(), ft, "f", linkage::external_linkage);
+
+  auto fork = fork_op::create(2, *lambda->fctargument(0));
+  auto longPath = fork[1];
+  for (size_t n = 0; n < 3; n++)
+  {
+    longPath = buffer_op::create(*longPath, 1)[0];
+  }
+  jlm::rvsdg::bitadd_op add(32);
+  auto sum = jlm::rvsdg::simple_node::create_normalized(
+      lambda->subregion(),
+      add,
+      { fork[0], longPath })[0];
+
+  auto f = lambda->finalize({ sum });
+  GraphExport::Create(*f, "");
+
+  // Act
+  auto report = add_buffers(rm, true, BufferSizingConfiguration());
+
+  // Assert
+  auto shortBuffer = GetBuffer(*fork[0]);
+  auto longBuffer = GetBuffer(*fork[1]);
+  assert(shortBuffer && shortBuffer->pass_through && shortBuffer->capacity == 3);
+  assert(longBuffer && longBuffer->pass_through && longBuffer->capacity == 1);
+  assert(report.NumBuffers == 2);
+  assert(report.TotalSlots == 4);
+  assert(report.EstimatedII == 1);
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER(
+    "jlm/hls/backend/rvsdg2rhls/AddBuffersTests-ReconvergentPaths",
+    TestReconvergentPaths)
+
+static int
+TestTargetII()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::hls;
+
+  // Arrange
+  auto b32 = jlm::rvsdg::bittype::Create(32);
+  auto ft = FunctionType::Create({ b32 }, { b32 });
+
+  RvsdgModule rm(jlm::util::filepath(""), "", "");
+  auto nf = rm.Rvsdg().node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+
+  auto lambda = lambda::node::create(rm.Rvsdg().root(), ft, "f", linkage::external_linkage);
+
+  auto fork = fork_op::create(2, *lambda->fctargument(0));
+  auto longPath = fork[1];
+  for (size_t n = 0; n < 4; n++)
+  {
+    longPath = buffer_op::create(*longPath, 1)[0];
+  }
+  jlm::rvsdg::bitadd_op add(32);
+  auto sum = jlm::rvsdg::simple_node::create_normalized(
+      lambda->subregion(),
+      add,
+      { fork[0], longPath })[0];
+
+  auto f = lambda->finalize({ sum });
+  GraphExport::Create(*f, "");
+
+  // Act
+  BufferSizingConfiguration configuration;
+  configuration.TargetII = 2;
+  auto report = add_buffers(rm, true, configuration);
+
+  // Assert
+  assert(GetBuffer(*fork[0])->capacity == 2);
+  assert(GetBuffer(*fork[1])->capacity == 1);
+  assert(report.TotalSlots == 3);
+  assert(report.EstimatedII == 2);
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER("jlm/hls/backend/rvsdg2rhls/AddBuffersTests-TargetII", TestTargetII)
+
+static int
+TestLoop()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::hls;
+
+  // Arrange
+  auto b32 = jlm::rvsdg::bittype::Create(32);
+  auto ft = FunctionType::Create({ b32, b32, b32 }, { b32, b32, b32 });
+
+  RvsdgModule rm(jlm::util::filepath(""), "", "");
+  auto nf = rm.Rvsdg().node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+
+  auto lambda = lambda::node::create(rm.Rvsdg().root(), ft, "f", linkage::external_linkage);
+
+  jlm::rvsdg::bitult_op ult(32);
+  jlm::rvsdg::bitadd_op add(32);
+
+  auto theta = jlm::rvsdg::ThetaNode::create(lambda->subregion());
+  auto subregion = theta->subregion();
+  auto idv = theta->add_loopvar(lambda->fctargument(0));
+  auto lvs = theta->add_loopvar(lambda->fctargument(1));
+  auto lve = theta->add_loopvar(lambda->fctargument(2));
+
+  auto arm = jlm::rvsdg::simple_node::create_normalized(
+      subregion,
+      add,
+      { idv->argument(), lvs->argument() })[0];
+  auto cmp =
+      jlm::rvsdg::simple_node::create_normalized(subregion, ult, { arm, lve->argument() })[0];
+  auto match = jlm::rvsdg::match(1, { { 1, 1 } }, 0, 2, cmp);
+
+  idv->result()->divert_to(arm);
+  theta->set_predicate(match);
+
+  auto f = lambda->finalize({ theta->output(0), theta->output(1), theta->output(2) });
+  GraphExport::Create(*f, "");
+
+  ConvertThetaNodes(rm);
+  add_forks(rm);
+
+  // Act
+  auto report = add_buffers(rm, true, BufferSizingConfiguration());
+
+  // Assert
+  // The back-edges are registered, such that an iteration can start at most every cycle.
+  assert(report.NumBuffers > 0);
+  assert(report.EstimatedII == 1);
+
+  RhlsSimulator simulator(*f->node());
+  auto results = simulator.Run({ 0, 1, 8 });
+  assert(results == std::vector<uint64_t>({ 8, 1, 8 }));
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER("jlm/hls/backend/rvsdg2rhls/AddBuffersTests-Loop", TestLoop)
@@ -0,0 +1,190 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+
+#include <jlm/hls/backend/rvsdg2rhls/alloca-conv.hpp>
+#include <jlm/hls/ir/hls.hpp>
+#include <jlm/llvm/ir/operators.hpp>
+#include <jlm/llvm/ir/operators/alloca.hpp>
+#include <jlm/llvm/ir/operators/GetElementPtr.hpp>
+#include <jlm/llvm/ir/operators/MemoryStateOperations.hpp>
+
+/**
+ * Creates a lambda that loads the elements 0 and 1 of a local array with four elements. If
+ * \p dynamicLoad is true, it additionally loads the element indexed by its first argument.
+ */
+static void
+CreateArrayLoads(jlm::llvm::RvsdgModule & rm, bool dynamicLoad)
+{
+  using namespace jlm::llvm;
+
+  auto b32 = jlm::rvsdg::bittype::Create(32);
+  auto b64 = jlm::rvsdg::bittype::Create(64);
+  auto arrayType = arraytype::Create(b32, 4);
+  auto ft = FunctionType::Create(
+      { b64, MemoryStateType::Create() },
+      { b32, b32, b32, MemoryStateType::Create() });
+
+  auto lambda = lambda::node::create(rm.Rvsdg().root(), ft, "f", linkage::external_linkage);
+  auto region = lambda->subregion();
+
+  auto size = jlm::rvsdg::create_bitconstant(region, 32, 1);
+  auto alloca = alloca_op::create(arrayType, size, 4);
+  auto state = MemoryStateMergeOperation::Create({ alloca[1], lambda->fctargument(1) });
+
+  auto zero = jlm::rvsdg::create_bitconstant(region, 64, 0);
+  auto one = jlm::rvsdg::create_bitconstant(region, 64, 1);
+  std::vector<jlm::rvsdg::output *> indices({ zero, one });
+  if (dynamicLoad)
+  {
+    indices.push_back(lambda->fctargument(0));
+  }
+
+  std::vector<jlm::rvsdg::output *> results;
+  for (auto index : indices)
+  {
+    auto address =
+        GetElementPtrOperation::Create(alloca[0], { zero, index }, arrayType, PointerType::Create());
+    auto load = LoadNonVolatileNode::Create(address, { state }, b32, 4);
+    results.push_back(load[0]);
+    state = load[1];
+  }
+  while (results.size() < 3)
+  {
+    results.push_back(results.back());
+  }
+  results.push_back(state);
+
+  auto f = lambda->finalize(results);
+  GraphExport::Create(*f, "");
+}
+
+static std::vector<jlm::rvsdg::node *>
+GetLocalMemories(jlm::llvm::RvsdgModule & rm)
+{
+  auto lambda = jlm::util::AssertedCast<jlm::llvm::lambda::node>(rm.Rvsdg().root()->nodes.first());
+  std::vector<jlm::rvsdg::node *> memories;
+  for (auto & node : lambda->subregion()->nodes)
+  {
+    if (jlm::rvsdg::is<jlm::hls::local_mem_op>(&node))
+    {
+      memories.push_back(&node);
+    }
+  }
+  return memories;
+}
+
+static int
+TestAutomaticPartitioning()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::hls;
+
+  // Arrange
+  RvsdgModule rm(jlm::util::filepath(""), "", "");
+  auto nf = rm.Rvsdg().node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+  CreateArrayLoads(rm, false);
+
+  // Act
+  LocalMemoryPartitioning partitioning;
+  partitioning.PartitionScheme = LocalMemoryPartitioning::Scheme::Automatic;
+  alloca_conv(rm, partitioning);
+
+  // Assert
+  // elements 0 and 1 are placed in different banks by a cyclic partitioning
+  auto memories = GetLocalMemories(rm);
+  assert(memories.size() == 2);
+  for (auto memory : memories)
+  {
+    auto memoryType = std::dynamic_pointer_cast<const arraytype>(memory->output(0)->Type());
+    assert(memoryType->nelements() == 2);
+    auto response = jlm::rvsdg::input::GetNode(**memory->output(0)->begin());
+    assert(jlm::rvsdg::is<local_mem_resp_op>(response));
+    assert(response->noutputs() == 1);
+  }
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER(
+    "jlm/hls/backend/rvsdg2rhls/AllocaConversionTests-AutomaticPartitioning",
+    TestAutomaticPartitioning)
+
+static int
+TestCrossbar()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::hls;
+
+  // Arrange
+  RvsdgModule rm(jlm::util::filepath(""), "", "");
+  auto nf = rm.Rvsdg().node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+  CreateArrayLoads(rm, true);
+
+  // Act
+  LocalMemoryPartitioning partitioning;
+  partitioning.PartitionScheme = LocalMemoryPartitioning::Scheme::Cyclic;
+  partitioning.Factor = 2;
+  alloca_conv(rm, partitioning);
+
+  // Assert
+  // every bank serves its static load and the dynamic load
+  auto memories = GetLocalMemories(rm);
+  assert(memories.size() == 2);
+  for (auto memory : memories)
+  {
+    auto response = jlm::rvsdg::input::GetNode(**memory->output(0)->begin());
+    assert(response->noutputs() == 2);
+    auto request = jlm::rvsdg::input::GetNode(**memory->output(1)->begin());
+    assert(jlm::rvsdg::is<local_mem_req_op>(request));
+    assert(request->ninputs() == 3);
+  }
+
+  size_t numMuxes = 0;
+  size_t numBranches = 0;
+  auto lambda = jlm::util::AssertedCast<lambda::node>(rm.Rvsdg().root()->nodes.first());
+  for (auto & node : lambda->subregion()->nodes)
+  {
+    numMuxes += jlm::rvsdg::is<jlm::hls::mux_op>(&node);
+    numBranches += jlm::rvsdg::is<jlm::hls::branch_op>(&node);
+  }
+  assert(numMuxes == 1);
+  assert(numBranches == 1);
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER("jlm/hls/backend/rvsdg2rhls/AllocaConversionTests-Crossbar", TestCrossbar)
+
+static int
+TestNoPartitioning()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::hls;
+
+  // Arrange
+  RvsdgModule rm(jlm::util::filepath(""), "", "");
+  auto nf = rm.Rvsdg().node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+  CreateArrayLoads(rm, true);
+
+  // Act
+  LocalMemoryPartitioning partitioning;
+  partitioning.PartitionScheme = LocalMemoryPartitioning::Scheme::Automatic;
+  alloca_conv(rm, partitioning);
+
+  // Assert
+  // the dynamic load is not bank-local, such that the array is kept in a single memory
+  auto memories = GetLocalMemories(rm);
+  assert(memories.size() == 1);
+  auto memoryType = std::dynamic_pointer_cast<const arraytype>(memories[0]->output(0)->Type());
+  assert(memoryType->nelements() == 4);
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER(
+    "jlm/hls/backend/rvsdg2rhls/AllocaConversionTests-NoPartitioning",
+    TestNoPartitioning)
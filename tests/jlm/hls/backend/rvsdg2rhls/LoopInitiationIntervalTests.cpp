@@ -0,0 +1,188 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+
+#include <jlm/hls/backend/rvsdg2rhls/add-buffers.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/add-forks.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/LoopInitiationInterval.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/ThetaConversion.hpp>
+#include <jlm/hls/ir/hls.hpp>
+#include <jlm/llvm/ir/operators.hpp>
+#include <jlm/rvsdg/theta.hpp>
+
+/**
+ * Creates a lambda with a loop that increments its first argument by its second argument until
+ * it reaches its third argument. The increment passes through \p numRegisters non-pass-through
+ * buffers.
+ */
+static jlm::llvm::lambda::output *
+CreateLoop(jlm::llvm::RvsdgModule & rm, size_t numRegisters)
+{
+  using namespace jlm::llvm;
+
+  auto b32 = jlm::rvsdg::bittype::Create(32);
+  auto ft = FunctionType::Create({ b32, b32, b32 }, { b32, b32, b32 });
+
+  auto lambda = lambda::node::create(rm.Rvsdg().root(), ft, "f", linkage::external_linkage);
+
+  jlm::rvsdg::bitult_op ult(32);
+  jlm::rvsdg::bitadd_op add(32);
+
+  auto theta = jlm::rvsdg::ThetaNode::create(lambda->subregion());
+  auto subregion = theta->subregion();
+  auto idv = theta->add_loopvar(lambda->fctargument(0));
+  auto lvs = theta->add_loopvar(lambda->fctargument(1));
+  auto lve = theta->add_loopvar(lambda->fctargument(2));
+
+  auto arm = jlm::rvsdg::simple_node::create_normalized(
+      subregion,
+      add,
+      { idv->argument(), lvs->argument() })[0];
+  for (size_t n = 0; n < numRegisters; n++)
+  {
+    arm = jlm::hls::buffer_op::create(*arm, 1)[0];
+  }
+  auto cmp =
+      jlm::rvsdg::simple_node::create_normalized(subregion, ult, { arm, lve->argument() })[0];
+  auto match = jlm::rvsdg::match(1, { { 1, 1 } }, 0, 2, cmp);
+
+  idv->result()->divert_to(arm);
+  theta->set_predicate(match);
+
+  auto f = lambda->finalize({ theta->output(0), theta->output(1), theta->output(2) });
+  GraphExport::Create(*f, "");
+
+  jlm::hls::ConvertThetaNodes(rm);
+
+  return f;
+}
+
+static int
+TestPipelinedLoop()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::hls;
+
+  // Arrange
+  RvsdgModule rm(jlm::util::filepath(""), "", "");
+  auto nf = rm.Rvsdg().node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+
+  CreateLoop(rm, 0);
+
+  // Act
+  auto loops = ComputeLoopInitiationIntervals(rm, 10);
+
+  // Assert
+  assert(loops.size() == 1);
+  assert(loops[0].GetII() == 1);
+  assert(loops[0].ToString().find("loop in f: II 1") == 0);
+
+  auto & path = loops[0].GetCriticalPath();
+  assert(!path.empty());
+  assert(dynamic_cast<const backedge_argument *>(path.front()));
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER(
+    "jlm/hls/backend/rvsdg2rhls/LoopInitiationIntervalTests-PipelinedLoop",
+    TestPipelinedLoop)
+
+static int
+TestRegisteredRecurrence()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::hls;
+
+  // Arrange
+  RvsdgModule rm(jlm::util::filepath(""), "", "");
+  auto nf = rm.Rvsdg().node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+
+  CreateLoop(rm, 2);
+
+  // Act
+  auto loops = ComputeLoopInitiationIntervals(rm, 10);
+
+  // Assert
+  // two registers in the loop body plus the register of the back-edge
+  assert(loops.size() == 1);
+  assert(loops[0].GetII() == 3);
+
+  auto str = loops[0].ToString();
+  assert(str.find("loop in f: II 3") == 0);
+  assert(str.find("HLS_BUF_1 -> HLS_BUF_1") != std::string::npos);
+
+  auto & path = loops[0].GetCriticalPath();
+  assert(dynamic_cast<const backedge_argument *>(path.front()));
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER(
+    "jlm/hls/backend/rvsdg2rhls/LoopInitiationIntervalTests-RegisteredRecurrence",
+    TestRegisteredRecurrence)
+
+static int
+TestBufferSizing()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::hls;
+
+  // Arrange
+  RvsdgModule rm(jlm::util::filepath(""), "", "");
+  auto nf = rm.Rvsdg().node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+
+  CreateLoop(rm, 2);
+  add_forks(rm);
+
+  // Act
+  auto report = add_buffers(rm, true, BufferSizingConfiguration());
+
+  // Assert
+  assert(report.EstimatedII == 3);
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER(
+    "jlm/hls/backend/rvsdg2rhls/LoopInitiationIntervalTests-BufferSizing",
+    TestBufferSizing)
+
+static int
+TestRegionDepth()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::hls;
+
+  // Arrange
+  RvsdgModule rm(jlm::util::filepath(""), "", "");
+  auto nf = rm.Rvsdg().node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+
+  auto f = CreateLoop(rm, 2);
+  auto lambda = f->node();
+  auto loop = dynamic_cast<const loop_node *>(
+      jlm::rvsdg::output::GetNode(*lambda->subregion()->result(0)->origin()));
+  assert(loop);
+
+  // Act
+  LatencyModel latencyModel(10);
+  auto loopDepth = latencyModel.GetRegionDepth(*loop->subregion());
+  auto lambdaDepth = latencyModel.GetRegionDepth(*lambda->subregion());
+  auto rootDepth = latencyModel.GetRegionDepth(*rm.Rvsdg().root());
+
+  // Assert
+  // the two registers are on the path from the arguments to the results of the loop body
+  assert(loopDepth >= 2);
+  assert(latencyModel.GetOutputLatency(*loop->output(0)) == loopDepth);
+  assert(lambdaDepth == loopDepth);
+  assert(rootDepth == loopDepth);
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER(
+    "jlm/hls/backend/rvsdg2rhls/LoopInitiationIntervalTests-RegionDepth",
+    TestRegionDepth)
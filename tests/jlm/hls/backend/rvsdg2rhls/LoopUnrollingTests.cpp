@@ -0,0 +1,256 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+
+#include <jlm/hls/backend/rvsdg2rhls/add-buffers.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/add-forks.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/add-sinks.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/GammaConversion.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/LoopUnrolling.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/mem-conv.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/mem-queue.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/mem-sep.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/memstate-conv.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/remove-unused-state.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/ThetaConversion.hpp>
+#include <jlm/hls/util/RhlsSimulator.hpp>
+#include <jlm/llvm/ir/operators.hpp>
+#include <jlm/rvsdg/theta.hpp>
+
+/**
+ * Creates a function that sums the first elements of the array a, multiplied by the factor f if
+ * \p multiply is set. The loop iterates \p numIterations times, or f times if \p numIterations is
+ * zero.
+ *
+ * @param swapOperands If true, the loop compares end > i instead of i < end.
+ */
+static std::unique_ptr<jlm::llvm::RvsdgModule>
+CreateSumLoop(bool multiply, bool swapOperands = false, int64_t numIterations = 16)
+{
+  using namespace jlm::llvm;
+
+  auto rvsdgModule = RvsdgModule::Create(jlm::util::filepath(""), "", "");
+  auto nf = rvsdgModule->Rvsdg().node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+
+  auto b32 = jlm::rvsdg::bittype::Create(32);
+  auto functionType = FunctionType::Create(
+      { b32, PointerType::Create(), MemoryStateType::Create() },
+      { b32, MemoryStateType::Create() });
+
+  auto lambda = lambda::node::create(
+      rvsdgModule->Rvsdg().root(),
+      functionType,
+      "test",
+      linkage::external_linkage);
+
+  auto theta = jlm::rvsdg::ThetaNode::create(lambda->subregion());
+  auto thetaRegion = theta->subregion();
+  auto zero = jlm::rvsdg::create_bitconstant(lambda->subregion(), 32, 0);
+  auto idv = theta->add_loopvar(zero);
+  auto sum = theta->add_loopvar(zero);
+  auto factor = theta->add_loopvar(lambda->fctargument(0));
+  auto base = theta->add_loopvar(lambda->fctargument(1));
+  auto memoryState = theta->add_loopvar(lambda->fctargument(2));
+
+  auto address = GetElementPtrOperation::Create(
+      base->argument(),
+      { idv->argument() },
+      b32,
+      PointerType::Create());
+  auto loadOutput = LoadNonVolatileNode::Create(address, { memoryState->argument() }, b32, 32);
+  auto value = loadOutput[0];
+  if (multiply)
+    value = jlm::rvsdg::bitmul_op::create(32, value, factor->argument());
+
+  auto one = jlm::rvsdg::create_bitconstant(thetaRegion, 32, 1);
+  auto end = numIterations != 0
+               ? jlm::rvsdg::create_bitconstant(thetaRegion, 32, numIterations)
+               : factor->argument();
+  auto next = jlm::rvsdg::bitadd_op::create(32, idv->argument(), one);
+  auto accumulated = jlm::rvsdg::bitadd_op::create(32, sum->argument(), value);
+  jlm::rvsdg::bitult_op ult(32);
+  jlm::rvsdg::bitugt_op ugt(32);
+  auto cmp = swapOperands
+               ? jlm::rvsdg::simple_node::create_normalized(thetaRegion, ugt, { end, next })[0]
+               : jlm::rvsdg::simple_node::create_normalized(thetaRegion, ult, { next, end })[0];
+  auto match = jlm::rvsdg::match(1, { { 1, 1 } }, 0, 2, cmp);
+
+  idv->result()->divert_to(next);
+  sum->result()->divert_to(accumulated);
+  memoryState->result()->divert_to(loadOutput[1]);
+  theta->set_predicate(match);
+
+  auto lambdaOutput = lambda->finalize({ theta->output(1), theta->output(4) });
+  GraphExport::Create(*lambdaOutput, "f");
+
+  return rvsdgModule;
+}
+
+static const jlm::llvm::lambda::node &
+GetLambda(jlm::llvm::RvsdgModule & rvsdgModule)
+{
+  return *jlm::util::AssertedCast<jlm::llvm::lambda::node>(
+      rvsdgModule.Rvsdg().root()->nodes.first());
+}
+
+static jlm::rvsdg::ThetaNode &
+GetTheta(jlm::llvm::RvsdgModule & rvsdgModule)
+{
+  for (auto & node : GetLambda(rvsdgModule).subregion()->Nodes())
+  {
+    if (auto theta = dynamic_cast<jlm::rvsdg::ThetaNode *>(&node))
+      return *theta;
+  }
+  JLM_UNREACHABLE("Expected a theta node");
+}
+
+/**
+ * Converts the function to RHLS, buffers the loads, and simulates it.
+ */
+static std::vector<uint64_t>
+ConvertAndSimulate(jlm::llvm::RvsdgModule & rvsdgModule, size_t & numCycles)
+{
+  jlm::hls::mem_sep_argument(rvsdgModule);
+  jlm::hls::remove_unused_state(rvsdgModule);
+  jlm::hls::ConvertGammaNodes(rvsdgModule);
+  jlm::hls::ConvertThetaNodes(rvsdgModule);
+  jlm::hls::mem_queue(rvsdgModule);
+  jlm::hls::MemoryConverter(rvsdgModule, 4);
+  jlm::hls::memstate_conv(rvsdgModule);
+  jlm::hls::add_sinks(rvsdgModule);
+  jlm::hls::add_forks(rvsdgModule);
+  jlm::hls::add_buffers(rvsdgModule, true);
+
+  jlm::hls::RhlsSimulator simulator(GetLambda(rvsdgModule));
+  for (size_t n = 0; n < 16; n++)
+  {
+    simulator.WriteMemory(0x1000 + 4 * n, n + 1, 4);
+  }
+  auto results = simulator.Run({ 3, 0x1000 });
+  numCycles = simulator.GetNumCycles();
+
+  return results;
+}
+
+static int
+TestUnrollFactor()
+{
+  using namespace jlm::hls;
+
+  // Arrange
+  auto sumLoop = CreateSumLoop(false);
+  auto multiplyLoop = CreateSumLoop(true);
+
+  UnrollConfiguration configuration;
+  configuration.MaxFactor = 8;
+  configuration.NumMemoryPorts = 4;
+  configuration.AreaBudget = 500;
+
+  UnrollConfiguration disabled;
+  disabled.MaxFactor = 1;
+
+  // Act & Assert
+  // The single load of the loop limits the factor to the number of memory ports
+  assert(ComputeUnrollFactor(GetTheta(*sumLoop), configuration) == 4);
+  configuration.NumMemoryPorts = 2;
+  assert(ComputeUnrollFactor(GetTheta(*sumLoop), configuration) == 2);
+
+  // A factor of three requires a fourth copy of the load for the remaining iteration
+  configuration.NumMemoryPorts = 3;
+  assert(ComputeUnrollFactor(GetTheta(*sumLoop), configuration) == 2);
+
+  // Two multipliers fit into the area budget
+  configuration.NumMemoryPorts = 8;
+  assert(ComputeUnrollFactor(GetTheta(*multiplyLoop), configuration) == 2);
+
+  assert(ComputeUnrollFactor(GetTheta(*sumLoop), disabled) == 1);
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER(
+    "jlm/hls/backend/rvsdg2rhls/LoopUnrollingTests-UnrollFactor",
+    TestUnrollFactor)
+
+static int
+TestUnrollSumLoop()
+{
+  using namespace jlm::hls;
+
+  // Arrange
+  auto reference = CreateSumLoop(true);
+  auto unrolled = CreateSumLoop(true);
+
+  // Act
+  auto numUnrolled = UnrollLoops(*unrolled, UnrollConfiguration());
+
+  // Assert
+  assert(numUnrolled == 1);
+
+  auto & theta = GetTheta(*unrolled);
+  size_t numLoads = 0;
+  for (auto & node : theta.subregion()->Nodes())
+  {
+    if (jlm::rvsdg::is<jlm::llvm::LoadNonVolatileOperation>(&node))
+      numLoads++;
+  }
+  assert(numLoads == 4);
+
+  size_t referenceCycles = 0;
+  auto referenceResults = ConvertAndSimulate(*reference, referenceCycles);
+  size_t numCycles = 0;
+  auto results = ConvertAndSimulate(*unrolled, numCycles);
+
+  assert(referenceResults == std::vector<uint64_t>({ 3 * 136 }));
+  assert(results == referenceResults);
+  // Every copy of the load received its own port, such that the loads are issued in parallel
+  assert(GetLambda(*reference).nfctarguments() == 3 + 1);
+  assert(GetLambda(*unrolled).nfctarguments() == 3 + 4);
+  assert(3 * numCycles < 2 * referenceCycles);
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER(
+    "jlm/hls/backend/rvsdg2rhls/LoopUnrollingTests-UnrollSumLoop",
+    TestUnrollSumLoop)
+
+static int
+TestUnrollSwappedComparison()
+{
+  using namespace jlm::hls;
+
+  UnrollConfiguration configuration;
+  configuration.NumMemoryPorts = 8;
+
+  // The loop executes 16, 13, or 14 iterations, such that no, one, or two iterations remain after
+  // unrolling, or the trip count is only known at runtime
+  for (int64_t numIterations : { 16, 13, 14, 0 })
+  {
+    // Arrange
+    auto reference = CreateSumLoop(false, true, numIterations);
+    auto unrolled = CreateSumLoop(false, true, numIterations);
+
+    // Act
+    auto numUnrolled = UnrollLoops(*unrolled, configuration);
+
+    // Assert
+    assert(numUnrolled == 1);
+
+    size_t referenceCycles = 0;
+    auto referenceResults = ConvertAndSimulate(*reference, referenceCycles);
+    size_t numCycles = 0;
+    auto results = ConvertAndSimulate(*unrolled, numCycles);
+
+    auto n = numIterations != 0 ? numIterations : 3;
+    assert(referenceResults == std::vector<uint64_t>({ uint64_t(n * (n + 1) / 2) }));
+    assert(results == referenceResults);
+  }
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER(
+    "jlm/hls/backend/rvsdg2rhls/LoopUnrollingTests-UnrollSwappedComparison",
+    TestUnrollSwappedComparison)
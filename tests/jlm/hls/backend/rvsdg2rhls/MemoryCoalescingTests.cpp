@@ -0,0 +1,340 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+
+#include <jlm/hls/backend/rvsdg2rhls/mem-conv.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/mem-queue.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/mem-sep.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/MemoryCoalescing.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/ThetaConversion.hpp>
+#include <jlm/hls/ir/hls.hpp>
+#include <jlm/hls/util/RhlsSimulator.hpp>
+#include <jlm/llvm/ir/operators.hpp>
+#include <jlm/rvsdg/theta.hpp>
+
+/**
+ * Creates a theta node in the region of \p sum that adds the first \p end elements of the array
+ * \p base with a stride of \p stride elements to \p sum. If \p store is true, every partial sum is
+ * also stored back to the element it was computed from.
+ *
+ * \return The theta node. Its outputs 1 and 4 are the sum and the memory state.
+ */
+static jlm::rvsdg::ThetaNode &
+CreateSumTheta(
+    jlm::rvsdg::output & sum,
+    jlm::rvsdg::output & end,
+    jlm::rvsdg::output & base,
+    jlm::rvsdg::output & memoryState,
+    size_t stride,
+    bool store)
+{
+  using namespace jlm::llvm;
+
+  auto b32 = jlm::rvsdg::bittype::Create(32);
+  auto theta = jlm::rvsdg::ThetaNode::create(sum.region());
+  auto thetaRegion = theta->subregion();
+  auto zero = jlm::rvsdg::create_bitconstant(sum.region(), 32, 0);
+  auto idv = theta->add_loopvar(zero);
+  auto sumVariable = theta->add_loopvar(&sum);
+  auto endVariable = theta->add_loopvar(&end);
+  auto baseVariable = theta->add_loopvar(&base);
+  auto memoryStateVariable = theta->add_loopvar(&memoryState);
+
+  auto address = GetElementPtrOperation::Create(
+      baseVariable->argument(),
+      { idv->argument() },
+      b32,
+      PointerType::Create());
+  auto loadOutput =
+      LoadNonVolatileNode::Create(address, { memoryStateVariable->argument() }, b32, 32);
+
+  jlm::rvsdg::bitadd_op add(32);
+  jlm::rvsdg::bitult_op ult(32);
+  auto step = jlm::rvsdg::create_bitconstant(thetaRegion, 32, stride);
+  auto next =
+      jlm::rvsdg::simple_node::create_normalized(thetaRegion, add, { idv->argument(), step })[0];
+  auto accumulated = jlm::rvsdg::simple_node::create_normalized(
+      thetaRegion,
+      add,
+      { sumVariable->argument(), loadOutput[0] })[0];
+  auto cmp = jlm::rvsdg::simple_node::create_normalized(
+      thetaRegion,
+      ult,
+      { next, endVariable->argument() })[0];
+  auto match = jlm::rvsdg::match(1, { { 1, 1 } }, 0, 2, cmp);
+
+  auto state = loadOutput[1];
+  if (store)
+    state = StoreNonVolatileNode::Create(address, accumulated, { state }, 32)[0];
+
+  idv->result()->divert_to(next);
+  sumVariable->result()->divert_to(accumulated);
+  memoryStateVariable->result()->divert_to(state);
+  theta->set_predicate(match);
+
+  return *theta;
+}
+
+/**
+ * Creates a function with the arguments sum, n, a, and a memory state, and the empty lambda body.
+ */
+static jlm::llvm::lambda::node &
+CreateSumFunction(jlm::llvm::RvsdgModule & rvsdgModule)
+{
+  using namespace jlm::llvm;
+
+  auto nf = rvsdgModule.Rvsdg().node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+
+  auto b32 = jlm::rvsdg::bittype::Create(32);
+  auto functionType = FunctionType::Create(
+      { b32, b32, PointerType::Create(), MemoryStateType::Create() },
+      { b32, MemoryStateType::Create() });
+
+  return *lambda::node::create(
+      rvsdgModule.Rvsdg().root(),
+      functionType,
+      "test",
+      linkage::external_linkage);
+}
+
+/**
+ * Converts \p rvsdgModule to RHLS up to and including MemoryConverter.
+ */
+static void
+ConvertToRhls(jlm::llvm::RvsdgModule & rvsdgModule)
+{
+  jlm::hls::mem_sep_argument(rvsdgModule);
+  jlm::hls::ConvertThetaNodes(rvsdgModule);
+  jlm::hls::mem_queue(rvsdgModule);
+  jlm::hls::MemoryConverter(rvsdgModule);
+}
+
+/**
+ * Creates a function that sums the first n elements of the array a with a stride of \p stride
+ * elements, and converts it to RHLS up to and including MemoryConverter.
+ */
+static std::unique_ptr<jlm::llvm::RvsdgModule>
+CreateSumLoop(size_t stride, bool store = false)
+{
+  using namespace jlm::llvm;
+
+  auto rvsdgModule = RvsdgModule::Create(jlm::util::filepath(""), "", "");
+  auto & lambda = CreateSumFunction(*rvsdgModule);
+  auto & theta = CreateSumTheta(
+      *lambda.fctargument(0),
+      *lambda.fctargument(1),
+      *lambda.fctargument(2),
+      *lambda.fctargument(3),
+      stride,
+      store);
+
+  auto lambdaOutput = lambda.finalize({ theta.output(1), theta.output(4) });
+  GraphExport::Create(*lambdaOutput, "f");
+
+  ConvertToRhls(*rvsdgModule);
+
+  return rvsdgModule;
+}
+
+/**
+ * Creates a function that sums the first n elements of the array a twice, once in every iteration
+ * of an outer loop, and converts it to RHLS up to and including MemoryConverter.
+ */
+static std::unique_ptr<jlm::llvm::RvsdgModule>
+CreateRepeatedSumLoop()
+{
+  using namespace jlm::llvm;
+
+  auto rvsdgModule = RvsdgModule::Create(jlm::util::filepath(""), "", "");
+  auto & lambda = CreateSumFunction(*rvsdgModule);
+
+  auto outerTheta = jlm::rvsdg::ThetaNode::create(lambda.subregion());
+  auto outerRegion = outerTheta->subregion();
+  auto zero = jlm::rvsdg::create_bitconstant(lambda.subregion(), 32, 0);
+  auto counter = outerTheta->add_loopvar(zero);
+  auto sum = outerTheta->add_loopvar(lambda.fctargument(0));
+  auto end = outerTheta->add_loopvar(lambda.fctargument(1));
+  auto base = outerTheta->add_loopvar(lambda.fctargument(2));
+  auto memoryState = outerTheta->add_loopvar(lambda.fctargument(3));
+
+  auto & innerTheta = CreateSumTheta(
+      *sum->argument(),
+      *end->argument(),
+      *base->argument(),
+      *memoryState->argument(),
+      1,
+      false);
+
+  auto one = jlm::rvsdg::create_bitconstant(outerRegion, 32, 1);
+  auto two = jlm::rvsdg::create_bitconstant(outerRegion, 32, 2);
+  jlm::rvsdg::bitadd_op add(32);
+  jlm::rvsdg::bitult_op ult(32);
+  auto next =
+      jlm::rvsdg::simple_node::create_normalized(outerRegion, add, { counter->argument(), one })[0];
+  auto cmp = jlm::rvsdg::simple_node::create_normalized(outerRegion, ult, { next, two })[0];
+  auto match = jlm::rvsdg::match(1, { { 1, 1 } }, 0, 2, cmp);
+
+  counter->result()->divert_to(next);
+  sum->result()->divert_to(innerTheta.output(1));
+  memoryState->result()->divert_to(innerTheta.output(4));
+  outerTheta->set_predicate(match);
+
+  auto lambdaOutput = lambda.finalize({ outerTheta->output(1), outerTheta->output(4) });
+  GraphExport::Create(*lambdaOutput, "f");
+
+  ConvertToRhls(*rvsdgModule);
+
+  return rvsdgModule;
+}
+
+static const jlm::llvm::lambda::node &
+GetLambda(jlm::llvm::RvsdgModule & rvsdgModule)
+{
+  return *jlm::util::AssertedCast<jlm::llvm::lambda::node>(
+      rvsdgModule.Rvsdg().root()->nodes.first());
+}
+
+static std::vector<uint64_t>
+Simulate(jlm::hls::RhlsSimulator & simulator, size_t numElements)
+{
+  for (size_t n = 0; n < numElements; n++)
+  {
+    simulator.WriteMemory(0x1000 + 4 * n, n + 1, 4);
+  }
+  return simulator.Run({ 0, numElements, 0x1000 });
+}
+
+static int
+TestUnitStride()
+{
+  // Arrange
+  auto reference = CreateSumLoop(1);
+  auto coalesced = CreateSumLoop(1);
+  jlm::hls::BurstConfiguration configuration;
+  configuration.BurstLength = 4;
+
+  // Act
+  auto numCoalesced = jlm::hls::CoalesceDecoupledLoads(*coalesced, configuration);
+
+  // Assert
+  assert(numCoalesced == 1);
+  auto & lambda = GetLambda(*coalesced);
+  assert(jlm::rvsdg::Region::Contains<jlm::hls::burst_load_op>(*lambda.subregion(), true));
+  assert(!jlm::rvsdg::Region::Contains<jlm::hls::decoupled_load_op>(*lambda.subregion(), true));
+
+  jlm::hls::RhlsSimulator referenceSimulator(GetLambda(*reference));
+  auto referenceResults = Simulate(referenceSimulator, 16);
+  jlm::hls::RhlsSimulator simulator(lambda);
+  auto results = Simulate(simulator, 16);
+
+  assert(referenceResults == std::vector<uint64_t>({ 136 }));
+  assert(results == referenceResults);
+  assert(referenceSimulator.GetNumMemoryRequests() == 16);
+  assert(simulator.GetNumMemoryRequests() == 4);
+  assert(simulator.ToString().find("Memory requests: 4\n") != std::string::npos);
+  assert(simulator.GetNumCycles() <= referenceSimulator.GetNumCycles());
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER(
+    "jlm/hls/backend/rvsdg2rhls/MemoryCoalescingTests-UnitStride",
+    TestUnitStride)
+
+static int
+TestMultiBeatBurst()
+{
+  // Arrange
+  auto rvsdgModule = CreateSumLoop(1);
+  jlm::hls::BurstConfiguration configuration;
+  configuration.BurstLength = 8;
+
+  // Act
+  auto numCoalesced = jlm::hls::CoalesceDecoupledLoads(*rvsdgModule, configuration);
+
+  // Assert
+  assert(numCoalesced == 1);
+
+  jlm::hls::RhlsSimulator simulator(GetLambda(*rvsdgModule));
+  auto results = Simulate(simulator, 20);
+  assert(results == std::vector<uint64_t>({ 210 }));
+  assert(simulator.GetNumMemoryRequests() == 3);
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER(
+    "jlm/hls/backend/rvsdg2rhls/MemoryCoalescingTests-MultiBeatBurst",
+    TestMultiBeatBurst)
+
+static int
+TestNonUnitStride()
+{
+  // Arrange
+  auto rvsdgModule = CreateSumLoop(2);
+
+  // Act
+  auto numCoalesced = jlm::hls::CoalesceDecoupledLoads(*rvsdgModule, {});
+
+  // Assert
+  assert(numCoalesced == 0);
+  auto & lambda = GetLambda(*rvsdgModule);
+  assert(jlm::rvsdg::Region::Contains<jlm::hls::decoupled_load_op>(*lambda.subregion(), true));
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER(
+    "jlm/hls/backend/rvsdg2rhls/MemoryCoalescingTests-NonUnitStride",
+    TestNonUnitStride)
+
+static int
+TestStoreToSamePort()
+{
+  // Arrange
+  auto rvsdgModule = CreateSumLoop(1, true);
+
+  // Act
+  auto numCoalesced = jlm::hls::CoalesceDecoupledLoads(*rvsdgModule, {});
+
+  // Assert
+  assert(numCoalesced == 0);
+  auto & lambda = GetLambda(*rvsdgModule);
+  assert(!jlm::rvsdg::Region::Contains<jlm::hls::burst_load_op>(*lambda.subregion(), true));
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER(
+    "jlm/hls/backend/rvsdg2rhls/MemoryCoalescingTests-StoreToSamePort",
+    TestStoreToSamePort)
+
+static int
+TestLoopReentry()
+{
+  // Arrange
+  auto reference = CreateRepeatedSumLoop();
+  auto coalesced = CreateRepeatedSumLoop();
+
+  // Act
+  auto numCoalesced = jlm::hls::CoalesceDecoupledLoads(*coalesced, {});
+
+  // Assert
+  assert(numCoalesced == 1);
+
+  // Both executions of the inner loop read the same line, which is requested again after the
+  // loop is entered for the second time
+  jlm::hls::RhlsSimulator referenceSimulator(GetLambda(*reference));
+  auto referenceResults = Simulate(referenceSimulator, 2);
+  jlm::hls::RhlsSimulator simulator(GetLambda(*coalesced));
+  auto results = Simulate(simulator, 2);
+
+  assert(referenceResults == std::vector<uint64_t>({ 6 }));
+  assert(results == referenceResults);
+  assert(simulator.GetNumMemoryRequests() == 2);
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER(
+    "jlm/hls/backend/rvsdg2rhls/MemoryCoalescingTests-LoopReentry",
+    TestLoopReentry)
@@ -0,0 +1,182 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+
+#include <jlm/hls/backend/rvsdg2rhls/add-buffers.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/add-forks.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/add-sinks.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/mem-conv.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/mem-queue.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/mem-sep.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/memstate-conv.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/PerformanceCounters.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/remove-unused-state.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/ThetaConversion.hpp>
+#include <jlm/hls/ir/hls.hpp>
+#include <jlm/hls/util/RhlsSimulator.hpp>
+#include <jlm/llvm/ir/operators.hpp>
+#include <jlm/rvsdg/theta.hpp>
+
+/**
+ * Creates a function that sums the elements of the array a from index i up to 16 and converts it
+ * to RHLS. The start index is an argument, as the induction variable of a loop that only depends
+ * on constants runs ahead into the next invocation of the loop.
+ */
+static std::unique_ptr<jlm::llvm::RvsdgModule>
+CreateSumLoop()
+{
+  using namespace jlm::llvm;
+
+  auto rvsdgModule = RvsdgModule::Create(jlm::util::filepath(""), "", "");
+  auto nf = rvsdgModule->Rvsdg().node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+
+  auto b32 = jlm::rvsdg::bittype::Create(32);
+  auto functionType = FunctionType::Create(
+      { b32, PointerType::Create(), MemoryStateType::Create() },
+      { b32, MemoryStateType::Create() });
+
+  auto lambda = lambda::node::create(
+      rvsdgModule->Rvsdg().root(),
+      functionType,
+      "test",
+      linkage::external_linkage);
+
+  auto theta = jlm::rvsdg::ThetaNode::create(lambda->subregion());
+  auto thetaRegion = theta->subregion();
+  auto zero = jlm::rvsdg::create_bitconstant(lambda->subregion(), 32, 0);
+  auto idv = theta->add_loopvar(lambda->fctargument(0));
+  auto sum = theta->add_loopvar(zero);
+  auto base = theta->add_loopvar(lambda->fctargument(1));
+  auto memoryState = theta->add_loopvar(lambda->fctargument(2));
+
+  auto address = GetElementPtrOperation::Create(
+      base->argument(),
+      { idv->argument() },
+      b32,
+      PointerType::Create());
+  auto loadOutput = LoadNonVolatileNode::Create(address, { memoryState->argument() }, b32, 32);
+
+  auto one = jlm::rvsdg::create_bitconstant(thetaRegion, 32, 1);
+  auto end = jlm::rvsdg::create_bitconstant(thetaRegion, 32, 16);
+  auto next = jlm::rvsdg::bitadd_op::create(32, idv->argument(), one);
+  auto accumulated = jlm::rvsdg::bitadd_op::create(32, sum->argument(), loadOutput[0]);
+  jlm::rvsdg::bitult_op ult(32);
+  auto cmp = jlm::rvsdg::simple_node::create_normalized(thetaRegion, ult, { next, end })[0];
+  auto match = jlm::rvsdg::match(1, { { 1, 1 } }, 0, 2, cmp);
+
+  idv->result()->divert_to(next);
+  sum->result()->divert_to(accumulated);
+  memoryState->result()->divert_to(loadOutput[1]);
+  theta->set_predicate(match);
+
+  auto lambdaOutput = lambda->finalize({ theta->output(1), theta->output(3) });
+  GraphExport::Create(*lambdaOutput, "f");
+
+  jlm::hls::mem_sep_argument(*rvsdgModule);
+  jlm::hls::remove_unused_state(*rvsdgModule);
+  jlm::hls::ConvertThetaNodes(*rvsdgModule);
+  jlm::hls::mem_queue(*rvsdgModule);
+  jlm::hls::MemoryConverter(*rvsdgModule);
+  jlm::hls::memstate_conv(*rvsdgModule);
+  jlm::hls::add_sinks(*rvsdgModule);
+  jlm::hls::add_forks(*rvsdgModule);
+  jlm::hls::add_buffers(*rvsdgModule, true);
+
+  return rvsdgModule;
+}
+
+static const jlm::llvm::lambda::node &
+GetLambda(jlm::llvm::RvsdgModule & rvsdgModule)
+{
+  return *jlm::util::AssertedCast<jlm::llvm::lambda::node>(
+      rvsdgModule.Rvsdg().root()->nodes.first());
+}
+
+static std::vector<uint64_t>
+Simulate(jlm::hls::RhlsSimulator & simulator)
+{
+  for (size_t n = 0; n < 16; n++)
+  {
+    simulator.WriteMemory(0x1000 + 4 * n, n + 1, 4);
+  }
+  return simulator.Run({ 0, 0x1000 });
+}
+
+static int
+TestCountIterations()
+{
+  using namespace jlm::hls;
+
+  // Arrange
+  auto reference = CreateSumLoop();
+  auto instrumented = CreateSumLoop();
+
+  // Act
+  auto numCounters = AddPerformanceCounters(*instrumented, PerformanceCounterConfiguration());
+
+  // Assert
+  auto counters = GetPerformanceCounters(*GetLambda(*instrumented).subregion());
+  assert(counters.size() == numCounters);
+
+  size_t numIterationCounters = 0;
+  for (size_t n = 0; n < counters.size(); n++)
+  {
+    auto & operation = *jlm::util::AssertedCast<const perf_counter_op>(&counters[n]->operation());
+    assert(operation.id() == n);
+    if (operation.kind() == perf_counter_op::counter_kind::iterations)
+    {
+      assert(operation.name() == "loop0");
+      numIterationCounters++;
+    }
+  }
+  assert(numIterationCounters == 1);
+  // Besides the iteration counter, the loop inputs and the address of the load are instrumented
+  assert(numCounters > 2);
+
+  RhlsSimulator referenceSimulator(GetLambda(*reference));
+  auto referenceResults = Simulate(referenceSimulator);
+  RhlsSimulator simulator(GetLambda(*instrumented));
+  auto results = Simulate(simulator);
+
+  // The counters do not change the behavior or the timing of the circuit
+  assert(referenceResults == std::vector<uint64_t>({ 136 }));
+  assert(results == referenceResults);
+  assert(simulator.GetNumCycles() == referenceSimulator.GetNumCycles());
+
+  auto values = simulator.GetPerformanceCounters();
+  assert(values.size() == numCounters);
+  assert(values[0] == 16);
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER(
+    "jlm/hls/backend/rvsdg2rhls/PerformanceCountersTests-CountIterations",
+    TestCountIterations)
+
+static int
+TestConfiguration()
+{
+  using namespace jlm::hls;
+
+  // Arrange
+  auto rvsdgModule = CreateSumLoop();
+  PerformanceCounterConfiguration configuration;
+  configuration.LoopStallCounters = false;
+  configuration.MemoryStallCounters = false;
+
+  // Act
+  auto numCounters = AddPerformanceCounters(*rvsdgModule, configuration);
+
+  // Assert
+  assert(numCounters == 1);
+  assert(GetPerformanceCounters(*GetLambda(*rvsdgModule).subregion()).size() == 1);
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER(
+    "jlm/hls/backend/rvsdg2rhls/PerformanceCountersTests-Configuration",
+    TestConfiguration)
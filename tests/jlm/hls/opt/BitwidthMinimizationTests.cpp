@@ -0,0 +1,254 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+
+#include <jlm/hls/backend/rvsdg2rhls/ThetaConversion.hpp>
+#include <jlm/hls/opt/BitwidthMinimization.hpp>
+#include <jlm/hls/util/RhlsSimulator.hpp>
+#include <jlm/llvm/ir/operators.hpp>
+#include <jlm/rvsdg/gamma.hpp>
+#include <jlm/rvsdg/theta.hpp>
+#include <jlm/util/Statistics.hpp>
+
+/**
+ * Creates a function that counts from zero to \p bound with the comparison Compare and
+ * accumulates its argument in every iteration. The function returns the counter and the sum.
+ */
+template<class Compare>
+static jlm::llvm::lambda::output *
+CreateCountedLoop(jlm::llvm::RvsdgModule & rm, uint64_t bound, bool boundIsArgument)
+{
+  using namespace jlm::llvm;
+
+  auto b32 = jlm::rvsdg::bittype::Create(32);
+  auto ft = FunctionType::Create({ b32, b32 }, { b32, b32 });
+
+  auto lambda = lambda::node::create(rm.Rvsdg().root(), ft, "f", linkage::external_linkage);
+  auto zero = jlm::rvsdg::create_bitconstant(lambda->subregion(), 32, 0);
+
+  auto theta = jlm::rvsdg::ThetaNode::create(lambda->subregion());
+  auto subregion = theta->subregion();
+  auto counter = theta->add_loopvar(zero);
+  auto sum = theta->add_loopvar(zero);
+  auto value = theta->add_loopvar(lambda->fctargument(0));
+  auto limit = theta->add_loopvar(lambda->fctargument(1));
+
+  auto one = jlm::rvsdg::create_bitconstant(subregion, 32, 1);
+  auto next = jlm::rvsdg::bitadd_op::create(32, counter->argument(), one);
+  auto nextSum = jlm::rvsdg::bitadd_op::create(32, sum->argument(), value->argument());
+  auto boundValue = boundIsArgument ? limit->argument()
+                                    : jlm::rvsdg::create_bitconstant(subregion, 32, bound);
+  Compare compare(32);
+  auto condition =
+      jlm::rvsdg::simple_node::create_normalized(subregion, compare, { next, boundValue })[0];
+  auto predicate = jlm::rvsdg::match(1, { { 1, 1 } }, 0, 2, condition);
+
+  counter->result()->divert_to(next);
+  sum->result()->divert_to(nextSum);
+  theta->set_predicate(predicate);
+
+  auto f = lambda->finalize({ counter, sum });
+  GraphExport::Create(*f, "");
+
+  return f;
+}
+
+static jlm::rvsdg::ThetaNode *
+GetTheta(jlm::llvm::lambda::output & lambdaOutput)
+{
+  for (auto & node : lambdaOutput.node()->subregion()->Nodes())
+  {
+    if (auto theta = dynamic_cast<jlm::rvsdg::ThetaNode *>(&node))
+      return theta;
+  }
+  return nullptr;
+}
+
+static int
+TestLoopRanges()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::hls;
+
+  // Arrange
+  RvsdgModule rm(jlm::util::filepath(""), "", "");
+  auto nf = rm.Rvsdg().node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+
+  auto f = CreateCountedLoop<jlm::rvsdg::bitult_op>(rm, 100, false);
+  auto theta = GetTheta(*f);
+
+  // Act
+  ValueRangeAnalysis analysis;
+  analysis.Analyze(*f->node()->subregion());
+
+  // Assert
+  auto counterRange = analysis.GetRange(*theta->input(0)->argument());
+  assert(counterRange == ValueRange({ 0, 99 }));
+  assert(counterRange.GetRequiredBits() == 7);
+  assert(analysis.GetRange(*theta->output(0)) == ValueRange({ 1, 100 }));
+
+  // The sum is not bounded
+  assert(analysis.GetRange(*theta->output(1)) == ValueRange::CreateFull(32));
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER("jlm/hls/opt/BitwidthMinimizationTests-LoopRanges", TestLoopRanges)
+
+static int
+TestGammaRanges()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::hls;
+
+  // Arrange
+  auto b1 = jlm::rvsdg::bittype::Create(1);
+  auto b32 = jlm::rvsdg::bittype::Create(32);
+  auto ft = FunctionType::Create({ b1 }, { b32 });
+
+  RvsdgModule rm(jlm::util::filepath(""), "", "");
+  auto nf = rm.Rvsdg().node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+
+  auto lambda = lambda::node::create(rm.Rvsdg().root(), ft, "f", linkage::external_linkage);
+  auto predicate = jlm::rvsdg::match(1, { { 1, 1 } }, 0, 2, lambda->fctargument(0));
+  auto gamma = jlm::rvsdg::GammaNode::create(predicate, 2);
+  auto three = jlm::rvsdg::create_bitconstant(gamma->subregion(0), 32, 3);
+  auto ten = jlm::rvsdg::create_bitconstant(gamma->subregion(1), 32, 10);
+  auto exitVar = gamma->add_exitvar({ three, ten });
+  auto f = lambda->finalize({ exitVar });
+  GraphExport::Create(*f, "");
+
+  // Act
+  ValueRangeAnalysis analysis;
+  analysis.Analyze(*lambda->subregion());
+
+  // Assert
+  assert(analysis.GetRange(*exitVar) == ValueRange({ 3, 10 }));
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER("jlm/hls/opt/BitwidthMinimizationTests-GammaRanges", TestGammaRanges)
+
+static int
+TestNarrowLoop()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::hls;
+
+  // Arrange
+  RvsdgModule rm(jlm::util::filepath(""), "", "");
+  auto nf = rm.Rvsdg().node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+
+  auto f = CreateCountedLoop<jlm::rvsdg::bitslt_op>(rm, 100, false);
+
+  // Act
+  BitwidthMinimization bitwidthMinimization;
+  jlm::util::StatisticsCollector statisticsCollector;
+  bitwidthMinimization.run(rm, statisticsCollector);
+
+  // Assert
+  // The counter and its increment are narrowed to 7 bits, the signed comparison to 8 bits
+  assert(bitwidthMinimization.GetNumNarrowedLoopVariables() == 1);
+  assert(bitwidthMinimization.GetNumNarrowedOperations() == 2);
+  assert(bitwidthMinimization.GetBitsSaved() == (32 - 7) + (32 - 7) + (32 - 8));
+
+  auto theta = GetTheta(*f);
+  auto numNarrowLoopVars = 0;
+  for (size_t n = 0; n < theta->ninputs(); n++)
+  {
+    if (theta->input(n)->type() == *jlm::rvsdg::bittype::Create(7))
+      numNarrowLoopVars++;
+  }
+  assert(numNarrowLoopVars == 1);
+
+  ConvertThetaNodes(rm);
+  RhlsSimulator simulator(*f->node());
+  auto results = simulator.Run({ 3, 0 });
+  assert(results == std::vector<uint64_t>({ 100, 300 }));
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER("jlm/hls/opt/BitwidthMinimizationTests-NarrowLoop", TestNarrowLoop)
+
+static int
+TestUnboundedLoop()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::hls;
+
+  // Arrange
+  RvsdgModule rm(jlm::util::filepath(""), "", "");
+  auto nf = rm.Rvsdg().node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+
+  auto f = CreateCountedLoop<jlm::rvsdg::bitult_op>(rm, 0, true);
+
+  // Act
+  BitwidthMinimization bitwidthMinimization;
+  jlm::util::StatisticsCollector statisticsCollector;
+  bitwidthMinimization.run(rm, statisticsCollector);
+
+  // Assert
+  assert(bitwidthMinimization.GetNumNarrowedLoopVariables() == 0);
+  assert(bitwidthMinimization.GetNumNarrowedOperations() == 0);
+  assert(bitwidthMinimization.GetBitsSaved() == 0);
+
+  ConvertThetaNodes(rm);
+  RhlsSimulator simulator(*f->node());
+  auto results = simulator.Run({ 2, 5 });
+  assert(results == std::vector<uint64_t>({ 5, 10 }));
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER("jlm/hls/opt/BitwidthMinimizationTests-UnboundedLoop", TestUnboundedLoop)
+
+static int
+TestWideTruncation()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::hls;
+
+  // Arrange
+  auto b128 = jlm::rvsdg::bittype::Create(128);
+  auto b32 = jlm::rvsdg::bittype::Create(32);
+  auto ft = FunctionType::Create({ b128 }, { b32 });
+
+  RvsdgModule rm(jlm::util::filepath(""), "", "");
+  auto nf = rm.Rvsdg().node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+
+  auto lambda = lambda::node::create(rm.Rvsdg().root(), ft, "f", linkage::external_linkage);
+  auto truncated = trunc_op::create(32, lambda->fctargument(0));
+  auto five = jlm::rvsdg::create_bitconstant(lambda->subregion(), 32, 5);
+  auto sum = jlm::rvsdg::bitadd_op::create(32, truncated, five);
+
+  auto f = lambda->finalize({ sum });
+  GraphExport::Create(*f, "");
+
+  // Act
+  ValueRangeAnalysis analysis;
+  analysis.Analyze(*lambda->subregion());
+
+  BitwidthMinimization bitwidthMinimization;
+  jlm::util::StatisticsCollector statisticsCollector;
+  bitwidthMinimization.run(rm, statisticsCollector);
+
+  // Assert
+  // Nothing is known about the truncated value of the 128 bit argument
+  assert(analysis.GetRange(*lambda->fctargument(0)) == ValueRange::CreateUnknown());
+  assert(analysis.GetRange(*truncated) == ValueRange::CreateFull(32));
+  assert(analysis.GetRange(*sum) == ValueRange::CreateFull(32));
+
+  assert(bitwidthMinimization.GetNumNarrowedOperations() == 0);
+  auto addNode = jlm::rvsdg::output::GetNode(*lambda->fctresult(0)->origin());
+  assert(jlm::rvsdg::is<jlm::rvsdg::bitadd_op>(addNode));
+  assert(addNode->output(0)->type() == *b32);
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER("jlm/hls/opt/BitwidthMinimizationTests-WideTruncation", TestWideTruncation)
@@ -0,0 +1,165 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+
+#include <jlm/hls/ir/hls.hpp>
+#include <jlm/hls/opt/ResourceSharing.hpp>
+#include <jlm/hls/util/RhlsSimulator.hpp>
+#include <jlm/llvm/ir/operators.hpp>
+#include <jlm/util/Statistics.hpp>
+
+static size_t
+CountNodes(const jlm::rvsdg::Region & region, const std::string & kind)
+{
+  size_t count = 0;
+  for (auto & node : region.Nodes())
+  {
+    if (jlm::hls::OperatorCostTable::GetOperatorKind(node.operation()) == kind)
+      count++;
+  }
+  return count;
+}
+
+static int
+TestExclusiveBranches()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  auto b32 = jlm::rvsdg::bittype::Create(32);
+  auto ft = FunctionType::Create({ jlm::rvsdg::bittype::Create(1), b32, b32 }, { b32 });
+
+  RvsdgModule rm(jlm::util::filepath(""), "", "");
+  auto nf = rm.Rvsdg().node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+
+  auto lambda = lambda::node::create(rm.Rvsdg().root(), ft, "f", linkage::external_linkage);
+  auto subregion = lambda->subregion();
+  auto predicate = jlm::rvsdg::match(1, { { 0, 0 } }, 1, 2, lambda->fctargument(0));
+
+  // RHLS representation of a gamma node converted without speculation
+  auto x = jlm::hls::branch_op::create(*predicate, *lambda->fctargument(1));
+  auto y = jlm::hls::branch_op::create(*predicate, *lambda->fctargument(2));
+
+  jlm::rvsdg::bitmul_op mul(32);
+  jlm::rvsdg::bitadd_op add(32);
+  auto mul0 = jlm::rvsdg::simple_node::create_normalized(subregion, mul, { x[0], y[0] })[0];
+  auto add0 = jlm::rvsdg::simple_node::create_normalized(subregion, add, { mul0, x[0] })[0];
+  auto mul1 = jlm::rvsdg::simple_node::create_normalized(subregion, mul, { x[1], x[1] })[0];
+
+  auto mux = jlm::hls::mux_op::create(*predicate, { add0, mul1 }, false);
+  auto f = lambda->finalize({ mux[0] });
+  GraphExport::Create(*f, "");
+
+  auto costTable = jlm::hls::OperatorCostTable::CreateDefault();
+  auto estimateBefore = jlm::hls::EstimateResources(*rm.Rvsdg().root(), costTable);
+
+  // Act
+  jlm::util::StatisticsCollector statisticsCollector;
+  jlm::hls::ResourceSharing resourceSharing(costTable);
+  resourceSharing.run(rm, statisticsCollector);
+
+  auto estimateAfter = jlm::hls::EstimateResources(*rm.Rvsdg().root(), costTable);
+
+  // Assert
+  assert(resourceSharing.GetNumSharedUnits() == 1);
+  assert(resourceSharing.GetAreaSaved() > 0);
+  assert(CountNodes(*subregion, "mul") == 1);
+  assert(estimateBefore.NumUnits == 2 && estimateAfter.NumUnits == 1);
+  assert(estimateAfter.Area == estimateBefore.Area / 2);
+  assert(estimateAfter.Latency == estimateBefore.Latency);
+
+  jlm::hls::RhlsSimulator simulator(*f->node());
+  assert(simulator.Run({ 0, 3, 5 }) == std::vector<uint64_t>({ 18 }));
+  assert(simulator.Run({ 1, 3, 5 }) == std::vector<uint64_t>({ 9 }));
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER("jlm/hls/opt/ResourceSharingTests-ExclusiveBranches", TestExclusiveBranches)
+
+static int
+TestSpeculation()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  auto b32 = jlm::rvsdg::bittype::Create(32);
+  auto ft = FunctionType::Create({ jlm::rvsdg::ControlType::Create(2), b32, b32 }, { b32 });
+
+  RvsdgModule rm(jlm::util::filepath(""), "", "");
+  auto nf = rm.Rvsdg().node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+
+  auto lambda = lambda::node::create(rm.Rvsdg().root(), ft, "f", linkage::external_linkage);
+  auto subregion = lambda->subregion();
+
+  // RHLS representation of a gamma node converted with speculation
+  jlm::rvsdg::bitmul_op mul(32);
+  auto x = lambda->fctargument(1);
+  auto y = lambda->fctargument(2);
+  auto mul0 = jlm::rvsdg::simple_node::create_normalized(subregion, mul, { x, y })[0];
+  auto mul1 = jlm::rvsdg::simple_node::create_normalized(subregion, mul, { x, x })[0];
+
+  auto mux = jlm::hls::mux_op::create(*lambda->fctargument(0), { mul0, mul1 }, true);
+  auto f = lambda->finalize({ mux[0] });
+  GraphExport::Create(*f, "");
+
+  // Act
+  jlm::util::StatisticsCollector statisticsCollector;
+  jlm::hls::ResourceSharing resourceSharing;
+  resourceSharing.run(rm, statisticsCollector);
+
+  // Assert
+  assert(resourceSharing.GetNumSharedUnits() == 0);
+  assert(CountNodes(*subregion, "mul") == 2);
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER("jlm/hls/opt/ResourceSharingTests-Speculation", TestSpeculation)
+
+static int
+TestUnprofitable()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  auto b32 = jlm::rvsdg::bittype::Create(32);
+  auto ft = FunctionType::Create({ jlm::rvsdg::ControlType::Create(2), b32, b32 }, { b32 });
+
+  RvsdgModule rm(jlm::util::filepath(""), "", "");
+  auto nf = rm.Rvsdg().node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+
+  auto lambda = lambda::node::create(rm.Rvsdg().root(), ft, "f", linkage::external_linkage);
+  auto subregion = lambda->subregion();
+  auto predicate = lambda->fctargument(0);
+
+  auto x = jlm::hls::branch_op::create(*predicate, *lambda->fctargument(1));
+  auto y = jlm::hls::branch_op::create(*predicate, *lambda->fctargument(2));
+
+  jlm::rvsdg::bitmul_op mul(32);
+  auto mul0 = jlm::rvsdg::simple_node::create_normalized(subregion, mul, { x[0], y[0] })[0];
+  auto mul1 = jlm::rvsdg::simple_node::create_normalized(subregion, mul, { x[1], y[1] })[0];
+
+  auto mux = jlm::hls::mux_op::create(*predicate, { mul0, mul1 }, false);
+  auto f = lambda->finalize({ mux[0] });
+  GraphExport::Create(*f, "");
+
+  jlm::hls::OperatorCostTable costTable;
+  costTable.SetCost("mul", { 4, 1 });
+
+  // Act
+  jlm::util::StatisticsCollector statisticsCollector;
+  jlm::hls::ResourceSharing resourceSharing(costTable);
+  resourceSharing.run(rm, statisticsCollector);
+
+  // Assert
+  assert(resourceSharing.GetNumSharedUnits() == 0);
+  assert(CountNodes(*subregion, "mul") == 2);
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER("jlm/hls/opt/ResourceSharingTests-Unprofitable", TestUnprofitable)
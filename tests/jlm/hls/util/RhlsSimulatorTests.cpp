@@ -0,0 +1,172 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+
+#include <jlm/hls/backend/rvsdg2rhls/mem-conv.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/ThetaConversion.hpp>
+#include <jlm/hls/ir/hls.hpp>
+#include <jlm/hls/util/RhlsSimulator.hpp>
+#include <jlm/llvm/ir/operators.hpp>
+#include <jlm/rvsdg/theta.hpp>
+
+#include <cassert>
+#include <string>
+
+static int
+TestLoop()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  auto b32 = jlm::rvsdg::bittype::Create(32);
+  auto ft = FunctionType::Create({ b32, b32, b32 }, { b32, b32, b32 });
+
+  RvsdgModule rm(jlm::util::filepath(""), "", "");
+  auto nf = rm.Rvsdg().node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+
+  auto lambda = lambda::node::create(rm.Rvsdg().root(), ft, "f", linkage::external_linkage);
+
+  jlm::rvsdg::bitult_op ult(32);
+  jlm::rvsdg::bitadd_op add(32);
+
+  auto theta = jlm::rvsdg::ThetaNode::create(lambda->subregion());
+  auto subregion = theta->subregion();
+  auto idv = theta->add_loopvar(lambda->fctargument(0));
+  auto lvs = theta->add_loopvar(lambda->fctargument(1));
+  auto lve = theta->add_loopvar(lambda->fctargument(2));
+
+  auto arm = jlm::rvsdg::simple_node::create_normalized(
+      subregion,
+      add,
+      { idv->argument(), lvs->argument() })[0];
+  auto cmp =
+      jlm::rvsdg::simple_node::create_normalized(subregion, ult, { arm, lve->argument() })[0];
+  auto match = jlm::rvsdg::match(1, { { 1, 1 } }, 0, 2, cmp);
+
+  idv->result()->divert_to(arm);
+  theta->set_predicate(match);
+
+  auto f = lambda->finalize({ theta->output(0), theta->output(1), theta->output(2) });
+  GraphExport::Create(*f, "");
+
+  jlm::hls::ConvertThetaNodes(rm);
+
+  // Act
+  jlm::hls::RhlsSimulator simulator(*f->node());
+  auto shortResults = simulator.Run({ 0, 1, 4 });
+  auto shortCycles = simulator.GetNumCycles();
+  auto longResults = simulator.Run({ 0, 1, 16 });
+  auto longCycles = simulator.GetNumCycles();
+  auto report = simulator.ToString();
+
+  // Assert
+  assert(shortResults == std::vector<uint64_t>({ 4, 1, 4 }));
+  assert(longResults == std::vector<uint64_t>({ 16, 1, 16 }));
+  assert(longCycles > shortCycles);
+
+  auto edges = simulator.GetEdgeStatistics();
+  assert(!edges.empty());
+
+  // The report describes the last invocation
+  assert(report.find("Cycles: " + std::to_string(longCycles) + "\n") == 0);
+  auto stalls = "Stalls: " + std::to_string(simulator.GetNumStalls()) + "\n";
+  assert(report.find(stalls) != std::string::npos);
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER("jlm/hls/util/RhlsSimulatorTests-Loop", TestLoop)
+
+static int
+TestMemoryLatency()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::hls;
+
+  // Arrange
+  auto rvsdgModule = RvsdgModule::Create(jlm::util::filepath(""), "", "");
+  auto nf = rvsdgModule->Rvsdg().node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+
+  auto functionType = FunctionType::Create(
+      { PointerType::Create(), MemoryStateType::Create() },
+      { jlm::rvsdg::bittype::Create(32), MemoryStateType::Create() });
+
+  auto lambda = lambda::node::create(
+      rvsdgModule->Rvsdg().root(),
+      functionType,
+      "test",
+      linkage::external_linkage);
+
+  auto loadOutput = LoadNonVolatileNode::Create(
+      lambda->fctargument(0),
+      { lambda->fctargument(1) },
+      jlm::rvsdg::bittype::Create(32),
+      32);
+
+  auto lambdaOutput = lambda->finalize({ loadOutput[0], loadOutput[1] });
+  GraphExport::Create(*lambdaOutput, "f");
+
+  MemoryConverter(*rvsdgModule);
+  lambda = jlm::util::AssertedCast<lambda::node>(rvsdgModule->Rvsdg().root()->nodes.first());
+
+  // Act
+  RhlsSimulator::Configuration fastConfiguration;
+  fastConfiguration.MemoryLatency = 5;
+  RhlsSimulator fastSimulator(*lambda, fastConfiguration);
+  fastSimulator.WriteMemory(0x1000, 42, 4);
+  auto fastResults = fastSimulator.Run({ 0x1000 });
+
+  RhlsSimulator::Configuration slowConfiguration;
+  slowConfiguration.MemoryLatency = 15;
+  RhlsSimulator slowSimulator(*lambda, slowConfiguration);
+  slowSimulator.WriteMemory(0x1000, 42, 4);
+  auto slowResults = slowSimulator.Run({ 0x1000 });
+
+  // Assert
+  assert(fastResults == std::vector<uint64_t>({ 42 }));
+  assert(slowResults == std::vector<uint64_t>({ 42 }));
+  assert(slowSimulator.GetNumCycles() - fastSimulator.GetNumCycles() == 10);
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER("jlm/hls/util/RhlsSimulatorTests-MemoryLatency", TestMemoryLatency)
+
+static int
+TestBufferOccupancy()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  auto b32 = jlm::rvsdg::bittype::Create(32);
+  auto ft = FunctionType::Create({ b32 }, { b32 });
+
+  RvsdgModule rm(jlm::util::filepath(""), "", "");
+  auto nf = rm.Rvsdg().node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+
+  auto lambda = lambda::node::create(rm.Rvsdg().root(), ft, "f", linkage::external_linkage);
+  auto buffer = jlm::hls::buffer_op::create(*lambda->fctargument(0), 4)[0];
+  auto f = lambda->finalize({ buffer });
+  GraphExport::Create(*f, "");
+
+  // Act
+  jlm::hls::RhlsSimulator simulator(*f->node());
+  auto results = simulator.Run({ 7 });
+
+  // Assert
+  assert(results == std::vector<uint64_t>({ 7 }));
+  assert(simulator.GetNumCycles() == 2);
+  assert(simulator.GetNumStalls() == 0);
+
+  auto buffers = simulator.GetBufferStatistics();
+  assert(buffers.size() == 1);
+  assert(buffers[0].Capacity == 4);
+  assert(buffers[0].MaxOccupancy == 1);
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER("jlm/hls/util/RhlsSimulatorTests-BufferOccupancy", TestBufferOccupancy)
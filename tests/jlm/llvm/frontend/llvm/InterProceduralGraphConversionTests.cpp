@@ -0,0 +1,107 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-operation.hpp>
+#include <test-registry.hpp>
+#include <test-types.hpp>
+
+#include <jlm/llvm/frontend/InterProceduralGraphConversion.hpp>
+#include <jlm/llvm/ir/ipgraph-module.hpp>
+#include <jlm/llvm/ir/operators/lambda.hpp>
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/util/Statistics.hpp>
+
+/**
+ * Adds an externally visible function with the given \p name to \p ipgModule. The function
+ * consists of a single test operation that maps its argument to its result.
+ */
+static jlm::llvm::function_node &
+AddFunction(jlm::llvm::ipgraph_module & ipgModule, const std::string & name)
+{
+  using namespace jlm::llvm;
+
+  auto valueType = jlm::tests::valuetype::Create();
+  auto functionType = FunctionType::Create({ valueType }, { valueType });
+
+  auto cfg = cfg::create(ipgModule);
+  auto argument = cfg->entry()->append_argument(argument::create("x", valueType));
+
+  auto basicBlock = basic_block::create(*cfg);
+  jlm::tests::test_op operation({ valueType }, { valueType });
+  auto threeAddressCode = basicBlock->append_last(tac::create(operation, { argument }));
+  cfg->exit()->append_result(threeAddressCode->result(0));
+
+  cfg->exit()->divert_inedges(basicBlock);
+  basicBlock->add_outedge(cfg->exit());
+
+  auto functionNode =
+      function_node::create(ipgModule.ipgraph(), name, functionType, linkage::external_linkage);
+  functionNode->add_cfg(std::move(cfg));
+  ipgModule.create_variable(functionNode);
+
+  return *functionNode;
+}
+
+static int
+TestConversionKeepsModule()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  auto ipgModule = ipgraph_module::create(jlm::util::filepath(""), "", "");
+  auto & f = AddFunction(*ipgModule, "f");
+  jlm::util::StatisticsCollector statisticsCollector;
+
+  // Act
+  auto rvsdgModule = ConvertInterProceduralGraphModule(*ipgModule, statisticsCollector);
+
+  // Assert
+  assert(rvsdgModule->Rvsdg().root()->nresults() == 1);
+  assert(f.hasBody());
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/frontend/llvm/InterProceduralGraphConversionTests-ConversionKeepsModule",
+    TestConversionKeepsModule)
+
+static int
+TestStreamingConversion()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  auto ipgModule = ipgraph_module::create(jlm::util::filepath(""), "", "");
+  AddFunction(*ipgModule, "f");
+  AddFunction(*ipgModule, "g");
+
+  jlm::util::StatisticsCollectorSettings settings(
+      { jlm::util::Statistics::Id::RvsdgConstruction });
+  jlm::util::StatisticsCollector statisticsCollector(std::move(settings));
+
+  // Act
+  auto rvsdgModule = ConvertInterProceduralGraphModule(std::move(ipgModule), statisticsCollector);
+
+  // Assert
+  auto & rootRegion = *rvsdgModule->Rvsdg().root();
+  assert(rootRegion.nresults() == 2);
+  for (size_t n = 0; n < rootRegion.nresults(); n++)
+  {
+    auto node = jlm::rvsdg::output::GetNode(*rootRegion.result(n)->origin());
+    assert(dynamic_cast<const lambda::node *>(node));
+  }
+
+  assert(statisticsCollector.NumCollectedStatistics() == 1);
+  auto & statistics = *statisticsCollector.CollectedStatistics().begin();
+  auto peakRssBefore = statistics.GetMeasurementValue<uint64_t>("#BytesPeakRssBefore");
+  auto peakRssAfter = statistics.GetMeasurementValue<uint64_t>("#BytesPeakRssAfter");
+  assert(peakRssBefore > 0);
+  assert(peakRssAfter >= peakRssBefore);
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/frontend/llvm/InterProceduralGraphConversionTests-StreamingConversion",
+    TestStreamingConversion)
@@ -0,0 +1,139 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+
+#include <jlm/llvm/frontend/UnreachableFunctionElimination.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IR/Verifier.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/raw_ostream.h>
+
+/**
+ * Creates a module with the following functions:
+ * - f: external, calls g
+ * - g: internal, reachable from f
+ * - h: internal, unreachable, calls k
+ * - k: internal, only reachable from h
+ * - u: internal, referenced by the initializer of the external global variable "table"
+ * Additionally, the internal global variable "unused" refers to h.
+ */
+static std::unique_ptr<llvm::Module>
+CreateModule(llvm::LLVMContext & context)
+{
+  using namespace llvm;
+
+  auto module = std::make_unique<Module>("module", context);
+
+  auto voidFunctionType = FunctionType::get(Type::getVoidTy(context), {}, false);
+  auto createFunction = [&](const char * name, GlobalValue::LinkageTypes linkage)
+  {
+    auto function = Function::Create(voidFunctionType, linkage, name, module.get());
+    BasicBlock::Create(context, "bb", function);
+    return function;
+  };
+
+  auto f = createFunction("f", GlobalValue::ExternalLinkage);
+  auto g = createFunction("g", GlobalValue::InternalLinkage);
+  auto h = createFunction("h", GlobalValue::InternalLinkage);
+  auto k = createFunction("k", GlobalValue::InternalLinkage);
+  auto u = createFunction("u", GlobalValue::InternalLinkage);
+
+  IRBuilder<> builder(&f->getEntryBlock());
+  builder.CreateCall(g);
+  builder.CreateRetVoid();
+
+  builder.SetInsertPoint(&h->getEntryBlock());
+  builder.CreateCall(k);
+  builder.CreateRetVoid();
+
+  for (auto function : { g, k, u })
+  {
+    builder.SetInsertPoint(&function->getEntryBlock());
+    builder.CreateRetVoid();
+  }
+
+  auto pointerType = PointerType::getUnqual(voidFunctionType);
+  new GlobalVariable(
+      *module,
+      pointerType,
+      true,
+      GlobalValue::ExternalLinkage,
+      ConstantExpr::getBitCast(u, pointerType),
+      "table");
+  new GlobalVariable(*module, pointerType, true, GlobalValue::InternalLinkage, h, "unused");
+
+  assert(!verifyModule(*module, &errs()));
+  return module;
+}
+
+static int
+TestEliminateUnreachableFunctions()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  llvm::LLVMContext context;
+  auto module = CreateModule(context);
+  jlm::util::StatisticsCollector statisticsCollector;
+
+  // Act
+  auto numSkippedFunctions = EliminateUnreachableFunctions(*module, statisticsCollector);
+
+  // Assert
+  assert(numSkippedFunctions == 2);
+  assert(module->getFunction("f") && module->getFunction("g") && module->getFunction("u"));
+  assert(!module->getFunction("h") && !module->getFunction("k"));
+  assert(module->getNamedGlobal("table"));
+  assert(!module->getNamedGlobal("unused"));
+  assert(!verifyModule(*module, &llvm::errs()));
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/frontend/llvm/UnreachableFunctionEliminationTests-EliminateUnreachableFunctions",
+    TestEliminateUnreachableFunctions)
+
+static int
+TestLazyMaterialization()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  llvm::LLVMContext context;
+  std::string bitcode;
+  {
+    llvm::raw_string_ostream os(bitcode);
+    llvm::WriteBitcodeToFile(*CreateModule(context), os);
+  }
+
+  auto buffer = llvm::MemoryBuffer::getMemBuffer(bitcode, "module", false);
+  auto module = llvm::cantFail(llvm::getOwningLazyBitcodeModule(std::move(buffer), context));
+  assert(module->getFunction("h")->isMaterializable());
+
+  jlm::util::StatisticsCollector statisticsCollector;
+
+  // Act
+  auto numSkippedFunctions = EliminateUnreachableFunctions(*module, statisticsCollector);
+
+  // Assert
+  assert(numSkippedFunctions == 2);
+  assert(!module->getFunction("h") && !module->getFunction("k"));
+  for (auto name : { "f", "g", "u" })
+  {
+    auto function = module->getFunction(name);
+    assert(!function->isMaterializable() && !function->empty());
+  }
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/frontend/llvm/UnreachableFunctionEliminationTests-LazyMaterialization",
+    TestLazyMaterialization)
@@ -9,6 +9,7 @@
 #include <tests/test-types.hpp>
 
 #include <jlm/llvm/ir/types.hpp>
+#include <jlm/rvsdg/control.hpp>
 
 #include <cassert>
 
@@ -73,3 +74,43 @@ TestIsOrContains()
 }
 
 JLM_UNIT_TEST_REGISTER("jlm/llvm/ir/TestTypes-TestIsOrContains", TestIsOrContains);
+
+static int
+TestTypeInterning()
+{
+  using namespace jlm::llvm;
+
+  // Arrange & Act
+  auto functionType1 = FunctionType::Create(
+      { PointerType::Create(), jlm::rvsdg::bittype::Create(32) },
+      { MemoryStateType::Create() });
+  auto functionType2 = FunctionType::Create(
+      { PointerType::Create(), jlm::rvsdg::bittype::Create(32) },
+      { MemoryStateType::Create() });
+  auto functionType3 = FunctionType::Create(
+      { PointerType::Create(), jlm::rvsdg::bittype::Create(64) },
+      { MemoryStateType::Create() });
+
+  auto arrayType1 = arraytype::Create(jlm::rvsdg::bittype::Create(100), 8);
+  auto arrayType2 = arraytype::Create(jlm::rvsdg::bittype::Create(100), 8);
+  auto controlType1 = jlm::rvsdg::ControlType::Create(7);
+  auto controlType2 = jlm::rvsdg::ControlType::Create(7);
+
+  // Assert
+  // Structurally equal types are represented by the same instance
+  assert(functionType1 == functionType2);
+  assert(functionType1 != functionType3);
+  assert(*functionType1 != *functionType3);
+  assert(arrayType1 == arrayType2);
+  assert(&arrayType1->element_type() == jlm::rvsdg::bittype::Create(100).get());
+  assert(controlType1 == controlType2);
+
+  // Interned types are freed once they are no longer referenced
+  auto numInternedTypes = jlm::rvsdg::NumInternedTypes();
+  functionType3.reset();
+  assert(jlm::rvsdg::NumInternedTypes() == numInternedTypes - 1);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/llvm/ir/TestTypes-TestTypeInterning", TestTypeInterning);
@@ -0,0 +1,292 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-operation.hpp>
+#include <test-registry.hpp>
+#include <test-types.hpp>
+
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/llvm/opt/GammaMerging.hpp>
+#include <jlm/rvsdg/control.hpp>
+#include <jlm/rvsdg/gamma.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <cassert>
+
+/**
+ * @return The origin of the gamma input that \p output is an argument of.
+ */
+static jlm::rvsdg::output *
+GetEntryVarOrigin(jlm::rvsdg::output & output)
+{
+  auto argument = jlm::util::AssertedCast<jlm::rvsdg::RegionArgument>(&output);
+  return argument->input()->origin();
+}
+
+static int
+TestSamePredicate()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  auto valueType = jlm::tests::valuetype::Create();
+
+  jlm::llvm::RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+  auto x = &jlm::tests::GraphImport::Create(graph, bittype::Create(1), "x");
+  auto y = &jlm::tests::GraphImport::Create(graph, valueType, "y");
+  auto predicate = match(1, { { 1, 0 } }, 1, 2, x);
+
+  auto gamma1 = GammaNode::create(predicate, 2);
+  auto ev1 = gamma1->add_entryvar(y);
+  auto a0 = jlm::tests::create_testop(gamma1->subregion(0), { ev1->argument(0) }, { valueType });
+  auto a1 = jlm::tests::create_testop(gamma1->subregion(1), { ev1->argument(1) }, { valueType });
+  auto xv1 = gamma1->add_exitvar({ a0[0], a1[0] });
+
+  auto gamma2 = GammaNode::create(predicate, 2);
+  auto ev2 = gamma2->add_entryvar(xv1);
+  auto ev3 = gamma2->add_entryvar(y);
+  auto xv2 = gamma2->add_exitvar({ ev2->argument(0), ev3->argument(1) });
+
+  auto & ex1 = jlm::llvm::GraphExport::Create(*xv1, "a");
+  auto & ex2 = jlm::llvm::GraphExport::Create(*xv2, "b");
+
+  jlm::util::StatisticsCollector statisticsCollector(
+      jlm::util::StatisticsCollectorSettings({ jlm::util::Statistics::Id::GammaMerging }));
+
+  // Act
+  GammaMerging gammaMerging;
+  gammaMerging.run(rvsdgModule, statisticsCollector);
+
+  // Assert
+  auto gamma = dynamic_cast<GammaNode *>(output::GetNode(*ex1.origin()));
+  assert(gamma == gamma1);
+  assert(output::GetNode(*ex2.origin()) == gamma1);
+  assert(graph.root()->nnodes() == 2);
+
+  // The output of gamma1 is forwarded within the subregions
+  auto gammaOutput = jlm::util::AssertedCast<GammaOutput>(ex2.origin());
+  assert(gammaOutput->result(0)->origin() == a0[0]);
+  assert(GetEntryVarOrigin(*gammaOutput->result(1)->origin()) == y);
+
+  auto & statistics = *statisticsCollector.CollectedStatistics().begin();
+  assert(statistics.GetMeasurementValue<uint64_t>("#MergedGammas") == 1);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/llvm/opt/GammaMergingTests-TestSamePredicate", TestSamePredicate)
+
+static int
+TestMatchOfSameValue()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  auto valueType = jlm::tests::valuetype::Create();
+
+  jlm::llvm::RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+  auto x = &jlm::tests::GraphImport::Create(graph, bittype::Create(8), "x");
+  auto y = &jlm::tests::GraphImport::Create(graph, valueType, "y");
+  auto z = &jlm::tests::GraphImport::Create(graph, valueType, "z");
+
+  // The alternatives of predicate2 are the swapped alternatives of predicate1
+  auto predicate1 = match(8, { { 3, 1 } }, 0, 2, x);
+  auto predicate2 = match(8, { { 3, 0 } }, 1, 2, x);
+
+  auto gamma1 = GammaNode::create(predicate1, 2);
+  auto ev1 = gamma1->add_entryvar(y);
+  auto xv1 = gamma1->add_exitvar({ ev1->argument(0), ev1->argument(1) });
+
+  auto gamma2 = GammaNode::create(predicate2, 2);
+  auto ev2 = gamma2->add_entryvar(xv1);
+  auto ev3 = gamma2->add_entryvar(z);
+  auto xv2 = gamma2->add_exitvar({ ev2->argument(0), ev3->argument(1) });
+
+  // The alternatives of predicate3 are not determined by the ones of predicate1
+  auto predicate3 = match(8, { { 4, 1 } }, 0, 2, x);
+  auto gamma3 = GammaNode::create(predicate3, 2);
+  auto ev4 = gamma3->add_entryvar(y);
+  auto xv3 = gamma3->add_exitvar({ ev4->argument(0), ev4->argument(1) });
+
+  jlm::llvm::GraphExport::Create(*xv1, "a");
+  auto & ex2 = jlm::llvm::GraphExport::Create(*xv2, "b");
+  auto & ex3 = jlm::llvm::GraphExport::Create(*xv3, "c");
+
+  jlm::util::StatisticsCollector statisticsCollector;
+
+  // Act
+  GammaMerging gammaMerging;
+  gammaMerging.run(rvsdgModule, statisticsCollector);
+
+  // Assert
+  assert(output::GetNode(*ex2.origin()) == gamma1);
+  assert(output::GetNode(*ex3.origin()) == gamma3);
+
+  // Subregion 0 of gamma1 corresponds to subregion 1 of gamma2, and vice versa
+  auto gammaOutput = jlm::util::AssertedCast<GammaOutput>(ex2.origin());
+  assert(GetEntryVarOrigin(*gammaOutput->result(0)->origin()) == z);
+  assert(GetEntryVarOrigin(*gammaOutput->result(1)->origin()) == y);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/llvm/opt/GammaMergingTests-TestMatchOfSameValue", TestMatchOfSameValue)
+
+static int
+TestPredicateThreading()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  auto valueType = jlm::tests::valuetype::Create();
+
+  jlm::llvm::RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+  auto x = &jlm::tests::GraphImport::Create(graph, ControlType::Create(3), "x");
+  auto y = &jlm::tests::GraphImport::Create(graph, valueType, "y");
+
+  // gamma1 computes a control value that selects the subregions 1, 0, and 1 of gamma2
+  auto gamma1 = GammaNode::create(x, 3);
+  auto c0 = control_constant(gamma1->subregion(0), 2, 1);
+  auto c1 = control_constant(gamma1->subregion(1), 2, 0);
+  auto c2 = control_constant(gamma1->subregion(2), 2, 1);
+  auto predicate = gamma1->add_exitvar({ c0, c1, c2 });
+
+  auto gamma2 = GammaNode::create(predicate, 2);
+  auto ev = gamma2->add_entryvar(y);
+  auto a0 = jlm::tests::create_testop(gamma2->subregion(0), { ev->argument(0) }, { valueType });
+  auto a1 = jlm::tests::create_testop(gamma2->subregion(1), { ev->argument(1) }, { valueType });
+  auto xv = gamma2->add_exitvar({ a0[0], a1[0] });
+
+  auto & ex = jlm::llvm::GraphExport::Create(*xv, "a");
+
+  jlm::util::StatisticsCollector statisticsCollector;
+
+  // Act
+  GammaMerging gammaMerging;
+  gammaMerging.run(rvsdgModule, statisticsCollector);
+
+  // Assert
+  assert(output::GetNode(*ex.origin()) == gamma1);
+  assert(gamma1->subregion(0)->nnodes() == 2);
+  assert(gamma1->subregion(1)->nnodes() == 2);
+  assert(gamma1->subregion(2)->nnodes() == 2);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/opt/GammaMergingTests-TestPredicateThreading",
+    TestPredicateThreading)
+
+static int
+TestReplicatedPredicate()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  jlm::llvm::RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+  auto x = &jlm::tests::GraphImport::Create(graph, ControlType::Create(2), "x");
+
+  auto gamma = GammaNode::create(x, 2);
+  auto c0 = control_constant(gamma->subregion(0), 2, 0);
+  auto c1 = control_constant(gamma->subregion(1), 2, 1);
+  auto xv = gamma->add_exitvar({ c0, c1 });
+
+  auto & ex = jlm::llvm::GraphExport::Create(*xv, "a");
+
+  // Act
+  auto eliminated = GammaMerging::EliminateReplicatedPredicates(*gamma);
+
+  // Assert
+  assert(eliminated);
+  assert(ex.origin() == x);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/opt/GammaMergingTests-TestReplicatedPredicate",
+    TestReplicatedPredicate)
+
+static int
+TestReplicatedPredicateWithDifferentType()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  jlm::llvm::RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+  auto x = &jlm::tests::GraphImport::Create(graph, ControlType::Create(2), "x");
+
+  auto gamma = GammaNode::create(x, 2);
+  auto c0 = control_constant(gamma->subregion(0), 3, 0);
+  auto c1 = control_constant(gamma->subregion(1), 3, 1);
+  auto xv = gamma->add_exitvar({ c0, c1 });
+
+  auto & ex = jlm::llvm::GraphExport::Create(*xv, "a");
+
+  // Act
+  auto eliminated = GammaMerging::EliminateReplicatedPredicates(*gamma);
+
+  // Assert
+  assert(!eliminated);
+  assert(ex.origin() == xv);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/opt/GammaMergingTests-TestReplicatedPredicateWithDifferentType",
+    TestReplicatedPredicateWithDifferentType)
+
+static int
+TestCycle()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  auto valueType = jlm::tests::valuetype::Create();
+
+  jlm::llvm::RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+  auto x = &jlm::tests::GraphImport::Create(graph, ControlType::Create(2), "x");
+  auto y = &jlm::tests::GraphImport::Create(graph, valueType, "y");
+
+  auto gamma1 = GammaNode::create(x, 2);
+  auto ev1 = gamma1->add_entryvar(y);
+  auto xv1 = gamma1->add_exitvar({ ev1->argument(0), ev1->argument(1) });
+
+  // gamma2 depends on gamma1 through a node outside of gamma1
+  auto value = jlm::tests::create_testop(graph.root(), { xv1 }, { valueType })[0];
+  auto gamma2 = GammaNode::create(x, 2);
+  auto ev2 = gamma2->add_entryvar(value);
+  auto xv2 = gamma2->add_exitvar({ ev2->argument(0), ev2->argument(1) });
+
+  auto & ex = jlm::llvm::GraphExport::Create(*xv2, "a");
+
+  jlm::util::StatisticsCollector statisticsCollector;
+
+  // Act
+  GammaMerging gammaMerging;
+  gammaMerging.run(rvsdgModule, statisticsCollector);
+
+  // Assert
+  assert(output::GetNode(*ex.origin()) == gamma2);
+  assert(GammaMerging::TryMerge(*gamma2) == nullptr);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/llvm/opt/GammaMergingTests-TestCycle", TestCycle)
@@ -0,0 +1,211 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-operation.hpp>
+#include <test-registry.hpp>
+#include <test-types.hpp>
+
+#include <jlm/llvm/ir/operators/Load.hpp>
+#include <jlm/llvm/ir/operators/Store.hpp>
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/llvm/opt/InvariantLoadHoisting.hpp>
+#include <jlm/rvsdg/control.hpp>
+#include <jlm/rvsdg/theta.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <cassert>
+
+/**
+ * Creates a theta node with the loop variables p, s, and x. The theta node loads from p with
+ * memory state s, and combines the loaded value with x. If \p storeToP is true, the loop also
+ * stores to p, such that the memory state s is modified within the loop.
+ */
+static jlm::rvsdg::ThetaNode &
+CreateLoop(
+    jlm::rvsdg::Region & region,
+    jlm::rvsdg::output & address,
+    jlm::rvsdg::output & memoryState,
+    jlm::rvsdg::output & value,
+    bool storeToP)
+{
+  using namespace jlm::llvm;
+  using namespace jlm::rvsdg;
+
+  auto valueType = jlm::tests::valuetype::Create();
+
+  auto theta = ThetaNode::create(&region);
+  auto lvp = theta->add_loopvar(&address);
+  auto lvs = theta->add_loopvar(&memoryState);
+  auto lvx = theta->add_loopvar(&value);
+
+  auto loadResults =
+      LoadNonVolatileNode::Create(lvp->argument(), { lvs->argument() }, valueType, 4);
+  auto sum = jlm::tests::create_testop(
+      theta->subregion(),
+      { loadResults[0], lvx->argument() },
+      { valueType });
+  lvx->result()->divert_to(sum[0]);
+
+  if (storeToP)
+  {
+    auto storeResults =
+        StoreNonVolatileNode::Create(lvp->argument(), sum[0], { loadResults[1] }, 4);
+    lvs->result()->divert_to(storeResults[0]);
+  }
+
+  auto predicate = jlm::tests::create_testop(
+      theta->subregion(),
+      { lvx->argument() },
+      { ControlType::Create(2) });
+  theta->set_predicate(predicate[0]);
+
+  return *theta;
+}
+
+static size_t
+CountLoadNodes(const jlm::rvsdg::Region & region)
+{
+  size_t numLoadNodes = 0;
+  for (auto & node : region.nodes)
+  {
+    if (jlm::rvsdg::is<jlm::llvm::LoadNonVolatileOperation>(&node))
+      numLoadNodes++;
+  }
+
+  return numLoadNodes;
+}
+
+static int
+TestHoistInvariantLoad()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  jlm::llvm::RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+  auto p = &jlm::tests::GraphImport::Create(graph, PointerType::Create(), "p");
+  auto s = &jlm::tests::GraphImport::Create(graph, MemoryStateType::Create(), "s");
+  auto x = &jlm::tests::GraphImport::Create(graph, jlm::tests::valuetype::Create(), "x");
+
+  auto & theta = CreateLoop(*graph.root(), *p, *s, *x, false);
+  auto & exportX = jlm::llvm::GraphExport::Create(*theta.output(2), "x");
+  auto & exportS = jlm::llvm::GraphExport::Create(*theta.output(1), "s");
+
+  jlm::util::StatisticsCollector statisticsCollector(
+      jlm::util::StatisticsCollectorSettings(
+          { jlm::util::Statistics::Id::InvariantLoadHoisting }));
+
+  // Act
+  InvariantLoadHoisting invariantLoadHoisting;
+  invariantLoadHoisting.run(rvsdgModule, statisticsCollector);
+
+  // Assert
+  assert(CountLoadNodes(*theta.subregion()) == 0);
+  assert(CountLoadNodes(*graph.root()) == 1);
+  assert(jlm::rvsdg::output::GetNode(*exportX.origin()) == &theta);
+
+  // The memory state is routed through the hoisted load before it enters the loop
+  auto loadNode = jlm::rvsdg::output::GetNode(*theta.input(1)->origin());
+  assert(jlm::rvsdg::is<LoadNonVolatileOperation>(loadNode));
+  assert(loadNode->input(0)->origin() == p);
+  assert(loadNode->input(1)->origin() == s);
+  assert(exportS.origin() == theta.output(1));
+
+  auto & statistics = *statisticsCollector.CollectedStatistics().begin();
+  assert(statistics.GetMeasurementValue<uint64_t>("#HoistedLoads") == 1);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/opt/InvariantLoadHoistingTests-TestHoistInvariantLoad",
+    TestHoistInvariantLoad)
+
+static int
+TestModifiedMemoryState()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  jlm::llvm::RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+  auto p = &jlm::tests::GraphImport::Create(graph, PointerType::Create(), "p");
+  auto s = &jlm::tests::GraphImport::Create(graph, MemoryStateType::Create(), "s");
+  auto x = &jlm::tests::GraphImport::Create(graph, jlm::tests::valuetype::Create(), "x");
+
+  auto & theta = CreateLoop(*graph.root(), *p, *s, *x, true);
+  jlm::llvm::GraphExport::Create(*theta.output(1), "s");
+
+  jlm::util::StatisticsCollector statisticsCollector;
+
+  // Act
+  InvariantLoadHoisting invariantLoadHoisting;
+  invariantLoadHoisting.run(rvsdgModule, statisticsCollector);
+
+  // Assert
+  assert(CountLoadNodes(*theta.subregion()) == 1);
+  assert(CountLoadNodes(*graph.root()) == 0);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/opt/InvariantLoadHoistingTests-TestModifiedMemoryState",
+    TestModifiedMemoryState)
+
+static int
+TestNestedLoops()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  jlm::llvm::RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+  auto p = &jlm::tests::GraphImport::Create(graph, PointerType::Create(), "p");
+  auto s = &jlm::tests::GraphImport::Create(graph, MemoryStateType::Create(), "s");
+  auto x = &jlm::tests::GraphImport::Create(graph, jlm::tests::valuetype::Create(), "x");
+
+  auto outerTheta = ThetaNode::create(graph.root());
+  auto lvp = outerTheta->add_loopvar(p);
+  auto lvs = outerTheta->add_loopvar(s);
+  auto lvx = outerTheta->add_loopvar(x);
+
+  auto & innerTheta = CreateLoop(
+      *outerTheta->subregion(),
+      *lvp->argument(),
+      *lvs->argument(),
+      *lvx->argument(),
+      false);
+  lvx->result()->divert_to(innerTheta.output(2));
+
+  auto predicate = jlm::tests::create_testop(
+      outerTheta->subregion(),
+      { lvx->argument() },
+      { ControlType::Create(2) });
+  outerTheta->set_predicate(predicate[0]);
+
+  jlm::llvm::GraphExport::Create(*outerTheta->output(2), "x");
+
+  jlm::util::StatisticsCollector statisticsCollector(
+      jlm::util::StatisticsCollectorSettings(
+          { jlm::util::Statistics::Id::InvariantLoadHoisting }));
+
+  // Act
+  InvariantLoadHoisting invariantLoadHoisting;
+  invariantLoadHoisting.run(rvsdgModule, statisticsCollector);
+
+  // Assert
+  assert(CountLoadNodes(*innerTheta.subregion()) == 0);
+  assert(CountLoadNodes(*outerTheta->subregion()) == 0);
+  assert(CountLoadNodes(*graph.root()) == 1);
+
+  auto & statistics = *statisticsCollector.CollectedStatistics().begin();
+  assert(statistics.GetMeasurementValue<uint64_t>("#HoistedLoads") == 2);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/llvm/opt/InvariantLoadHoistingTests-TestNestedLoops", TestNestedLoops)
@@ -0,0 +1,292 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+
+#include <jlm/llvm/ir/operators/alloca.hpp>
+#include <jlm/llvm/ir/operators/lambda.hpp>
+#include <jlm/llvm/ir/operators/MemoryStateOperations.hpp>
+#include <jlm/llvm/ir/operators/Store.hpp>
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/llvm/opt/LoopFusion.hpp>
+#include <jlm/rvsdg/bitstring/arithmetic.hpp>
+#include <jlm/rvsdg/bitstring/comparison.hpp>
+#include <jlm/rvsdg/bitstring/constant.hpp>
+#include <jlm/rvsdg/control.hpp>
+#include <jlm/rvsdg/theta.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <cassert>
+#include <optional>
+
+/**
+ * Creates a theta node that stores its induction variable to \p address in every iteration. The
+ * induction variable starts at \p init and is incremented by one until it reaches \p end.
+ */
+static jlm::rvsdg::ThetaNode &
+CreateStoreLoop(
+    jlm::rvsdg::output & init,
+    jlm::rvsdg::output & end,
+    jlm::rvsdg::output & address,
+    jlm::rvsdg::output & memoryState)
+{
+  using namespace jlm::llvm;
+  using namespace jlm::rvsdg;
+
+  // Avoid that the induction variable update is folded into a constant while its loop variable is
+  // still invariant
+  auto nf = init.region()->graph()->node_normal_form(typeid(operation));
+  nf->set_mutable(false);
+
+  auto theta = ThetaNode::create(init.region());
+  auto lvi = theta->add_loopvar(&init);
+  auto lve = theta->add_loopvar(&end);
+  auto lva = theta->add_loopvar(&address);
+  auto lvs = theta->add_loopvar(&memoryState);
+
+  auto one = create_bitconstant(theta->subregion(), 32, 1);
+  auto next = bitadd_op::create(32, lvi->argument(), one);
+  auto compare = bitult_op::create(32, next, lve->argument());
+  auto predicate = match(1, { { 1, 1 } }, 0, 2, compare);
+  auto storeResults =
+      StoreNonVolatileNode::Create(lva->argument(), lvi->argument(), { lvs->argument() }, 4);
+
+  lvi->result()->divert_to(next);
+  lvs->result()->divert_to(storeResults[0]);
+  theta->set_predicate(predicate);
+
+  return *theta;
+}
+
+/**
+ * Creates a function f(n, s) with two allocas a and b, followed by two theta nodes that are
+ * connected through the memory state. The first loop stores to a, and the second loop stores to b.
+ *
+ * @param storeToSameAlloca If true, the second loop stores to a as well.
+ * @param end1 The end value of the first loop, or std::nullopt if the loop iterates until n.
+ * @param end2 The end value of the second loop, or std::nullopt if the loop iterates until n.
+ *
+ * @return The lambda node of f.
+ */
+static jlm::llvm::lambda::node &
+CreateFunctionWithLoops(
+    jlm::llvm::RvsdgModule & rvsdgModule,
+    bool storeToSameAlloca,
+    std::optional<int64_t> end1,
+    std::optional<int64_t> end2)
+{
+  using namespace jlm::llvm;
+  using namespace jlm::rvsdg;
+
+  auto & graph = rvsdgModule.Rvsdg();
+  auto bit32Type = bittype::Create(32);
+  auto memoryStateType = MemoryStateType::Create();
+  auto functionType =
+      FunctionType::Create({ bit32Type, memoryStateType }, { memoryStateType, memoryStateType });
+
+  auto lambda = lambda::node::create(graph.root(), functionType, "f", linkage::external_linkage);
+  auto subregion = lambda->subregion();
+  auto n = lambda->fctargument(0);
+
+  auto size = create_bitconstant(subregion, 32, 1);
+  auto a = alloca_op::create(bit32Type, size, 4);
+  auto b = alloca_op::create(bit32Type, size, 4);
+  auto memoryState = MemoryStateMergeOperation::Create({ lambda->fctargument(1), a[1], b[1] });
+
+  auto zero = create_bitconstant(subregion, 32, 0);
+  auto endValue1 = end1 ? create_bitconstant(subregion, 32, *end1) : n;
+  auto endValue2 = end2 ? create_bitconstant(subregion, 32, *end2) : n;
+
+  auto & theta1 = CreateStoreLoop(*zero, *endValue1, *a[0], *memoryState);
+  auto address2 = storeToSameAlloca ? a[0] : b[0];
+  auto & theta2 = CreateStoreLoop(*zero, *endValue2, *address2, *theta1.output(3));
+
+  // The memory state of the first loop is also used after both loops
+  auto lambdaOutput = lambda->finalize({ theta2.output(3), theta1.output(3) });
+  jlm::llvm::GraphExport::Create(*lambdaOutput, "f");
+
+  return *lambda;
+}
+
+static size_t
+CountThetaNodes(const jlm::rvsdg::Region & region)
+{
+  size_t numThetaNodes = 0;
+  for (auto & node : region.nodes)
+  {
+    if (jlm::rvsdg::is<jlm::rvsdg::ThetaOperation>(&node))
+      numThetaNodes++;
+  }
+
+  return numThetaNodes;
+}
+
+static int
+TestFuseLoops()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  jlm::llvm::RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & lambda = CreateFunctionWithLoops(rvsdgModule, false, 10, 10);
+
+  jlm::util::StatisticsCollector statisticsCollector(
+      jlm::util::StatisticsCollectorSettings({ jlm::util::Statistics::Id::LoopFusion }));
+
+  // Act
+  LoopFusion loopFusion;
+  loopFusion.run(rvsdgModule, statisticsCollector);
+
+  // Assert
+  assert(CountThetaNodes(*lambda.subregion()) == 1);
+
+  // Both function results are routed through the fused loop
+  auto theta = dynamic_cast<jlm::rvsdg::ThetaNode *>(
+      jlm::rvsdg::output::GetNode(*lambda.fctresult(0)->origin()));
+  assert(theta);
+  assert(lambda.fctresult(0)->origin() == lambda.fctresult(1)->origin());
+
+  // The memory state is threaded through both stores in every iteration
+  auto thetaOutput =
+      jlm::util::AssertedCast<jlm::rvsdg::ThetaOutput>(lambda.fctresult(0)->origin());
+  auto store2 = jlm::rvsdg::output::GetNode(*thetaOutput->result()->origin());
+  assert(jlm::rvsdg::is<StoreNonVolatileOperation>(store2));
+  auto store1 = jlm::rvsdg::output::GetNode(*store2->input(2)->origin());
+  assert(jlm::rvsdg::is<StoreNonVolatileOperation>(store1));
+  assert(store1->input(2)->origin() == thetaOutput->argument());
+
+  auto & statistics = *statisticsCollector.CollectedStatistics().begin();
+  assert(statistics.GetMeasurementValue<uint64_t>("#FusedLoops") == 1);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/llvm/opt/LoopFusionTests-TestFuseLoops", TestFuseLoops)
+
+static int
+TestSymbolicTripCounts()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  jlm::llvm::RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & lambda = CreateFunctionWithLoops(rvsdgModule, false, std::nullopt, std::nullopt);
+  jlm::util::StatisticsCollector statisticsCollector;
+
+  // Act
+  LoopFusion loopFusion;
+  loopFusion.run(rvsdgModule, statisticsCollector);
+
+  // Assert
+  assert(CountThetaNodes(*lambda.subregion()) == 1);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/opt/LoopFusionTests-TestSymbolicTripCounts",
+    TestSymbolicTripCounts)
+
+static int
+TestDifferentTripCounts()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  jlm::llvm::RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & lambda = CreateFunctionWithLoops(rvsdgModule, false, 10, 20);
+  jlm::util::StatisticsCollector statisticsCollector;
+
+  // Act
+  LoopFusion loopFusion;
+  loopFusion.run(rvsdgModule, statisticsCollector);
+
+  // Assert
+  assert(CountThetaNodes(*lambda.subregion()) == 2);
+
+  // Comparing the trip counts does not route the step values through new loop variables
+  for (auto & node : lambda.subregion()->nodes)
+  {
+    if (auto theta = dynamic_cast<const jlm::rvsdg::ThetaNode *>(&node))
+      assert(theta->nloopvars() == 4);
+  }
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/opt/LoopFusionTests-TestDifferentTripCounts",
+    TestDifferentTripCounts)
+
+static int
+TestConflictingMemoryAccesses()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  jlm::llvm::RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & lambda = CreateFunctionWithLoops(rvsdgModule, true, 10, 10);
+  jlm::util::StatisticsCollector statisticsCollector;
+
+  // Act
+  LoopFusion loopFusion;
+  loopFusion.run(rvsdgModule, statisticsCollector);
+
+  // Assert
+  assert(CountThetaNodes(*lambda.subregion()) == 2);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/opt/LoopFusionTests-TestConflictingMemoryAccesses",
+    TestConflictingMemoryAccesses)
+
+static int
+TestValueDependence()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  jlm::llvm::RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+  auto bit32Type = bittype::Create(32);
+  auto memoryStateType = MemoryStateType::Create();
+  auto functionType = FunctionType::Create({ memoryStateType }, { memoryStateType });
+
+  auto lambda = lambda::node::create(graph.root(), functionType, "f", linkage::external_linkage);
+  auto subregion = lambda->subregion();
+
+  auto size = create_bitconstant(subregion, 32, 1);
+  auto a = alloca_op::create(bit32Type, size, 4);
+  auto b = alloca_op::create(bit32Type, size, 4);
+  auto memoryState = MemoryStateMergeOperation::Create({ lambda->fctargument(0), a[1], b[1] });
+
+  auto zero = create_bitconstant(subregion, 32, 0);
+  auto ten = create_bitconstant(subregion, 32, 10);
+  auto & theta1 = CreateStoreLoop(*zero, *ten, *a[0], *memoryState);
+  auto & theta2 = CreateStoreLoop(*zero, *ten, *b[0], *theta1.output(3));
+
+  // The second loop uses the final value of the first loop's induction variable
+  theta2.add_loopvar(theta1.output(0));
+
+  auto lambdaOutput = lambda->finalize({ theta2.output(3) });
+  jlm::llvm::GraphExport::Create(*lambdaOutput, "f");
+
+  jlm::util::StatisticsCollector statisticsCollector;
+
+  // Act
+  LoopFusion loopFusion;
+  loopFusion.run(rvsdgModule, statisticsCollector);
+
+  // Assert
+  assert(CountThetaNodes(*subregion) == 2);
+  assert(output::GetNode(*lambda->fctresult(0)->origin()) == &theta2);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/llvm/opt/LoopFusionTests-TestValueDependence", TestValueDependence)
@@ -0,0 +1,237 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-operation.hpp>
+#include <test-registry.hpp>
+#include <test-types.hpp>
+
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/llvm/opt/LoopUnswitching.hpp>
+#include <jlm/rvsdg/gamma.hpp>
+#include <jlm/rvsdg/theta.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <cassert>
+#include <functional>
+
+/**
+ * Creates a theta node with the loop variables x, y, and z, where x is loop-invariant. The loop
+ * predicate is computed from y. For every entry in \p predicateIsInvariant, a gamma node updating
+ * y is created, whose predicate is computed from x if the entry is true, and from z otherwise.
+ */
+static jlm::rvsdg::ThetaNode &
+CreateLoop(jlm::llvm::RvsdgModule & rvsdgModule, const std::vector<bool> & predicateIsInvariant)
+{
+  using namespace jlm::llvm;
+  using namespace jlm::rvsdg;
+
+  auto & graph = rvsdgModule.Rvsdg();
+  auto valueType = jlm::tests::valuetype::Create();
+  auto bit1Type = bittype::Create(1);
+
+  auto x = &jlm::tests::GraphImport::Create(graph, bit1Type, "x");
+  auto y = &jlm::tests::GraphImport::Create(graph, valueType, "y");
+  auto z = &jlm::tests::GraphImport::Create(graph, bit1Type, "z");
+
+  auto theta = ThetaNode::create(graph.root());
+  auto lvx = theta->add_loopvar(x);
+  auto lvy = theta->add_loopvar(y);
+  auto lvz = theta->add_loopvar(z);
+
+  auto notZ = jlm::tests::create_testop(theta->subregion(), { lvz->argument() }, { bit1Type })[0];
+  lvz->result()->divert_to(notZ);
+
+  output * value = lvy->argument();
+  for (auto isInvariant : predicateIsInvariant)
+  {
+    auto condition = isInvariant ? lvx->argument() : lvz->argument();
+    auto predicate = match(1, { { 1, 0 } }, 1, 2, condition);
+
+    auto gamma = GammaNode::create(predicate, 2);
+    auto ev = gamma->add_entryvar(value);
+    auto value0 =
+        jlm::tests::create_testop(gamma->subregion(0), { ev->argument(0) }, { valueType })[0];
+    auto value1 =
+        jlm::tests::create_testop(gamma->subregion(1), { ev->argument(1) }, { valueType })[0];
+    value = gamma->add_exitvar({ value0, value1 });
+  }
+  lvy->result()->divert_to(value);
+
+  auto loopCondition = jlm::tests::create_testop(theta->subregion(), { value }, { bit1Type })[0];
+  theta->set_predicate(match(1, { { 1, 0 } }, 1, 2, loopCondition));
+
+  jlm::llvm::GraphExport::Create(*theta->output(1), "y");
+
+  return *theta;
+}
+
+/**
+ * Counts the theta nodes in \p region, and asserts that none of them contains a gamma node.
+ */
+static size_t
+CountGammaFreeThetaNodes(const jlm::rvsdg::Region & region)
+{
+  size_t numThetaNodes = 0;
+  for (auto & node : region.nodes)
+  {
+    if (auto theta = dynamic_cast<const jlm::rvsdg::ThetaNode *>(&node))
+    {
+      for (auto & innerNode : theta->subregion()->nodes)
+        assert(!jlm::rvsdg::is<jlm::rvsdg::GammaOperation>(&innerNode));
+      numThetaNodes++;
+    }
+    else if (auto gamma = dynamic_cast<const jlm::rvsdg::GammaNode *>(&node))
+    {
+      for (size_t n = 0; n < gamma->nsubregions(); n++)
+        numThetaNodes += CountGammaFreeThetaNodes(*gamma->subregion(n));
+    }
+  }
+
+  return numThetaNodes;
+}
+
+static int
+TestUnswitchInvariantGamma()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+  CreateLoop(rvsdgModule, { true });
+  auto & exportY = *graph.root()->result(0);
+
+  jlm::util::StatisticsCollector statisticsCollector(
+      jlm::util::StatisticsCollectorSettings({ jlm::util::Statistics::Id::LoopUnswitching }));
+
+  // Act
+  LoopUnswitching loopUnswitching;
+  loopUnswitching.run(rvsdgModule, statisticsCollector);
+
+  // Assert
+  auto gamma = dynamic_cast<jlm::rvsdg::GammaNode *>(
+      jlm::rvsdg::output::GetNode(*exportY.origin()));
+  assert(gamma && gamma->nsubregions() == 2);
+  assert(graph.root()->nnodes() == 2);
+  assert(CountGammaFreeThetaNodes(*graph.root()) == 2);
+
+  // The hoisted predicate must be computed from the value entering the loop
+  auto match = jlm::rvsdg::output::GetNode(*gamma->predicate()->origin());
+  assert(jlm::rvsdg::is<jlm::rvsdg::match_op>(match));
+  assert(match->input(0)->origin() == graph.root()->argument(0));
+
+  assert(statisticsCollector.NumCollectedStatistics() == 1);
+  auto & statistics = *statisticsCollector.CollectedStatistics().begin();
+  assert(statistics.GetMeasurementValue<uint64_t>("#UnswitchedLoops") == 1);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/opt/LoopUnswitchingTests-TestUnswitchInvariantGamma",
+    TestUnswitchInvariantGamma)
+
+static int
+TestVariantPredicate()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & theta = CreateLoop(rvsdgModule, { false });
+  jlm::util::StatisticsCollector statisticsCollector;
+
+  // Act
+  LoopUnswitching loopUnswitching;
+  loopUnswitching.run(rvsdgModule, statisticsCollector);
+
+  // Assert
+  assert(LoopUnswitching::FindInvariantGamma(theta) == nullptr);
+  auto & exportY = *rvsdgModule.Rvsdg().root()->result(0);
+  assert(jlm::rvsdg::output::GetNode(*exportY.origin()) == &theta);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/opt/LoopUnswitchingTests-TestVariantPredicate",
+    TestVariantPredicate)
+
+static int
+TestCodeGrowthBudget()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & theta = CreateLoop(rvsdgModule, { true });
+  jlm::util::StatisticsCollector statisticsCollector;
+
+  // Act
+  LoopUnswitching loopUnswitching(4);
+  loopUnswitching.run(rvsdgModule, statisticsCollector);
+
+  // Assert
+  assert(LoopUnswitching::FindInvariantGamma(theta) != nullptr);
+  auto & exportY = *rvsdgModule.Rvsdg().root()->result(0);
+  assert(jlm::rvsdg::output::GetNode(*exportY.origin()) == &theta);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/opt/LoopUnswitchingTests-TestCodeGrowthBudget",
+    TestCodeGrowthBudget)
+
+static int
+TestMultipleInvariantGammas()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+  CreateLoop(rvsdgModule, { true, false, true });
+
+  jlm::util::StatisticsCollector statisticsCollector(
+      jlm::util::StatisticsCollectorSettings({ jlm::util::Statistics::Id::LoopUnswitching }));
+
+  // Act
+  LoopUnswitching loopUnswitching;
+  loopUnswitching.run(rvsdgModule, statisticsCollector);
+
+  // Assert
+  // Both invariant gamma nodes are unswitched, resulting in four loops that only contain the
+  // gamma node with the loop-variant predicate.
+  size_t numThetaNodes = 0;
+  std::function<void(const jlm::rvsdg::Region &)> countThetaNodes =
+      [&](const jlm::rvsdg::Region & region)
+  {
+    for (auto & node : region.nodes)
+    {
+      if (auto theta = dynamic_cast<const jlm::rvsdg::ThetaNode *>(&node))
+      {
+        assert(LoopUnswitching::FindInvariantGamma(*theta) == nullptr);
+        numThetaNodes++;
+      }
+      else if (auto gamma = dynamic_cast<const jlm::rvsdg::GammaNode *>(&node))
+      {
+        for (size_t n = 0; n < gamma->nsubregions(); n++)
+          countThetaNodes(*gamma->subregion(n));
+      }
+    }
+  };
+  countThetaNodes(*graph.root());
+  assert(numThetaNodes == 4);
+
+  auto & statistics = *statisticsCollector.CollectedStatistics().begin();
+  assert(statistics.GetMeasurementValue<uint64_t>("#UnswitchedLoops") == 3);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/opt/LoopUnswitchingTests-TestMultipleInvariantGammas",
+    TestMultipleInvariantGammas)
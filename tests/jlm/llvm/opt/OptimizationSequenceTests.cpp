@@ -0,0 +1,92 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-operation.hpp>
+#include <test-registry.hpp>
+#include <test-types.hpp>
+
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/llvm/opt/DeadNodeElimination.hpp>
+#include <jlm/llvm/opt/OptimizationSequence.hpp>
+#include <jlm/rvsdg/region.hpp>
+#include <jlm/util/MemoryFootprint.hpp>
+#include <jlm/util/Statistics.hpp>
+
+static int
+MemoryFootprintIsAddedToPassStatistics()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::util;
+
+  // Arrange
+  auto valueType = jlm::tests::valuetype::Create();
+
+  RvsdgModule rvsdgModule(filepath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+
+  auto x = &jlm::tests::GraphImport::Create(graph, valueType, "x");
+  auto node = jlm::tests::test_op::create(graph.root(), { x }, { valueType });
+  jlm::tests::test_op::create(graph.root(), { x }, { valueType });
+  GraphExport::Create(*node->output(0), "y");
+
+  StatisticsCollector statisticsCollector(StatisticsCollectorSettings(
+      { Statistics::Id::DeadNodeElimination, Statistics::Id::MemoryFootprint }));
+
+  // Act
+  DeadNodeElimination deadNodeElimination;
+  OptimizationSequence::CreateAndRun(rvsdgModule, statisticsCollector, { &deadNodeElimination });
+
+  // Assert
+  // The sequence's own statistics are not demanded
+  assert(statisticsCollector.NumCollectedStatistics() == 1);
+  auto & statistics = *statisticsCollector.CollectedStatistics().begin();
+  assert(statistics.GetId() == Statistics::Id::DeadNodeElimination);
+
+  auto memoryFootprint = jlm::rvsdg::ComputeMemoryFootprint(*graph.root());
+  auto label = MemoryFootprint::GetLabel(MemoryFootprint::Category::RvsdgNodes);
+  assert(statistics.GetMeasurementValue<uint64_t>(label) != 0);
+  assert(
+      statistics.GetMeasurementValue<uint64_t>(label)
+      == memoryFootprint.Get(MemoryFootprint::Category::RvsdgNodes));
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/opt/OptimizationSequenceTests-MemoryFootprintIsAddedToPassStatistics",
+    MemoryFootprintIsAddedToPassStatistics)
+
+static int
+MemoryFootprintIsNotComputedUnlessDemanded()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::util;
+
+  // Arrange
+  auto valueType = jlm::tests::valuetype::Create();
+
+  RvsdgModule rvsdgModule(filepath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+
+  auto x = &jlm::tests::GraphImport::Create(graph, valueType, "x");
+  GraphExport::Create(*x, "y");
+
+  StatisticsCollector statisticsCollector(
+      StatisticsCollectorSettings({ Statistics::Id::DeadNodeElimination }));
+
+  // Act
+  DeadNodeElimination deadNodeElimination;
+  OptimizationSequence::CreateAndRun(rvsdgModule, statisticsCollector, { &deadNodeElimination });
+
+  // Assert
+  assert(statisticsCollector.NumCollectedStatistics() == 1);
+  auto & statistics = *statisticsCollector.CollectedStatistics().begin();
+  assert(!statistics.HasMeasurement(
+      MemoryFootprint::GetLabel(MemoryFootprint::Category::RvsdgNodes)));
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/opt/OptimizationSequenceTests-MemoryFootprintIsNotComputedUnlessDemanded",
+    MemoryFootprintIsNotComputedUnlessDemanded)
@@ -0,0 +1,323 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+
+#include <jlm/llvm/ir/operators/call.hpp>
+#include <jlm/llvm/ir/operators/lambda.hpp>
+#include <jlm/llvm/ir/operators/Phi.hpp>
+#include <jlm/llvm/ir/operators/Store.hpp>
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/llvm/opt/TailRecursionElimination.hpp>
+#include <jlm/rvsdg/bitstring/arithmetic.hpp>
+#include <jlm/rvsdg/bitstring/comparison.hpp>
+#include <jlm/rvsdg/bitstring/constant.hpp>
+#include <jlm/rvsdg/control.hpp>
+#include <jlm/rvsdg/gamma.hpp>
+#include <jlm/rvsdg/theta.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <cassert>
+#include <functional>
+
+/**
+ * Creates a recursive function f(n, ..., io, mem) within a phi node. The function returns the
+ * results of \p createBaseCase if n is zero, and the results of \p createRecursion otherwise. The
+ * latter receives the gamma subregion, the gamma arguments of the function arguments, and the
+ * gamma argument of the recursion variable.
+ */
+static jlm::llvm::phi::node &
+CreateRecursiveFunction(
+    jlm::llvm::RvsdgModule & rvsdgModule,
+    const std::shared_ptr<const jlm::llvm::FunctionType> & functionType,
+    const std::function<std::vector<jlm::rvsdg::output *>(
+        jlm::rvsdg::Region &,
+        const std::vector<jlm::rvsdg::output *> &)> & createBaseCase,
+    const std::function<std::vector<jlm::rvsdg::output *>(
+        jlm::rvsdg::Region &,
+        const std::vector<jlm::rvsdg::output *> &,
+        jlm::rvsdg::output &)> & createRecursion)
+{
+  using namespace jlm::llvm;
+
+  auto & graph = rvsdgModule.Rvsdg();
+
+  phi::builder phiBuilder;
+  phiBuilder.begin(graph.root());
+  auto recursionVariable = phiBuilder.add_recvar(PointerType::Create());
+
+  auto lambda =
+      lambda::node::create(phiBuilder.subregion(), functionType, "f", linkage::external_linkage);
+  auto ctxVarF = lambda->add_ctxvar(recursionVariable->argument());
+
+  auto zero = jlm::rvsdg::create_bitconstant(lambda->subregion(), 32, 0);
+  auto isZero = jlm::rvsdg::biteq_op::create(32, lambda->fctargument(0), zero);
+  auto predicate = jlm::rvsdg::match(1, { { 1, 0 } }, 1, 2, isZero);
+
+  auto gamma = jlm::rvsdg::GammaNode::create(predicate, 2);
+  std::vector<jlm::rvsdg::output *> baseArguments, recursionArguments;
+  for (size_t n = 0; n < lambda->nfctarguments(); n++)
+  {
+    auto entryVar = gamma->add_entryvar(lambda->fctargument(n));
+    baseArguments.push_back(entryVar->argument(0));
+    recursionArguments.push_back(entryVar->argument(1));
+  }
+  auto entryVarF = gamma->add_entryvar(ctxVarF);
+
+  auto baseResults = createBaseCase(*gamma->subregion(0), baseArguments);
+  auto recursionResults =
+      createRecursion(*gamma->subregion(1), recursionArguments, *entryVarF->argument(1));
+
+  std::vector<jlm::rvsdg::output *> results;
+  for (size_t n = 0; n < baseResults.size(); n++)
+    results.push_back(gamma->add_exitvar({ baseResults[n], recursionResults[n] }));
+
+  auto lambdaOutput = lambda->finalize(results);
+  recursionVariable->result()->divert_to(lambdaOutput);
+  auto phiNode = phiBuilder.end();
+
+  GraphExport::Create(*phiNode->output(0), "f");
+
+  return *phiNode;
+}
+
+/**
+ * Counts the nodes in \p region and all its subregions that satisfy \p predicate.
+ */
+static size_t
+CountNodes(
+    const jlm::rvsdg::Region & region,
+    const std::function<bool(const jlm::rvsdg::node &)> & predicate)
+{
+  size_t numNodes = 0;
+  for (auto & node : region.nodes)
+  {
+    if (predicate(node))
+      numNodes++;
+
+    if (auto structuralNode = dynamic_cast<const jlm::rvsdg::StructuralNode *>(&node))
+    {
+      for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+        numNodes += CountNodes(*structuralNode->subregion(n), predicate);
+    }
+  }
+
+  return numNodes;
+}
+
+static bool
+IsCallNode(const jlm::rvsdg::node & node)
+{
+  return jlm::rvsdg::is<jlm::llvm::CallOperation>(&node);
+}
+
+static int
+TestStateThreading()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  // f(n, p, io, mem) { if (n == 0) return (n, io, mem); *p = n; return f(n - 1, p, io, mem); }
+  auto bit32Type = jlm::rvsdg::bittype::Create(32);
+  auto functionType = FunctionType::Create(
+      { bit32Type, PointerType::Create(), iostatetype::Create(), MemoryStateType::Create() },
+      { bit32Type, iostatetype::Create(), MemoryStateType::Create() });
+
+  RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+
+  auto createBaseCase =
+      [](jlm::rvsdg::Region &, const std::vector<jlm::rvsdg::output *> & arguments)
+  {
+    return std::vector<jlm::rvsdg::output *>({ arguments[0], arguments[2], arguments[3] });
+  };
+  auto createRecursion = [&](jlm::rvsdg::Region & region,
+                             const std::vector<jlm::rvsdg::output *> & arguments,
+                             jlm::rvsdg::output & function)
+  {
+    auto & storeNode =
+        StoreNonVolatileNode::CreateNode(*arguments[1], *arguments[0], { arguments[3] }, 4);
+    auto one = jlm::rvsdg::create_bitconstant(&region, 32, 1);
+    auto nMinusOne = jlm::rvsdg::bitsub_op::create(32, arguments[0], one);
+    auto & callNode = CallNode::CreateNode(
+        &function,
+        functionType,
+        { nMinusOne, arguments[1], arguments[2], storeNode.output(0) });
+    return callNode.Results();
+  };
+  CreateRecursiveFunction(rvsdgModule, functionType, createBaseCase, createRecursion);
+
+  jlm::util::StatisticsCollector statisticsCollector(jlm::util::StatisticsCollectorSettings(
+      { jlm::util::Statistics::Id::TailRecursionElimination }));
+
+  // Act
+  TailRecursionElimination tailRecursionElimination;
+  tailRecursionElimination.run(rvsdgModule, statisticsCollector);
+
+  // Assert
+  // The phi node is replaced by the lambda node
+  assert(graph.root()->nnodes() == 1);
+  auto lambda = dynamic_cast<const lambda::node *>(
+      jlm::rvsdg::output::GetNode(*graph.root()->result(0)->origin()));
+  assert(lambda);
+  assert(CountNodes(*lambda->subregion(), IsCallNode) == 0);
+
+  // The I/O state enters the loop through the I/O state argument
+  auto ioStateOutput =
+      jlm::util::AssertedCast<jlm::rvsdg::ThetaOutput>(lambda->fctresult(1)->origin());
+  assert(ioStateOutput->input()->origin() == lambda->fctargument(2));
+
+  // The memory state returned by the base case is the state produced by the store of the previous
+  // iteration
+  auto memoryStateOutput =
+      jlm::util::AssertedCast<jlm::rvsdg::ThetaOutput>(lambda->fctresult(2)->origin());
+  auto gammaOutput =
+      jlm::util::AssertedCast<jlm::rvsdg::GammaOutput>(memoryStateOutput->result()->origin());
+  auto baseCaseState =
+      jlm::util::AssertedCast<jlm::rvsdg::RegionArgument>(gammaOutput->result(0)->origin());
+  auto loopArgument =
+      jlm::util::AssertedCast<jlm::rvsdg::RegionArgument>(baseCaseState->input()->origin());
+  auto loopInput = jlm::util::AssertedCast<jlm::rvsdg::ThetaInput>(loopArgument->input());
+  auto nextState =
+      jlm::util::AssertedCast<jlm::rvsdg::GammaOutput>(loopInput->result()->origin());
+  auto storeOutput = nextState->result(1)->origin();
+  assert(jlm::rvsdg::is<StoreNonVolatileOperation>(jlm::rvsdg::output::GetNode(*storeOutput)));
+
+  auto & statistics = *statisticsCollector.CollectedStatistics().begin();
+  assert(statistics.GetMeasurementValue<uint64_t>("#TransformedFunctions") == 1);
+  assert(statistics.GetMeasurementValue<uint64_t>("#RemovedPhiNodes") == 1);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/opt/TailRecursionEliminationTests-TestStateThreading",
+    TestStateThreading)
+
+static int
+TestAccumulator()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  // f(n, io, mem) { if (n == 0) return (1, io, mem); return n * f(n - 1, io, mem); }
+  auto bit32Type = jlm::rvsdg::bittype::Create(32);
+  auto functionType = FunctionType::Create(
+      { bit32Type, iostatetype::Create(), MemoryStateType::Create() },
+      { bit32Type, iostatetype::Create(), MemoryStateType::Create() });
+
+  RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+
+  auto createBaseCase =
+      [](jlm::rvsdg::Region & region, const std::vector<jlm::rvsdg::output *> & arguments)
+  {
+    auto one = jlm::rvsdg::create_bitconstant(&region, 32, 1);
+    return std::vector<jlm::rvsdg::output *>({ one, arguments[1], arguments[2] });
+  };
+  auto createRecursion = [&](jlm::rvsdg::Region & region,
+                             const std::vector<jlm::rvsdg::output *> & arguments,
+                             jlm::rvsdg::output & function)
+  {
+    auto one = jlm::rvsdg::create_bitconstant(&region, 32, 1);
+    auto nMinusOne = jlm::rvsdg::bitsub_op::create(32, arguments[0], one);
+    auto & callNode = CallNode::CreateNode(
+        &function,
+        functionType,
+        { nMinusOne, arguments[1], arguments[2] });
+    auto product = jlm::rvsdg::bitmul_op::create(32, arguments[0], callNode.Result(0));
+    return std::vector<jlm::rvsdg::output *>(
+        { product, callNode.GetIoStateOutput(), callNode.GetMemoryStateOutput() });
+  };
+  CreateRecursiveFunction(rvsdgModule, functionType, createBaseCase, createRecursion);
+
+  jlm::util::StatisticsCollector statisticsCollector;
+
+  // Act
+  TailRecursionElimination tailRecursionElimination;
+  tailRecursionElimination.run(rvsdgModule, statisticsCollector);
+
+  // Assert
+  auto lambda = dynamic_cast<const lambda::node *>(
+      jlm::rvsdg::output::GetNode(*graph.root()->result(0)->origin()));
+  assert(lambda);
+  assert(CountNodes(*lambda->subregion(), IsCallNode) == 0);
+
+  // The product is accumulated in a loop variable that is initialized with one
+  auto productOutput =
+      jlm::util::AssertedCast<jlm::rvsdg::ThetaOutput>(lambda->fctresult(0)->origin());
+  auto initialValue = jlm::rvsdg::output::GetNode(*productOutput->input()->origin());
+  auto & constant = *jlm::util::AssertedCast<const jlm::rvsdg::bitconstant_op>(
+      &initialValue->operation());
+  assert(constant.value() == jlm::rvsdg::bitvalue_repr(32, 1));
+
+  // Both the tail and the base case multiply the accumulated value
+  auto isMultiplication = [](const jlm::rvsdg::node & node)
+  {
+    return jlm::rvsdg::is<jlm::rvsdg::bitmul_op>(&node);
+  };
+  assert(CountNodes(*lambda->subregion(), isMultiplication) == 2);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/opt/TailRecursionEliminationTests-TestAccumulator",
+    TestAccumulator)
+
+static int
+TestNonTailRecursion()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  // f(n, io, mem) { if (n == 0) return (0, io, mem); return f(n - 1, io, mem) - n; }
+  auto bit32Type = jlm::rvsdg::bittype::Create(32);
+  auto functionType = FunctionType::Create(
+      { bit32Type, iostatetype::Create(), MemoryStateType::Create() },
+      { bit32Type, iostatetype::Create(), MemoryStateType::Create() });
+
+  RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+
+  auto createBaseCase =
+      [](jlm::rvsdg::Region &, const std::vector<jlm::rvsdg::output *> & arguments)
+  {
+    return arguments;
+  };
+  auto createRecursion = [&](jlm::rvsdg::Region & region,
+                             const std::vector<jlm::rvsdg::output *> & arguments,
+                             jlm::rvsdg::output & function)
+  {
+    auto one = jlm::rvsdg::create_bitconstant(&region, 32, 1);
+    auto nMinusOne = jlm::rvsdg::bitsub_op::create(32, arguments[0], one);
+    auto & callNode = CallNode::CreateNode(
+        &function,
+        functionType,
+        { nMinusOne, arguments[1], arguments[2] });
+    auto difference = jlm::rvsdg::bitsub_op::create(32, callNode.Result(0), arguments[0]);
+    return std::vector<jlm::rvsdg::output *>(
+        { difference, callNode.GetIoStateOutput(), callNode.GetMemoryStateOutput() });
+  };
+  auto & phiNode =
+      CreateRecursiveFunction(rvsdgModule, functionType, createBaseCase, createRecursion);
+
+  jlm::util::StatisticsCollector statisticsCollector;
+
+  // Act
+  TailRecursionElimination tailRecursionElimination;
+  tailRecursionElimination.run(rvsdgModule, statisticsCollector);
+
+  // Assert
+  // The subtraction is not commutative and prevents the transformation
+  assert(jlm::rvsdg::output::GetNode(*graph.root()->result(0)->origin()) == &phiNode);
+  assert(CountNodes(*phiNode.subregion(), IsCallNode) == 1);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/opt/TailRecursionEliminationTests-TestNonTailRecursion",
+    TestNonTailRecursion)
@@ -461,6 +461,45 @@ TestLoadConstraintDirectly()
   assert(set.GetPointsToSet(reg1).Contains(alloca2));
 }
 
+// Test constraints that add pointees to the points-to set they are iterating over
+static void
+TestConstraintsGrowingIteratedSet()
+{
+  using namespace jlm::llvm::aa;
+
+  // Enough pointees to make the points-to sets grow several times
+  const size_t numAllocas = 64;
+  jlm::tests::NAllocaNodesTest rvsdg(numAllocas);
+  rvsdg.InitializeTest();
+
+  PointerObjectSet set;
+  std::vector<PointerObjectIndex> allocas;
+  for (size_t n = 0; n < numAllocas; n++)
+    allocas.push_back(set.CreateAllocaMemoryObject(rvsdg.GetAllocaNode(n), true));
+  const auto reg = set.CreateRegisterPointerObject(rvsdg.GetAllocaOutput(0));
+
+  // *alloca0 = reg, where alloca0 points to itself
+  set.AddToPointsToSet(allocas[0], allocas[0]);
+  for (size_t n = 2; n < numAllocas; n++)
+    set.AddToPointsToSet(reg, allocas[n]);
+
+  StoreConstraint store(allocas[0], reg);
+  assert(store.ApplyDirectly(set));
+  while (store.ApplyDirectly(set))
+    ;
+  assert(set.GetPointsToSet(allocas[0]).Size() == numAllocas - 1);
+
+  // alloca1 = *alloca1, where alloca1 points to itself and alloca0
+  set.AddToPointsToSet(allocas[1], allocas[1]);
+  set.AddToPointsToSet(allocas[1], allocas[0]);
+
+  LoadConstraint load(allocas[1], allocas[1]);
+  assert(load.ApplyDirectly(set));
+  while (load.ApplyDirectly(set))
+    ;
+  assert(set.GetPointsToSet(allocas[1]).Size() == numAllocas);
+}
+
 static void
 TestEscapedFunctionConstraint()
 {
@@ -877,6 +916,7 @@ TestPointerObjectSet()
   TestSupersetConstraint();
   TestStoreConstraintDirectly();
   TestLoadConstraintDirectly();
+  TestConstraintsGrowingIteratedSet();
   TestEscapedFunctionConstraint();
   TestFunctionCallConstraint();
   TestAddPointsToExternalConstraint();
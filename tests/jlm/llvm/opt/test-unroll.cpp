@@ -273,6 +273,156 @@ test_unknown_boundaries()
   //	jlm::rvsdg::view(graph, stdout);
 }
 
+/*
+  Follows \p output through region arguments, invariant loop variables, and gamma exit variables
+  with the same origin in all subregions to the output it originates from.
+*/
+static const jlm::rvsdg::output *
+trace_origin(const jlm::rvsdg::output * output)
+{
+  while (true)
+  {
+    auto argument = dynamic_cast<const jlm::rvsdg::RegionArgument *>(output);
+    if (argument && argument->input())
+    {
+      output = argument->input()->origin();
+      continue;
+    }
+
+    auto thetaOutput = dynamic_cast<const jlm::rvsdg::ThetaOutput *>(output);
+    if (thetaOutput && thetaOutput->result()->origin() == thetaOutput->argument())
+    {
+      output = thetaOutput->input()->origin();
+      continue;
+    }
+
+    auto gamma = dynamic_cast<const jlm::rvsdg::GammaNode *>(jlm::rvsdg::output::GetNode(*output));
+    if (gamma)
+    {
+      auto origin = trace_origin(gamma->subregion(0)->result(output->index())->origin());
+      for (size_t n = 1; n < gamma->nsubregions(); n++)
+      {
+        if (trace_origin(gamma->subregion(n)->result(output->index())->origin()) != origin)
+          return output;
+      }
+
+      output = origin;
+      continue;
+    }
+
+    return output;
+  }
+}
+
+/*
+  Checks that the first operand of every ugt comparison in \p region and its subregions is an end
+  value, i.e., either \p end or a constant.
+*/
+static size_t
+check_ugt_operand_order(const jlm::rvsdg::Region & region, const jlm::rvsdg::output * end)
+{
+  auto is_end = [&](const jlm::rvsdg::output * output)
+  {
+    output = trace_origin(output);
+    return output == end
+        || jlm::rvsdg::is<jlm::rvsdg::bitconstant_op>(jlm::rvsdg::output::GetNode(*output));
+  };
+
+  size_t ncomparisons = 0;
+  for (auto & node : region.nodes)
+  {
+    if (auto structnode = dynamic_cast<const jlm::rvsdg::StructuralNode *>(&node))
+    {
+      for (size_t n = 0; n < structnode->nsubregions(); n++)
+        ncomparisons += check_ugt_operand_order(*structnode->subregion(n), end);
+    }
+    else if (jlm::rvsdg::is<jlm::rvsdg::bitugt_op>(&node))
+    {
+      assert(is_end(node.input(0)->origin()));
+      assert(!is_end(node.input(1)->origin()));
+      ncomparisons++;
+    }
+  }
+
+  return ncomparisons;
+}
+
+static inline void
+test_swapped_operands()
+{
+  using namespace jlm::llvm;
+
+  auto bt = jlm::rvsdg::bittype::Create(32);
+  jlm::rvsdg::bitugt_op ugt(32);
+
+  /* Loop with known trip count that compares end > i */
+  {
+    jlm::rvsdg::graph graph;
+    auto nf = graph.node_normal_form(typeid(jlm::rvsdg::operation));
+    nf->set_mutable(false);
+
+    auto init = jlm::rvsdg::create_bitconstant(graph.root(), 32, 0);
+    auto end = jlm::rvsdg::create_bitconstant(graph.root(), 32, 100);
+
+    auto theta = jlm::rvsdg::ThetaNode::create(graph.root());
+    auto lvi = theta->add_loopvar(init);
+    auto lve = theta->add_loopvar(end);
+
+    auto one = jlm::rvsdg::create_bitconstant(theta->subregion(), 32, 1);
+    auto add = jlm::rvsdg::bitadd_op::create(32, lvi->argument(), one);
+    auto cmp = jlm::rvsdg::simple_node::create_normalized(
+        theta->subregion(),
+        ugt,
+        { lve->argument(), add })[0];
+    auto match = jlm::rvsdg::match(1, { { 1, 1 } }, 0, 2, cmp);
+    lvi->result()->divert_to(add);
+    theta->set_predicate(match);
+
+    auto inductionVariable = InductionVariable::Create(*theta);
+    assert(inductionVariable && inductionVariable->IsEndFirstOperand());
+    assert(*inductionVariable->GetTripCount() == 100);
+    assert(theta->nloopvars() == 2);
+
+    jlm::llvm::unroll(theta, 3);
+
+    /*
+      The unrolled theta compares end > i as well, and the epilogue is a copy of the body.
+    */
+    assert(nthetas(graph.root()) == 1);
+    assert(check_ugt_operand_order(*graph.root(), end) != 0);
+  }
+
+  /* Loop with unknown trip count that compares end > i */
+  {
+    RvsdgModule rm(jlm::util::filepath(""), "", "");
+    auto & graph = rm.Rvsdg();
+
+    auto x = &jlm::tests::GraphImport::Create(graph, bt, "x");
+    auto y = &jlm::tests::GraphImport::Create(graph, bt, "y");
+
+    auto theta = jlm::rvsdg::ThetaNode::create(graph.root());
+    auto lv1 = theta->add_loopvar(x);
+    auto lv2 = theta->add_loopvar(y);
+
+    auto one = jlm::rvsdg::create_bitconstant(theta->subregion(), 32, 1);
+    auto add = jlm::rvsdg::bitadd_op::create(32, lv1->argument(), one);
+    auto cmp = jlm::rvsdg::bitugt_op::create(32, lv2->argument(), add);
+    auto match = jlm::rvsdg::match(1, { { 1, 1 } }, 0, 2, cmp);
+    lv1->result()->divert_to(add);
+    theta->set_predicate(match);
+
+    GraphExport::Create(*lv1, "x");
+
+    jlm::llvm::unroll(theta, 2);
+
+    /*
+      The predicates of the unrolled gamma, the unrolled theta, and the residual gamma all compare
+      end > i.
+    */
+    assert(check_ugt_operand_order(*graph.root(), y) >= 3);
+  }
+}
+
 static std::vector<jlm::rvsdg::ThetaNode *>
 find_thetas(jlm::rvsdg::Region * region)
 {
@@ -420,6 +570,7 @@ verify()
   test_nested_theta();
   test_known_boundaries();
   test_unknown_boundaries();
+  test_swapped_operands();
 
   return 0;
 }
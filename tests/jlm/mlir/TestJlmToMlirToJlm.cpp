@@ -13,6 +13,8 @@
 #include <jlm/mlir/frontend/MlirToJlmConverter.hpp>
 #include <jlm/rvsdg/nullary.hpp>
 
+#include <cstdio>
+
 static int
 TestUndef()
 {
@@ -362,7 +364,69 @@ TestStore()
   return 0;
 }
 
+/**
+ * Converts an RVSDG with a single undef operation to MLIR and back, once through a file in
+ * \p format and once in memory.
+ */
+static void
+TestRoundTrip(jlm::mlir::JlmToMlirConverter::Format format)
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  auto rvsdgModule = RvsdgModule::Create(jlm::util::filepath(""), "", "");
+  auto graph = &rvsdgModule->Rvsdg();
+  auto nf = graph->node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+  UndefValueOperation::Create(*graph->root(), jlm::rvsdg::bittype::Create(32));
+
+  auto filePath = jlm::util::filepath::CreateUniqueFileName(
+      jlm::util::filepath("/tmp"),
+      "TestJlmToMlirToJlm-",
+      ".mlir");
+  jlm::util::StatisticsCollector statisticsCollector;
+
+  // Act
+  jlm::mlir::JlmToMlirConverter mlirgen;
+  mlirgen.ConvertAndPrint(*rvsdgModule, filePath, format, statisticsCollector);
+  jlm::mlir::MlirToJlmConverter rvsdggen;
+  auto fileModule = rvsdggen.ReadAndConvertMlir(filePath, statisticsCollector);
+  std::remove(filePath.to_str().c_str());
+
+  auto omega = mlirgen.ConvertModule(*rvsdgModule, statisticsCollector);
+  auto memoryModule = rvsdggen.ConvertOmegaNode(omega, statisticsCollector);
+  omega->destroy();
+
+  // Assert
+  for (auto module : { fileModule.get(), memoryModule.get() })
+  {
+    auto region = module->Rvsdg().root();
+    assert(region->nnodes() == 1);
+    auto convertedUndef =
+        dynamic_cast<const UndefValueOperation *>(&region->nodes.first()->operation());
+    assert(convertedUndef != nullptr);
+    auto outputType = convertedUndef->result(0);
+    assert(std::dynamic_pointer_cast<const jlm::rvsdg::bittype>(outputType)->nbits() == 32);
+  }
+}
+
+static int
+TestTextRoundTrip()
+{
+  TestRoundTrip(jlm::mlir::JlmToMlirConverter::Format::Text);
+  return 0;
+}
+
+static int
+TestBytecodeRoundTrip()
+{
+  TestRoundTrip(jlm::mlir::JlmToMlirConverter::Format::Bytecode);
+  return 0;
+}
+
 JLM_UNIT_TEST_REGISTER("jlm/mlir/TestMlirUndefGen", TestUndef)
 JLM_UNIT_TEST_REGISTER("jlm/mlir/TestMlirAllocaGen", TestAlloca)
 JLM_UNIT_TEST_REGISTER("jlm/mlir/TestMlirLoadGen", TestLoad)
 JLM_UNIT_TEST_REGISTER("jlm/mlir/TestMlirStoreGen", TestStore)
+JLM_UNIT_TEST_REGISTER("jlm/mlir/TestMlirTextRoundTrip", TestTextRoundTrip)
+JLM_UNIT_TEST_REGISTER("jlm/mlir/TestMlirBytecodeRoundTrip", TestBytecodeRoundTrip)
@@ -8,6 +8,7 @@
 #include <test-types.hpp>
 
 #include <jlm/util/AnnotationMap.hpp>
+#include <jlm/util/MemoryFootprint.hpp>
 
 #include <algorithm>
 #include <cassert>
@@ -481,3 +482,50 @@ BottomNodeTests()
 }
 
 JLM_UNIT_TEST_REGISTER("jlm/rvsdg/RegionTests-BottomNodeTests", BottomNodeTests)
+
+static int
+MemoryFootprintTests()
+{
+  using namespace jlm::rvsdg;
+  using namespace jlm::tests;
+  using Category = jlm::util::MemoryFootprint::Category;
+
+  // Arrange
+  auto valueType = valuetype::Create();
+
+  graph rvsdg;
+  auto & import = jlm::tests::GraphImport::Create(rvsdg, valueType, "x");
+  structural_node::create(rvsdg.root(), 2);
+  test_op::create(rvsdg.root(), { &import }, { valueType });
+
+  // Act
+  auto memoryFootprint1 = ComputeMemoryFootprint(*rvsdg.root());
+  test_op::create(rvsdg.root(), { &import }, { valueType });
+  auto memoryFootprint2 = ComputeMemoryFootprint(*rvsdg.root());
+
+  // Assert
+  // The root region and the two subregions of the structural node
+  assert(memoryFootprint1.Get(Category::RvsdgRegions) >= 3 * sizeof(Region));
+  assert(
+      memoryFootprint1.Get(Category::RvsdgNodes) >= sizeof(StructuralNode) + sizeof(simple_node));
+  assert(memoryFootprint1.Get(Category::ThreeAddressCodes) == 0);
+  assert(memoryFootprint1.Get(Category::PointsToSets) == 0);
+
+  assert(memoryFootprint2.Get(Category::RvsdgNodes) > memoryFootprint1.Get(Category::RvsdgNodes));
+  assert(
+      memoryFootprint2.Get(Category::RvsdgInputs) > memoryFootprint1.Get(Category::RvsdgInputs));
+  assert(
+      memoryFootprint2.Get(Category::RvsdgUserSets)
+      > memoryFootprint1.Get(Category::RvsdgUserSets));
+
+  // The new node shares the operation and the types with the existing nodes
+  assert(
+      memoryFootprint2.Get(Category::RvsdgOperations)
+      == memoryFootprint1.Get(Category::RvsdgOperations));
+  assert(memoryFootprint2.Get(Category::RvsdgTypes) == memoryFootprint1.Get(Category::RvsdgTypes));
+  assert(memoryFootprint2.Get(Category::RvsdgTypes) == sizeof(Type));
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/rvsdg/RegionTests-MemoryFootprintTests", MemoryFootprintTests)
@@ -7,6 +7,7 @@
 #include "test-registry.hpp"
 #include "test-types.hpp"
 
+#include <jlm/rvsdg/bitstring/constant.hpp>
 #include <jlm/rvsdg/view.hpp>
 
 static void
@@ -212,6 +213,63 @@ TestRemoveInputsWhere()
   assert(node.ninputs() == 0);
 }
 
+/**
+ * Test that nodes with equal simple operations share the operation
+ */
+static void
+TestSharedOperations()
+{
+  // Arrange
+  jlm::rvsdg::graph rvsdg;
+  auto valueType = jlm::tests::valuetype::Create();
+  auto stateType = jlm::tests::statetype::Create();
+  auto x = &jlm::tests::GraphImport::Create(rvsdg, valueType, "x");
+
+  // Act
+  auto & node1 = jlm::tests::SimpleNode::Create(*rvsdg.root(), { x }, { valueType });
+  auto & node2 = jlm::tests::SimpleNode::Create(*rvsdg.root(), { x }, { valueType });
+  auto & node3 = jlm::tests::SimpleNode::Create(*rvsdg.root(), { x }, { stateType });
+
+  // Assert
+  assert(&node1.operation() == &node2.operation());
+  assert(&node1.operation() != &node3.operation());
+  assert(node1.operation() != node3.operation());
+
+  // The shared operation outlives the node that created it
+  jlm::rvsdg::remove(&node1);
+  assert(node2.operation() == jlm::tests::test_op({ valueType }, { valueType }));
+}
+
+/**
+ * Test that constants of the same type are shared, even if there are more of them than fit into
+ * a single bucket of the interning table
+ */
+static void
+TestSharedConstants()
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  jlm::rvsdg::graph rvsdg;
+  rvsdg.node_normal_form(typeid(jlm::rvsdg::operation))->set_mutable(false);
+  const size_t numConstants = 32;
+
+  // Act
+  std::vector<jlm::rvsdg::node *> constants1, constants2;
+  for (size_t n = 0; n < numConstants; n++)
+    constants1.push_back(output::GetNode(*create_bitconstant(rvsdg.root(), 32, n)));
+  for (size_t n = 0; n < numConstants; n++)
+    constants2.push_back(output::GetNode(*create_bitconstant(rvsdg.root(), 32, n)));
+
+  // Assert
+  for (size_t n = 0; n < numConstants; n++)
+  {
+    assert(constants1[n] != constants2[n]);
+    assert(&constants1[n]->operation() == &constants2[n]->operation());
+    assert(constants1[n]->operation() == int_constant_op(32, n));
+  }
+}
+
 static int
 test_nodes()
 {
@@ -219,6 +277,8 @@ test_nodes()
   test_node_depth();
   TestRemoveOutputsWhere();
   TestRemoveInputsWhere();
+  TestSharedOperations();
+  TestSharedConstants();
 
   return 0;
 }
@@ -128,6 +128,28 @@ TestJlmOptStatistics()
   assert(statisticsCollectorSettings.GetDemandedStatistics() == expectedStatistics);
 }
 
+static void
+TestJlmOptServer()
+{
+  // Arrange
+  jlm::tooling::JlcCommandLineOptions commandLineOptions;
+  commandLineOptions.Compilations_.push_back(
+      { { "foo.o" }, { "" }, { "foo.o" }, "foo.o", true, true, true, true });
+  commandLineOptions.OutputFile_ = { "foobar" };
+  commandLineOptions.JlmOptServerSocket_ = { "/tmp/jlm-opt.sock" };
+
+  // Act
+  auto commandGraph = jlm::tooling::JlcCommandGraphGenerator::Generate(commandLineOptions);
+
+  // Assert
+  auto & clangCommandNode = (*commandGraph->GetEntryNode().OutgoingEdges().begin()).GetSink();
+  auto & jlmOptCommandNode = (clangCommandNode.OutgoingEdges().begin())->GetSink();
+  auto & jlmOptCommand =
+      *dynamic_cast<const jlm::tooling::JlmOptCommand *>(&jlmOptCommandNode.GetCommand());
+
+  assert(jlmOptCommand.GetServerSocket() == "/tmp/jlm-opt.sock");
+}
+
 static int
 Test()
 {
@@ -135,6 +157,7 @@ Test()
   Test2();
   TestJlmOptOptimizations();
   TestJlmOptStatistics();
+  TestJlmOptServer();
 
   return 0;
 }
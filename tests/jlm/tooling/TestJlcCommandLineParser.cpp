@@ -184,6 +184,22 @@ TestJlmOptPassStatistics()
   assert(commandLineOptions.JlmOptPassStatistics_ == expectedStatistics);
 }
 
+static void
+TestJlmOptServer()
+{
+  using namespace jlm::tooling;
+
+  // Arrange
+  std::vector<std::string> commandLineArguments(
+      { "jlc", "--jlm-opt-server", "/tmp/jlm-opt.sock", "foobar.c" });
+
+  // Act
+  auto & commandLineOptions = ParseCommandLineArguments(commandLineArguments);
+
+  // Assert
+  assert(commandLineOptions.JlmOptServerSocket_ == "/tmp/jlm-opt.sock");
+}
+
 static int
 Test()
 {
@@ -194,6 +210,7 @@ Test()
   TestJlmOptOptimizations();
   TestFalseJlmOptOptimization();
   TestJlmOptPassStatistics();
+  TestJlmOptServer();
 
   return 0;
 }
@@ -124,7 +124,8 @@ OutputFormatParsing()
   {
     auto outputFormat = static_cast<JlmOptCommandLineOptions::OutputFormat>(n);
 #ifndef ENABLE_MLIR
-    if (outputFormat == JlmOptCommandLineOptions::OutputFormat::Mlir)
+    if (outputFormat == JlmOptCommandLineOptions::OutputFormat::Mlir
+        || outputFormat == JlmOptCommandLineOptions::OutputFormat::MlirBytecode)
       continue;
 #endif
 
@@ -138,3 +139,84 @@ OutputFormatParsing()
 JLM_UNIT_TEST_REGISTER(
     "jlm/tooling/TestJlmOptCommandLineParser-OutputFormatParsing",
     OutputFormatParsing)
+
+static int
+CommandLineArgumentsRoundTrip()
+{
+  using namespace jlm::tooling;
+  using namespace jlm::util;
+  using Annotation = jlm::llvm::RvsdgTreePrinter::Configuration::Annotation;
+
+  // Arrange
+  filepath statisticsDirectory(std::filesystem::temp_directory_path());
+  JlmOptCommandLineOptions expectedOptions(
+      filepath("/input/file.ll"),
+      JlmOptCommandLineOptions::InputFormat::Llvm,
+      filepath("/output/file.ll"),
+      JlmOptCommandLineOptions::OutputFormat::Xml,
+      StatisticsCollectorSettings(
+          StatisticsCollectorSettings::CreateUniqueStatisticsFile(
+              statisticsDirectory,
+              filepath("file.ll")),
+          { Statistics::Id::DeadNodeElimination, Statistics::Id::SteensgaardAnalysis }),
+      jlm::llvm::RvsdgTreePrinter::Configuration(
+          statisticsDirectory,
+          { Annotation::NumRvsdgNodes, Annotation::NumMemoryStateInputsOutputs }),
+      { JlmOptCommandLineOptions::OptimizationId::DeadNodeElimination,
+        JlmOptCommandLineOptions::OptimizationId::CommonNodeElimination,
+        JlmOptCommandLineOptions::OptimizationId::DeadNodeElimination });
+
+  std::vector<std::string> commandLineArguments({ "jlm-opt" });
+  for (auto & argument : expectedOptions.ToCommandLineArguments())
+    commandLineArguments.push_back(argument);
+
+  // Act
+  auto & options = ParseCommandLineArguments(commandLineArguments);
+
+  // Assert
+  assert(options.GetInputFile() == expectedOptions.GetInputFile());
+  assert(options.GetInputFormat() == expectedOptions.GetInputFormat());
+  assert(options.GetOutputFile() == expectedOptions.GetOutputFile());
+  assert(options.GetOutputFormat() == expectedOptions.GetOutputFormat());
+  assert(options.GetOptimizationIds() == expectedOptions.GetOptimizationIds());
+  assert(
+      options.GetStatisticsCollectorSettings().GetDemandedStatistics()
+      == expectedOptions.GetStatisticsCollectorSettings().GetDemandedStatistics());
+  auto statisticsDirectoryOf = [](const JlmOptCommandLineOptions & options)
+  {
+    auto & statisticsFile = options.GetStatisticsCollectorSettings().GetFilePath();
+    return std::filesystem::path(statisticsFile.path()).lexically_normal();
+  };
+  assert(statisticsDirectoryOf(options) == statisticsDirectoryOf(expectedOptions));
+  assert(
+      options.GetRvsdgTreePrinterConfiguration().RequiredAnnotations()
+      == expectedOptions.GetRvsdgTreePrinterConfiguration().RequiredAnnotations());
+  assert(options.GetServerSocket() == "");
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/tooling/TestJlmOptCommandLineParser-CommandLineArgumentsRoundTrip",
+    CommandLineArgumentsRoundTrip)
+
+static int
+ServerParsing()
+{
+  using namespace jlm::tooling;
+
+  // Arrange
+  std::vector<std::string> commandLineArguments(
+      { "jlm-opt", "--server", "/tmp/jlm-opt.sock", "--server-workers", "3" });
+
+  // Act
+  auto & commandLineOptions = ParseCommandLineArguments(commandLineArguments);
+
+  // Assert
+  assert(commandLineOptions.GetServerSocket() == "/tmp/jlm-opt.sock");
+  assert(commandLineOptions.GetNumServerWorkers() == 3);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/tooling/TestJlmOptCommandLineParser-ServerParsing", ServerParsing)
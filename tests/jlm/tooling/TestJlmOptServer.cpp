@@ -0,0 +1,209 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+
+#include <jlm/tooling/JlmOptServer.hpp>
+
+#include <fstream>
+#include <thread>
+
+static jlm::tooling::JlmOptCommandLineOptions
+CreateJobOptions(const jlm::util::filepath & inputFile, const jlm::util::filepath & outputFile)
+{
+  using namespace jlm::tooling;
+
+  jlm::util::filepath tempDirectory(std::filesystem::temp_directory_path());
+  return JlmOptCommandLineOptions(
+      inputFile,
+      JlmOptCommandLineOptions::InputFormat::Llvm,
+      outputFile,
+      JlmOptCommandLineOptions::OutputFormat::Ascii,
+      jlm::util::StatisticsCollectorSettings(),
+      jlm::llvm::RvsdgTreePrinter::Configuration(tempDirectory, {}),
+      { JlmOptCommandLineOptions::OptimizationId::DeadNodeElimination });
+}
+
+/**
+ * Runs a server with two workers, submits compile jobs to it from multiple client threads, and
+ * shuts it down again.
+ */
+static int
+TestJobs()
+{
+  using namespace jlm::tooling;
+  using namespace jlm::util;
+
+  // Arrange
+  auto directory = std::filesystem::temp_directory_path() / "TestJlmOptServer";
+  std::filesystem::create_directories(directory);
+  filepath socketPath((directory / "jlm-opt.sock").string());
+
+  const size_t numJobs = 8;
+  std::vector<JlmOptCommandLineOptions> jobs;
+  for (size_t n = 0; n < numJobs; n++)
+  {
+    auto inputFile = (directory / ("input" + std::to_string(n) + ".ll")).string();
+    auto outputFile = (directory / ("output" + std::to_string(n) + ".txt")).string();
+    std::filesystem::remove(outputFile);
+
+    std::ofstream stream(inputFile);
+    stream << "define i32 @f" << n << "(i32 %x) {\n"
+           << "  %y = add i32 %x, " << n << "\n"
+           << "  ret i32 %y\n"
+           << "}\n";
+    stream.close();
+
+    jobs.push_back(CreateJobOptions(filepath(inputFile), filepath(outputFile)));
+  }
+
+  std::filesystem::remove(socketPath.to_str());
+  JlmOptServer server("jlm-opt", socketPath, 2);
+  assert(server.NumWorkers() == 2);
+  std::thread serverThread(&JlmOptServer::Run, &server);
+
+  // Wait until the server listens on the socket
+  while (!socketPath.Exists())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  // Act
+  std::vector<std::thread> clients;
+  for (size_t n = 0; n < numJobs; n++)
+  {
+    clients.emplace_back(
+        [&, n]()
+        {
+          JlmOptServer::SubmitJob(socketPath, jobs[n]);
+        });
+  }
+  for (auto & client : clients)
+    client.join();
+
+  bool failedJobThrew = false;
+  try
+  {
+    auto missingInputFile = filepath((directory / "missing.ll").string());
+    auto outputFile = filepath((directory / "missing.txt").string());
+    JlmOptServer::SubmitJob(socketPath, CreateJobOptions(missingInputFile, outputFile));
+  }
+  catch (jlm::util::error &)
+  {
+    failedJobThrew = true;
+  }
+
+  JlmOptServer::RequestShutdown(socketPath);
+  serverThread.join();
+
+  // Assert
+  assert(failedJobThrew);
+  assert(!socketPath.Exists());
+  for (size_t n = 0; n < numJobs; n++)
+  {
+    std::ifstream stream(jobs[n].GetOutputFile().to_str());
+    std::string output((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    assert(output.find("f" + std::to_string(n)) != std::string::npos);
+  }
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/tooling/TestJlmOptServer-TestJobs", TestJobs)
+
+/**
+ * Submits malformed jobs and a job requesting help to a server, and checks that they fail without
+ * terminating the server, which still processes a valid job afterwards.
+ */
+static int
+TestMalformedJobs()
+{
+  using namespace jlm::tooling;
+  using namespace jlm::util;
+
+  // Arrange
+  auto directory = std::filesystem::temp_directory_path() / "TestJlmOptServer-malformed";
+  std::filesystem::create_directories(directory);
+  filepath socketPath((directory / "jlm-opt.sock").string());
+
+  auto inputFile = (directory / "input.ll").string();
+  auto outputFile = (directory / "output.txt").string();
+  std::filesystem::remove(outputFile);
+
+  std::ofstream stream(inputFile);
+  stream << "define i32 @f(i32 %x) {\n"
+         << "  ret i32 %x\n"
+         << "}\n";
+  stream.close();
+
+  std::filesystem::remove(socketPath.to_str());
+  JlmOptServer server("jlm-opt", socketPath, 1);
+  std::thread serverThread(&JlmOptServer::Run, &server);
+
+  while (!socketPath.Exists())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  const std::vector<std::vector<std::string>> malformedJobs = {
+    { "--no-such-option", inputFile, "-o", outputFile },
+    { "--help" },
+    { "-version" },
+  };
+
+  // Act
+  size_t numFailedJobs = 0;
+  for (auto & arguments : malformedJobs)
+  {
+    try
+    {
+      JlmOptServer::SubmitJob(socketPath, arguments);
+    }
+    catch (jlm::util::error &)
+    {
+      numFailedJobs++;
+    }
+  }
+
+  JlmOptServer::SubmitJob(
+      socketPath,
+      CreateJobOptions(filepath(inputFile), filepath(outputFile)));
+
+  JlmOptServer::RequestShutdown(socketPath);
+  serverThread.join();
+
+  // Assert
+  assert(numFailedJobs == malformedJobs.size());
+  assert(filepath(outputFile).Exists());
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/tooling/TestJlmOptServer-TestMalformedJobs", TestMalformedJobs)
+
+static int
+TestUnreachableServer()
+{
+  using namespace jlm::tooling;
+
+  // Arrange
+  jlm::util::filepath socketPath(
+      (std::filesystem::temp_directory_path() / "TestJlmOptServer-missing.sock").string());
+  auto options = CreateJobOptions(jlm::util::filepath("input.ll"), jlm::util::filepath("out.txt"));
+
+  // Act & Assert
+  bool threw = false;
+  try
+  {
+    JlmOptServer::SubmitJob(socketPath, options);
+  }
+  catch (jlm::util::error &)
+  {
+    threw = true;
+  }
+  assert(threw);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/tooling/TestJlmOptServer-TestUnreachableServer",
+    TestUnreachableServer)
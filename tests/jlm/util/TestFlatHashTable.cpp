@@ -0,0 +1,209 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+
+#include <jlm/util/FlatHashTable.hpp>
+
+#include <cassert>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+struct Identity final
+{
+  template<typename T>
+  const T &
+  operator()(const T & item) const noexcept
+  {
+    return item;
+  }
+};
+
+/**
+ * A hash function that maps all items to the same probe sequence and control byte.
+ */
+struct ConstantHash final
+{
+  std::size_t
+  operator()(int) const noexcept
+  {
+    return 42;
+  }
+};
+
+using IntTable = jlm::util::FlatHashTable<int, int, Identity, std::hash<int>>;
+
+}
+
+static int
+TestGrowth()
+{
+  IntTable table;
+  assert(table.Size() == 0 && table.Capacity() == 0);
+  assert(table.EstimateHeapBytes() == 0);
+  assert(table.begin() == table.end());
+
+  const int numItems = 10000;
+  for (int n = 0; n < numItems; n++)
+  {
+    auto [it, inserted] = table.Insert(n);
+    assert(inserted && *it == n);
+  }
+
+  assert(table.Size() == numItems);
+  assert((table.Capacity() & (table.Capacity() - 1)) == 0);
+  assert(table.Capacity() * 7 / 8 >= numItems);
+
+  for (int n = 0; n < numItems; n++)
+  {
+    assert(table.Contains(n));
+    assert(!table.Insert(n).second);
+  }
+  assert(!table.Contains(numItems));
+
+  std::vector<bool> seen(numItems, false);
+  for (auto item : table)
+  {
+    assert(!seen[item]);
+    seen[item] = true;
+  }
+  for (auto wasSeen : seen)
+    assert(wasSeen);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/util/TestFlatHashTable-TestGrowth", TestGrowth)
+
+static int
+TestTombstones()
+{
+  IntTable table;
+  table.Reserve(100);
+  const auto capacity = table.Capacity();
+
+  // Repeatedly inserting and erasing must reuse the deleted slots instead of growing the table
+  for (int round = 0; round < 100; round++)
+  {
+    for (int n = 0; n < 50; n++)
+      assert(table.Insert(round * 50 + n).second);
+    for (int n = 0; n < 50; n++)
+      assert(table.Erase(round * 50 + n));
+  }
+
+  assert(table.Size() == 0);
+  assert(table.Capacity() == capacity);
+  assert(table.begin() == table.end());
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/util/TestFlatHashTable-TestTombstones", TestTombstones)
+
+static int
+TestCollisions()
+{
+  jlm::util::FlatHashTable<int, int, Identity, ConstantHash> table;
+
+  // All items share a single probe sequence, which spans multiple groups
+  for (int n = 0; n < 100; n++)
+    assert(table.Insert(n).second);
+
+  for (int n = 0; n < 100; n += 2)
+    assert(table.Erase(n));
+
+  for (int n = 0; n < 100; n++)
+    assert(table.Contains(n) == (n % 2 == 1));
+
+  assert(table.Size() == 50);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/util/TestFlatHashTable-TestCollisions", TestCollisions)
+
+static int
+TestEraseKeepsIterators()
+{
+  IntTable table;
+  for (int n = 0; n < 100; n++)
+    table.Insert(n);
+
+  auto it = table.Find(42);
+  auto address = &*it;
+
+  // Erasing other items must neither move item 42 nor invalidate the iterator to it
+  for (int n = 0; n < 100; n++)
+  {
+    if (n != 42)
+      table.Erase(n);
+  }
+
+  assert(table.Size() == 1);
+  assert(*it == 42 && &*it == address);
+  assert(table.Find(42) == it);
+
+  auto next = table.Erase(it);
+  assert(next == table.end());
+  assert(table.Find(42) == table.end());
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/util/TestFlatHashTable-TestEraseKeepsIterators",
+    TestEraseKeepsIterators)
+
+static int
+TestNonTrivialItems()
+{
+  struct KeyOf final
+  {
+    const std::string &
+    operator()(const std::pair<const std::string, std::shared_ptr<int>> & item) const noexcept
+    {
+      return item.first;
+    }
+  };
+
+  using Table = jlm::util::FlatHashTable<
+      std::pair<const std::string, std::shared_ptr<int>>,
+      std::string,
+      KeyOf,
+      std::hash<std::string>>;
+
+  auto value = std::make_shared<int>(0);
+  {
+    Table table;
+    for (int n = 0; n < 1000; n++)
+      table.Insert({ std::to_string(n), value });
+    assert(value.use_count() == 1001);
+
+    for (int n = 0; n < 1000; n += 2)
+      table.Erase(std::to_string(n));
+    assert(value.use_count() == 501);
+
+    Table copy(table);
+    assert(copy.Size() == 500 && copy.Contains("1") && !copy.Contains("0"));
+    assert(value.use_count() == 1001);
+
+    Table moved(std::move(copy));
+    assert(moved.Size() == 500 && copy.Size() == 0);
+    assert(value.use_count() == 1001);
+
+    moved.Clear();
+    assert(moved.Size() == 0 && moved.begin() == moved.end());
+    assert(value.use_count() == 501);
+  }
+  assert(value.use_count() == 1);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/util/TestFlatHashTable-TestNonTrivialItems", TestNonTrivialItems)
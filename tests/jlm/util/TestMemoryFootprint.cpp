@@ -0,0 +1,103 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+
+#include <jlm/util/HashSet.hpp>
+#include <jlm/util/MemoryFootprint.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <cassert>
+
+static int
+TestAccumulation()
+{
+  using namespace jlm::util;
+  using Category = MemoryFootprint::Category;
+
+  // Arrange
+  MemoryFootprint memoryFootprint1;
+  memoryFootprint1.Add(Category::RvsdgNodes, 100);
+  memoryFootprint1.Add(Category::RvsdgNodes, 20);
+  memoryFootprint1.Add(Category::PointsToSets, 3);
+
+  MemoryFootprint memoryFootprint2;
+  memoryFootprint2.Add(Category::ThreeAddressCodes, 40);
+  memoryFootprint2.Add(Category::PointsToSets, 4);
+
+  // Act
+  memoryFootprint1 += memoryFootprint2;
+
+  // Assert
+  assert(memoryFootprint1.Get(Category::RvsdgNodes) == 120);
+  assert(memoryFootprint1.Get(Category::ThreeAddressCodes) == 40);
+  assert(memoryFootprint1.Get(Category::PointsToSets) == 7);
+  assert(memoryFootprint1.Get(Category::CfgNodes) == 0);
+  assert(memoryFootprint1.Total() == 167);
+  assert(memoryFootprint2.Total() == 44);
+
+  auto string = memoryFootprint1.ToString();
+  assert(string.find("#BytesRvsdgNodes: 120\n") != std::string::npos);
+  assert(string.find("#BytesTotal: 167\n") != std::string::npos);
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER("jlm/util/TestMemoryFootprint-Accumulation", TestAccumulation)
+
+static int
+TestStatistics()
+{
+  using namespace jlm::util;
+  using Category = MemoryFootprint::Category;
+
+  // Arrange
+  MemoryFootprint memoryFootprint;
+  memoryFootprint.Add(Category::RvsdgRegions, 64);
+  memoryFootprint.Add(Category::PointsToGraphEdges, 8);
+
+  Statistics statistics(Statistics::Id::DeadNodeElimination, filepath("file.ll"));
+
+  // Act
+  statistics.AddMeasurements(memoryFootprint);
+
+  // Assert
+  assert(statistics.GetMeasurementValue<uint64_t>("#BytesRvsdgRegions") == 64);
+  assert(statistics.GetMeasurementValue<uint64_t>("#BytesPointsToGraphEdges") == 8);
+  assert(!statistics.HasMeasurement("#BytesRvsdgNodes"));
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER("jlm/util/TestMemoryFootprint-Statistics", TestStatistics)
+
+static int
+TestUnorderedContainerEstimate()
+{
+  using namespace jlm::util;
+
+  // Arrange
+  std::unordered_set<int *> set;
+  HashSet<int *> hashSet;
+  int values[16];
+
+  // Act
+  auto emptySetBytes = MemoryFootprint::EstimateBytes(set);
+  for (auto & value : values)
+  {
+    set.insert(&value);
+    hashSet.Insert(&value);
+  }
+
+  // Assert
+  assert(MemoryFootprint::EstimateBytes(set) > emptySetBytes);
+  assert(MemoryFootprint::EstimateBytes(set) >= 16 * sizeof(int *));
+  // The flat HashSet stores its items inline, without a node per item
+  assert(hashSet.EstimateHeapBytes() >= 16 * sizeof(int *));
+  assert(hashSet.EstimateHeapBytes() < MemoryFootprint::EstimateBytes(set));
+
+  return 0;
+}
+JLM_UNIT_TEST_REGISTER(
+    "jlm/util/TestMemoryFootprint-UnorderedContainerEstimate",
+    TestUnorderedContainerEstimate)
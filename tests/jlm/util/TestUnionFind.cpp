@@ -0,0 +1,107 @@
+/*
+ * Copyright 2026 The jlm Authors
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+
+#include <jlm/util/UnionFind.hpp>
+
+#include <cassert>
+#include <random>
+
+static int
+TestUnionFind()
+{
+  jlm::util::UnionFind<uint32_t> unionFind;
+  assert(unionFind.NumElements() == 0 && unionFind.NumSets() == 0);
+
+  for (uint32_t n = 0; n < 6; n++)
+    assert(unionFind.MakeSet() == n);
+
+  assert(unionFind.NumElements() == 6 && unionFind.NumSets() == 6);
+  for (uint32_t n = 0; n < 6; n++)
+    assert(unionFind.IsRoot(n) && unionFind.Find(n) == n);
+
+  // Merge {0, 1, 2} and {3, 4}
+  auto root012 = unionFind.Union(0, 1);
+  assert(unionFind.Union(1, 2) == root012);
+  auto root34 = unionFind.Union(3, 4);
+  assert(unionFind.NumSets() == 3);
+
+  assert(unionFind.Find(0) == unionFind.Find(2));
+  assert(unionFind.Find(3) == unionFind.Find(4));
+  assert(unionFind.Find(0) != unionFind.Find(3));
+  assert(unionFind.IsRoot(root012) && unionFind.IsRoot(root34) && unionFind.IsRoot(5));
+
+  // Merging elements of the same set is a no-op
+  assert(unionFind.Union(2, 0) == root012);
+  assert(unionFind.NumSets() == 3);
+
+  auto root = unionFind.Union(4, 1);
+  assert(root == root012 || root == root34);
+  assert(unionFind.NumSets() == 2);
+  for (uint32_t n = 0; n < 5; n++)
+    assert(unionFind.Find(n) == root);
+  assert(unionFind.Find(5) == 5);
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/util/TestUnionFind-TestUnionFind", TestUnionFind)
+
+/**
+ * Checks the union-find against a naive labeling of the elements on a large random sequence of
+ * unions, which also exercises path halving on deep trees.
+ */
+static int
+TestRandomUnions()
+{
+  const size_t numElements = 10000;
+
+  jlm::util::UnionFind<uint32_t> unionFind;
+  unionFind.Reserve(numElements);
+  std::vector<size_t> labels(numElements);
+  for (size_t n = 0; n < numElements; n++)
+  {
+    unionFind.MakeSet();
+    labels[n] = n;
+  }
+
+  std::mt19937 random(0);
+  size_t numSets = numElements;
+  for (size_t n = 0; n < numElements / 2; n++)
+  {
+    uint32_t element1 = random() % numElements;
+    uint32_t element2 = random() % numElements;
+    unionFind.Union(element1, element2);
+
+    auto label1 = labels[element1];
+    auto label2 = labels[element2];
+    if (label1 == label2)
+      continue;
+
+    numSets--;
+    for (auto & label : labels)
+    {
+      if (label == label2)
+        label = label1;
+    }
+  }
+
+  assert(unionFind.NumSets() == numSets);
+  for (size_t n = 0; n < 1000; n++)
+  {
+    uint32_t element1 = random() % numElements;
+    uint32_t element2 = random() % numElements;
+    auto sameSet = unionFind.Find(element1) == unionFind.Find(element2);
+    assert(sameSet == (labels[element1] == labels[element2]));
+  }
+
+  // The parent and rank arrays are the only allocations
+  assert(unionFind.EstimateHeapBytes() >= numElements * (sizeof(uint32_t) + sizeof(uint8_t)));
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/util/TestUnionFind-TestRandomUnions", TestRandomUnions)
@@ -156,3 +156,79 @@ TestWorkset()
 }
 
 JLM_UNIT_TEST_REGISTER("jlm/llvm/opt/alias-analyses/TestWorklist-TestWorkset", TestWorkset)
+
+/**
+ * Work items of enumeration type are not integral, and are therefore handled by the generic
+ * worklist implementations based on hashing.
+ */
+enum class GenericWorkItem : size_t
+{
+};
+
+/**
+ * Pushes and pops the same sequence of work items to an integral and a generic instance of
+ * \p WorklistTemplate, and checks that both produce the same order.
+ */
+template<template<typename> class WorklistTemplate>
+static void
+CheckDenseMatchesGeneric()
+{
+  WorklistTemplate<size_t> dense;
+  WorklistTemplate<GenericWorkItem> generic;
+
+  // Use large work items, such that the dense storage has to grow multiple times
+  size_t item = 1;
+  for (size_t round = 0; round < 100; round++)
+  {
+    for (size_t n = 0; n < 10; n++)
+    {
+      item = (item * 7919 + round) % 10007;
+      dense.PushWorkItem(item);
+      generic.PushWorkItem(static_cast<GenericWorkItem>(item));
+    }
+
+    for (size_t n = 0; n < 5 && dense.HasMoreWorkItems(); n++)
+    {
+      assert(generic.HasMoreWorkItems());
+      assert(static_cast<GenericWorkItem>(dense.PopWorkItem()) == generic.PopWorkItem());
+    }
+  }
+
+  while (dense.HasMoreWorkItems())
+  {
+    assert(generic.HasMoreWorkItems());
+    assert(static_cast<GenericWorkItem>(dense.PopWorkItem()) == generic.PopWorkItem());
+  }
+  assert(!generic.HasMoreWorkItems());
+}
+
+static int
+TestDenseWorkItems()
+{
+  CheckDenseMatchesGeneric<jlm::util::LifoWorklist>();
+  CheckDenseMatchesGeneric<jlm::util::FifoWorklist>();
+  CheckDenseMatchesGeneric<jlm::util::LrfWorklist>();
+  CheckDenseMatchesGeneric<jlm::util::TwoPhaseLrfWorklist>();
+
+  jlm::util::Workset<size_t> dense;
+  jlm::util::Workset<GenericWorkItem> generic;
+  for (size_t item : { 10000, 3, 500, 3 })
+  {
+    dense.PushWorkItem(item);
+    generic.PushWorkItem(static_cast<GenericWorkItem>(item));
+  }
+  for (size_t item : { 10000, 3, 500 })
+  {
+    assert(dense.HasWorkItem(item) && generic.HasWorkItem(static_cast<GenericWorkItem>(item)));
+    dense.RemoveWorkItem(item);
+    generic.RemoveWorkItem(static_cast<GenericWorkItem>(item));
+    assert(!dense.HasWorkItem(item) && !generic.HasWorkItem(static_cast<GenericWorkItem>(item)));
+  }
+  assert(!dense.HasMoreWorkItems() && !generic.HasMoreWorkItems());
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/opt/alias-analyses/TestWorklist-TestDenseWorkItems",
+    TestDenseWorkItems)
@@ -8,7 +8,11 @@
 #include <jlm/hls/backend/rhls2firrtl/json-hls.hpp>
 #include <jlm/hls/backend/rhls2firrtl/RhlsToFirrtlConverter.hpp>
 #include <jlm/hls/backend/rhls2firrtl/verilator-harness-hls.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/add-buffers.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/LoopInitiationInterval.hpp>
+#include <jlm/hls/backend/rvsdg2rhls/PerformanceCounters.hpp>
 #include <jlm/hls/backend/rvsdg2rhls/rvsdg2rhls.hpp>
+#include <jlm/hls/opt/ResourceSharing.hpp>
 #include <jlm/llvm/backend/jlm2llvm/jlm2llvm.hpp>
 #include <jlm/llvm/backend/rvsdg2jlm/rvsdg2jlm.hpp>
 #include <jlm/llvm/frontend/InterProceduralGraphConversion.hpp>
@@ -42,6 +46,92 @@ llvmToFile(jlm::llvm::RvsdgModule & module, std::string fileName)
   lm->print(os, nullptr);
 }
 
+static void
+loopReportToFile(const jlm::llvm::RvsdgModule & module, size_t memoryLatency, std::string fileName)
+{
+  std::string report;
+  for (auto & loop : jlm::hls::ComputeLoopInitiationIntervals(module, memoryLatency))
+  {
+    report += loop.ToString() + "\n";
+  }
+  stringToFile(report, fileName);
+}
+
+static void
+resourceReportToFile(const jlm::llvm::RvsdgModule & module, std::string fileName)
+{
+  auto estimate = jlm::hls::EstimateResources(
+      *module.Rvsdg().root(),
+      jlm::hls::OperatorCostTable::CreateDefault());
+  stringToFile(
+      "units: " + std::to_string(estimate.NumUnits) + "\narea: " + std::to_string(estimate.Area)
+          + "\nlatency: " + std::to_string(estimate.Latency) + "\n",
+      fileName);
+}
+
+static void
+bufferReportToFile(const jlm::hls::BufferSizingReport & report, std::string fileName)
+{
+  stringToFile(
+      "buffers: " + std::to_string(report.NumBuffers) + "\nslots: "
+          + std::to_string(report.TotalSlots) + "\nii: " + std::to_string(report.EstimatedII)
+          + "\n",
+      fileName);
+}
+
+static jlm::util::StatisticsCollector
+createBitwidthStatisticsCollector(bool isDemanded, std::string fileName)
+{
+  jlm::util::HashSet<jlm::util::Statistics::Id> demandedStatistics;
+  if (isDemanded)
+  {
+    demandedStatistics.Insert(jlm::util::Statistics::Id::BitwidthMinimization);
+  }
+  return jlm::util::StatisticsCollector(jlm::util::StatisticsCollectorSettings(
+      jlm::util::filepath(fileName),
+      std::move(demandedStatistics)));
+}
+
+static jlm::hls::MemoryModelConfiguration
+createMemoryModelConfiguration(const jlm::tooling::JlmHlsCommandLineOptions & commandLineOptions)
+{
+  using MemoryModel = jlm::tooling::JlmHlsCommandLineOptions::MemoryModel;
+
+  jlm::hls::MemoryModelConfiguration configuration;
+  switch (commandLineOptions.MemoryModel_)
+  {
+  case MemoryModel::FixedLatency:
+    configuration.Kind = jlm::hls::MemoryModelConfiguration::Model::FixedLatency;
+    break;
+  case MemoryModel::Bandwidth:
+    configuration.Kind = jlm::hls::MemoryModelConfiguration::Model::Bandwidth;
+    break;
+  case MemoryModel::Dram:
+    configuration.Kind = jlm::hls::MemoryModelConfiguration::Model::Dram;
+    break;
+  }
+  configuration.Latency = commandLineOptions.MemoryLatency_;
+  configuration.BytesPerCycle = commandLineOptions.MemoryBandwidth_;
+  configuration.MaxOutstanding = commandLineOptions.MemoryMaxOutstanding_;
+
+  return configuration;
+}
+
+static jlm::hls::RhlsConfiguration
+createRhlsConfiguration(const jlm::tooling::JlmHlsCommandLineOptions & commandLineOptions)
+{
+  jlm::hls::RhlsConfiguration configuration;
+  configuration.CoalesceLoads = commandLineOptions.CoalesceLoads_;
+  configuration.MinimizeBitwidths = commandLineOptions.MinimizeBitwidths_;
+  configuration.ShareResources = commandLineOptions.ShareResources_;
+  configuration.PartitionLocalMemories = commandLineOptions.PartitionLocalMemories_;
+  configuration.MaxUnrollFactor = commandLineOptions.MaxUnrollFactor_;
+  configuration.BufferSizing.TargetII = commandLineOptions.TargetII_;
+  configuration.BufferSizing.MemoryLatency = commandLineOptions.MemoryLatency_;
+
+  return configuration;
+}
+
 int
 main(int argc, char ** argv)
 {
@@ -75,7 +165,39 @@ main(int argc, char ** argv)
       == jlm::tooling::JlmHlsCommandLineOptions::OutputFormat::Firrtl)
   {
     jlm::hls::rvsdg2ref(*rvsdgModule, commandLineOptions.OutputFiles_.to_str() + ".ref.ll");
-    jlm::hls::rvsdg2rhls(*rvsdgModule);
+    auto bitwidthStatisticsCollector = createBitwidthStatisticsCollector(
+        commandLineOptions.GenerateBitwidthReport_,
+        commandLineOptions.OutputFiles_.to_str() + ".bitwidth.txt");
+    auto bufferSizingReport = jlm::hls::rvsdg2rhls(
+        *rvsdgModule,
+        bitwidthStatisticsCollector,
+        createRhlsConfiguration(commandLineOptions));
+    bitwidthStatisticsCollector.PrintStatistics();
+    if (commandLineOptions.GenerateLoopReport_)
+    {
+      loopReportToFile(
+          *rvsdgModule,
+          commandLineOptions.MemoryLatency_,
+          commandLineOptions.OutputFiles_.to_str() + ".loops.txt");
+    }
+    if (commandLineOptions.GenerateResourceReport_)
+    {
+      resourceReportToFile(
+          *rvsdgModule,
+          commandLineOptions.OutputFiles_.to_str() + ".resources.txt");
+    }
+    if (commandLineOptions.GenerateBufferReport_)
+    {
+      bufferReportToFile(
+          bufferSizingReport,
+          commandLineOptions.OutputFiles_.to_str() + ".buffers.txt");
+    }
+    if (commandLineOptions.AddPerformanceCounters_)
+    {
+      jlm::hls::AddPerformanceCounters(
+          *rvsdgModule,
+          jlm::hls::PerformanceCounterConfiguration());
+    }
 
     // Writing the FIRRTL to a file and then reading it back in to convert to Verilog.
     // Could potentially change to pass the FIRRTL directly to the converter, but the converter
@@ -91,7 +213,9 @@ main(int argc, char ** argv)
       exit(1);
     }
 
-    jlm::hls::VerilatorHarnessHLS vhls(outputVerilogFile);
+    jlm::hls::VerilatorHarnessHLS vhls(
+        outputVerilogFile,
+        createMemoryModelConfiguration(commandLineOptions));
     stringToFile(vhls.run(*rvsdgModule), commandLineOptions.OutputFiles_.to_str() + ".harness.cpp");
 
     // TODO: hide behind flag
@@ -101,7 +225,33 @@ main(int argc, char ** argv)
   else if (
       commandLineOptions.OutputFormat_ == jlm::tooling::JlmHlsCommandLineOptions::OutputFormat::Dot)
   {
-    jlm::hls::rvsdg2rhls(*rvsdgModule);
+    auto bitwidthStatisticsCollector = createBitwidthStatisticsCollector(
+        commandLineOptions.GenerateBitwidthReport_,
+        commandLineOptions.OutputFiles_.path() + "/jlm_hls.bitwidth.txt");
+    auto bufferSizingReport = jlm::hls::rvsdg2rhls(
+        *rvsdgModule,
+        bitwidthStatisticsCollector,
+        createRhlsConfiguration(commandLineOptions));
+    bitwidthStatisticsCollector.PrintStatistics();
+    if (commandLineOptions.GenerateLoopReport_)
+    {
+      loopReportToFile(
+          *rvsdgModule,
+          commandLineOptions.MemoryLatency_,
+          commandLineOptions.OutputFiles_.path() + "/jlm_hls.loops.txt");
+    }
+    if (commandLineOptions.GenerateResourceReport_)
+    {
+      resourceReportToFile(
+          *rvsdgModule,
+          commandLineOptions.OutputFiles_.path() + "/jlm_hls.resources.txt");
+    }
+    if (commandLineOptions.GenerateBufferReport_)
+    {
+      bufferReportToFile(
+          bufferSizingReport,
+          commandLineOptions.OutputFiles_.path() + "/jlm_hls.buffers.txt");
+    }
 
     jlm::hls::DotHLS dhls;
     stringToFile(dhls.run(*rvsdgModule), commandLineOptions.OutputFiles_.path() + "/jlm_hls.dot");
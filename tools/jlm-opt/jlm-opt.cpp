@@ -4,14 +4,25 @@
  */
 
 #include <jlm/tooling/Command.hpp>
+#include <jlm/tooling/JlmOptServer.hpp>
 
 int
 main(int argc, char ** argv)
 {
-  auto & commandLineOptions = jlm::tooling::JlmOptCommandLineParser::Parse(argc, argv);
-
   try
   {
+    auto & commandLineOptions = jlm::tooling::JlmOptCommandLineParser::Parse(argc, argv);
+
+    if (!commandLineOptions.GetServerSocket().to_str().empty())
+    {
+      jlm::tooling::JlmOptServer server(
+          argv[0],
+          commandLineOptions.GetServerSocket(),
+          commandLineOptions.GetNumServerWorkers());
+      server.Run();
+      return 0;
+    }
+
     jlm::tooling::JlmOptCommand command(argv[0], commandLineOptions);
     command.Run();
   }